@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "meta\version.hpp"
-#include "string\format.hpp"
+#include "meta/version.hpp"
+#include "string/format.hpp"
 
 #pragma endregion
 
@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\node.hpp"
-#include "parallel\id_generator.hpp"
+#include "scene/node.hpp"
+#include "parallel/id_generator.hpp"
 
 #pragma endregion
 
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\state.hpp"
-#include "type\types.hpp"
+#include "scene/state.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\component.hpp"
-#include "scene\transform.hpp"
+#include "scene/component.hpp"
+#include "scene/transform.hpp"
 
 #pragma endregion
 
@@ -562,6 +562,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\node.tpp"
+#include "scene/node.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "collection\vector.hpp"
+#include "collection/vector.hpp"
 
 #pragma endregion
 
@@ -28,6 +28,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\scene_utils.tpp"
+#include "scene/scene_utils.tpp"
 
 #pragma endregion
\ No newline at end of file
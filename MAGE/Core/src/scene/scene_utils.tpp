@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\state.hpp"
+#include "scene/state.hpp"
 
 #pragma endregion
 
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\node.hpp"
+#include "scene/node.hpp"
 
 #pragma endregion
 
@@ -12,6 +12,49 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	std::atomic< std::size_t > Transform::s_nb_interpolated_transforms(0u);
+
+	void Transform::SetInterpolated(bool interpolated) {
+		if (interpolated == IsInterpolated()) {
+			return;
+		}
+
+		if (interpolated) {
+			m_interpolation = MakeUnique< InterpolationState >();
+			m_interpolation->m_previous = GetSQTTransform();
+		}
+		else {
+			RevertInterpolation();
+			m_interpolation = nullptr;
+		}
+	}
+
+	void Transform::StorePreviousTransform() noexcept {
+		if (m_interpolation) {
+			m_interpolation->m_previous = GetSQTTransform();
+		}
+	}
+
+	void Transform::ApplyInterpolation(F32 alpha) noexcept {
+		if (!m_interpolation) {
+			return;
+		}
+
+		const auto transform = Lerp(m_interpolation->m_previous,
+									GetSQTTransform(), alpha);
+		m_interpolation->m_object_to_parent = transform.GetObjectToParentMatrix();
+		m_interpolation->m_parent_to_object = transform.GetParentToObjectMatrix();
+		m_interpolation->m_applied          = true;
+		SetDirty();
+	}
+
+	void Transform::RevertInterpolation() noexcept {
+		if (m_interpolation && m_interpolation->m_applied) {
+			m_interpolation->m_applied = false;
+			SetDirty();
+		}
+	}
+
 	void Transform::SetDirty() const noexcept {
 		m_dirty_object_to_world = true;
 		m_dirty_world_to_object = true;
@@ -31,11 +74,11 @@ namespace mage {
 			const auto parent = m_owner->GetParent();
 
 			if (nullptr != parent) {
-				m_object_to_world = GetObjectToParentMatrix()
+				m_object_to_world = GetInterpolatedObjectToParentMatrix()
 					              * parent->GetTransform().GetObjectToWorldMatrix();
 			}
 			else {
-				m_object_to_world = GetObjectToParentMatrix();
+				m_object_to_world = GetInterpolatedObjectToParentMatrix();
 			}
 		}
 	}
@@ -49,10 +92,10 @@ namespace mage {
 
 			if (nullptr != parent) {
 				m_world_to_object = parent->GetTransform().GetWorldToObjectMatrix()
-					              * GetParentToObjectMatrix();
+					              * GetInterpolatedParentToObjectMatrix();
 			}
 			else {
-				m_world_to_object = GetParentToObjectMatrix();
+				m_world_to_object = GetInterpolatedParentToObjectMatrix();
 			}
 		}
 	}
@@ -5,7 +5,16 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "transform\transform.hpp"
+#include "transform/transform.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
 
 #pragma endregion
 
@@ -42,10 +51,12 @@ namespace mage {
 			m_world_to_object(),
 			m_dirty_object_to_world(true),
 			m_dirty_world_to_object(true),
-			m_owner() {}
+			m_owner(),
+			m_interpolation() {}
 
 		/**
-		 Constructs a transform from the given transform.
+		 Constructs a transform from the given transform. The interpolation
+		 state of the given transform is not copied.
 
 		 @param[in]		transform
 						A reference to the transform to copy.
@@ -56,7 +67,8 @@ namespace mage {
 			m_world_to_object(),
 			m_dirty_object_to_world(true),
 			m_dirty_world_to_object(true),
-			m_owner() {}
+			m_owner(),
+			m_interpolation() {}
 
 		/**
 		 Constructs a transform by moving the given transform.
@@ -76,7 +88,8 @@ namespace mage {
 		//---------------------------------------------------------------------
 
 		/**
-		 Copies the given transform to this transform.
+		 Copies the given transform to this transform. The interpolation state
+		 of the given transform is not copied.
 
 		 @param[in]		transform
 						A reference to the transform to copy.
@@ -98,12 +111,109 @@ namespace mage {
 						this transform).
 		 */
 		Transform& operator=(Transform&& transform) noexcept {
-			m_transform = std::move(transform.m_transform);
-			m_owner     = std::move(transform.m_owner);
+			m_transform     = std::move(transform.m_transform);
+			m_owner         = std::move(transform.m_owner);
+			m_interpolation = std::move(transform.m_interpolation);
 			SetDirty();
 			return *this;
 		}
 
+		//---------------------------------------------------------------------
+		// Member Methods: Snapshot
+		//---------------------------------------------------------------------
+
+		/**
+		 Sets this transform to a snapshot of the given transform.
+
+		 The local transformation and the object-to-world and world-to-object
+		 matrices of the given transform are copied. The copied matrices are
+		 not recomputed from the parent of this transform, until this
+		 transform changes.
+
+		 @param[in]		transform
+						A reference to the transform.
+		 */
+		void Snapshot(const Transform& transform) noexcept {
+			m_transform             = transform.m_transform;
+			m_object_to_world       = transform.GetObjectToWorldMatrix();
+			m_world_to_object       = transform.GetWorldToObjectMatrix();
+			m_dirty_object_to_world = false;
+			m_dirty_world_to_object = false;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Interpolation
+		//---------------------------------------------------------------------
+		#pragma region
+
+		/**
+		 Checks whether this transform is interpolated between fixed delta
+		 time updates.
+
+		 @return		@c true if this transform is interpolated. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsInterpolated() const noexcept {
+			return bool(m_interpolation);
+		}
+
+		/**
+		 Returns the number of interpolated transforms.
+
+		 The interpolation of the transforms (i.e. storing, applying and
+		 reverting) can be skipped for all nodes if no transform is
+		 interpolated.
+
+		 @return		The number of interpolated transforms.
+		 */
+		[[nodiscard]]
+		static std::size_t GetNumberOfInterpolatedTransforms() noexcept {
+			return s_nb_interpolated_transforms.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 Sets whether this transform is interpolated between fixed delta time
+		 updates.
+
+		 Transforms which are not interpolated, only store a null pointer and
+		 are rendered with their current local transform.
+
+		 @param[in]		interpolated
+						@c true if this transform needs to be interpolated.
+						@c false otherwise.
+		 */
+		void SetInterpolated(bool interpolated);
+
+		/**
+		 Stores the local transform of this transform as the previous local
+		 transform (i.e. the local transform before the next fixed delta time
+		 update), if this transform is interpolated.
+		 */
+		void StorePreviousTransform() noexcept;
+
+		/**
+		 Interpolates the local transform of this transform between the
+		 previous and the current local transform, if this transform is
+		 interpolated. The object-to-world and world-to-object matrices of
+		 this transform (and its descendants) reflect the interpolated local
+		 transform, until the interpolation is reverted. The current local
+		 transform itself is not changed.
+
+		 @param[in]		alpha
+						The interpolation factor (i.e. the fraction of the
+						fixed delta time elapsed since the last fixed delta
+						time update).
+		 */
+		void ApplyInterpolation(F32 alpha) noexcept;
+
+		/**
+		 Reverts the interpolation of this transform, if applied.
+		 */
+		void RevertInterpolation() noexcept;
+
+		#pragma endregion
+
 		//---------------------------------------------------------------------
 		// Member Methods: Translation
 		//---------------------------------------------------------------------
@@ -1455,6 +1565,97 @@ namespace mage {
 
 		friend class TransformClient;
 
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of transform interpolation states. The number of
+		 interpolated transforms is the number of interpolation states.
+		 */
+		struct alignas(16) InterpolationState {
+
+		public:
+
+			/**
+			 Constructs an interpolation state.
+			 */
+			InterpolationState() noexcept
+				: m_object_to_parent(),
+				m_parent_to_object(),
+				m_previous(),
+				m_applied(false) {
+
+				s_nb_interpolated_transforms.fetch_add(1u, std::memory_order_relaxed);
+			}
+
+			/**
+			 Constructs an interpolation state from the given interpolation
+			 state.
+
+			 @param[in]		state
+							A reference to the interpolation state to copy.
+			 */
+			InterpolationState(const InterpolationState& state) = delete;
+
+			/**
+			 Constructs an interpolation state by moving the given
+			 interpolation state.
+
+			 @param[in]		state
+							A reference to the interpolation state to move.
+			 */
+			InterpolationState(InterpolationState&& state) = delete;
+
+			/**
+			 Destructs this interpolation state.
+			 */
+			~InterpolationState() {
+				s_nb_interpolated_transforms.fetch_sub(1u, std::memory_order_relaxed);
+			}
+
+			/**
+			 Copies the given interpolation state to this interpolation
+			 state.
+
+			 @param[in]		state
+							A reference to the interpolation state to copy.
+			 @return		A reference to the copy of the given interpolation
+							state (i.e. this interpolation state).
+			 */
+			InterpolationState& operator=(const InterpolationState& state) = delete;
+
+			/**
+			 Moves the given interpolation state to this interpolation state.
+
+			 @param[in]		state
+							A reference to the interpolation state to move.
+			 @return		A reference to the moved interpolation state (i.e.
+							this interpolation state).
+			 */
+			InterpolationState& operator=(InterpolationState&& state) = delete;
+
+			/**
+			 The interpolated object-to-parent matrix.
+			 */
+			XMMATRIX m_object_to_parent;
+
+			/**
+			 The interpolated parent-to-object matrix.
+			 */
+			XMMATRIX m_parent_to_object;
+
+			/**
+			 The previous local transform.
+			 */
+			SQTTransform3D m_previous;
+
+			/**
+			 A flag indicating whether the interpolation is applied.
+			 */
+			bool m_applied;
+		};
+
 		//---------------------------------------------------------------------
 		// Member Methods: Update
 		//---------------------------------------------------------------------
@@ -1471,6 +1672,47 @@ namespace mage {
 			SetDirty();
 		}
 
+		/**
+		 Returns the local transform of this transform as an SQT transform.
+
+		 @return		The local transform of this transform as an SQT
+						transform.
+		 */
+		[[nodiscard]]
+		const SQTTransform3D GetSQTTransform() const noexcept {
+			return SQTTransform3D(m_transform.GetTranslation(),
+								  m_transform.GetObjectToParentRotationQuaternion(),
+								  m_transform.GetScale());
+		}
+
+		/**
+		 Returns the (interpolated) object-to-parent matrix of this transform
+		 used for computing the object-to-world matrix of this transform.
+
+		 @return		The (interpolated) object-to-parent matrix of this
+						transform.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetInterpolatedObjectToParentMatrix() const noexcept {
+			return (m_interpolation && m_interpolation->m_applied)
+				? m_interpolation->m_object_to_parent
+				: GetObjectToParentMatrix();
+		}
+
+		/**
+		 Returns the (interpolated) parent-to-object matrix of this transform
+		 used for computing the world-to-object matrix of this transform.
+
+		 @return		The (interpolated) parent-to-object matrix of this
+						transform.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetInterpolatedParentToObjectMatrix() const noexcept {
+			return (m_interpolation && m_interpolation->m_applied)
+				? m_interpolation->m_parent_to_object
+				: GetParentToObjectMatrix();
+		}
+
 		/**
 		 Updates the object-to-world matrix of this transform if dirty.
 
@@ -1487,6 +1729,15 @@ namespace mage {
 
 		#pragma endregion
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of interpolated transforms.
+		 */
+		static std::atomic< std::size_t > s_nb_interpolated_transforms;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -1522,6 +1773,12 @@ namespace mage {
 		 A pointer to the node owning this transform.
 		 */
 		ProxyPtr< Node > m_owner;
+
+		/**
+		 A pointer to the interpolation state of this transform. The pointer
+		 is @c nullptr if this transform is not interpolated.
+		 */
+		UniquePtr< InterpolationState > m_interpolation;
 	};
 
 	#pragma endregion
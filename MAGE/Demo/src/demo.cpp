@@ -1,4 +1,7 @@
-#include "samples\sponza\sponza_scene.hpp"
+#include "samples/sponza/sponza_scene.hpp"
+
+#include <cstdlib>
+#include <cstring>
 
 /**
  The user-provided entry point for MAGE.
@@ -10,7 +13,12 @@
 				This parameter is always @c nullptr.
  @param[in]		lpCmdLine
 				The command line for the application, excluding the program
-				name.
+				name. @c -pipelined renders on a separate render thread.
+				@c -fps=N limits the frame rate to N frames per second.
+				@c -gpu=T scales the resolution dynamically to render a
+				frame in T milliseconds on the GPU.
+				@c -record records the input to @c input.rec for replaying
+				it in benchmarks.
  @param[in]		nCmdShow
 				Controls how the window is to be shown.
  @return		@c 0, if the function terminates before entering the message
@@ -19,7 +27,7 @@
  */
 int WINAPI WinMain(HINSTANCE instance,
 				   [[maybe_unused]] HINSTANCE prev_instance,
-				   [[maybe_unused]] LPSTR lpCmdLine,
+				   LPSTR lpCmdLine,
 				   int nCmdShow) {
 
 	using namespace mage;
@@ -27,6 +35,20 @@ int WINAPI WinMain(HINSTANCE instance,
 	// Create the engine setup.
 	const auto not_null_instance = NotNull< HINSTANCE >(instance);
 	EngineSetup setup(not_null_instance);
+	// Render on a separate render thread if requested.
+	setup.SetPipelined(nullptr != std::strstr(lpCmdLine, "-pipelined"));
+	// Limit the frame rate if requested.
+	if (const auto fps = std::strstr(lpCmdLine, "-fps="); nullptr != fps) {
+		setup.SetTargetFrameRate(std::atof(fps + 5));
+	}
+	// Scale the resolution dynamically if requested.
+	if (const auto gpu = std::strstr(lpCmdLine, "-gpu="); nullptr != gpu) {
+		setup.SetTargetGPUFrameTime(std::atof(gpu + 5));
+	}
+	// Record the input if requested.
+	if (nullptr != std::strstr(lpCmdLine, "-record")) {
+		setup.SetInputRecordingPath(L"input.rec");
+	}
 
 	// Create the engine.
 	UniquePtr< Engine > engine = CreateEngine(setup);
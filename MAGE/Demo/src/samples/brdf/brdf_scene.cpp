@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "samples\brdf\brdf_scene.hpp"
-#include "samples\cornell\cornell_scene.hpp"
+#include "samples/brdf/brdf_scene.hpp"
+#include "samples/cornell/cornell_scene.hpp"
 
 #pragma endregion
 
@@ -13,7 +13,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\texture\texture_factory.hpp"
+#include "resource/texture/texture_factory.hpp"
 
 #include "editor_script.hpp"
 #include "stats_script.hpp"
@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "samples\cornell\cornell_scene.hpp"
-#include "samples\sponza\sponza_scene.hpp"
+#include "samples/cornell/cornell_scene.hpp"
+#include "samples/sponza/sponza_scene.hpp"
 
 #pragma endregion
 
@@ -13,7 +13,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\texture\texture_factory.hpp"
+#include "resource/texture/texture_factory.hpp"
 
 #include "character_motor_script.hpp"
 #include "mouse_look_script.hpp"
@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "samples\sibenik\sibenik_scene.hpp"
-#include "samples\forrest\forrest_scene.hpp"
+#include "samples/sibenik/sibenik_scene.hpp"
+#include "samples/forrest/forrest_scene.hpp"
 
 #pragma endregion
 
@@ -13,7 +13,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\texture\texture_factory.hpp"
+#include "resource/texture/texture_factory.hpp"
 
 #include "character_motor_script.hpp"
 #include "mouse_look_script.hpp"
@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "samples\sponza\sponza_scene.hpp"
-#include "samples\sibenik\sibenik_scene.hpp"
+#include "samples/sponza/sponza_scene.hpp"
+#include "samples/sibenik/sibenik_scene.hpp"
 
 #pragma endregion
 
@@ -13,7 +13,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\texture\texture_factory.hpp"
+#include "resource/texture/texture_factory.hpp"
 
 #include "character_motor_script.hpp"
 #include "mouse_look_script.hpp"
@@ -51,20 +51,22 @@ namespace mage {
 		//---------------------------------------------------------------------
 		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
 
+		// The models and sky are loaded asynchronously, and added to the
+		// scene once loaded.
 		const auto teapot_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/teapot/teapot.mdl", mesh_desc);
 		const auto plane_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/plane/plane.obj", mesh_desc);
 		const auto sponza_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/sponza/sponza.mdl",    mesh_desc);
 		const auto tree_model_desc_tree
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
+			= rendering_factory.GetOrCreateAsync< ModelDescriptor >(
 				L"assets/models/tree/tree1a_lod0.mdl", mesh_desc);
 		const auto sky_texture
-			= rendering_factory.GetOrCreate< Texture >(
+			= rendering_factory.GetOrCreateAsync< Texture >(
 				L"assets/textures/sky/sky.dds");
 		const auto logo_texture = CreateMAGETexture(rendering_factory);
 
@@ -73,7 +75,9 @@ namespace mage {
 		//---------------------------------------------------------------------
 		const auto camera = rendering_world.Create< PerspectiveCamera >();
 		camera->GetSettings().GetFog().SetDensity(0.001f);
-		camera->GetSettings().GetSky().SetTexture(sky_texture);
+		rendering_factory.OnLoaded(sky_texture, [camera](TexturePtr texture) {
+			camera->GetSettings().GetSky().SetTexture(std::move(texture));
+		});
 
 		const auto camera_node = Create< Node >("Player");
 		camera_node->Add(camera);
@@ -81,19 +85,33 @@ namespace mage {
 		//---------------------------------------------------------------------
 		// Models
 		//---------------------------------------------------------------------
-		const auto teapot_node = Import(engine, *teapot_model_desc);
-		teapot_node->GetTransform().AddRotationY(1.59f);
-		teapot_node->GetTransform().AddTranslationY(-1.5f);
-		
-		const auto plane_node = Import(engine, *plane_model_desc);
-		plane_node->GetTransform().SetScale(10.0f);
-		plane_node->GetTransform().AddTranslationY(-2.0f);
-
-		const auto sponza_node = Import(engine, *sponza_model_desc);
-		sponza_node->GetTransform().SetScale(10.0f);
-
-		const auto tree_node = Import(engine, *tree_model_desc_tree);
-		tree_node->GetTransform().AddTranslationY(-1.0f);
+		rendering_factory.OnLoaded(teapot_model_desc,
+			[this, &engine](ModelDescriptorPtr model_desc) {
+				const auto teapot_node = Import(engine, *model_desc);
+				teapot_node->GetTransform().AddRotationY(1.59f);
+				teapot_node->GetTransform().AddTranslationY(-1.5f);
+				//teapot_node->Add(Create< script::RotationScript >());
+			});
+
+		rendering_factory.OnLoaded(plane_model_desc,
+			[this, &engine](ModelDescriptorPtr model_desc) {
+				const auto plane_node = Import(engine, *model_desc);
+				plane_node->GetTransform().SetScale(10.0f);
+				plane_node->GetTransform().AddTranslationY(-2.0f);
+			});
+
+		rendering_factory.OnLoaded(sponza_model_desc,
+			[this, &engine](ModelDescriptorPtr model_desc) {
+				const auto sponza_node = Import(engine, *model_desc);
+				sponza_node->GetTransform().SetScale(10.0f);
+			});
+
+		rendering_factory.OnLoaded(tree_model_desc_tree,
+			[this, &engine](ModelDescriptorPtr model_desc) {
+				const auto tree_node = Import(engine, *model_desc);
+				tree_node->GetTransform().AddTranslationY(-1.0f);
+				tree_node->Add(Create< script::RotationScript >());
+			});
 
 		//---------------------------------------------------------------------
 		// Lights
@@ -151,7 +169,5 @@ namespace mage {
 		camera_node->Add(Create< script::MouseLookScript >());
 		camera_node->Add(Create< script::CharacterMotorScript >());
 		//camera_node->Add(Create< script::VoxelGridAnchorScript >());
-		tree_node->Add(Create< script::RotationScript >());
-		//teapot_node->Add(Create< script::RotationScript >());
 	}
 }
\ No newline at end of file
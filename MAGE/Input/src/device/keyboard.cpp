@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "device\keyboard.hpp"
-#include "exception\exception.hpp"
+#include "device/keyboard.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -100,11 +100,29 @@ namespace mage::input {
 			}
 		}
 
-		// Update the key states.
+		std::bitset< 256 > active_keys;
 		for (std::size_t i = 0u; i < std::size(key_states); ++i) {
-			const bool active = key_states[i] & 0x80u;
+			active_keys[i] = key_states[i] & 0x80u;
+		}
+
+		Update(active_keys);
+	}
+
+	void Keyboard::Update(const std::bitset< 256 >& active_keys) noexcept {
+		// Update the key states.
+		for (std::size_t i = 0u; i < active_keys.size(); ++i) {
+			const bool active = active_keys[i];
 			m_key_states[2u*i]    = (active != m_key_states[2u*i+1u]);
 			m_key_states[2u*i+1u] = active;
 		}
 	}
+
+	const std::bitset< 256 > Keyboard::GetActiveKeys() const noexcept {
+		std::bitset< 256 > active_keys;
+		for (std::size_t i = 0u; i < active_keys.size(); ++i) {
+			active_keys[i] = m_key_states[2u*i+1u];
+		}
+
+		return active_keys;
+	}
 }
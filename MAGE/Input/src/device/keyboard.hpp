@@ -6,7 +6,7 @@
 #pragma region
 
 #include "direct_input.hpp"
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -110,6 +110,25 @@ namespace mage::input {
 		 */
 		void Update() noexcept;
 
+		/**
+		 Updates the state of this keyboard from the given active keys (e.g.,
+		 replayed active keys) instead of the keyboard device.
+
+		 @param[in]		active_keys
+						A reference to the active keys indexed by their
+						DirectInput key code.
+		 */
+		void Update(const std::bitset< 256 >& active_keys) noexcept;
+
+		/**
+		 Returns the active keys of this keyboard.
+
+		 @return		The active keys of this keyboard indexed by their
+						DirectInput key code.
+		 */
+		[[nodiscard]]
+		const std::bitset< 256 > GetActiveKeys() const noexcept;
+
 		/**
 		 Checks whether the given key is active.
 
@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "device\mouse.hpp"
-#include "exception\exception.hpp"
+#include "device/mouse.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -132,21 +132,46 @@ namespace mage::input {
 			}
 		}
 
+		std::bitset< 8 > active_buttons;
+		for (std::size_t i = 0u; i < std::size(mouse_state.rgbButtons); ++i) {
+			active_buttons[i] = mouse_state.rgbButtons[i] & 0x80u;
+		}
+
+		Update(GetMousePosition(m_window),
+			   { static_cast< S32 >(mouse_state.lX),
+				 static_cast< S32 >(mouse_state.lY) },
+			   static_cast< S32 >(mouse_state.lZ),
+			   active_buttons);
+	}
+
+	void Mouse::Update(S32x2 position,
+					   S32x2 delta,
+					   S32 delta_wheel,
+					   const std::bitset< 8 >& active_buttons) noexcept {
+
 		// Updates the mouse position.
-		m_position = GetMousePosition(m_window);
+		m_position    = position;
 
 		// Update the mouse deltas.
-		m_delta[0u]   = static_cast< S32 >(mouse_state.lX);
-		m_delta[1u]   = static_cast< S32 >(mouse_state.lY);
-		m_delta_wheel = static_cast< S32 >(mouse_state.lZ);
+		m_delta       = delta;
+		m_delta_wheel = delta_wheel;
 
 		// Update the button states.
-		for (std::size_t i = 0u; i < std::size(mouse_state.rgbButtons); ++i) {
-			const bool active = mouse_state.rgbButtons[i] & 0x80u;
+		for (std::size_t i = 0u; i < active_buttons.size(); ++i) {
+			const bool active = active_buttons[i];
 			m_button_states[2u*i]    = (active != m_button_states[2u*i+1u]);
 			m_button_states[2u*i+1u] = active;
 		}
 	}
 
+	const std::bitset< 8 > Mouse::GetActiveButtons() const noexcept {
+		std::bitset< 8 > active_buttons;
+		for (std::size_t i = 0u; i < active_buttons.size(); ++i) {
+			active_buttons[i] = m_button_states[2u*i+1u];
+		}
+
+		return active_buttons;
+	}
+
 	#pragma endregion
 }
@@ -6,7 +6,7 @@
 #pragma region
 
 #include "direct_input.hpp"
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -110,6 +110,33 @@ namespace mage::input {
 		 */
 		void Update() noexcept;
 
+		/**
+		 Updates the state of this mouse from the given state (e.g., a
+		 replayed state) instead of the mouse device.
+
+		 @param[in]		position
+						The position of the mouse cursor.
+		 @param[in]		delta
+						The change in the horizontal and vertical
+						coordinates.
+		 @param[in]		delta_wheel
+						The change in the scroll wheel coordinates.
+		 @param[in]		active_buttons
+						A reference to the active buttons.
+		 */
+		void Update(S32x2 position,
+					S32x2 delta,
+					S32 delta_wheel,
+					const std::bitset< 8 >& active_buttons) noexcept;
+
+		/**
+		 Returns the active buttons of this mouse.
+
+		 @return		The active buttons of this mouse.
+		 */
+		[[nodiscard]]
+		const std::bitset< 8 > GetActiveButtons() const noexcept;
+
 		/**
 		 Checks whether the given button is active.
 
@@ -4,7 +4,7 @@
 #pragma region
 
 #include "input_manager.hpp"
-#include "exception\exception.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -108,6 +108,39 @@ namespace mage::input {
 			m_mouse->Update();
 		}
 
+		/**
+		 Updates the state of the input systems of this input manager from
+		 the given input state (e.g., a replayed input state) instead of the
+		 input devices.
+
+		 @param[in]		state
+						A reference to the input state.
+		 */
+		void Update(const InputState& state) noexcept {
+			m_keyboard->Update(state.m_active_keys);
+			m_mouse->Update(state.m_mouse_position,
+							state.m_mouse_delta,
+							state.m_mouse_delta_wheel,
+							state.m_active_mouse_buttons);
+		}
+
+		/**
+		 Returns the input state of the input systems of this input manager.
+
+		 @return		The input state of the input systems of this input
+						manager.
+		 */
+		[[nodiscard]]
+		const InputState GetState() const noexcept {
+			InputState state;
+			state.m_active_keys          = m_keyboard->GetActiveKeys();
+			state.m_mouse_position       = m_mouse->GetPosition();
+			state.m_mouse_delta          = m_mouse->GetDelta();
+			state.m_mouse_delta_wheel    = m_mouse->GetDeltaWheel();
+			state.m_active_mouse_buttons = m_mouse->GetActiveButtons();
+			return state;
+		}
+
 		/**
 		 Returns the keyboard of this input manager.
 
@@ -241,6 +274,15 @@ namespace mage::input {
 		m_impl->Update();
 	}
 
+	void Manager::Update(const InputState& state) noexcept {
+		m_impl->Update(state);
+	}
+
+	[[nodiscard]]
+	const InputState Manager::GetState() const noexcept {
+		return m_impl->GetState();
+	}
+
 	[[nodiscard]]
 	const Keyboard& Manager::GetKeyboard() const noexcept {
 		return m_impl->GetKeyboard();
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "device\keyboard.hpp"
-#include "device\mouse.hpp"
+#include "device/keyboard.hpp"
+#include "device/mouse.hpp"
 
 #pragma endregion
 
@@ -15,6 +15,46 @@
 //-----------------------------------------------------------------------------
 namespace mage::input {
 
+	/**
+	 A struct of input states containing the state of the input systems of a
+	 single frame.
+	 */
+	struct InputState {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The active keys of the keyboard of this input state.
+		 */
+		std::bitset< 256 > m_active_keys = {};
+
+		/**
+		 The position of the mouse cursor of this input state.
+		 */
+		S32x2 m_mouse_position = {};
+
+		/**
+		 The change in the horizontal and vertical coordinates of the mouse of
+		 this input state.
+		 */
+		S32x2 m_mouse_delta = {};
+
+		/**
+		 The change in the scroll wheel coordinates of the mouse of this input
+		 state.
+		 */
+		S32 m_mouse_delta_wheel = 0;
+
+		/**
+		 The active buttons of the mouse of this input state.
+		 */
+		std::bitset< 8 > m_active_mouse_buttons = {};
+	};
+
 	/**
 	 A class of input managers.
 	 */
@@ -100,6 +140,25 @@ namespace mage::input {
 		 */
 		void Update() noexcept;
 
+		/**
+		 Updates the state of the input systems of this input manager from
+		 the given input state (e.g., a replayed input state) instead of the
+		 input devices.
+
+		 @param[in]		state
+						A reference to the input state.
+		 */
+		void Update(const InputState& state) noexcept;
+
+		/**
+		 Returns the input state of the input systems of this input manager.
+
+		 @return		The input state of the input systems of this input
+						manager.
+		 */
+		[[nodiscard]]
+		const InputState GetState() const noexcept;
+
 		/**
 		 Returns the keyboard of this input manager.
 
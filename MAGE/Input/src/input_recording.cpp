@@ -0,0 +1,355 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "input_recording.hpp"
+#include "io/binary_reader.hpp"
+#include "io/binary_writer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::input {
+
+	namespace {
+
+		constexpr const_zstring g_input_token_magic = "MAGEinput";
+
+		/**
+		 Packs the given bits into bytes.
+
+		 @tparam		N
+						The number of bits.
+		 @param[in]		bits
+						A reference to the bits.
+		 @return		The packed bits.
+		 */
+		template< std::size_t N >
+		[[nodiscard]]
+		const std::array< U8, (N + 7u) / 8u >
+			PackBits(const std::bitset< N >& bits) noexcept {
+
+			std::array< U8, (N + 7u) / 8u > bytes = {};
+			for (std::size_t i = 0u; i < N; ++i) {
+				if (bits[i]) {
+					bytes[i / 8u] |= static_cast< U8 >(1u << (i % 8u));
+				}
+			}
+
+			return bytes;
+		}
+
+		/**
+		 Unpacks the given bytes into bits.
+
+		 @tparam		N
+						The number of bits.
+		 @param[in]		bytes
+						A pointer to the packed bits.
+		 @return		The unpacked bits.
+		 */
+		template< std::size_t N >
+		[[nodiscard]]
+		const std::bitset< N > UnpackBits(const U8* bytes) noexcept {
+			std::bitset< N > bits;
+			for (std::size_t i = 0u; i < N; ++i) {
+				bits[i] = bytes[i / 8u] & (1u << (i % 8u));
+			}
+
+			return bits;
+		}
+
+		//---------------------------------------------------------------------
+		// InputRecordingReader
+		//---------------------------------------------------------------------
+		#pragma region
+
+		/**
+		 A class of input recording file readers for reading input frames.
+		 */
+		class InputRecordingReader : private BigEndianBinaryReader {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			/**
+			 Constructs an input recording reader.
+
+			 @param[in,out]	frames
+							A reference to a vector for storing the read input
+							frames.
+			 */
+			explicit InputRecordingReader(std::vector< InputFrame >& frames)
+				: BigEndianBinaryReader(),
+				m_frames(frames) {}
+
+			/**
+			 Constructs an input recording reader from the given input
+			 recording reader.
+
+			 @param[in]		reader
+							A reference to the input recording reader to copy.
+			 */
+			InputRecordingReader(const InputRecordingReader& reader) = delete;
+
+			/**
+			 Constructs an input recording reader by moving the given input
+			 recording reader.
+
+			 @param[in]		reader
+							A reference to the input recording reader to move.
+			 */
+			InputRecordingReader(InputRecordingReader&& reader) noexcept = default;
+
+			/**
+			 Destructs this input recording reader.
+			 */
+			~InputRecordingReader() = default;
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			/**
+			 Copies the given input recording reader to this input recording
+			 reader.
+
+			 @param[in]		reader
+							A reference to an input recording reader to copy.
+			 @return		A reference to the copy of the given input
+							recording reader (i.e. this input recording
+							reader).
+			 */
+			InputRecordingReader& operator=(
+				const InputRecordingReader& reader) = delete;
+
+			/**
+			 Moves the given input recording reader to this input recording
+			 reader.
+
+			 @param[in]		reader
+							A reference to an input recording reader to move.
+			 @return		A reference to the moved input recording reader
+							(i.e. this input recording reader).
+			 */
+			InputRecordingReader& operator=(
+				InputRecordingReader&& reader) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			using BigEndianBinaryReader::ReadFromFile;
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Starts reading.
+
+			 @throws		Exception
+							Failed to read.
+			 */
+			virtual void ReadData() override {
+				// Read the header.
+				for (auto magic = g_input_token_magic; '\0' != *magic; ++magic) {
+					ThrowIfFailed((*magic == Read< U8 >()),
+								  "{}: invalid input recording header.",
+								  GetPath());
+				}
+
+				const auto nb_frames = Read< U32 >();
+				m_frames.clear();
+				m_frames.reserve(nb_frames);
+
+				for (U32 i = 0u; i < nb_frames; ++i) {
+					InputFrame frame;
+					frame.m_delta_time = Read< F64 >();
+
+					auto& state = frame.m_state;
+					state.m_active_keys = UnpackBits< 256 >(ReadArray< U8 >(32u));
+					state.m_active_mouse_buttons = UnpackBits< 8 >(ReadArray< U8 >(1u));
+					state.m_mouse_position[0u]   = Read< S32 >();
+					state.m_mouse_position[1u]   = Read< S32 >();
+					state.m_mouse_delta[0u]      = Read< S32 >();
+					state.m_mouse_delta[1u]      = Read< S32 >();
+					state.m_mouse_delta_wheel    = Read< S32 >();
+
+					m_frames.push_back(std::move(frame));
+				}
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 A reference to a vector containing the read input frames of this
+			 input recording reader.
+			 */
+			std::vector< InputFrame >& m_frames;
+		};
+
+		#pragma endregion
+
+		//---------------------------------------------------------------------
+		// InputRecordingWriter
+		//---------------------------------------------------------------------
+		#pragma region
+
+		/**
+		 A class of input recording file writers for writing input frames.
+		 */
+		class InputRecordingWriter : private BigEndianBinaryWriter {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			/**
+			 Constructs an input recording writer.
+
+			 @param[in]		frames
+							A reference to a vector containing the input
+							frames to write.
+			 */
+			explicit InputRecordingWriter(const std::vector< InputFrame >& frames)
+				: BigEndianBinaryWriter(),
+				m_frames(frames) {}
+
+			/**
+			 Constructs an input recording writer from the given input
+			 recording writer.
+
+			 @param[in]		writer
+							A reference to the input recording writer to copy.
+			 */
+			InputRecordingWriter(const InputRecordingWriter& writer) = delete;
+
+			/**
+			 Constructs an input recording writer by moving the given input
+			 recording writer.
+
+			 @param[in]		writer
+							A reference to the input recording writer to move.
+			 */
+			InputRecordingWriter(InputRecordingWriter&& writer) noexcept = default;
+
+			/**
+			 Destructs this input recording writer.
+			 */
+			~InputRecordingWriter() = default;
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			/**
+			 Copies the given input recording writer to this input recording
+			 writer.
+
+			 @param[in]		writer
+							A reference to an input recording writer to copy.
+			 @return		A reference to the copy of the given input
+							recording writer (i.e. this input recording
+							writer).
+			 */
+			InputRecordingWriter& operator=(
+				const InputRecordingWriter& writer) = delete;
+
+			/**
+			 Moves the given input recording writer to this input recording
+			 writer.
+
+			 @param[in]		writer
+							A reference to an input recording writer to move.
+			 @return		A reference to the moved input recording writer
+							(i.e. this input recording writer).
+			 */
+			InputRecordingWriter& operator=(
+				InputRecordingWriter&& writer) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			using BigEndianBinaryWriter::WriteToFile;
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Starts writing.
+
+			 @throws		Exception
+							Failed to write.
+			 */
+			virtual void WriteData() override {
+				WriteString(NotNull< const_zstring >(g_input_token_magic));
+				Write< U32 >(static_cast< U32 >(m_frames.size()));
+
+				for (const auto& frame : m_frames) {
+					Write< F64 >(frame.m_delta_time);
+
+					const auto& state = frame.m_state;
+					Write(PackBits(state.m_active_keys));
+					Write(PackBits(state.m_active_mouse_buttons));
+					Write< S32 >(state.m_mouse_position[0u]);
+					Write< S32 >(state.m_mouse_position[1u]);
+					Write< S32 >(state.m_mouse_delta[0u]);
+					Write< S32 >(state.m_mouse_delta[1u]);
+					Write< S32 >(state.m_mouse_delta_wheel);
+				}
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 A reference to a vector containing the input frames to write of
+			 this input recording writer.
+			 */
+			const std::vector< InputFrame >& m_frames;
+		};
+
+		#pragma endregion
+	}
+
+	void ImportInputRecordingFromFile(const std::filesystem::path& path,
+									  std::vector< InputFrame >& frames) {
+
+		InputRecordingReader reader(frames);
+		reader.ReadFromFile(path);
+	}
+
+	void ExportInputRecordingToFile(const std::filesystem::path& path,
+									const std::vector< InputFrame >& frames) {
+
+		InputRecordingWriter writer(frames);
+		writer.WriteToFile(path);
+	}
+}
\ No newline at end of file
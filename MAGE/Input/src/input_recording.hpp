@@ -0,0 +1,80 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "input_manager.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::input {
+
+	/**
+	 A struct of input frames containing the input state and the delta time
+	 of a single recorded frame.
+	 */
+	struct InputFrame {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The (wall clock) delta time (in seconds) of this input frame.
+		 */
+		F64 m_delta_time = 0.0;
+
+		/**
+		 The input state of this input frame.
+		 */
+		InputState m_state = {};
+	};
+
+	/**
+	 Imports the input frames from the input recording file associated with
+	 the given path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	frames
+					A reference to a vector containing the input frames.
+	 @throws		Exception
+					Failed to import the input frames from file.
+	 */
+	void ImportInputRecordingFromFile(const std::filesystem::path& path,
+									  std::vector< InputFrame >& frames);
+
+	/**
+	 Exports the given input frames to the input recording file associated
+	 with the given path.
+
+	 Each input frame is stored in 61 bytes: the delta time, the active keys
+	 and mouse buttons as packed bits, and the mouse position and deltas.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[in]		frames
+					A reference to a vector containing the input frames.
+	 @throws		Exception
+					Failed to export the input frames to file.
+	 */
+	void ExportInputRecordingToFile(const std::filesystem::path& path,
+									const std::vector< InputFrame >& frames);
+}
\ No newline at end of file
@@ -0,0 +1,353 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "io/writer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 A struct of summaries of benchmark samples.
+		 */
+		struct Summary {
+
+		public:
+
+			F64 m_mean = 0.0;
+
+			F64 m_p50 = 0.0;
+
+			F64 m_p95 = 0.0;
+
+			F64 m_p99 = 0.0;
+
+			F64 m_max = 0.0;
+		};
+
+		/**
+		 Returns the given percentile of the given sorted samples using the
+		 nearest-rank method.
+
+		 @pre			@a samples is not empty.
+		 @pre			@a samples is sorted in ascending order.
+		 @param[in]		samples
+						A reference to the vector containing the samples.
+		 @param[in]		percentile
+						The percentile in [0,1].
+		 @return		The given percentile of the given sorted samples.
+		 */
+		[[nodiscard]]
+		F64 GetPercentile(const std::vector< F64 >& samples,
+						  F64 percentile) noexcept {
+
+			const auto rank  = std::ceil(percentile * samples.size());
+			const auto index = static_cast< std::size_t >(std::max(rank, 1.0)) - 1u;
+			return samples[std::min(index, samples.size() - 1u)];
+		}
+
+		/**
+		 Summarizes the given samples.
+
+		 @param[in]		samples
+						The samples.
+		 @return		The summary of the given samples.
+		 */
+		[[nodiscard]]
+		const Summary Summarize(std::vector< F64 > samples) {
+			Summary summary;
+			if (samples.empty()) {
+				return summary;
+			}
+
+			std::sort(samples.begin(), samples.end());
+
+			F64 sum = 0.0;
+			for (const auto sample : samples) {
+				sum += sample;
+			}
+
+			summary.m_mean = sum / samples.size();
+			summary.m_p50  = GetPercentile(samples, 0.50);
+			summary.m_p95  = GetPercentile(samples, 0.95);
+			summary.m_p99  = GetPercentile(samples, 0.99);
+			summary.m_max  = samples.back();
+			return summary;
+		}
+
+		/**
+		 Summarizes the given member of the given benchmark frames.
+
+		 @tparam		T
+						The member type.
+		 @param[in]		frames
+						A reference to the vector containing the benchmark
+						frames.
+		 @param[in]		member
+						A pointer to the member.
+		 @return		The summary of the given member of the given benchmark
+						frames.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		const Summary Summarize(const std::vector< BenchmarkFrame >& frames,
+								T BenchmarkFrame::* member) {
+
+			std::vector< F64 > samples;
+			samples.reserve(frames.size());
+			for (const auto& frame : frames) {
+				samples.push_back(static_cast< F64 >(frame.*member));
+			}
+
+			return Summarize(std::move(samples));
+		}
+
+		/**
+		 A class of benchmark writers for writing JSON benchmark reports.
+		 */
+		class BenchmarkWriter : private Writer {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			explicit BenchmarkWriter(const BenchmarkSetup& setup,
+									 const std::vector< BenchmarkFrame >& frames,
+									 const std::vector< std::pair< const char*, U32 > >& stages,
+									 const std::vector< Summary >& stage_summaries)
+				: Writer(),
+				m_setup(setup),
+				m_frames(frames),
+				m_stages(stages),
+				m_stage_summaries(stage_summaries) {}
+
+			BenchmarkWriter(const BenchmarkWriter& writer) = delete;
+
+			BenchmarkWriter(BenchmarkWriter&& writer) noexcept = default;
+
+			~BenchmarkWriter() = default;
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			BenchmarkWriter& operator=(const BenchmarkWriter& writer) = delete;
+
+			BenchmarkWriter& operator=(BenchmarkWriter&& writer) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			using Writer::WriteToFile;
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			virtual void Write() override {
+				char buffer[256];
+				const auto not_null_buffer = NotNull< zstring >(buffer);
+
+				WriteStringLine(NotNull< const_zstring >("{"));
+
+				WriteTo(buffer,
+						"\"frames\":{},\"warmup_frames\":{},\"delta_time\":{:.6f},"
+						"\"software_rendering\":{},",
+						m_frames.size(),
+						m_setup.m_nb_warmup_frames,
+						m_setup.m_delta_time.count(),
+						m_setup.m_software_rendering ? "true" : "false");
+				WriteStringLine(not_null_buffer);
+
+				// Times are in milliseconds.
+				WriteString(NotNull< const_zstring >("\"frame_time\":"));
+				WriteSummary(Summarize(m_frames, &BenchmarkFrame::m_frame_time));
+				WriteStringLine(NotNull< const_zstring >(","));
+
+				WriteStringLine(NotNull< const_zstring >("\"stages\":["));
+				for (std::size_t i = 0u; i < m_stages.size(); ++i) {
+					WriteString(NotNull< const_zstring >("{\"name\":\""));
+					// Escape the name.
+					for (auto name = m_stages[i].first; '\0' != *name; ++name) {
+						if ('"' == *name || '\\' == *name) {
+							WriteCharacter('\\');
+						}
+						WriteCharacter(*name);
+					}
+
+					WriteTo(buffer, "\",\"depth\":{},\"time\":",
+							m_stages[i].second);
+					WriteString(not_null_buffer);
+					WriteSummary(m_stage_summaries[i]);
+					WriteStringLine(NotNull< const_zstring >(
+						(i + 1u != m_stages.size()) ? "}," : "}"));
+				}
+				WriteStringLine(NotNull< const_zstring >("],"));
+
+				WriteString(NotNull< const_zstring >(
+					"\"allocations\":{\"count\":"));
+				WriteSummary(Summarize(m_frames, &BenchmarkFrame::m_nb_allocations));
+				WriteString(NotNull< const_zstring >(",\"bytes\":"));
+				WriteSummary(Summarize(m_frames, &BenchmarkFrame::m_nb_allocated_bytes));
+				WriteStringLine(NotNull< const_zstring >("},"));
+
+				WriteString(NotNull< const_zstring >(
+					"\"culling\":{\"tests\":"));
+				WriteSummary(Summarize(m_frames, &BenchmarkFrame::m_nb_culling_tests));
+				WriteString(NotNull< const_zstring >(",\"culled\":"));
+				WriteSummary(Summarize(m_frames, &BenchmarkFrame::m_nb_culled));
+				WriteString(NotNull< const_zstring >(",\"draws\":"));
+				WriteSummary(Summarize(m_frames, &BenchmarkFrame::m_nb_draws));
+				WriteStringLine(NotNull< const_zstring >("}"));
+
+				WriteStringLine(NotNull< const_zstring >("}"));
+			}
+
+			void WriteSummary(const Summary& summary) {
+				char buffer[256];
+				WriteTo(buffer,
+						"{{\"mean\":{:.4f},\"p50\":{:.4f},\"p95\":{:.4f},"
+						"\"p99\":{:.4f},\"max\":{:.4f}}}",
+						summary.m_mean,
+						summary.m_p50,
+						summary.m_p95,
+						summary.m_p99,
+						summary.m_max);
+				WriteString(NotNull< zstring >(buffer));
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			const BenchmarkSetup& m_setup;
+
+			const std::vector< BenchmarkFrame >& m_frames;
+
+			const std::vector< std::pair< const char*, U32 > >& m_stages;
+
+			const std::vector< Summary >& m_stage_summaries;
+		};
+	}
+
+	//-------------------------------------------------------------------------
+	// BenchmarkKeyframe
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	[[nodiscard]]
+	const BenchmarkKeyframe
+		SampleCameraPath(const std::vector< BenchmarkKeyframe >& path,
+						 F64 time) noexcept {
+
+		const auto it = std::upper_bound(
+			path.cbegin(), path.cend(), time,
+			[](F64 lhs, const BenchmarkKeyframe& rhs) noexcept {
+				return lhs < rhs.m_time;
+			});
+
+		if (path.cbegin() == it) {
+			return path.front();
+		}
+		if (path.cend() == it) {
+			return path.back();
+		}
+
+		const auto& k0 = *(it - 1);
+		const auto& k1 = *it;
+		const auto  t  = static_cast< F32 >((time - k0.m_time)
+			                                / (k1.m_time - k0.m_time));
+
+		BenchmarkKeyframe keyframe;
+		keyframe.m_time = time;
+		for (std::size_t i = 0u; i < 3u; ++i) {
+			keyframe.m_translation[i] = k0.m_translation[i]
+				+ t * (k1.m_translation[i] - k0.m_translation[i]);
+			keyframe.m_rotation[i]    = k0.m_rotation[i]
+				+ t * (k1.m_rotation[i]    - k0.m_rotation[i]);
+		}
+
+		return keyframe;
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// BenchmarkRecorder
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	BenchmarkRecorder::BenchmarkRecorder(const BenchmarkSetup& setup)
+		: m_setup(setup),
+		m_frames(),
+		m_stages(),
+		m_stage_indices() {
+
+		m_frames.reserve(m_setup.m_nb_frames);
+	}
+
+	BenchmarkRecorder::BenchmarkRecorder(
+		BenchmarkRecorder&& recorder) noexcept = default;
+
+	BenchmarkRecorder::~BenchmarkRecorder() = default;
+
+	void BenchmarkRecorder::Record(const BenchmarkFrame& frame,
+								   const std::vector< ProfileStatistics >& statistics) {
+
+		m_frames.push_back(frame);
+
+		for (const auto& stage : statistics) {
+			const auto [it, inserted]
+				= m_stage_indices.try_emplace(stage.m_name, m_stages.size());
+			if (inserted) {
+				StageSamples samples;
+				samples.m_name  = stage.m_name;
+				samples.m_depth = stage.m_depth;
+				samples.m_times.reserve(m_setup.m_nb_frames);
+				m_stages.push_back(std::move(samples));
+			}
+
+			m_stages[it->second].m_times.push_back(stage.m_last_time);
+		}
+	}
+
+	void BenchmarkRecorder::Export(const std::filesystem::path& path) const {
+		std::vector< std::pair< const char*, U32 > > stages;
+		std::vector< Summary > stage_summaries;
+		stages.reserve(m_stages.size());
+		stage_summaries.reserve(m_stages.size());
+
+		for (const auto& stage : m_stages) {
+			stages.emplace_back(stage.m_name, stage.m_depth);
+			stage_summaries.push_back(Summarize(stage.m_times));
+		}
+
+		BenchmarkWriter writer(m_setup, m_frames, stages, stage_summaries);
+		writer.WriteToFile(path);
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,359 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "system/profiler.hpp"
+#include "system/timer.hpp"
+#include "type/vector_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// BenchmarkKeyframe
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of benchmark keyframes of scripted camera paths.
+	 */
+	struct BenchmarkKeyframe {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The time (in seconds) of this benchmark keyframe.
+		 */
+		F64 m_time = 0.0;
+
+		/**
+		 The translation of the camera at this benchmark keyframe.
+		 */
+		F32x3 m_translation = {};
+
+		/**
+		 The rotation (in radians) of the camera at this benchmark keyframe.
+		 */
+		F32x3 m_rotation = {};
+	};
+
+	/**
+	 Samples the given camera path at the given time. The translation and
+	 rotation are linearly interpolated between the surrounding keyframes
+	 and clamped to the first and last keyframe.
+
+	 @pre			@a path is not empty.
+	 @pre			The keyframes of @a path are sorted by time.
+	 @param[in]		path
+					A reference to the vector containing the keyframes of the
+					camera path.
+	 @param[in]		time
+					The time (in seconds).
+	 @return		The (interpolated) keyframe of the given camera path at
+					the given time.
+	 */
+	[[nodiscard]]
+	const BenchmarkKeyframe
+		SampleCameraPath(const std::vector< BenchmarkKeyframe >& path,
+						 F64 time) noexcept;
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// BenchmarkSetup
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of benchmark setups.
+	 */
+	struct BenchmarkSetup {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of measured frames of this benchmark setup.
+		 */
+		std::size_t m_nb_frames = 1000u;
+
+		/**
+		 The number of warm-up frames of this benchmark setup. Warm-up frames
+		 are rendered before the measured frames, but are not measured.
+		 */
+		std::size_t m_nb_warmup_frames = 60u;
+
+		/**
+		 The fixed delta time (in seconds) of this benchmark setup.
+		 */
+		TimeIntervalSeconds m_delta_time = TimeIntervalSeconds(1.0 / 60.0);
+
+		/**
+		 The keyframes of the scripted camera path of this benchmark setup.
+
+		 If the camera path is empty, the camera is not driven.
+		 */
+		std::vector< BenchmarkKeyframe > m_camera_path;
+
+		/**
+		 The path of the input recording replayed by this benchmark setup.
+
+		 If the path is empty, no input is replayed and the frames advance
+		 with the fixed delta time. Otherwise, each frame replays the input
+		 state and the delta time of the next recorded frame, and the number
+		 of frames is the number of recorded frames.
+		 */
+		std::filesystem::path m_input_path;
+
+		/**
+		 The path of the JSON report of this benchmark setup.
+		 */
+		std::filesystem::path m_output_path = L"benchmark.json";
+
+		/**
+		 The display resolution of this benchmark setup for software
+		 rendering.
+		 */
+		U32x2 m_resolution = { 1280u, 720u };
+
+		/**
+		 Flag indicating whether the software (i.e. WARP) adapter is used
+		 instead of a hardware adapter.
+		 */
+		bool m_software_rendering = false;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// BenchmarkFrame
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of benchmark frames containing the measurements of a single
+	 frame.
+	 */
+	struct BenchmarkFrame {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The total time (in milliseconds) of this benchmark frame.
+		 */
+		F64 m_frame_time = 0.0;
+
+		/**
+		 The number of allocations of this benchmark frame.
+		 */
+		U64 m_nb_allocations = 0u;
+
+		/**
+		 The number of allocated bytes of this benchmark frame.
+		 */
+		U64 m_nb_allocated_bytes = 0u;
+
+		/**
+		 The number of draw calls of this benchmark frame.
+		 */
+		U32 m_nb_draws = 0u;
+
+		/**
+		 The number of view frustum culling tests of this benchmark frame.
+		 */
+		U32 m_nb_culling_tests = 0u;
+
+		/**
+		 The number of culled objects of this benchmark frame.
+		 */
+		U32 m_nb_culled = 0u;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// BenchmarkRecorder
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of benchmark recorders for recording benchmark frames and
+	 exporting their percentiles as a JSON report.
+	 */
+	class BenchmarkRecorder {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a benchmark recorder.
+
+		 @param[in]		setup
+						A reference to the benchmark setup.
+		 */
+		explicit BenchmarkRecorder(const BenchmarkSetup& setup);
+
+		/**
+		 Constructs a benchmark recorder from the given benchmark recorder.
+
+		 @param[in]		recorder
+						A reference to the benchmark recorder to copy.
+		 */
+		BenchmarkRecorder(const BenchmarkRecorder& recorder) = delete;
+
+		/**
+		 Constructs a benchmark recorder by moving the given benchmark
+		 recorder.
+
+		 @param[in]		recorder
+						A reference to the benchmark recorder to move.
+		 */
+		BenchmarkRecorder(BenchmarkRecorder&& recorder) noexcept;
+
+		/**
+		 Destructs this benchmark recorder.
+		 */
+		~BenchmarkRecorder();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given benchmark recorder to this benchmark recorder.
+
+		 @param[in]		recorder
+						A reference to the benchmark recorder to copy.
+		 @return		A reference to the copy of the given benchmark recorder
+						(i.e. this benchmark recorder).
+		 */
+		BenchmarkRecorder& operator=(const BenchmarkRecorder& recorder) = delete;
+
+		/**
+		 Moves the given benchmark recorder to this benchmark recorder.
+
+		 @param[in]		recorder
+						A reference to the benchmark recorder to move.
+		 @return		A reference to the moved benchmark recorder (i.e. this
+						benchmark recorder).
+		 */
+		BenchmarkRecorder& operator=(BenchmarkRecorder&& recorder) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records the given benchmark frame.
+
+		 @param[in]		frame
+						A reference to the benchmark frame.
+		 @param[in]		statistics
+						A reference to the vector containing the profile
+						statistics of the benchmark frame.
+		 */
+		void Record(const BenchmarkFrame& frame,
+					const std::vector< ProfileStatistics >& statistics);
+
+		/**
+		 Exports the recorded benchmark frames of this benchmark recorder to
+		 the given JSON file.
+
+		 @param[in]		path
+						A reference to the path.
+		 @throws		Exception
+						Failed to export the recorded benchmark frames to the
+						given JSON file.
+		 */
+		void Export(const std::filesystem::path& path) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of stage samples containing the times of a profile scope.
+		 */
+		struct StageSamples {
+
+		public:
+
+			/**
+			 The name of the profile scope.
+			 */
+			const char* m_name = nullptr;
+
+			/**
+			 The nesting depth of the profile scope.
+			 */
+			U32 m_depth = 0u;
+
+			/**
+			 The times (in milliseconds) of the profile scope per recorded
+			 frame.
+			 */
+			std::vector< F64 > m_times;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The benchmark setup of this benchmark recorder.
+		 */
+		BenchmarkSetup m_setup;
+
+		/**
+		 The recorded benchmark frames of this benchmark recorder.
+		 */
+		std::vector< BenchmarkFrame > m_frames;
+
+		/**
+		 The stage samples of this benchmark recorder.
+		 */
+		std::vector< StageSamples > m_stages;
+
+		/**
+		 A mapping between the profile scope names and the indices of the
+		 stage samples of this benchmark recorder.
+		 */
+		std::unordered_map< const char*, std::size_t > m_stage_indices;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
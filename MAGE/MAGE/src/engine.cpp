@@ -3,13 +3,18 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "display\display_configurator.hpp"
-#include "exception\exception.hpp"
+#include "display/display_configurator.hpp"
+#include "exception/exception.hpp"
 #include "imgui_window_message_listener.hpp"
-#include "logging\dump.hpp"
-#include "meta\targetver.hpp"
-#include "meta\version.hpp"
-#include "scene\scene.hpp"
+#include "logging/async_logger.hpp"
+#include "logging/dump.hpp"
+#include "memory/allocation_counter.hpp"
+#include "meta/targetver.hpp"
+#include "meta/version.hpp"
+#include "renderer/pipeline.hpp"
+#include "scene/scene.hpp"
+#include "system/profiler.hpp"
+#include "system/telemetry.hpp"
 
 #pragma endregion
 
@@ -118,6 +123,40 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
+	namespace {
+
+		/**
+		 Records the engine telemetry of the previous frame and takes the
+		 telemetry snapshot of the previous frame.
+
+		 @param[in]		time
+						A reference to the game time of the previous frame.
+		 @param[in]		frame_statistics
+						A reference to the frame time statistics.
+		 */
+		void NextTelemetryFrame(const GameTime& time,
+								const FrameStatistics& frame_statistics) {
+			static auto& s_nb_allocations
+				= Telemetry::Get().GetGauge("Allocations");
+			static auto& s_frame_time
+				= Telemetry::Get().GetHistogram("Frame time (us)");
+			static auto& s_frame_jitter
+				= Telemetry::Get().GetGauge("Frame jitter (ms)");
+			static auto s_prev_nb_allocations = GetNumberOfAllocations();
+
+			const auto nb_allocations = GetNumberOfAllocations();
+			s_nb_allocations.Set(static_cast< F64 >(nb_allocations
+				                                    - s_prev_nb_allocations));
+			s_prev_nb_allocations = nb_allocations;
+
+			s_frame_time.Record(static_cast< U64 >(
+				1000000.0 * time.GetWallClockDeltaTime().count()));
+			s_frame_jitter.Set(frame_statistics.m_jitter);
+
+			Telemetry::Get().NextFrame();
+		}
+	}
+
 	Engine::Engine(const EngineSetup& setup,
 				   const rendering::DisplayConfiguration& display_config)
 		: m_window(),
@@ -128,6 +167,9 @@ namespace mage {
 		m_requested_scene(),
 		m_timer(),
 		m_time(),
+		m_frame_limiter(),
+		m_input_recording_path(setup.GetInputRecordingPath()),
+		m_input_frames(),
 		m_fixed_delta_time(TimeIntervalSeconds::zero()),
 		m_fixed_time_budget(TimeIntervalSeconds::zero()),
 		m_deactive(false),
@@ -148,6 +190,9 @@ namespace mage {
 	void Engine::InitializeSystems(const EngineSetup& setup,
 								   const rendering::DisplayConfiguration& display_config) {
 
+		// Calibrate the time stamp counter before any timer is started.
+		TSCClock::Calibrate();
+
 		// Initialize the window.
 		{
 			auto window_desc
@@ -158,6 +203,12 @@ namespace mage {
 											display_config.GetDisplayResolution());
 
 			m_message_handler.m_on_active_change = [this](bool deactive) {
+				// DXGI may leave or restore the full screen mode of the swap
+				// chain on (de)activation.
+				if (m_rendering_manager) {
+					m_rendering_manager->Flush();
+				}
+
 				m_deactive = deactive;
 
 				if (m_deactive) {
@@ -165,6 +216,7 @@ namespace mage {
 				}
 				else {
 					m_timer.Resume();
+					m_frame_limiter.Restart();
 				}
 			};
 
@@ -173,6 +225,8 @@ namespace mage {
 			};
 
 			m_message_handler.m_on_print_screen  = [this]() {
+				m_rendering_manager->Flush();
+
 				auto& swap_chain = m_rendering_manager->GetSwapChain();
 				const auto fname = L"screenshot-" + GetLocalSystemDateAndTimeAsString()
 					             + L".png";
@@ -191,8 +245,14 @@ namespace mage {
 		m_input_manager = MakeUnique< input::Manager >(window);
 
 		// Initialize the rendering system.
-		m_rendering_manager = MakeUnique< rendering::Manager >(window, display_config);
+		auto rendering_config = display_config;
+		rendering_config.SetTargetFrameTime(setup.GetTargetGPUFrameTime());
+		m_rendering_manager = MakeUnique< rendering::Manager >(window, rendering_config);
 		m_rendering_manager->BindPersistentState();
+		m_rendering_manager->SetPipelined(setup.IsPipelined());
+
+		// Initialize the frame limiter.
+		m_frame_limiter.SetTargetFrameRate(setup.GetTargetFrameRate());
 
 		// Initializes the COM library for use by the calling thread and sets
 		// the thread's concurrency model to multithreaded concurrency.
@@ -222,6 +282,9 @@ namespace mage {
 	}
 
 	void Engine::ApplyRequestedScene() {
+		// Discard the pending resource load actions of the current scene.
+		m_rendering_manager->GetResourceManager().CancelCallbacks();
+
 		if (m_scene) {
 			m_scene->Uninitialize(*this);
 		}
@@ -259,6 +322,7 @@ namespace mage {
 		auto& swap_chain     = m_rendering_manager->GetSwapChain();
 		const auto lost_mode = swap_chain.LostMode();
 		if (m_mode_switch || lost_mode) {
+			m_rendering_manager->Flush();
 			swap_chain.SwitchMode(!lost_mode);
 			m_mode_switch = false;
 			return true;
@@ -272,10 +336,20 @@ namespace mage {
 
 	[[nodiscard]]
 	bool Engine::UpdateScripting() {
+		MAGE_PROFILE_SCOPE("Engine::UpdateScripting");
+
 		// Perform the fixed delta time updates of the current scene.
 		if (TimeIntervalSeconds::zero() != m_fixed_delta_time) {
 			m_fixed_time_budget += m_time.GetWallClockDeltaTime();
 			while (m_fixed_time_budget >= m_fixed_delta_time) {
+				// Store the local transforms before the fixed delta time
+				// update for the interpolation (if any).
+				if (0u != Transform::GetNumberOfInterpolatedTransforms()) {
+					m_scene->ForEach< Node >([](Node& node) noexcept {
+						node.GetTransform().StorePreviousTransform();
+					});
+				}
+
 				m_scene->ForEach< BehaviorScript >([this](BehaviorScript& script) {
 					if (State::Active == script.GetState()) {
 						script.FixedUpdate(*this);
@@ -314,12 +388,37 @@ namespace mage {
 		return false;
 	}
 
+	void Engine::Render() {
+		// Transforms are only interpolated between fixed delta time
+		// updates. The nodes are not traversed if no transform is
+		// interpolated.
+		if (TimeIntervalSeconds::zero() == m_fixed_delta_time
+			|| 0u == Transform::GetNumberOfInterpolatedTransforms()) {
+
+			m_rendering_manager->Render(m_time);
+			return;
+		}
+
+		const auto alpha = static_cast< F32 >(m_fixed_time_budget
+											  / m_fixed_delta_time);
+		m_scene->ForEach< Node >([alpha](Node& node) noexcept {
+			node.GetTransform().ApplyInterpolation(alpha);
+		});
+
+		m_rendering_manager->Render(m_time);
+
+		m_scene->ForEach< Node >([](Node& node) noexcept {
+			node.GetTransform().RevertInterpolation();
+		});
+	}
+
 	[[nodiscard]]
 	int Engine::Run(UniquePtr< Scene >&& scene, int nCmdShow) {
 		// Show the main window.
 		m_window->Show(nCmdShow);
 
 		// Handle startup in fullscreen mode.
+		m_rendering_manager->Flush();
 		auto& swap_chain = m_rendering_manager->GetSwapChain();
 		swap_chain.SetInitialMode();
 
@@ -346,11 +445,18 @@ namespace mage {
 				continue;
 			}
 
-			// Check if the main window is deactive.
+			// Block until the next message while the main window is
+			// deactive, instead of spinning through the message loop.
 			if (m_deactive) {
+				WaitMessage();
 				continue;
 			}
 
+			// Collect the profile events of the previous frame.
+			MAGE_PROFILE_FRAME();
+			NextTelemetryFrame(m_time, m_frame_limiter.GetStatistics());
+			MAGE_PROFILE_SCOPE("Engine::Run");
+
 			if (UpdateInput()) {
 				continue;
 			}
@@ -362,16 +468,153 @@ namespace mage {
 				continue;
 			}
 
+			// Record the input state and the delta time of the frames whose
+			// scripts are updated, so that a replay updates the scripts with
+			// the same input states and delta times.
+			if (!m_input_recording_path.empty()) {
+				m_input_frames.push_back({
+					m_time.GetWallClockDeltaTime().count(),
+					m_input_manager->GetState()
+				});
+			}
+
 			if (UpdateScripting()) {
 				continue;
 			}
 
-			m_rendering_manager->Render(m_time);
+			Render();
+
+			// Pace the frames at the target frame rate.
+			m_frame_limiter.Wait();
+		}
+
+		if (!m_input_recording_path.empty()) {
+			input::ExportInputRecordingToFile(m_input_recording_path,
+											  m_input_frames);
 		}
 
 		return static_cast< int >(msg.wParam);
 	}
 
+	[[nodiscard]]
+	int Engine::RunBenchmark(UniquePtr< Scene >&& scene,
+							 const BenchmarkSetup& setup) {
+
+		// The engine window is never shown and the input devices are never
+		// polled, so the frames only depend on the benchmark setup. The
+		// frames are rendered on this thread, so that the measurements of
+		// each frame include its rendering.
+		m_rendering_manager->SetPipelined(false);
+
+		RequestScene(std::move(scene));
+		ApplyRequestedScene();
+		// Check if the engine is finished.
+		if (!m_scene) {
+			return 1;
+		}
+
+		std::vector< input::InputFrame > input_frames;
+		if (!setup.m_input_path.empty()) {
+			input::ImportInputRecordingFromFile(setup.m_input_path,
+												input_frames);
+		}
+		const bool replay = !input_frames.empty();
+
+		BenchmarkRecorder recorder(setup);
+		const auto nb_frames  = replay
+			? input_frames.size()
+			: setup.m_nb_warmup_frames + setup.m_nb_frames;
+		auto delta_time       = setup.m_delta_time;
+		auto total_delta_time = TimeIntervalSeconds::zero();
+
+		MSG msg;
+		SecureZeroMemory(&msg, sizeof(msg));
+		for (std::size_t frame = 0u; frame < nb_frames; ++frame) {
+
+			// Dispatch the pending window messages without waiting.
+			while (PeekMessage(&msg, nullptr, 0u, 0u, PM_REMOVE)) {
+				if (WM_QUIT == msg.message) {
+					return 1;
+				}
+
+				TranslateMessage(&msg);
+				DispatchMessage(&msg);
+			}
+
+			const auto nb_allocations     = GetNumberOfAllocations();
+			const auto nb_allocated_bytes = GetNumberOfAllocatedBytes();
+			const auto begin              = Profiler::Now();
+			{
+				MAGE_PROFILE_SCOPE("Engine::Run");
+
+				// Replay the recorded input state and delta time.
+				if (replay) {
+					const auto& input_frame = input_frames[frame];
+					m_input_manager->Update(input_frame.m_state);
+					delta_time = TimeIntervalSeconds(input_frame.m_delta_time);
+				}
+
+				// Advance the time with the (fixed) delta time.
+				total_delta_time += delta_time;
+				m_time = GameTime(delta_time, total_delta_time,
+								  delta_time, total_delta_time);
+
+				m_rendering_manager->Update();
+
+				if (UpdateScripting()) {
+					return 1;
+				}
+
+				// Drive the camera after the scripts to override any camera
+				// scripts.
+				if (!setup.m_camera_path.empty()) {
+					const auto keyframe = SampleCameraPath(
+						setup.m_camera_path, total_delta_time.count());
+
+					bool driven = false;
+					m_rendering_manager->GetWorld().ForEach< rendering::Camera >(
+						[&driven, &keyframe](rendering::Camera& camera) {
+							if (driven || State::Active != camera.GetState()) {
+								return;
+							}
+
+							auto& transform = camera.GetOwner()->GetTransform();
+							transform.SetTranslation(keyframe.m_translation);
+							transform.SetRotation(keyframe.m_rotation);
+							driven = true;
+						});
+				}
+
+				Render();
+			}
+			const auto end = Profiler::Now();
+
+			// Collect the profile events of this frame.
+			MAGE_PROFILE_FRAME();
+
+			if (frame < setup.m_nb_warmup_frames) {
+				continue;
+			}
+
+			BenchmarkFrame measurement;
+			measurement.m_frame_time         = (end - begin) * 0.000001;
+			measurement.m_nb_allocations     = GetNumberOfAllocations()
+				                             - nb_allocations;
+			measurement.m_nb_allocated_bytes = GetNumberOfAllocatedBytes()
+				                             - nb_allocated_bytes;
+			const auto statistics = m_rendering_manager->GetPipelineStatistics();
+			measurement.m_nb_draws           = statistics.m_nb_draws;
+			measurement.m_nb_culling_tests   = statistics.m_nb_culling_tests;
+			measurement.m_nb_culled          = statistics.m_nb_culled;
+
+			recorder.Record(measurement, Profiler::Get().GetStatistics());
+		}
+
+		recorder.Export(setup.m_output_path);
+
+		return 0;
+	}
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -379,20 +622,34 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	UniquePtr< Engine > CreateEngine(const EngineSetup& setup) {
-		#ifdef _DEBUG
-		const int debug_flags = _CrtSetDbgFlag(_CRTDBG_REPORT_FLAG);
-		// Perform automatic leak checking at program exit through a call to
-		// _CrtDumpMemoryLeaks and generate an error report if the application
-		// failed to free all the memory it allocated.
-		_CrtSetDbgFlag(debug_flags | _CRTDBG_LEAK_CHECK_DF);
-		#endif
-
-		AddUnhandledExceptionFilter();
+	namespace {
+
+		/**
+		 Initializes the application (i.e. the leak checking, the unhandled
+		 exception filter and the console) before constructing an engine.
+		 */
+		void InitializeApplication() {
+			#ifdef _DEBUG
+			const int debug_flags = _CrtSetDbgFlag(_CRTDBG_REPORT_FLAG);
+			// Perform automatic leak checking at program exit through a call
+			// to _CrtDumpMemoryLeaks and generate an error report if the
+			// application failed to free all the memory it allocated.
+			_CrtSetDbgFlag(debug_flags | _CRTDBG_LEAK_CHECK_DF);
+			#endif
+
+			AddUnhandledExceptionFilter();
+
+			// Initialize a console.
+			InitializeConsole();
+			PrintConsoleHeader();
+
+			// Write the log messages to the console on a drain thread.
+			AsyncLogger::Get().Start(LogOverflowPolicy::Count);
+		}
+	}
 
-		// Initialize a console.
-		InitializeConsole();
-		PrintConsoleHeader();
+	UniquePtr< Engine > CreateEngine(const EngineSetup& setup) {
+		InitializeApplication();
 
 		// Enumerate the display configurations.
 		auto configurator = MakeUnique< rendering::DisplayConfigurator >();
@@ -409,5 +666,20 @@ namespace mage {
 		return MakeUnique< Engine >(setup, *config);
 	}
 
+	UniquePtr< Engine > CreateBenchmarkEngine(const EngineSetup& setup,
+											  const BenchmarkSetup& benchmark_setup) {
+
+		if (!benchmark_setup.m_software_rendering) {
+			return CreateEngine(setup);
+		}
+
+		InitializeApplication();
+
+		// Construct an engine using the WARP software adapter.
+		const auto config = rendering::CreateSoftwareDisplayConfiguration(
+			benchmark_setup.m_resolution);
+		return MakeUnique< Engine >(setup, config);
+	}
+
 	#pragma endregion
 }
@@ -5,10 +5,12 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "benchmark.hpp"
 #include "engine_setup.hpp"
-#include "input_manager.hpp"
+#include "input_recording.hpp"
 #include "rendering_manager.hpp"
-#include "ui\window.hpp"
+#include "system/frame_limiter.hpp"
+#include "ui/window.hpp"
 
 #pragma endregion
 
@@ -221,6 +223,31 @@ namespace mage {
 		[[nodiscard]]
 		int Run(UniquePtr< Scene >&& scene, int nCmdShow = SW_NORMAL);
 
+		/**
+		 Runs this engine in benchmark mode.
+
+		 The given scene is run for a fixed number of frames with a fixed
+		 delta time, without showing the engine window and without polling
+		 the input devices. If the given benchmark setup has an input
+		 recording, its input states and delta times are replayed instead.
+		 The first camera of the scene is driven along the camera path of
+		 the given benchmark setup. The frame times, profile
+		 stage times, allocations and culling statistics of the measured
+		 frames are exported to a JSON report.
+
+		 @param[in]		scene
+						A reference to the benchmark scene.
+		 @param[in]		setup
+						A reference to the benchmark setup.
+		 @return		@c 0 if the benchmark succeeded.
+		 @return		@c 1 if the scene terminated before all frames were
+						rendered.
+		 @throws		Exception
+						Failed to export the benchmark report.
+		 */
+		[[nodiscard]]
+		int RunBenchmark(UniquePtr< Scene >&& scene, const BenchmarkSetup& setup);
+
 		/**
 		 Returns the input manager of this engine.
 
@@ -268,6 +295,57 @@ namespace mage {
 			return m_time;
 		}
 
+		/**
+		 Returns the fixed delta time (in seconds) of this game engine.
+
+		 @return		The fixed delta time (in seconds) of this game engine.
+						Zero if fixed delta time updates are treated as
+						non-fixed delta time updates.
+		 */
+		[[nodiscard]]
+		TimeIntervalSeconds GetFixedDeltaTime() const noexcept {
+			return m_fixed_delta_time;
+		}
+
+		/**
+		 Sets the fixed delta time (in seconds) of this game engine to the
+		 given fixed delta time.
+
+		 Interpolated transforms (see @c Transform::SetInterpolated) are
+		 rendered between the local transforms before and after the last
+		 fixed delta time update, which allows the fixed delta time updates
+		 to run at a lower rate than the frames.
+
+		 @param[in]		fixed_delta_time
+						The fixed delta time (in seconds). Zero to treat
+						fixed delta time updates as non-fixed delta time
+						updates.
+		 */
+		void SetFixedDeltaTime(TimeIntervalSeconds fixed_delta_time) noexcept {
+			m_fixed_delta_time  = fixed_delta_time;
+			m_fixed_time_budget = TimeIntervalSeconds::zero();
+		}
+
+		/**
+		 Returns the frame limiter of this game engine.
+
+		 @return		A reference to the frame limiter of this game engine.
+		 */
+		[[nodiscard]]
+		WallClockFrameLimiter& GetFrameLimiter() noexcept {
+			return m_frame_limiter;
+		}
+
+		/**
+		 Returns the frame limiter of this game engine.
+
+		 @return		A reference to the frame limiter of this game engine.
+		 */
+		[[nodiscard]]
+		const WallClockFrameLimiter& GetFrameLimiter() const noexcept {
+			return m_frame_limiter;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -304,6 +382,15 @@ namespace mage {
 		[[nodiscard]]
 		bool UpdateScripting();
 
+		/**
+		 Renders the current scene of this engine. The interpolated
+		 transforms are interpolated for the duration of the rendering.
+
+		 @throws		Exception
+						Failed to render the current scene.
+		 */
+		void Render();
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -348,6 +435,21 @@ namespace mage {
 		 */
 		GameTime m_time;
 
+		/**
+		 The frame limiter of this engine.
+		 */
+		WallClockFrameLimiter m_frame_limiter;
+
+		/**
+		 The path of the input recording of this engine.
+		 */
+		std::filesystem::path m_input_recording_path;
+
+		/**
+		 The recorded input frames of this engine.
+		 */
+		std::vector< input::InputFrame > m_input_frames;
+
 		/**
 		 The fixed delta time (in seconds) of this engine.
 
@@ -390,5 +492,24 @@ namespace mage {
 
 	UniquePtr< Engine > CreateEngine(const EngineSetup& setup);
 
+	/**
+	 Creates an engine for running benchmarks.
+
+	 If the given benchmark setup uses software rendering, the display
+	 configuration dialog is skipped and the WARP software adapter is used at
+	 the resolution of the benchmark setup.
+
+	 @param[in]		setup
+					A reference to the engine setup.
+	 @param[in]		benchmark_setup
+					A reference to the benchmark setup.
+	 @return		A pointer to the engine. @c nullptr if the display
+					configuration was cancelled.
+	 @throws		Exception
+					Failed to create the engine.
+	 */
+	UniquePtr< Engine > CreateBenchmarkEngine(const EngineSetup& setup,
+											  const BenchmarkSetup& benchmark_setup);
+
 	#pragma endregion
 }
@@ -5,7 +5,16 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
 
 #pragma endregion
 
@@ -36,7 +45,11 @@ namespace mage {
 		explicit EngineSetup(NotNull< HINSTANCE > instance,
 							 std::wstring name = L"MAGE")
 			: m_instance(instance),
-			m_name(std::move(name)) {}
+			m_name(std::move(name)),
+			m_pipelined(false),
+			m_target_frame_rate(0.0),
+			m_target_gpu_frame_time(0.0),
+			m_input_recording_path() {}
 
 		/**
 		 Constructs an engine setup from the given engine setup.
@@ -107,6 +120,107 @@ namespace mage {
 			return m_name;
 		}
 
+		/**
+		 Checks whether the engine renders on a separate render thread
+		 pipelined with the scripting.
+
+		 @return		@c true if the engine renders on a separate render
+						thread. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsPipelined() const noexcept {
+			return m_pipelined;
+		}
+
+		/**
+		 Sets whether the engine renders on a separate render thread
+		 pipelined with the scripting (i.e. the scripts of the next frame
+		 are updated while the current frame is rendered).
+
+		 @param[in]		pipelined
+						@c true if the engine needs to render on a separate
+						render thread. @c false otherwise.
+		 */
+		void SetPipelined(bool pipelined) noexcept {
+			m_pipelined = pipelined;
+		}
+
+		/**
+		 Returns the target frame rate (in frames per second) of the engine.
+
+		 @return		The target frame rate (in frames per second) of the
+						engine. @c 0 if the frame rate is unlimited.
+		 */
+		[[nodiscard]]
+		F64 GetTargetFrameRate() const noexcept {
+			return m_target_frame_rate;
+		}
+
+		/**
+		 Sets the target frame rate (in frames per second) of the engine to
+		 the given frame rate.
+
+		 @param[in]		frame_rate
+						The target frame rate (in frames per second).
+						@c 0 to not limit the frame rate.
+		 */
+		void SetTargetFrameRate(F64 frame_rate) noexcept {
+			m_target_frame_rate = frame_rate;
+		}
+
+		/**
+		 Returns the target GPU frame time (in milliseconds) of the dynamic
+		 resolution of the engine.
+
+		 @return		The target GPU frame time (in milliseconds) of the
+						dynamic resolution of the engine. @c 0 if dynamic
+						resolution is disabled.
+		 */
+		[[nodiscard]]
+		F64 GetTargetGPUFrameTime() const noexcept {
+			return m_target_gpu_frame_time;
+		}
+
+		/**
+		 Sets the target GPU frame time (in milliseconds) of the dynamic
+		 resolution of the engine to the given frame time. The scene is
+		 rendered at a reduced resolution, which is selected from the
+		 measured GPU frame times, and upsampled before the sprites and GUI
+		 are rendered.
+
+		 @param[in]		frame_time
+						The target GPU frame time (in milliseconds). @c 0 to
+						disable dynamic resolution.
+		 */
+		void SetTargetGPUFrameTime(F64 frame_time) noexcept {
+			m_target_gpu_frame_time = frame_time;
+		}
+
+		/**
+		 Returns the path of the input recording of the engine.
+
+		 @return		A reference to the path of the input recording of the
+						engine. The path is empty if the input is not
+						recorded.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path& GetInputRecordingPath() const noexcept {
+			return m_input_recording_path;
+		}
+
+		/**
+		 Sets the path of the input recording of the engine to the given
+		 path. The input state and the delta time of each frame are recorded
+		 and exported to the given path when the engine stops running.
+
+		 @param[in]		path
+						The path of the input recording. An empty path to
+						not record the input.
+		 */
+		void SetInputRecordingPath(std::filesystem::path path) noexcept {
+			m_input_recording_path = std::move(path);
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -122,5 +236,27 @@ namespace mage {
 		 The name of the application.
 		 */
 		std::wstring m_name;
+
+		/**
+		 A flag indicating whether the engine renders on a separate render
+		 thread.
+		 */
+		bool m_pipelined;
+
+		/**
+		 The target frame rate (in frames per second) of the engine.
+		 */
+		F64 m_target_frame_rate;
+
+		/**
+		 The target GPU frame time (in milliseconds) of the dynamic resolution
+		 of the engine.
+		 */
+		F64 m_target_gpu_frame_time;
+
+		/**
+		 The path of the input recording of the engine.
+		 */
+		std::filesystem::path m_input_recording_path;
 	};
 }
\ No newline at end of file
@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\scene.hpp"
-#include "resource\model\material_factory.hpp"
+#include "scene/scene.hpp"
+#include "resource/model/material_factory.hpp"
 
 #pragma endregion
 
@@ -104,6 +104,7 @@ namespace mage {
 						   model_part.m_nb_indices,
 						   model_part.m_aabb,
 						   model_part.m_sphere);
+			model->SetClusters(model_part.m_clusters);
 
 			// Set the material of the model component.
 			const auto material = desc.GetMaterial(model_part.m_material);
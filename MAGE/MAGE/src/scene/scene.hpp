@@ -6,9 +6,9 @@
 #pragma region
 
 #include "engine.hpp"
-#include "scene\node.hpp"
-#include "scene\scene_utils.hpp"
-#include "scene\script\behavior_script.hpp"
+#include "scene/node.hpp"
+#include "scene/scene_utils.hpp"
+#include "scene/script/behavior_script.hpp"
 
 #pragma endregion
 
@@ -235,6 +235,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\scene.tpp"
+#include "scene/scene.tpp"
 
 #pragma endregion
\ No newline at end of file
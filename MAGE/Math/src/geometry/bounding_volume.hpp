@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "geometry\geometry.hpp"
+#include "geometry/geometry.hpp"
 
 #pragma endregion
 
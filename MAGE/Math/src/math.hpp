@@ -5,6 +5,6 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "directxmath\facade.hpp"
+#include "directxmath/facade.hpp"
 
 #pragma endregion
\ No newline at end of file
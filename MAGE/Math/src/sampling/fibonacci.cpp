@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "sampling\fibonacci.hpp"
+#include "sampling/fibonacci.hpp"
 
 #pragma endregion
 
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "sampling\primes.hpp"
-#include "logging\logging.hpp"
+#include "sampling/primes.hpp"
+#include "logging/logging.hpp"
 
 #pragma endregion
 
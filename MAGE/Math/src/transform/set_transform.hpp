@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "transform\transform_utils.hpp"
+#include "transform/transform_utils.hpp"
 
 #pragma endregion
 
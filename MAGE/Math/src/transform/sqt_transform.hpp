@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "transform\transform_utils.hpp"
+#include "transform/transform_utils.hpp"
 
 #pragma endregion
 
@@ -41,7 +41,7 @@ namespace mage {
 						The scale component.
 		 */
 		explicit S1QTTransform3D(const F32x3& translation = { 0.0f, 0.0f, 0.0f },
-			                     const F32x4& rotation    = { 1.0f, 0.0f, 0.0f, 0.0f },
+			                     const F32x4& rotation    = { 0.0f, 0.0f, 0.0f, 1.0f },
 			                     F32 scale = 1.0f) noexcept
 			: m_translation(translation),
 			m_scale(scale),
@@ -600,9 +600,9 @@ namespace mage {
 		[[nodiscard]]
 		const XMMATRIX XM_CALLCONV GetObjectToParentMatrix() const noexcept {
 			// Scale . Rotation . Translation
-			return GetAffineTransformationMatrix(GetScale(),
-				                                 GetRotation(),
-				                                 GetTranslation());
+			return GetQuaternionAffineTransformationMatrix(GetScale(),
+				                                           GetRotation(),
+				                                           GetTranslation());
 		}
 
 		/**
@@ -613,9 +613,9 @@ namespace mage {
 		[[nodiscard]]
 		const XMMATRIX XM_CALLCONV GetParentToObjectMatrix() const noexcept {
 			// Translation . Rotation . Scale
-			return GetInverseAffineTransformationMatrix(GetScale(),
-				                                        GetRotation(),
-				                                        GetTranslation());
+			return GetInverseQuaternionAffineTransformationMatrix(GetScale(),
+				                                                  GetRotation(),
+				                                                  GetTranslation());
 		}
 
 		/**
@@ -771,7 +771,7 @@ namespace mage {
 						A reference to the scale component.
 		 */
 		explicit SQTTransform3D(const F32x3& translation = { 0.0f, 0.0f, 0.0f },
-			                    const F32x4& rotation    = { 1.0f, 0.0f, 0.0f, 0.0f },
+			                    const F32x4& rotation    = { 0.0f, 0.0f, 0.0f, 1.0f },
 			                    const F32x3& scale       = { 1.0f, 1.0f, 1.0f }) noexcept
 			: m_translation(translation),
 			m_padding0{},
@@ -1521,9 +1521,9 @@ namespace mage {
 		[[nodiscard]]
 		const XMMATRIX XM_CALLCONV GetObjectToParentMatrix() const noexcept {
 			// Scale . Rotation . Translation
-			return GetAffineTransformationMatrix(GetScale(),
-				                                 GetRotation(),
-				                                 GetTranslation());
+			return GetQuaternionAffineTransformationMatrix(GetScale(),
+				                                           GetRotation(),
+				                                           GetTranslation());
 		}
 
 		/**
@@ -1534,9 +1534,9 @@ namespace mage {
 		[[nodiscard]]
 		const XMMATRIX XM_CALLCONV GetParentToObjectMatrix() const noexcept {
 			// Translation . Rotation . Scale
-			return GetInverseAffineTransformationMatrix(GetScale(),
-				                                        GetRotation(),
-				                                        GetTranslation());
+			return GetInverseQuaternionAffineTransformationMatrix(GetScale(),
+				                                                  GetRotation(),
+				                                                  GetTranslation());
 		}
 
 		/**
@@ -1671,5 +1671,29 @@ namespace mage {
 
 	static_assert(48u == sizeof(SQTTransform3D));
 
+	/**
+	 Interpolates between the given transforms. The translation and scale
+	 components are interpolated linearly, and the rotation components are
+	 interpolated spherically.
+
+	 @param[in]		from
+					A reference to the transform at @a alpha = 0.
+	 @param[in]		to
+					A reference to the transform at @a alpha = 1.
+	 @param[in]		alpha
+					The interpolation factor.
+	 @return		The interpolated transform.
+	 */
+	[[nodiscard]]
+	inline const SQTTransform3D Lerp(const SQTTransform3D& from,
+									 const SQTTransform3D& to,
+									 F32 alpha) noexcept {
+
+		return SQTTransform3D(
+			XMVectorLerp(from.GetTranslation(), to.GetTranslation(), alpha),
+			XMQuaternionSlerp(from.GetRotation(), to.GetRotation(), alpha),
+			XMVectorLerp(from.GetScale(), to.GetScale(), alpha));
+	}
+
 	#pragma endregion
 }
\ No newline at end of file
@@ -162,6 +162,61 @@ namespace mage {
 													translation);
 	}
 
+	[[nodiscard]]
+	inline const XMMATRIX XM_CALLCONV
+		GetQuaternionAffineTransformationMatrix(FXMVECTOR scale,
+												FXMVECTOR rotation,
+												FXMVECTOR translation) noexcept {
+
+		// Scale . Rotation . Translation
+		auto transformation = XMMatrixRotationQuaternion(rotation);
+		transformation.r[0u] *= XMVectorGetX(scale);
+		transformation.r[1u] *= XMVectorGetY(scale);
+		transformation.r[2u] *= XMVectorGetZ(scale);
+		transformation.r[3u] = XMVectorSetW(translation, 1.0f);
+		return transformation;
+	}
+
+	[[nodiscard]]
+	inline const XMMATRIX XM_CALLCONV
+		GetQuaternionAffineTransformationMatrix(F32       scale,
+												FXMVECTOR rotation,
+												FXMVECTOR translation) noexcept {
+
+		return GetQuaternionAffineTransformationMatrix(XMLoad(F32x3(scale)),
+													   rotation,
+													   translation);
+	}
+
+	[[nodiscard]]
+	inline const XMMATRIX XM_CALLCONV
+		GetInverseQuaternionAffineTransformationMatrix(FXMVECTOR scale,
+													   FXMVECTOR rotation,
+													   FXMVECTOR translation) noexcept {
+
+		// Translation . Rotation . Scale
+		auto transformation
+			= XMMatrixTranspose(XMMatrixRotationQuaternion(rotation));
+		const auto t = XMVector3TransformCoord(-translation, transformation);
+		const auto s = XMVectorSetW(XMVectorReciprocal(scale), 1.0f);
+		transformation.r[0u] *= s;
+		transformation.r[1u] *= s;
+		transformation.r[2u] *= s;
+		transformation.r[3u] = s * t;
+		return transformation;
+	}
+
+	[[nodiscard]]
+	inline const XMMATRIX XM_CALLCONV
+		GetInverseQuaternionAffineTransformationMatrix(F32       scale,
+													   FXMVECTOR rotation,
+													   FXMVECTOR translation) noexcept {
+
+		return GetInverseQuaternionAffineTransformationMatrix(XMLoad(F32x3(scale)),
+															  rotation,
+															  translation);
+	}
+
 	[[nodiscard]]
 	inline const XMMATRIX XM_CALLCONV
 		GetAffineTransformationMatrix(FXMVECTOR scale,
@@ -6,8 +6,8 @@
 #pragma region
 
 #include "direct3d11.hpp"
-#include "renderer\configuration.hpp"
-#include "type\types.hpp"
+#include "renderer/configuration.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -47,7 +47,8 @@ namespace mage::rendering {
 			m_display_mode(display_mode),
 			m_aa(AntiAliasing::None),
 			m_windowed(true),
-			m_vsync(false) {}
+			m_vsync(false),
+			m_target_frame_time(0.0) {}
 
 		/**
 		 Constructs a display configuration from the given display
@@ -425,6 +426,46 @@ namespace mage::rendering {
 			m_vsync = vsync;
 		}
 
+		//---------------------------------------------------------------------
+		// Member Methods: Dynamic Resolution
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this display configuration uses dynamic resolution.
+
+		 @return		@c true if this display configuration uses dynamic
+						resolution. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool UsesDynamicResolution() const noexcept {
+			return 0.0 < m_target_frame_time;
+		}
+
+		/**
+		 Returns the target GPU frame time (in milliseconds) of the dynamic
+		 resolution of this display configuration.
+
+		 @return		The target GPU frame time (in milliseconds) of the
+						dynamic resolution of this display configuration.
+						@c 0 if dynamic resolution is disabled.
+		 */
+		[[nodiscard]]
+		F64 GetTargetFrameTime() const noexcept {
+			return m_target_frame_time;
+		}
+
+		/**
+		 Sets the target GPU frame time (in milliseconds) of the dynamic
+		 resolution of this display configuration to the given frame time.
+
+		 @param[in]		target_frame_time
+						The target GPU frame time (in milliseconds). @c 0 to
+						disable dynamic resolution.
+		 */
+		void SetTargetFrameTime(F64 target_frame_time) noexcept {
+			m_target_frame_time = target_frame_time;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -484,5 +525,16 @@ namespace mage::rendering {
 		 configuration.
 		 */
 		bool m_vsync;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Dynamic Resolution
+		//---------------------------------------------------------------------
+
+		/**
+		 The target GPU frame time (in milliseconds) of the dynamic resolution
+		 of this display configuration. @c 0 if dynamic resolution is
+		 disabled.
+		 */
+		F64 m_target_frame_time;
 	};
 }
\ No newline at end of file
@@ -3,12 +3,12 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "collection\collection_utils.hpp"
-#include "display\display_configurator.hpp"
-#include "display\display_settings.hpp"
-#include "platform\windows_utils.hpp"
-#include "resource\script\variable_script.hpp"
-#include "ui\combo_box.hpp"
+#include "collection/collection_utils.hpp"
+#include "display/display_configurator.hpp"
+#include "display/display_settings.hpp"
+#include "platform/windows_utils.hpp"
+#include "resource/script/variable_script.hpp"
+#include "ui/combo_box.hpp"
 
 #pragma endregion
 
@@ -17,6 +17,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <dxgi1_4.h>
 #include <vector>
 #include <windowsx.h>
 
@@ -688,7 +689,7 @@ namespace mage::rendering {
 					break;
 				}
 				if (!selected_diplay_mode) {
-					Error("Selected display mode retrieval failed.");
+					MAGE_ERROR("Selected display mode retrieval failed.");
 
 					// Close the dialog.
 					EndDialog(dialog, IDCANCEL);
@@ -823,4 +824,42 @@ namespace mage::rendering {
 	}
 
 	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Factory
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	[[nodiscard]]
+	const DisplayConfiguration
+		CreateSoftwareDisplayConfiguration(const U32x2& resolution,
+										   DXGI_FORMAT pixel_format) {
+
+		ComPtr< IDXGIFactory4 > factory;
+		{
+			const HRESULT result = CreateDXGIFactory1(
+				__uuidof(IDXGIFactory4), (void**)factory.GetAddressOf());
+			ThrowIfFailed(result, "IDXGIFactory4 creation failed: {:08X}.", result);
+		}
+
+		// Get the WARP adapter.
+		ComPtr< DXGIAdapter > adapter;
+		{
+			const HRESULT result = factory->EnumWarpAdapter(
+				__uuidof(DXGIAdapter), (void**)adapter.GetAddressOf());
+			ThrowIfFailed(result, "WARP adapter creation failed: {:08X}.", result);
+		}
+
+		DXGI_MODE_DESC display_mode = {};
+		display_mode.Width                   = resolution[0];
+		display_mode.Height                  = resolution[1];
+		display_mode.RefreshRate.Numerator   = 60u;
+		display_mode.RefreshRate.Denominator = 1u;
+		display_mode.Format                  = pixel_format;
+
+		// The WARP adapter has no outputs and only supports windowed mode.
+		return DisplayConfiguration(std::move(adapter), nullptr, display_mode);
+	}
+
+	#pragma endregion
 }
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "display\display_configuration.hpp"
+#include "display/display_configuration.hpp"
 
 #pragma endregion
 
@@ -132,4 +132,23 @@ namespace mage::rendering {
 		 */
 		UniquePtr< Impl > m_impl;
 	};
+
+	/**
+	 Creates a display configuration for the Windows Advanced Rasterization
+	 Platform (WARP) software adapter. The display configuration uses the
+	 windowed mode without V-sync and anti-aliasing.
+
+	 @param[in]		resolution
+					The display resolution.
+	 @param[in]		pixel_format
+					The pixel format.
+	 @return		The display configuration for the WARP software adapter.
+	 @throws		Exception
+					Failed to create the WARP software adapter.
+	 */
+	[[nodiscard]]
+	const DisplayConfiguration
+		CreateSoftwareDisplayConfiguration(const U32x2& resolution,
+										   DXGI_FORMAT pixel_format
+										   = DXGI_FORMAT_R8G8B8A8_UNORM);
 }
\ No newline at end of file
@@ -0,0 +1,109 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/dds/dds_loader.hpp"
+#include "loaders/dds/dds_reader.hpp"
+#include "loaders/dds/dds_writer.hpp"
+#include "loaders/dds/dds_tokens.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	namespace {
+
+		/**
+		 Imports the texture descriptor from the DDS file associated with the
+		 given path.
+
+		 @param[in]		path
+						A reference to the path.
+		 @param[out]	desc
+						A reference to the texture descriptor.
+		 @return		The offset (in bytes) of the pixel data in the DDS
+						file.
+		 @throws		Exception
+						Failed to import the texture descriptor from file.
+		 */
+		std::size_t ImportHeader(const std::filesystem::path& path,
+								 TextureDescriptor& desc) {
+
+			constexpr std::size_t max_header_size = sizeof(U32)
+				                                  + sizeof(DDSHeader)
+				                                  + sizeof(DDSHeaderDXT10);
+
+			U8 header[max_header_size];
+			const auto nb_bytes = ReadBinaryFile(path, 0u, header);
+
+			std::size_t data_offset = 0u;
+			try {
+				DDSReader reader(desc, data_offset);
+				reader.ReadFromMemory(gsl::span< const U8 >(header, nb_bytes));
+			}
+			catch (const Exception& e) {
+				throw Exception("{}: {}", path, e.what());
+			}
+
+			return data_offset;
+		}
+	}
+
+	void ImportDDSTextureDescriptorFromFile(const std::filesystem::path& path,
+		                                    TextureDescriptor& desc) {
+
+		ImportHeader(path, desc);
+	}
+
+	void ImportDDSTextureFromFile(const std::filesystem::path& path,
+		                          TextureData& output,
+		                          U32 first_mip_level) {
+
+		// Read the header.
+		TextureDescriptor desc;
+		const auto data_offset = ImportHeader(path, desc);
+
+		// Compute the layout of all subresources in the DDS file.
+		const auto subresources = ComputeSubresources(desc);
+		first_mip_level = std::min(first_mip_level, desc.m_nb_mip_levels - 1u);
+
+		// Allocate the mip chain starting at the first mip level.
+		output.Initialize(GetMipChain(desc, first_mip_level));
+
+		// Read the mip chain of each texture array item.
+		for (U32 item = 0u; item < desc.m_array_size; ++item) {
+			const auto& first = subresources[first_mip_level
+				+ static_cast< std::size_t >(item) * desc.m_nb_mip_levels];
+			const auto& last  = subresources[desc.m_nb_mip_levels - 1u
+				+ static_cast< std::size_t >(item) * desc.m_nb_mip_levels];
+			const auto size   = last.m_offset + last.m_size - first.m_offset;
+
+			const auto index  = output.GetSubresourceIndex(0u, item);
+			const auto nb_bytes = ReadBinaryFile(
+				path, data_offset + first.m_offset,
+				gsl::span< U8 >(output.GetPixels(index), size));
+			ThrowIfFailed((size == nb_bytes),
+						  "{}: end of file: no pixel data found.", path);
+		}
+	}
+
+	void ExportDDSTextureToFile(const std::filesystem::path& path,
+								const TextureData& data) {
+
+		DDSWriter writer(data);
+		writer.WriteToFile(path);
+	}
+}
\ No newline at end of file
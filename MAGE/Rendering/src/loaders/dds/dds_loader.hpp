@@ -0,0 +1,78 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/texture/texture_data.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 Imports the texture descriptor from the DDS file associated with the
+	 given path. Only the header of the DDS file is read.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	desc
+					A reference to the texture descriptor.
+	 @throws		Exception
+					Failed to import the texture descriptor from file.
+	 */
+	void ImportDDSTextureDescriptorFromFile(const std::filesystem::path& path,
+		                                    TextureDescriptor& desc);
+
+	/**
+	 Imports the texture data from the DDS file associated with the given
+	 path.
+
+	 Only the mip levels starting at the given mip level are read (i.e. the
+	 less detailed part of the mip chain). The resulting texture data's most
+	 detailed mip level corresponds to the given mip level.
+
+	 This function does not use the rendering device and can be called from
+	 any thread.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	output
+					A reference to the texture data.
+	 @param[in]		first_mip_level
+					The first (i.e. most detailed) mip level to read. This
+					mip level is clamped to the least detailed mip level.
+	 @throws		Exception
+					Failed to import the texture data from file.
+	 */
+	void ImportDDSTextureFromFile(const std::filesystem::path& path,
+		                          TextureData& output,
+		                          U32 first_mip_level = 0u);
+
+	/**
+	 Exports the given texture data to the DDS file associated with the given
+	 path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[in]		data
+					A reference to the texture data.
+	 @throws		Exception
+					Failed to export the texture data to file.
+	 */
+	void ExportDDSTextureToFile(const std::filesystem::path& path,
+		                        const TextureData& data);
+}
\ No newline at end of file
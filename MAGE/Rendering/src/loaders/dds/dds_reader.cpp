@@ -0,0 +1,255 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/dds/dds_reader.hpp"
+#include "loaders/dds/dds_tokens.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	namespace {
+
+		/**
+		 Returns the DXGI format of the given (legacy) DDS pixel format.
+
+		 @param[in]		pixel_format
+						A reference to the DDS pixel format.
+		 @return		@c DXGI_FORMAT_UNKNOWN if the given DDS pixel format
+						has no matching DXGI format.
+		 @return		The DXGI format of the given DDS pixel format.
+		 */
+		[[nodiscard]]
+		DXGI_FORMAT GetFormat(const DDSPixelFormat& pixel_format) noexcept {
+			const auto IsBitMask = [&pixel_format](U32 r, U32 g, U32 b, U32 a) {
+				return pixel_format.m_r_bit_mask == r
+					&& pixel_format.m_g_bit_mask == g
+					&& pixel_format.m_b_bit_mask == b
+					&& pixel_format.m_a_bit_mask == a;
+			};
+
+			const auto flags     = pixel_format.m_flags;
+			const auto bit_count = pixel_format.m_rgb_bit_count;
+
+			if (flags & g_dds_flag_rgb) {
+				if (32u == bit_count) {
+					if (IsBitMask(0x000000FFu, 0x0000FF00u, 0x00FF0000u, 0xFF000000u)) {
+						return DXGI_FORMAT_R8G8B8A8_UNORM;
+					}
+					if (IsBitMask(0x00FF0000u, 0x0000FF00u, 0x000000FFu, 0xFF000000u)) {
+						return DXGI_FORMAT_B8G8R8A8_UNORM;
+					}
+					if (IsBitMask(0x00FF0000u, 0x0000FF00u, 0x000000FFu, 0x00000000u)) {
+						return DXGI_FORMAT_B8G8R8X8_UNORM;
+					}
+					// D3DX writes 10:10:10:2 formats with swapped red/blue masks.
+					if (IsBitMask(0x3FF00000u, 0x000FFC00u, 0x000003FFu, 0xC0000000u)) {
+						return DXGI_FORMAT_R10G10B10A2_UNORM;
+					}
+					if (IsBitMask(0x0000FFFFu, 0xFFFF0000u, 0x00000000u, 0x00000000u)) {
+						return DXGI_FORMAT_R16G16_UNORM;
+					}
+					if (IsBitMask(0xFFFFFFFFu, 0x00000000u, 0x00000000u, 0x00000000u)) {
+						return DXGI_FORMAT_R32_FLOAT;
+					}
+				}
+				else if (16u == bit_count) {
+					if (IsBitMask(0x7C00u, 0x03E0u, 0x001Fu, 0x8000u)) {
+						return DXGI_FORMAT_B5G5R5A1_UNORM;
+					}
+					if (IsBitMask(0xF800u, 0x07E0u, 0x001Fu, 0x0000u)) {
+						return DXGI_FORMAT_B5G6R5_UNORM;
+					}
+					if (IsBitMask(0x0F00u, 0x00F0u, 0x000Fu, 0xF000u)) {
+						return DXGI_FORMAT_B4G4R4A4_UNORM;
+					}
+				}
+			}
+			else if (flags & g_dds_flag_luminance) {
+				if (8u == bit_count) {
+					if (IsBitMask(0x000000FFu, 0x00000000u, 0x00000000u, 0x00000000u)) {
+						return DXGI_FORMAT_R8_UNORM;
+					}
+					if (IsBitMask(0x000000FFu, 0x00000000u, 0x00000000u, 0x0000FF00u)) {
+						return DXGI_FORMAT_R8G8_UNORM;
+					}
+				}
+				else if (16u == bit_count) {
+					if (IsBitMask(0x0000FFFFu, 0x00000000u, 0x00000000u, 0x00000000u)) {
+						return DXGI_FORMAT_R16_UNORM;
+					}
+					if (IsBitMask(0x000000FFu, 0x00000000u, 0x00000000u, 0x0000FF00u)) {
+						return DXGI_FORMAT_R8G8_UNORM;
+					}
+				}
+			}
+			else if (flags & g_dds_flag_alpha) {
+				if (8u == bit_count) {
+					return DXGI_FORMAT_A8_UNORM;
+				}
+			}
+			else if (flags & g_dds_flag_bumpdudv) {
+				if (16u == bit_count) {
+					if (IsBitMask(0x00FFu, 0xFF00u, 0x0000u, 0x0000u)) {
+						return DXGI_FORMAT_R8G8_SNORM;
+					}
+				}
+				else if (32u == bit_count) {
+					if (IsBitMask(0x000000FFu, 0x0000FF00u, 0x00FF0000u, 0xFF000000u)) {
+						return DXGI_FORMAT_R8G8B8A8_SNORM;
+					}
+					if (IsBitMask(0x0000FFFFu, 0xFFFF0000u, 0x00000000u, 0x00000000u)) {
+						return DXGI_FORMAT_R16G16_SNORM;
+					}
+				}
+			}
+			else if (flags & g_dds_flag_fourcc) {
+				switch (pixel_format.m_fourcc) {
+
+				case MakeFourCC('D', 'X', 'T', '1'):
+					return DXGI_FORMAT_BC1_UNORM;
+				// Premultiplied alpha is stored the same way.
+				case MakeFourCC('D', 'X', 'T', '2'):
+				case MakeFourCC('D', 'X', 'T', '3'):
+					return DXGI_FORMAT_BC2_UNORM;
+				case MakeFourCC('D', 'X', 'T', '4'):
+				case MakeFourCC('D', 'X', 'T', '5'):
+					return DXGI_FORMAT_BC3_UNORM;
+				case MakeFourCC('A', 'T', 'I', '1'):
+				case MakeFourCC('B', 'C', '4', 'U'):
+					return DXGI_FORMAT_BC4_UNORM;
+				case MakeFourCC('B', 'C', '4', 'S'):
+					return DXGI_FORMAT_BC4_SNORM;
+				case MakeFourCC('A', 'T', 'I', '2'):
+				case MakeFourCC('B', 'C', '5', 'U'):
+					return DXGI_FORMAT_BC5_UNORM;
+				case MakeFourCC('B', 'C', '5', 'S'):
+					return DXGI_FORMAT_BC5_SNORM;
+				// D3DFORMAT enumeration values
+				case 36u:  // D3DFMT_A16B16G16R16
+					return DXGI_FORMAT_R16G16B16A16_UNORM;
+				case 110u: // D3DFMT_Q16W16V16U16
+					return DXGI_FORMAT_R16G16B16A16_SNORM;
+				case 111u: // D3DFMT_R16F
+					return DXGI_FORMAT_R16_FLOAT;
+				case 112u: // D3DFMT_G16R16F
+					return DXGI_FORMAT_R16G16_FLOAT;
+				case 113u: // D3DFMT_A16B16G16R16F
+					return DXGI_FORMAT_R16G16B16A16_FLOAT;
+				case 114u: // D3DFMT_R32F
+					return DXGI_FORMAT_R32_FLOAT;
+				case 115u: // D3DFMT_G32R32F
+					return DXGI_FORMAT_R32G32_FLOAT;
+				case 116u: // D3DFMT_A32B32G32R32F
+					return DXGI_FORMAT_R32G32B32A32_FLOAT;
+				default:
+					break;
+
+				}
+			}
+
+			return DXGI_FORMAT_UNKNOWN;
+		}
+	}
+
+	DDSReader::DDSReader(TextureDescriptor& desc, std::size_t& data_offset)
+		: BigEndianBinaryReader(),
+		m_desc(desc),
+		m_data_offset(data_offset) {}
+
+	DDSReader::DDSReader(DDSReader&& reader) noexcept = default;
+
+	DDSReader::~DDSReader() = default;
+
+	void DDSReader::ReadData() {
+		// Read the header.
+		ThrowIfFailed((g_dds_token_magic == Read< U32 >()),
+					  "{}: invalid DDS magic number.", GetPath());
+
+		const auto header = Read< DDSHeader >();
+		ThrowIfFailed((sizeof(DDSHeader)      == header.m_size
+					   && sizeof(DDSPixelFormat) == header.m_pixel_format.m_size),
+					  "{}: invalid DDS header.", GetPath());
+
+		TextureDescriptor desc;
+		desc.m_dimension     = D3D11_RESOURCE_DIMENSION_TEXTURE2D;
+		desc.m_width         = header.m_width;
+		desc.m_height        = header.m_height;
+		desc.m_depth         = std::max(header.m_depth, 1u);
+		desc.m_array_size    = 1u;
+		desc.m_nb_mip_levels = std::max(header.m_mip_map_count, 1u);
+		m_data_offset        = sizeof(U32) + sizeof(DDSHeader);
+
+		if ((header.m_pixel_format.m_flags & g_dds_flag_fourcc)
+			&& g_dds_token_dx10 == header.m_pixel_format.m_fourcc) {
+
+			// Read the header extension.
+			const auto header_dxt10 = Read< DDSHeaderDXT10 >();
+			m_data_offset += sizeof(DDSHeaderDXT10);
+
+			desc.m_format     = header_dxt10.m_format;
+			desc.m_array_size = header_dxt10.m_array_size;
+			desc.m_dimension  = static_cast< D3D11_RESOURCE_DIMENSION >(
+									header_dxt10.m_resource_dimension);
+
+			switch (desc.m_dimension) {
+
+			case D3D11_RESOURCE_DIMENSION_TEXTURE1D:
+				desc.m_height = desc.m_depth = 1u;
+				break;
+			case D3D11_RESOURCE_DIMENSION_TEXTURE2D:
+				if (header_dxt10.m_misc_flags & D3D11_RESOURCE_MISC_TEXTURECUBE) {
+					desc.m_array_size *= 6u;
+					desc.m_cube_map = true;
+				}
+				desc.m_depth = 1u;
+				break;
+			case D3D11_RESOURCE_DIMENSION_TEXTURE3D:
+				ThrowIfFailed((0u != (header.m_flags & g_dds_flag_volume)),
+							  "{}: invalid DDS volume texture.", GetPath());
+				break;
+			default:
+				throw Exception("{}: unsupported DDS resource dimension: {}.",
+								GetPath(), header_dxt10.m_resource_dimension);
+
+			}
+		}
+		else {
+			desc.m_format = GetFormat(header.m_pixel_format);
+
+			if (header.m_flags & g_dds_flag_volume) {
+				desc.m_dimension = D3D11_RESOURCE_DIMENSION_TEXTURE3D;
+			}
+			else {
+				if (header.m_caps2 & g_dds_flag_cube_map) {
+					// All six faces must be defined.
+					ThrowIfFailed((g_dds_flag_cube_map_all_faces
+								   == (header.m_caps2 & g_dds_flag_cube_map_all_faces)),
+								  "{}: incomplete DDS cube map.", GetPath());
+					desc.m_array_size = 6u;
+					desc.m_cube_map   = true;
+				}
+				desc.m_depth = 1u;
+			}
+		}
+
+		ThrowIfFailed((DXGI_FORMAT_UNKNOWN != desc.m_format),
+					  "{}: unsupported DDS pixel format.", GetPath());
+
+		m_desc = desc;
+	}
+}
\ No newline at end of file
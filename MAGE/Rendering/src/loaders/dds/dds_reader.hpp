@@ -0,0 +1,122 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io/binary_reader.hpp"
+#include "resource/texture/texture_data.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of readers for reading the headers of DDS files.
+	 */
+	class DDSReader : private BigEndianBinaryReader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a DDS reader.
+
+		 @param[out]	desc
+						A reference to the texture descriptor.
+		 @param[out]	data_offset
+						A reference to the offset (in bytes) of the pixel data
+						in the DDS file.
+		*/
+		explicit DDSReader(TextureDescriptor& desc, std::size_t& data_offset);
+
+		/**
+		 Constructs a DDS reader from the given DDS reader.
+
+		 @param[in]		reader
+						A reference to the DDS reader to copy.
+		 */
+		DDSReader(const DDSReader& reader) = delete;
+
+		/**
+		 Constructs a DDS reader by moving the given DDS reader.
+
+		 @param[in]		reader
+						A reference to the DDS reader to move.
+		 */
+		DDSReader(DDSReader&& reader) noexcept;
+
+		/**
+		 Destructs this DDS reader.
+		 */
+		~DDSReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given DDS reader to this DDS reader.
+
+		 @param[in]		reader
+						A reference to a DDS reader to copy.
+		 @return		A reference to the copy of the given DDS reader (i.e.
+						this DDS reader).
+		 */
+		DDSReader& operator=(const DDSReader& reader) = delete;
+
+		/**
+		 Moves the given DDS reader to this DDS reader.
+
+		 @param[in]		reader
+						A reference to a DDS reader to move.
+		 @return		A reference to the moved DDS reader (i.e. this DDS
+						reader).
+		 */
+		DDSReader& operator=(DDSReader&& reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using BigEndianBinaryReader::ReadFromFile;
+
+		using BigEndianBinaryReader::ReadFromMemory;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts reading.
+
+		 @throws		Exception
+						Failed to read from the given file.
+		 */
+		virtual void ReadData() override;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the texture descriptor of this DDS reader.
+		 */
+		TextureDescriptor& m_desc;
+
+		/**
+		 A reference to the offset (in bytes) of the pixel data in the DDS
+		 file of this DDS reader.
+		 */
+		std::size_t& m_data_offset;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "direct3d11.hpp"
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 Returns the four-character code of the given characters.
+
+	 @param[in]		c0
+					The first character.
+	 @param[in]		c1
+					The second character.
+	 @param[in]		c2
+					The third character.
+	 @param[in]		c3
+					The fourth character.
+	 @return		The four-character code of the given characters.
+	 */
+	[[nodiscard]]
+	constexpr U32 MakeFourCC(char c0, char c1, char c2, char c3) noexcept {
+		return  static_cast< U32 >(static_cast< U8 >(c0))
+			 | (static_cast< U32 >(static_cast< U8 >(c1)) <<  8u)
+			 | (static_cast< U32 >(static_cast< U8 >(c2)) << 16u)
+			 | (static_cast< U32 >(static_cast< U8 >(c3)) << 24u);
+	}
+
+	constexpr U32 g_dds_token_magic = MakeFourCC('D', 'D', 'S', ' ');
+	constexpr U32 g_dds_token_dx10  = MakeFourCC('D', 'X', '1', '0');
+
+	// DDS pixel format flags
+	constexpr U32 g_dds_flag_alpha       = 0x00000002u; // DDPF_ALPHA
+	constexpr U32 g_dds_flag_fourcc      = 0x00000004u; // DDPF_FOURCC
+	constexpr U32 g_dds_flag_rgb         = 0x00000040u; // DDPF_RGB
+	constexpr U32 g_dds_flag_luminance   = 0x00020000u; // DDPF_LUMINANCE
+	constexpr U32 g_dds_flag_bumpdudv    = 0x00080000u; // DDPF_BUMPDUDV
+
+	// DDS header flags
+	constexpr U32 g_dds_flag_caps        = 0x00000001u; // DDSD_CAPS
+	constexpr U32 g_dds_flag_height      = 0x00000002u; // DDSD_HEIGHT
+	constexpr U32 g_dds_flag_width       = 0x00000004u; // DDSD_WIDTH
+	constexpr U32 g_dds_flag_pixelformat = 0x00001000u; // DDSD_PIXELFORMAT
+	constexpr U32 g_dds_flag_mipmapcount = 0x00020000u; // DDSD_MIPMAPCOUNT
+	constexpr U32 g_dds_flag_linearsize  = 0x00080000u; // DDSD_LINEARSIZE
+	constexpr U32 g_dds_flag_volume      = 0x00800000u; // DDSD_DEPTH
+
+	// DDS caps flags
+	constexpr U32 g_dds_flag_complex     = 0x00000008u; // DDSCAPS_COMPLEX
+	constexpr U32 g_dds_flag_texture     = 0x00001000u; // DDSCAPS_TEXTURE
+	constexpr U32 g_dds_flag_mipmap      = 0x00400000u; // DDSCAPS_MIPMAP
+
+	// DDS caps2 flags
+	constexpr U32 g_dds_flag_cube_map    = 0x00000200u; // DDSCAPS2_CUBEMAP
+	constexpr U32 g_dds_flag_cube_map_all_faces = 0x0000FE00u;
+
+	#pragma pack(push, 1)
+
+	/**
+	 A struct of DDS pixel formats.
+	 */
+	struct DDSPixelFormat {
+		U32 m_size;
+		U32 m_flags;
+		U32 m_fourcc;
+		U32 m_rgb_bit_count;
+		U32 m_r_bit_mask;
+		U32 m_g_bit_mask;
+		U32 m_b_bit_mask;
+		U32 m_a_bit_mask;
+	};
+
+	/**
+	 A struct of DDS headers.
+	 */
+	struct DDSHeader {
+		U32 m_size;
+		U32 m_flags;
+		U32 m_height;
+		U32 m_width;
+		U32 m_pitch_or_linear_size;
+		U32 m_depth;
+		U32 m_mip_map_count;
+		U32 m_reserved1[11];
+		DDSPixelFormat m_pixel_format;
+		U32 m_caps;
+		U32 m_caps2;
+		U32 m_caps3;
+		U32 m_caps4;
+		U32 m_reserved2;
+	};
+
+	/**
+	 A struct of DDS (DX10) header extensions.
+	 */
+	struct DDSHeaderDXT10 {
+		DXGI_FORMAT m_format;
+		U32 m_resource_dimension;
+		U32 m_misc_flags;
+		U32 m_array_size;
+		U32 m_misc_flags2;
+	};
+
+	#pragma pack(pop)
+
+	static_assert(32u  == sizeof(DDSPixelFormat));
+	static_assert(124u == sizeof(DDSHeader));
+	static_assert(20u  == sizeof(DDSHeaderDXT10));
+}
\ No newline at end of file
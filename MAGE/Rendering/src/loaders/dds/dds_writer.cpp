@@ -0,0 +1,81 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/dds/dds_writer.hpp"
+#include "loaders/dds/dds_tokens.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	DDSWriter::DDSWriter(const TextureData& data)
+		: BigEndianBinaryWriter(),
+		m_data(data) {}
+
+	DDSWriter::DDSWriter(DDSWriter&& writer) noexcept = default;
+
+	DDSWriter::~DDSWriter() = default;
+
+	void DDSWriter::WriteData() {
+		const auto& desc = m_data.GetDescriptor();
+		ThrowIfFailed((!m_data.empty()),
+					  "{}: no DDS texture data.", GetPath());
+
+		// Write the header.
+		Write< U32 >(g_dds_token_magic);
+
+		DDSHeader header = {};
+		header.m_size                  = sizeof(DDSHeader);
+		header.m_flags                 = g_dds_flag_caps
+			                           | g_dds_flag_height
+			                           | g_dds_flag_width
+			                           | g_dds_flag_pixelformat
+			                           | g_dds_flag_mipmapcount
+			                           | g_dds_flag_linearsize;
+		header.m_height                = desc.m_height;
+		header.m_width                 = desc.m_width;
+		header.m_pitch_or_linear_size  = static_cast< U32 >(
+			                             m_data.GetSubresource(0u).m_size);
+		header.m_depth                 = desc.m_depth;
+		header.m_mip_map_count         = desc.m_nb_mip_levels;
+		header.m_pixel_format.m_size   = sizeof(DDSPixelFormat);
+		header.m_pixel_format.m_flags  = g_dds_flag_fourcc;
+		header.m_pixel_format.m_fourcc = g_dds_token_dx10;
+		header.m_caps                  = g_dds_flag_texture;
+
+		if (1u < desc.m_nb_mip_levels) {
+			header.m_caps |= g_dds_flag_complex | g_dds_flag_mipmap;
+		}
+		if (D3D11_RESOURCE_DIMENSION_TEXTURE3D == desc.m_dimension) {
+			header.m_flags |= g_dds_flag_volume;
+		}
+		if (desc.m_cube_map) {
+			header.m_caps  |= g_dds_flag_complex;
+			header.m_caps2  = g_dds_flag_cube_map | g_dds_flag_cube_map_all_faces;
+		}
+
+		Write< DDSHeader >(header);
+
+		// Write the header extension.
+		DDSHeaderDXT10 header_dxt10 = {};
+		header_dxt10.m_format             = desc.m_format;
+		header_dxt10.m_resource_dimension = desc.m_dimension;
+		header_dxt10.m_array_size         = desc.m_array_size;
+
+		if (desc.m_cube_map) {
+			header_dxt10.m_misc_flags  = D3D11_RESOURCE_MISC_TEXTURECUBE;
+			header_dxt10.m_array_size /= 6u;
+		}
+
+		Write< DDSHeaderDXT10 >(header_dxt10);
+
+		// Write the pixel data. The subresources of texture data are stored
+		// in the same order and with the same pitches as in DDS files.
+		WriteArray(gsl::make_span(m_data.GetPixels(), m_data.GetSize()));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io/binary_writer.hpp"
+#include "resource/texture/texture_data.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of writers for writing DDS files. The DX10 header extension is
+	 always written.
+	 */
+	class DDSWriter : private BigEndianBinaryWriter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a DDS writer.
+
+		 @param[in]		data
+						A reference to the texture data.
+		 */
+		explicit DDSWriter(const TextureData& data);
+
+		/**
+		 Constructs a DDS writer from the given DDS writer.
+
+		 @param[in]		writer
+						A reference to the DDS writer to copy.
+		 */
+		DDSWriter(const DDSWriter& writer) = delete;
+
+		/**
+		 Constructs a DDS writer by moving the given DDS writer.
+
+		 @param[in]		writer
+						A reference to the DDS writer to move.
+		 */
+		DDSWriter(DDSWriter&& writer) noexcept;
+
+		/**
+		 Destructs this DDS writer.
+		 */
+		~DDSWriter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given DDS writer to this DDS writer.
+
+		 @param[in]		writer
+						A reference to a DDS writer to copy.
+		 @return		A reference to the copy of the given DDS writer (i.e.
+						this DDS writer).
+		 */
+		DDSWriter& operator=(const DDSWriter& writer) = delete;
+
+		/**
+		 Moves the given DDS writer to this DDS writer.
+
+		 @param[in]		writer
+						A reference to a DDS writer to move.
+		 @return		A reference to the moved DDS writer (i.e. this DDS
+						writer).
+		 */
+		DDSWriter& operator=(DDSWriter&& writer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using BigEndianBinaryReader::ReadFromFile;
+
+		using BigEndianBinaryReader::ReadFromMemory;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts writing.
+
+		 @throws		Exception
+						Failed to write.
+		 */
+		virtual void WriteData() override;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the texture data of this DDS writer.
+		 */
+		const TextureData& m_data;
+	};
+}
\ No newline at end of file
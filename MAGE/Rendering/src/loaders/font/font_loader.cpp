@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\font\font_loader.hpp"
-#include "loaders\font\font_reader.hpp"
+#include "loaders/font/font_loader.hpp"
+#include "loaders/font/font_reader.hpp"
 
 #pragma endregion
 
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\font\sprite_font_output.hpp"
-#include "resource\font\sprite_font_descriptor.hpp"
+#include "resource/font/sprite_font_output.hpp"
+#include "resource/font/sprite_font_descriptor.hpp"
 
 #pragma endregion
 
@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\font\font_reader.hpp"
-#include "loaders\font\font_tokens.hpp"
-#include "resource\texture\texture_format.hpp"
+#include "loaders/font/font_reader.hpp"
+#include "loaders/font/font_tokens.hpp"
+#include "resource/texture/texture_format.hpp"
 
 #pragma endregion
 
@@ -5,9 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\binary_reader.hpp"
-#include "resource\font\sprite_font_output.hpp"
-#include "resource\font\sprite_font_descriptor.hpp"
+#include "io/binary_reader.hpp"
+#include "resource/font/sprite_font_output.hpp"
+#include "resource/font/sprite_font_descriptor.hpp"
 
 #pragma endregion
 
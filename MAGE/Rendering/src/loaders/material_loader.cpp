@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\material_loader.hpp"
-#include "loaders\mtl\mtl_loader.hpp"
-#include "resource\rendering_resource_manager.hpp"
+#include "loaders/material_loader.hpp"
+#include "loaders/mtl/mtl_loader.hpp"
+#include "resource/rendering_resource_manager.hpp"
 
 #pragma endregion
 
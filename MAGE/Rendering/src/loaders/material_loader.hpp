@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\model\material.hpp"
+#include "resource/model/material.hpp"
 
 #pragma endregion
 
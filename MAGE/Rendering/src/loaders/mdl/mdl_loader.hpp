@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\model\model_output.hpp"
+#include "resource/model/model_output.hpp"
 
 #pragma endregion
 
@@ -64,6 +64,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mdl\mdl_loader.tpp"
+#include "loaders/mdl/mdl_loader.tpp"
 
 #pragma endregion
\ No newline at end of file
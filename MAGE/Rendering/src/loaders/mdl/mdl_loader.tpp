@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mdl\mdl_reader.hpp"
-#include "loaders\mdl\mdl_writer.hpp"
+#include "loaders/mdl/mdl_reader.hpp"
+#include "loaders/mdl/mdl_writer.hpp"
 
 #pragma endregion
 
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\line_reader.hpp"
-#include "resource\model\model_output.hpp"
+#include "io/line_reader.hpp"
+#include "resource/model/model_output.hpp"
 
 #pragma endregion
 
@@ -151,6 +151,14 @@ namespace mage::rendering::loader {
 		 */
 		void ReadMDLMaterialLibrary();
 
+		/**
+		 Reads a Cluster definition of the last Submodel definition.
+
+		 @throws		Exception
+						Failed to read a Cluster definition.
+		 */
+		void ReadMDLCluster();
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -165,6 +173,12 @@ namespace mage::rendering::loader {
 		 reader.
 		 */
 		ModelOutput< VertexT, IndexT >& m_model_output;
+
+		/**
+		 A flag indicating whether this MDL reader read any Cluster
+		 definitions.
+		 */
+		bool m_has_clusters;
 	};
 }
 
@@ -173,6 +187,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mdl\mdl_reader.tpp"
+#include "loaders/mdl/mdl_reader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,9 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\material_loader.hpp"
-#include "loaders\mdl\mdl_tokens.hpp"
-#include "loaders\msh\msh_loader.hpp"
+#include "loaders/material_loader.hpp"
+#include "loaders/mdl/mdl_tokens.hpp"
+#include "loaders/msh/msh_loader.hpp"
 
 #pragma endregion
 
@@ -22,7 +22,8 @@ namespace mage::rendering::loader {
 					ModelOutput< VertexT, IndexT >& model_output)
 		: LineReader(),
 		m_resource_manager(resource_manager),
-		m_model_output(model_output) {}
+		m_model_output(model_output),
+		m_has_clusters(false) {}
 
 	template< typename VertexT, typename IndexT >
 	MDLReader< VertexT, IndexT >::MDLReader(MDLReader&& reader) noexcept = default;
@@ -42,6 +43,11 @@ namespace mage::rendering::loader {
 	template< typename VertexT, typename IndexT >
 	void MDLReader< VertexT, IndexT >::Postprocess() {
 		m_model_output.ComputeBoundingVolumes();
+
+		// MDL files exported before model clusters were serialized.
+		if (!m_has_clusters) {
+			m_model_output.ComputeModelClusters();
+		}
 	}
 
 	template< typename VertexT, typename IndexT >
@@ -57,8 +63,11 @@ namespace mage::rendering::loader {
 		else if (g_mdl_token_material_library == token) {
 			ReadMDLMaterialLibrary();
 		}
+		else if (g_mdl_token_cluster          == token) {
+			ReadMDLCluster();
+		}
 		else {
-			Warning("{}: line {}: unsupported keyword token: {}.",
+			MAGE_WARNING("{}: line {}: unsupported keyword token: {}.",
 					GetPath(), GetCurrentLineNumber(), token);
 			return;
 		}
@@ -81,6 +90,26 @@ namespace mage::rendering::loader {
 		m_model_output.AddModelPart(std::move(model_part));
 	}
 
+	template< typename VertexT, typename IndexT >
+	void MDLReader< VertexT, IndexT >::ReadMDLCluster() {
+		ThrowIfFailed(!m_model_output.m_model_parts.empty(),
+					  "{}: line {}: no submodel defined for the cluster.",
+					  GetPath(), GetCurrentLineNumber());
+
+		const Point3 p_min(Read< F32, 3u >());
+		const Point3 p_max(Read< F32, 3u >());
+
+		ModelCluster cluster;
+		cluster.m_aabb        = AABB(p_min, p_max);
+		cluster.m_cone_axis   = Read< F32, 3u >();
+		cluster.m_cone_cutoff = Read< F32 >();
+		cluster.m_start_index = Read< U32 >();
+		cluster.m_nb_indices  = Read< U32 >();
+
+		m_model_output.m_model_parts.back().m_clusters.push_back(cluster);
+		m_has_clusters = true;
+	}
+
 	template< typename VertexT, typename IndexT >
 	void MDLReader< VertexT, IndexT >::ReadMDLMaterialLibrary() {
 		const UTF8toUTF16 mtl_name(Read< std::string_view >());
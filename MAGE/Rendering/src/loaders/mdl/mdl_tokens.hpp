@@ -8,4 +8,5 @@ namespace mage::rendering::loader {
 	constexpr const char    g_mdl_token_comment          = '#';
 	constexpr const_zstring g_mdl_token_submodel         = "s";
 	constexpr const_zstring g_mdl_token_material_library = "mtllib";
+	constexpr const_zstring g_mdl_token_cluster          = "c";
 }
\ No newline at end of file
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\writer.hpp"
-#include "resource\model\model_output.hpp"
+#include "io/writer.hpp"
+#include "resource/model/model_output.hpp"
 
 #pragma endregion
 
@@ -138,6 +138,16 @@ namespace mage::rendering::loader {
 		 */
 		void WriteModelParts();
 
+		/**
+		 Writes the model clusters of the given model part.
+
+		 @param[in]		model_part
+						A reference to the model part.
+		 @throws		Exception
+						Failed to write.
+		 */
+		void WriteModelClusters(const ModelPart& model_part);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -155,6 +165,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mdl\mdl_writer.tpp"
+#include "loaders/mdl/mdl_writer.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mdl\mdl_tokens.hpp"
-#include "loaders\msh\msh_loader.hpp"
+#include "loaders/mdl/mdl_tokens.hpp"
+#include "loaders/msh/msh_loader.hpp"
 
 #pragma endregion
 
@@ -85,6 +85,30 @@ namespace mage::rendering::loader {
 					model_part.m_nb_indices);
 
 			WriteStringLine(not_null_buffer);
+
+			WriteModelClusters(model_part);
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MDLWriter< VertexT, IndexT >
+		::WriteModelClusters(const ModelPart& model_part) {
+
+		char buffer[MAX_PATH];
+		const auto not_null_buffer = NotNull< const_zstring >(buffer);
+
+		for (const auto& cluster : model_part.m_clusters) {
+
+			WriteTo(buffer, "{} {} {} {} {} {} {}",
+					g_mdl_token_cluster,
+					XMStore< F32x3 >(cluster.m_aabb.MinPoint()),
+					XMStore< F32x3 >(cluster.m_aabb.MaxPoint()),
+					cluster.m_cone_axis,
+					cluster.m_cone_cutoff,
+					cluster.m_start_index,
+					cluster.m_nb_indices);
+
+			WriteStringLine(not_null_buffer);
 		}
 	}
 }
\ No newline at end of file
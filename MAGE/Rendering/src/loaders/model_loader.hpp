@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\model\model_output.hpp"
-#include "resource\mesh\mesh_descriptor.hpp"
+#include "resource/model/model_output.hpp"
+#include "resource/mesh/mesh_descriptor.hpp"
 
 #pragma endregion
 
@@ -69,6 +69,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\model_loader.tpp"
+#include "loaders/model_loader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mdl\mdl_loader.hpp"
-#include "loaders\obj\obj_loader.hpp"
+#include "loaders/mdl/mdl_loader.hpp"
+#include "loaders/obj/obj_loader.hpp"
 
 #pragma endregion
 
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -74,6 +74,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\msh\msh_loader.tpp"
+#include "loaders/msh/msh_loader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\msh\msh_reader.hpp"
-#include "loaders\msh\msh_writer.hpp"
+#include "loaders/msh/msh_reader.hpp"
+#include "loaders/msh/msh_writer.hpp"
 
 #pragma endregion
 
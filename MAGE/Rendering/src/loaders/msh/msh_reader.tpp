@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\msh\msh_tokens.hpp"
-#include "exception\exception.hpp"
+#include "loaders/msh/msh_tokens.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
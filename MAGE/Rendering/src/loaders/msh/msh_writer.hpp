@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\binary_writer.hpp"
+#include "io/binary_writer.hpp"
 
 #pragma endregion
 
@@ -140,6 +140,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\msh\msh_writer.tpp"
+#include "loaders/msh/msh_writer.tpp"
 
 #pragma endregion
\ No newline at end of file
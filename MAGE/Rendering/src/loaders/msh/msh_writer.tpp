@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\msh\msh_tokens.hpp"
+#include "loaders/msh/msh_tokens.hpp"
 
 #pragma endregion
 
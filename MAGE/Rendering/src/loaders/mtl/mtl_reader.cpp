@@ -3,9 +3,11 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mtl\mtl_reader.hpp"
-#include "loaders\mtl\mtl_tokens.hpp"
-#include "resource\model\material_factory.hpp"
+#include "loaders/mtl/mtl_reader.hpp"
+#include "loaders/mtl/mtl_tokens.hpp"
+#include "resource/model/material_factory.hpp"
+#include "loaders/texture_loader.hpp"
+#include "logging/logging.hpp"
 
 #pragma endregion
 
@@ -61,7 +63,7 @@ namespace mage::rendering::loader {
 			m_material_buffer.back().SetOpaque();
 		}
 		else {
-			Warning("{}: line {}: unsupported keyword token: {}.",
+			MAGE_WARNING("{}: line {}: unsupported keyword token: {}.",
 					GetPath(), GetCurrentLineNumber(), token);
 			return;
 		}
@@ -95,15 +97,18 @@ namespace mage::rendering::loader {
 	}
 
 	void MTLReader::ReadMTLBaseColorTexture() {
-		m_material_buffer.back().SetBaseColorTexture(ReadMTLTexture());
+		m_material_buffer.back().SetBaseColorTexture(
+			ReadMTLTexture(TextureUsage::BaseColor));
 	}
 
 	void MTLReader::ReadMTLMaterialTexture() {
-		m_material_buffer.back().SetMaterialTexture(ReadMTLTexture());
+		m_material_buffer.back().SetMaterialTexture(
+			ReadMTLTexture(TextureUsage::Material));
 	}
 
 	void MTLReader::ReadMTLNormalTexture() {
-		m_material_buffer.back().SetNormalTexture(ReadMTLTexture());
+		m_material_buffer.back().SetNormalTexture(
+			ReadMTLTexture(TextureUsage::Normal));
 	}
 
 	[[nodiscard]]
@@ -137,12 +142,21 @@ namespace mage::rendering::loader {
 	}
 
 	[[nodiscard]]
-	TexturePtr MTLReader::ReadMTLTexture() {
+	TexturePtr MTLReader::ReadMTLTexture(TextureUsage usage) {
 		// "-options args" are not supported and are not allowed.
 		const UTF8toUTF16 texture_name(Read< std::string_view >());
 		auto texture_path = GetPath();
 		texture_path.replace_filename(std::wstring_view(texture_name));
 
-		return m_resource_manager.GetOrCreate< Texture >(texture_path);
+		// Image files are baked to block-compressed DDS files (once).
+		try {
+			texture_path = BakeTexture(texture_path, usage);
+		}
+		catch (const std::exception& e) {
+			MAGE_WARNING("{}: texture baking failed: {}", GetPath(), e.what());
+		}
+
+		// Material textures are streamed.
+		return m_resource_manager.GetOrCreate< Texture >(texture_path, true);
 	}
 }
\ No newline at end of file
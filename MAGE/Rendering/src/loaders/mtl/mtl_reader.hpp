@@ -5,8 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\line_reader.hpp"
-#include "resource\rendering_resource_manager.hpp"
+#include "io/line_reader.hpp"
+#include "resource/rendering_resource_manager.hpp"
+#include "resource/texture/texture_processing.hpp"
 
 #pragma endregion
 
@@ -192,15 +193,18 @@ namespace mage::rendering::loader {
 		const SRGBA ReadMTLSRGBA();
 
 		/**
-		 Reads a texture.
+		 Reads a texture. Image files are baked (if needed) and the baked
+		 textures are used instead.
 
+		 @param[in]		usage
+						The texture usage.
 		 @return		A pointer to the texture represented by the next token
 						of this MTL reader.
 		 @throws		Exception
 						Failed to read a texture.
 		 */
 		[[nodiscard]]
-		TexturePtr ReadMTLTexture();
+		TexturePtr ReadMTLTexture(TextureUsage usage);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\obj\obj_reader.hpp"
+#include "loaders/obj/obj_reader.hpp"
 
 #pragma endregion
 
@@ -5,9 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\line_reader.hpp"
-#include "resource\model\model_output.hpp"
-#include "resource\mesh\mesh_descriptor.hpp"
+#include "io/line_reader.hpp"
+#include "resource/model/model_output.hpp"
+#include "resource/mesh/mesh_descriptor.hpp"
 
 #pragma endregion
 
@@ -375,6 +375,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\obj\obj_reader.tpp"
+#include "loaders/obj/obj_reader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,9 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\obj\obj_tokens.hpp"
-#include "loaders\material_loader.hpp"
-#include "resource\mesh\vertex.hpp"
+#include "loaders/obj/obj_tokens.hpp"
+#include "loaders/material_loader.hpp"
+#include "resource/mesh/vertex.hpp"
 
 #pragma endregion
 
@@ -99,7 +99,7 @@ namespace mage::rendering::loader {
 			ReadOBJSmoothingGroup();
 		}
 		else {
-			Warning("{}: line {}: unsupported keyword token: {}.",
+			MAGE_WARNING("{}: line {}: unsupported keyword token: {}.",
 					GetPath(), GetCurrentLineNumber(), token);
 			return;
 		}
@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\sprite_font_loader.hpp"
-#include "loaders\font\font_loader.hpp"
-#include "exception\exception.hpp"
+#include "loaders/sprite_font_loader.hpp"
+#include "loaders/font/font_loader.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -3,11 +3,11 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\texture_loader.hpp"
-#include "directxtex\DDSTextureLoader.h"
-#include "directxtex\ScreenGrab.h"
-#include "directxtex\WICTextureLoader.h"
-#include "exception\exception.hpp"
+#include "loaders/texture_loader.hpp"
+#include "loaders/dds/dds_loader.hpp"
+#include "loaders/wic/wic_loader.hpp"
+#include "directxtex/ScreenGrab.h"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -16,6 +16,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <mutex>
+#include <vector>
 #include <wincodec.h>
 
 #pragma endregion
@@ -25,23 +27,247 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering::loader {
 
-	void ImportTextureFromFile(const std::filesystem::path& path,
-		                       ID3D11Device& device,
-		                       NotNull< ID3D11ShaderResourceView** > texture_srv) {
+	namespace {
 
-		std::wstring extension(path.extension());
-		TransformToLowerCase(extension);
+		/**
+		 The mutex for serializing texture bakes.
+		 */
+		std::mutex g_bake_mutex;
 
-		if (L".dds" == extension) {
-			const HRESULT result = DirectX::CreateDDSTextureFromFile(
-				&device, path.c_str(), nullptr, texture_srv);
-			ThrowIfFailed(result, "Texture importing failed: {:08X}.", result);
+		/**
+		 Checks whether the given path is associated with a DDS file.
+
+		 @param[in]		path
+						A reference to the path.
+		 @return		@c true if the given path is associated with a DDS
+						file. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsDDSFile(const std::filesystem::path& path) {
+			std::wstring extension(path.extension());
+			TransformToLowerCase(extension);
+
+			return L".dds" == extension;
+		}
+	}
+
+	[[nodiscard]]
+	const std::filesystem::path GetBakedTexturePath(
+		const std::filesystem::path& path) {
+
+		auto baked_path = path;
+		baked_path += L".dds";
+		return baked_path;
+	}
+
+	[[nodiscard]]
+	bool IsBakedTextureUpToDate(const std::filesystem::path& path) noexcept {
+		try {
+			const auto baked_path = GetBakedTexturePath(path);
+
+			std::error_code error;
+			const auto source_time = std::filesystem::last_write_time(path, error);
+			if (error) {
+				return false;
+			}
+			const auto baked_time  = std::filesystem::last_write_time(baked_path, error);
+			if (error) {
+				return false;
+			}
+
+			return source_time <= baked_time;
+		}
+		catch (...) {
+			return false;
+		}
+	}
+
+	const std::filesystem::path BakeTexture(const std::filesystem::path& path,
+		                                    TextureUsage usage) {
+
+		if (IsDDSFile(path)) {
+			return path;
+		}
+
+		const auto baked_path = GetBakedTexturePath(path);
+
+		const std::scoped_lock lock(g_bake_mutex);
+
+		// Another thread may have baked the texture in the meantime.
+		if (IsBakedTextureUpToDate(path)) {
+			return baked_path;
+		}
+
+		TextureData data;
+		ImportWICTextureFromFile(path, data, true);
+		data.SetFormat((TextureUsage::BaseColor == usage)
+					   ? DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+					   : DXGI_FORMAT_R8G8B8A8_UNORM);
+
+		TextureData mip_chain;
+		GenerateMipMaps(data, usage, mip_chain);
+		data.Clear();
+
+		TextureData compressed_data;
+		CompressTexture(mip_chain, GetCompressedFormat(mip_chain, usage),
+						compressed_data);
+
+		// Export to a temporary file first to never leave a partially
+		// written baked texture behind.
+		auto temporary_path = baked_path;
+		temporary_path += L".tmp";
+		ExportDDSTextureToFile(temporary_path, compressed_data);
+		std::filesystem::rename(temporary_path, baked_path);
+
+		return baked_path;
+	}
+
+	void ImportTextureFromFile(const std::filesystem::path& path,
+		                       TextureData& output) {
+
+		if (IsDDSFile(path)) {
+			ImportDDSTextureFromFile(path, output);
+		}
+		else if (IsBakedTextureUpToDate(path)) {
+			ImportDDSTextureFromFile(GetBakedTexturePath(path), output);
 		}
 		else {
-			const HRESULT result = DirectX::CreateWICTextureFromFile(
-				&device, path.c_str(), nullptr, texture_srv);
-			ThrowIfFailed(result, "Texture importing failed: {:08X}.", result);
+			ImportWICTextureFromFile(path, output);
+		}
+	}
+
+	void CreateTexture(const TextureData& data,
+		               ID3D11Device& device,
+		               NotNull< ID3D11ShaderResourceView** > texture_srv) {
+
+		ThrowIfFailed(!data.empty(), "Texture creation failed: no texture data.");
+
+		// Create the subresource data.
+		const auto nb_subresources = data.GetNumberOfSubresources();
+		std::vector< D3D11_SUBRESOURCE_DATA > initial_data(nb_subresources);
+		for (std::size_t i = 0u; i < nb_subresources; ++i) {
+			const auto& subresource = data.GetSubresource(i);
+			initial_data[i].pSysMem          = data.GetPixels(i);
+			initial_data[i].SysMemPitch      = static_cast< U32 >(subresource.m_row_pitch);
+			initial_data[i].SysMemSlicePitch = static_cast< U32 >(subresource.m_slice_pitch);
+		}
+
+		const auto& texture_desc  = data.GetDescriptor();
+		const auto  format        = texture_desc.m_format;
+		const auto  array_size    = texture_desc.m_array_size;
+		const auto  nb_mip_levels = texture_desc.m_nb_mip_levels;
+
+		ComPtr< ID3D11Resource > resource;
+		D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc = {};
+		srv_desc.Format = format;
+
+		switch (texture_desc.m_dimension) {
+
+		case D3D11_RESOURCE_DIMENSION_TEXTURE1D: {
+			const CD3D11_TEXTURE1D_DESC desc(format,
+											 texture_desc.m_width,
+											 array_size,
+											 nb_mip_levels,
+											 D3D11_BIND_SHADER_RESOURCE,
+											 D3D11_USAGE_IMMUTABLE);
+
+			ComPtr< ID3D11Texture1D > texture;
+			const HRESULT result = device.CreateTexture1D(
+				&desc, initial_data.data(), texture.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "Texture 1D creation failed: {:08X}.", result);
+			resource = texture;
+
+			if (1u < array_size) {
+				srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE1DARRAY;
+				srv_desc.Texture1DArray.MipLevels = nb_mip_levels;
+				srv_desc.Texture1DArray.ArraySize = array_size;
+			}
+			else {
+				srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE1D;
+				srv_desc.Texture1D.MipLevels = nb_mip_levels;
+			}
+			break;
 		}
+		case D3D11_RESOURCE_DIMENSION_TEXTURE2D: {
+			const CD3D11_TEXTURE2D_DESC desc(format,
+											 texture_desc.m_width,
+											 texture_desc.m_height,
+											 array_size,
+											 nb_mip_levels,
+											 D3D11_BIND_SHADER_RESOURCE,
+											 D3D11_USAGE_IMMUTABLE,
+											 0u,
+											 1u,
+											 0u,
+											 texture_desc.m_cube_map
+												 ? D3D11_RESOURCE_MISC_TEXTURECUBE : 0u);
+
+			ComPtr< ID3D11Texture2D > texture;
+			const HRESULT result = device.CreateTexture2D(
+				&desc, initial_data.data(), texture.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "Texture 2D creation failed: {:08X}.", result);
+			resource = texture;
+
+			if (texture_desc.m_cube_map) {
+				if (6u < array_size) {
+					srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURECUBEARRAY;
+					srv_desc.TextureCubeArray.MipLevels = nb_mip_levels;
+					srv_desc.TextureCubeArray.NumCubes  = array_size / 6u;
+				}
+				else {
+					srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURECUBE;
+					srv_desc.TextureCube.MipLevels = nb_mip_levels;
+				}
+			}
+			else if (1u < array_size) {
+				srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2DARRAY;
+				srv_desc.Texture2DArray.MipLevels = nb_mip_levels;
+				srv_desc.Texture2DArray.ArraySize = array_size;
+			}
+			else {
+				srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+				srv_desc.Texture2D.MipLevels = nb_mip_levels;
+			}
+			break;
+		}
+		case D3D11_RESOURCE_DIMENSION_TEXTURE3D: {
+			const CD3D11_TEXTURE3D_DESC desc(format,
+											 texture_desc.m_width,
+											 texture_desc.m_height,
+											 texture_desc.m_depth,
+											 nb_mip_levels,
+											 D3D11_BIND_SHADER_RESOURCE,
+											 D3D11_USAGE_IMMUTABLE);
+
+			ComPtr< ID3D11Texture3D > texture;
+			const HRESULT result = device.CreateTexture3D(
+				&desc, initial_data.data(), texture.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "Texture 3D creation failed: {:08X}.", result);
+			resource = texture;
+
+			srv_desc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE3D;
+			srv_desc.Texture3D.MipLevels = nb_mip_levels;
+			break;
+		}
+		default:
+			throw Exception("Unsupported texture dimension: {}.",
+							static_cast< U32 >(texture_desc.m_dimension));
+
+		}
+
+		// Create the SRV.
+		const HRESULT result = device.CreateShaderResourceView(
+			resource.Get(), &srv_desc, texture_srv);
+		ThrowIfFailed(result, "Texture SRV creation failed: {:08X}.", result);
+	}
+
+	void ImportTextureFromFile(const std::filesystem::path& path,
+		                       ID3D11Device& device,
+		                       NotNull< ID3D11ShaderResourceView** > texture_srv) {
+
+		TextureData data;
+		ImportTextureFromFile(path, data);
+		CreateTexture(data, device, texture_srv);
 	}
 
 	namespace {
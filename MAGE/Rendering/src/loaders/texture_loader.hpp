@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "direct3d11.hpp"
-#include "type\types.hpp"
+#include "resource/texture/texture_data.hpp"
+#include "resource/texture/texture_processing.hpp"
 
 #pragma endregion
 
@@ -25,7 +25,90 @@
 namespace mage::rendering::loader {
 
 	/**
-	 Imports the texture from the file associated with the given path.
+	 Returns the path of the baked texture of the given path (i.e. a DDS file
+	 next to the given path).
+
+	 @param[in]		path
+					A reference to the path.
+	 @return		The path of the baked texture of the given path.
+	 */
+	[[nodiscard]]
+	const std::filesystem::path GetBakedTexturePath(
+		const std::filesystem::path& path);
+
+	/**
+	 Checks whether the baked texture of the given path exists and is not
+	 older than the file associated with the given path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @return		@c true if the baked texture of the given path is up to
+					date. @c false otherwise.
+	 */
+	[[nodiscard]]
+	bool IsBakedTextureUpToDate(const std::filesystem::path& path) noexcept;
+
+	/**
+	 Bakes the texture of the image file associated with the given path (i.e.
+	 generates the complete mip chain, compresses it to a block-compressed
+	 format based on the content and the given usage and exports the result
+	 to a DDS file), unless the baked texture is up to date.
+
+	 Base color textures are processed in sRGB space. This function does not
+	 use the rendering device and can be called from any thread (that has
+	 initialized COM). Concurrent bakes are serialized.
+
+	 @param[in]		path
+					A reference to the path. DDS files are not baked.
+	 @param[in]		usage
+					The texture usage.
+	 @return		The path of the baked texture.
+	 @return		@a path, if the given path is associated with a DDS
+					file.
+	 @throws		Exception
+					Failed to bake the texture.
+	 */
+	const std::filesystem::path BakeTexture(const std::filesystem::path& path,
+		                                    TextureUsage usage);
+
+	/**
+	 Imports the texture data from the file associated with the given path.
+
+	 Up-to-date baked textures are preferred over image files.
+
+	 This function only decodes the file into memory. It does not use the
+	 rendering device and can be called from any thread (that has initialized
+	 COM).
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	output
+					A reference to the texture data.
+	 @throws		Exception
+					Failed to import the texture data from file.
+	 */
+	void ImportTextureFromFile(const std::filesystem::path& path,
+		                       TextureData& output);
+
+	/**
+	 Creates the texture from the given texture data.
+
+	 @param[in]		data
+					A reference to the texture data.
+	 @param[in,out]	device
+					A reference to the device.
+	 @param[out]	texture_srv
+					A pointer to a pointer to a shader resource view.
+	 @throws		Exception
+					Failed to create the texture.
+	 */
+	void CreateTexture(const TextureData& data,
+		               ID3D11Device& device,
+		               NotNull< ID3D11ShaderResourceView** > texture_srv);
+
+	/**
+	 Imports the texture from the file associated with the given path (i.e.
+	 imports the texture data and creates the texture from it).
 
 	 @param[in]		path
 					A reference to the path.
@@ -0,0 +1,319 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/wic/wic_loader.hpp"
+#include "resource/texture/texture_format.hpp"
+#include "exception/exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <wincodec.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	namespace {
+
+		/**
+		 A struct of WIC formats (i.e. a WIC pixel format and its matching
+		 DXGI format).
+		 */
+		struct WICFormat {
+
+		public:
+
+			/**
+			 The WIC pixel format of this WIC format.
+			 */
+			WICPixelFormatGUID m_pixel_format;
+
+			/**
+			 The DXGI format of this WIC format.
+			 */
+			DXGI_FORMAT m_format;
+		};
+
+		/**
+		 The WIC pixel formats which can be copied directly.
+		 */
+		const WICFormat g_wic_formats[] = {
+			{ GUID_WICPixelFormat128bppRGBAFloat,   DXGI_FORMAT_R32G32B32A32_FLOAT },
+			{ GUID_WICPixelFormat64bppRGBAHalf,     DXGI_FORMAT_R16G16B16A16_FLOAT },
+			{ GUID_WICPixelFormat64bppRGBA,         DXGI_FORMAT_R16G16B16A16_UNORM },
+			{ GUID_WICPixelFormat32bppRGBA,         DXGI_FORMAT_R8G8B8A8_UNORM     },
+			{ GUID_WICPixelFormat32bppBGRA,         DXGI_FORMAT_B8G8R8A8_UNORM     },
+			{ GUID_WICPixelFormat32bppBGR,          DXGI_FORMAT_B8G8R8X8_UNORM     },
+			{ GUID_WICPixelFormat32bppRGBA1010102,  DXGI_FORMAT_R10G10B10A2_UNORM  },
+			{ GUID_WICPixelFormat32bppGrayFloat,    DXGI_FORMAT_R32_FLOAT          },
+			{ GUID_WICPixelFormat16bppGrayHalf,     DXGI_FORMAT_R16_FLOAT          },
+			{ GUID_WICPixelFormat16bppGray,         DXGI_FORMAT_R16_UNORM          },
+			{ GUID_WICPixelFormat8bppGray,          DXGI_FORMAT_R8_UNORM           },
+			{ GUID_WICPixelFormat8bppAlpha,         DXGI_FORMAT_A8_UNORM           },
+		};
+
+		/**
+		 The WIC pixel formats which need a conversion to a WIC pixel format
+		 which can be copied directly (without loss of precision). All other
+		 WIC pixel formats are converted to @c GUID_WICPixelFormat32bppRGBA.
+		 */
+		const WICPixelFormatGUID g_wic_conversions[][2] = {
+			{ GUID_WICPixelFormat96bppRGBFloat,     GUID_WICPixelFormat128bppRGBAFloat },
+			{ GUID_WICPixelFormat128bppRGBFloat,    GUID_WICPixelFormat128bppRGBAFloat },
+			{ GUID_WICPixelFormat128bppPRGBAFloat,  GUID_WICPixelFormat128bppRGBAFloat },
+			{ GUID_WICPixelFormat48bppRGBHalf,      GUID_WICPixelFormat64bppRGBAHalf   },
+			{ GUID_WICPixelFormat64bppRGBHalf,      GUID_WICPixelFormat64bppRGBAHalf   },
+			{ GUID_WICPixelFormat48bppRGB,          GUID_WICPixelFormat64bppRGBA       },
+			{ GUID_WICPixelFormat48bppBGR,          GUID_WICPixelFormat64bppRGBA       },
+			{ GUID_WICPixelFormat64bppBGRA,         GUID_WICPixelFormat64bppRGBA       },
+			{ GUID_WICPixelFormat64bppPRGBA,        GUID_WICPixelFormat64bppRGBA       },
+			{ GUID_WICPixelFormat64bppPBGRA,        GUID_WICPixelFormat64bppRGBA       },
+		};
+
+		/**
+		 Returns the WIC imaging factory.
+
+		 The factory is created once and intentionally never released, since
+		 it may still be in use by other threads at program termination.
+
+		 @return		A reference to the WIC imaging factory.
+		 @throws		Exception
+						Failed to create the WIC imaging factory.
+		 */
+		[[nodiscard]]
+		IWICImagingFactory& GetWICFactory() {
+			static IWICImagingFactory* const s_factory = []() {
+				IWICImagingFactory* factory = nullptr;
+				const HRESULT result = CoCreateInstance(CLSID_WICImagingFactory,
+														nullptr,
+														CLSCTX_INPROC_SERVER,
+														IID_PPV_ARGS(&factory));
+				ThrowIfFailed(result,
+							  "WIC imaging factory creation failed: {:08X}.",
+							  result);
+				return factory;
+			}();
+
+			return *s_factory;
+		}
+
+		/**
+		 Returns the WIC pixel format which can be copied directly for the
+		 given WIC pixel format and the matching DXGI format.
+
+		 @param[in]		pixel_format
+						A reference to the WIC pixel format.
+		 @param[out]	target_pixel_format
+						A reference to the WIC pixel format which can be copied
+						directly.
+		 @return		The DXGI format matching @a target_pixel_format.
+		 */
+		[[nodiscard]]
+		DXGI_FORMAT GetFormat(const WICPixelFormatGUID& pixel_format,
+							  WICPixelFormatGUID& target_pixel_format) noexcept {
+
+			target_pixel_format = GUID_WICPixelFormat32bppRGBA;
+			for (const auto& conversion : g_wic_conversions) {
+				if (conversion[0] == pixel_format) {
+					target_pixel_format = conversion[1];
+					break;
+				}
+			}
+			for (const auto& format : g_wic_formats) {
+				if (format.m_pixel_format == pixel_format) {
+					target_pixel_format = pixel_format;
+					break;
+				}
+			}
+
+			for (const auto& format : g_wic_formats) {
+				if (format.m_pixel_format == target_pixel_format) {
+					return format.m_format;
+				}
+			}
+
+			return DXGI_FORMAT_R8G8B8A8_UNORM;
+		}
+
+		/**
+		 Checks whether the metadata of the given frame specifies the sRGB
+		 color space.
+
+		 @param[in]		frame
+						A reference to the frame.
+		 @return		@c true if the metadata of the given frame specifies
+						the sRGB color space. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsSRGB(IWICBitmapFrameDecode& frame) noexcept {
+			ComPtr< IWICMetadataQueryReader > reader;
+			if (FAILED(frame.GetMetadataQueryReader(reader.ReleaseAndGetAddressOf()))) {
+				return false;
+			}
+
+			GUID container_format;
+			if (FAILED(reader->GetContainerFormat(&container_format))) {
+				return false;
+			}
+
+			PROPVARIANT value;
+			PropVariantInit(&value);
+
+			bool srgb = false;
+			if (GUID_ContainerFormatPng == container_format) {
+				// Check for the sRGB chunk.
+				srgb = SUCCEEDED(reader->GetMetadataByName(
+							L"/sRGB/RenderingIntent", &value))
+					&& VT_UI1 == value.vt;
+			}
+			else {
+				srgb = SUCCEEDED(reader->GetMetadataByName(
+							L"System.Image.ColorSpace", &value))
+					&& VT_UI2 == value.vt && 1u == value.uiVal;
+			}
+
+			PropVariantClear(&value);
+
+			return srgb;
+		}
+	}
+
+	void ImportWICTextureFromFile(const std::filesystem::path& path,
+		                          TextureData& output,
+		                          bool force_rgba) {
+
+		auto& factory = GetWICFactory();
+
+		// Decode the first frame.
+		ComPtr< IWICBitmapDecoder > decoder;
+		{
+			const HRESULT result = factory.CreateDecoderFromFilename(
+				path.c_str(), nullptr, GENERIC_READ,
+				WICDecodeMetadataCacheOnDemand,
+				decoder.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "{}: WIC decoder creation failed: {:08X}.",
+						  path, result);
+		}
+
+		ComPtr< IWICBitmapFrameDecode > frame;
+		{
+			const HRESULT result
+				= decoder->GetFrame(0u, frame.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "{}: WIC frame decoding failed: {:08X}.",
+						  path, result);
+		}
+
+		UINT width  = 0u;
+		UINT height = 0u;
+		{
+			const HRESULT result = frame->GetSize(&width, &height);
+			ThrowIfFailed(result, "{}: WIC frame size query failed: {:08X}.",
+						  path, result);
+		}
+
+		WICPixelFormatGUID pixel_format;
+		{
+			const HRESULT result = frame->GetPixelFormat(&pixel_format);
+			ThrowIfFailed(result, "{}: WIC pixel format query failed: {:08X}.",
+						  path, result);
+		}
+
+		WICPixelFormatGUID target_pixel_format;
+		auto format = GetFormat(pixel_format, target_pixel_format);
+		if (force_rgba) {
+			target_pixel_format = GUID_WICPixelFormat32bppRGBA;
+			format              = DXGI_FORMAT_R8G8B8A8_UNORM;
+		}
+		if (IsSRGB(*frame.Get())) {
+			format = ConvertToSRGB(format);
+		}
+
+		// Bound the size to the maximum 2D texture size.
+		constexpr U32 max_size = D3D11_REQ_TEXTURE2D_U_OR_V_DIMENSION;
+		U32 target_width  = width;
+		U32 target_height = height;
+		if (max_size < width || max_size < height) {
+			const auto ratio = static_cast< F32 >(height)
+				             / static_cast< F32 >(width);
+			if (width > height) {
+				target_width  = max_size;
+				target_height = std::max(static_cast< U32 >(max_size * ratio), 1u);
+			}
+			else {
+				target_width  = std::max(static_cast< U32 >(max_size / ratio), 1u);
+				target_height = max_size;
+			}
+		}
+
+		ComPtr< IWICBitmapSource > source = frame;
+
+		if (target_width != width || target_height != height) {
+			ComPtr< IWICBitmapScaler > scaler;
+			HRESULT result
+				= factory.CreateBitmapScaler(scaler.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "{}: WIC scaler creation failed: {:08X}.",
+						  path, result);
+
+			result = scaler->Initialize(source.Get(),
+										target_width, target_height,
+										WICBitmapInterpolationModeFant);
+			ThrowIfFailed(result, "{}: WIC scaling failed: {:08X}.",
+						  path, result);
+
+			source = scaler;
+
+			// The scaler may output a different pixel format.
+			result = source->GetPixelFormat(&pixel_format);
+			ThrowIfFailed(result, "{}: WIC pixel format query failed: {:08X}.",
+						  path, result);
+		}
+
+		if (target_pixel_format != pixel_format) {
+			ComPtr< IWICFormatConverter > converter;
+			HRESULT result
+				= factory.CreateFormatConverter(converter.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "{}: WIC converter creation failed: {:08X}.",
+						  path, result);
+
+			result = converter->Initialize(source.Get(), target_pixel_format,
+										   WICBitmapDitherTypeErrorDiffusion,
+										   nullptr, 0.0,
+										   WICBitmapPaletteTypeMedianCut);
+			ThrowIfFailed(result, "{}: WIC conversion failed: {:08X}.",
+						  path, result);
+
+			source = converter;
+		}
+
+		// Copy the pixels.
+		TextureDescriptor desc;
+		desc.m_dimension     = D3D11_RESOURCE_DIMENSION_TEXTURE2D;
+		desc.m_format        = format;
+		desc.m_width         = target_width;
+		desc.m_height        = target_height;
+		desc.m_depth         = 1u;
+		desc.m_array_size    = 1u;
+		desc.m_nb_mip_levels = 1u;
+		output.Initialize(desc);
+
+		const auto& subresource = output.GetSubresource(0u);
+		const HRESULT result = source->CopyPixels(
+			nullptr,
+			static_cast< UINT >(subresource.m_row_pitch),
+			static_cast< UINT >(subresource.m_size),
+			output.GetPixels(0u));
+		ThrowIfFailed(result, "{}: WIC pixel copying failed: {:08X}.",
+					  path, result);
+	}
+}
\ No newline at end of file
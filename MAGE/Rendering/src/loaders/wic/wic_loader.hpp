@@ -0,0 +1,49 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/texture/texture_data.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 Imports the texture data from the image file (BMP, GIF, JPEG, PNG, TIFF,
+	 HD Photo, etc.) associated with the given path using the Windows Imaging
+	 Component (WIC).
+
+	 This function does not use the rendering device and can be called from
+	 any thread that has initialized COM.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	output
+					A reference to the texture data.
+	 @param[in]		force_rgba
+					@c true if the pixels must be converted to 8-bit RGBA
+					(i.e. @c DXGI_FORMAT_R8G8B8A8_UNORM or
+					@c DXGI_FORMAT_R8G8B8A8_UNORM_SRGB). @c false
+					otherwise.
+	 @throws		Exception
+					Failed to import the texture data from file.
+	 */
+	void ImportWICTextureFromFile(const std::filesystem::path& path,
+		                          TextureData& output,
+		                          bool force_rgba = false);
+}
\ No newline at end of file
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pipeline.hpp"
-#include "exception\exception.hpp"
+#include "renderer/pipeline.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
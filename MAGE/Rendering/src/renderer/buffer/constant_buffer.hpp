@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\buffer\buffer_lock.hpp"
+#include "renderer/buffer/buffer_lock.hpp"
 
 #pragma endregion
 
@@ -161,6 +161,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\buffer\constant_buffer.tpp"
+#include "renderer/buffer/constant_buffer.tpp"
 
 #pragma endregion
\ No newline at end of file
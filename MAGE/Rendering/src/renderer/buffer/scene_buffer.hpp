@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "geometry\geometry.hpp"
-#include "spectrum\spectrum.hpp"
+#include "geometry/geometry.hpp"
+#include "spectrum/spectrum.hpp"
 
 #pragma endregion
 
@@ -164,9 +164,25 @@ namespace mage::rendering {
 		 The padding of this camera buffer.
 		 */
 		U32x2 m_padding;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Dynamic Resolution
+		//---------------------------------------------------------------------
+
+		/**
+		 The top left corner of the output viewport (i.e. the unscaled
+		 viewport) of the camera of this camera buffer.
+		 */
+		F32x2 m_output_viewport_top_left;
+
+		/**
+		 The resolution of the output viewport (i.e. the unscaled viewport) of
+		 the camera of this camera buffer.
+		 */
+		U32x2 m_output_viewport_resolution;
 	};
 
-	static_assert(352u == sizeof(CameraBuffer),
+	static_assert(368u == sizeof(CameraBuffer),
 				  "CPU/GPU struct mismatch");
 
 	/**
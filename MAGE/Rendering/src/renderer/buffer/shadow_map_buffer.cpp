@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\buffer\shadow_map_buffer.hpp"
-#include "renderer\factory.hpp"
-#include "exception\exception.hpp"
+#include "renderer/buffer/shadow_map_buffer.hpp"
+#include "renderer/factory.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
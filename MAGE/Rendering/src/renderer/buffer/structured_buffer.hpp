@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\buffer\buffer_lock.hpp"
-#include "collection\vector.hpp"
+#include "renderer/buffer/buffer_lock.hpp"
+#include "collection/vector.hpp"
 
 #pragma endregion
 
@@ -200,6 +200,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\buffer\structured_buffer.tpp"
+#include "renderer/buffer/structured_buffer.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\factory.hpp"
+#include "renderer/factory.hpp"
 
 #pragma endregion
 
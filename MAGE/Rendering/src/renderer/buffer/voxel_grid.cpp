@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\buffer\voxel_grid.hpp"
-#include "renderer\factory.hpp"
-#include "exception\exception.hpp"
+#include "renderer/buffer/voxel_grid.hpp"
+#include "renderer/factory.hpp"
+#include "exception/exception.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
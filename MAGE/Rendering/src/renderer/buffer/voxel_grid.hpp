@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\camera\viewport.hpp"
+#include "scene/camera/viewport.hpp"
 
 #pragma endregion
 
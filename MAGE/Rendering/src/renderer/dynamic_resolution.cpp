@@ -0,0 +1,124 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer/dynamic_resolution.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 The smoothing factor of the exponential moving average of the frame
+		 times.
+		 */
+		constexpr F64 g_smoothing = 0.25;
+
+		/**
+		 The proportional gain of the PI controller.
+		 */
+		constexpr F64 g_proportional_gain = 0.1;
+
+		/**
+		 The integral gain of the PI controller.
+		 */
+		constexpr F64 g_integral_gain = 0.2;
+
+		/**
+		 The relative deviation of the resolution scale above which the
+		 resolution scale is adjusted.
+		 */
+		constexpr F64 g_upper_threshold = 0.03;
+
+		/**
+		 The relative deviation of the resolution scale below which the
+		 resolution scale is no longer adjusted.
+		 */
+		constexpr F64 g_lower_threshold = 0.01;
+	}
+
+	DynamicResolutionController
+		::DynamicResolutionController(F64 target_frame_time,
+									  F32 min_scale,
+									  F32 max_scale) noexcept
+		: m_target_frame_time(std::max(0.0, target_frame_time)),
+		m_min_scale(min_scale),
+		m_max_scale(max_scale),
+		m_scale(max_scale),
+		m_frame_time(0.0),
+		m_error(0.0),
+		m_adjusting(false) {}
+
+	void DynamicResolutionController
+		::SetTargetFrameTime(F64 target_frame_time) noexcept {
+
+		m_target_frame_time = std::max(0.0, target_frame_time);
+		m_error             = 0.0;
+		m_adjusting         = false;
+	}
+
+	void DynamicResolutionController
+		::SetScaleRange(F32 min_scale, F32 max_scale) noexcept {
+
+		m_min_scale = min_scale;
+		m_max_scale = max_scale;
+		m_scale     = std::clamp(m_scale, m_min_scale, m_max_scale);
+	}
+
+	F32 DynamicResolutionController::Update(F64 frame_time) noexcept {
+		if (0.0 >= m_target_frame_time || 0.0 >= frame_time) {
+			return m_scale;
+		}
+
+		// Smooth the frame times.
+		m_frame_time = (0.0 == m_frame_time)
+			? frame_time
+			: m_frame_time + g_smoothing * (frame_time - m_frame_time);
+
+		// The frame time is proportional to the square of the resolution
+		// scale, so the resolution scale matching the target frame time
+		// deviates by sqrt(target / frame time) - 1.
+		const auto error     = std::sqrt(m_target_frame_time / m_frame_time) - 1.0;
+		const auto abs_error = std::abs(error);
+
+		m_adjusting = m_adjusting ? (g_lower_threshold <= abs_error)
+			                      : (g_upper_threshold <  abs_error);
+		if (!m_adjusting) {
+			m_error = 0.0;
+			return m_scale;
+		}
+
+		// PI controller in velocity form: the resolution scale accumulates
+		// the integral term, so clamping the resolution scale cannot wind up.
+		const auto delta = g_proportional_gain * (error - m_error)
+			             + g_integral_gain * error;
+		m_error = error;
+		m_scale = std::clamp(static_cast< F32 >(m_scale * (1.0 + delta)),
+							 m_min_scale, m_max_scale);
+
+		return m_scale;
+	}
+
+	void DynamicResolutionController::Reset() noexcept {
+		m_scale      = m_max_scale;
+		m_frame_time = 0.0;
+		m_error      = 0.0;
+		m_adjusting  = false;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,247 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/scalar_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of dynamic resolution controllers selecting the resolution scale
+	 of the rendered viewports from the observed frame times.
+
+	 The frame time is assumed to be proportional to the number of rendered
+	 pixels (i.e. the square of the resolution scale). The frame times are
+	 smoothed with an exponential moving average, and the relative deviation
+	 of the resolution scale from the resolution scale matching the target
+	 frame time drives a PI controller (in velocity form). To avoid
+	 oscillating around the target frame time, the resolution scale is only
+	 adjusted once the deviation exceeds an upper threshold, until the
+	 deviation drops below a lower threshold (i.e. hysteresis).
+
+	 Dynamic resolution controllers do not depend on the rendering system and
+	 can be driven by synthetic frame time traces.
+	 */
+	class DynamicResolutionController {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a dynamic resolution controller.
+
+		 @param[in]		target_frame_time
+						The target frame time (in milliseconds).
+		 @param[in]		min_scale
+						The minimum resolution scale.
+		 @param[in]		max_scale
+						The maximum resolution scale.
+		 */
+		explicit DynamicResolutionController(F64 target_frame_time = 0.0,
+											 F32 min_scale = 0.5f,
+											 F32 max_scale = 1.0f) noexcept;
+
+		/**
+		 Constructs a dynamic resolution controller from the given dynamic
+		 resolution controller.
+
+		 @param[in]		controller
+						A reference to the dynamic resolution controller to
+						copy.
+		 */
+		DynamicResolutionController(
+			const DynamicResolutionController& controller) noexcept = default;
+
+		/**
+		 Constructs a dynamic resolution controller by moving the given
+		 dynamic resolution controller.
+
+		 @param[in]		controller
+						A reference to the dynamic resolution controller to
+						move.
+		 */
+		DynamicResolutionController(
+			DynamicResolutionController&& controller) noexcept = default;
+
+		/**
+		 Destructs this dynamic resolution controller.
+		 */
+		~DynamicResolutionController() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given dynamic resolution controller to this dynamic
+		 resolution controller.
+
+		 @param[in]		controller
+						A reference to the dynamic resolution controller to
+						copy.
+		 @return		A reference to the copy of the given dynamic
+						resolution controller (i.e. this dynamic resolution
+						controller).
+		 */
+		DynamicResolutionController& operator=(
+			const DynamicResolutionController& controller) noexcept = default;
+
+		/**
+		 Moves the given dynamic resolution controller to this dynamic
+		 resolution controller.
+
+		 @param[in]		controller
+						A reference to the dynamic resolution controller to
+						move.
+		 @return		A reference to the moved dynamic resolution controller
+						(i.e. this dynamic resolution controller).
+		 */
+		DynamicResolutionController& operator=(
+			DynamicResolutionController&& controller) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the target frame time (in milliseconds) of this dynamic
+		 resolution controller.
+
+		 @return		The target frame time (in milliseconds) of this
+						dynamic resolution controller.
+		 */
+		[[nodiscard]]
+		F64 GetTargetFrameTime() const noexcept {
+			return m_target_frame_time;
+		}
+
+		/**
+		 Sets the target frame time (in milliseconds) of this dynamic
+		 resolution controller to the given frame time.
+
+		 @param[in]		target_frame_time
+						The target frame time (in milliseconds).
+		 */
+		void SetTargetFrameTime(F64 target_frame_time) noexcept;
+
+		/**
+		 Returns the minimum resolution scale of this dynamic resolution
+		 controller.
+
+		 @return		The minimum resolution scale of this dynamic
+						resolution controller.
+		 */
+		[[nodiscard]]
+		F32 GetMinScale() const noexcept {
+			return m_min_scale;
+		}
+
+		/**
+		 Returns the maximum resolution scale of this dynamic resolution
+		 controller.
+
+		 @return		The maximum resolution scale of this dynamic
+						resolution controller.
+		 */
+		[[nodiscard]]
+		F32 GetMaxScale() const noexcept {
+			return m_max_scale;
+		}
+
+		/**
+		 Sets the range of the resolution scale of this dynamic resolution
+		 controller to the given range.
+
+		 @pre			@a min_scale is positive.
+		 @pre			@a min_scale is not greater than @a max_scale.
+		 @param[in]		min_scale
+						The minimum resolution scale.
+		 @param[in]		max_scale
+						The maximum resolution scale.
+		 */
+		void SetScaleRange(F32 min_scale, F32 max_scale) noexcept;
+
+		/**
+		 Returns the resolution scale of this dynamic resolution controller.
+
+		 @return		The resolution scale of this dynamic resolution
+						controller.
+		 */
+		[[nodiscard]]
+		F32 GetScale() const noexcept {
+			return m_scale;
+		}
+
+		/**
+		 Updates the resolution scale of this dynamic resolution controller.
+
+		 @param[in]		frame_time
+						The frame time (in milliseconds) of a frame rendered
+						at a previously returned resolution scale.
+		 @return		The resolution scale of this dynamic resolution
+						controller.
+		 */
+		F32 Update(F64 frame_time) noexcept;
+
+		/**
+		 Resets this dynamic resolution controller. The resolution scale is
+		 reset to the maximum resolution scale.
+		 */
+		void Reset() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The target frame time (in milliseconds) of this dynamic resolution
+		 controller.
+		 */
+		F64 m_target_frame_time;
+
+		/**
+		 The minimum resolution scale of this dynamic resolution controller.
+		 */
+		F32 m_min_scale;
+
+		/**
+		 The maximum resolution scale of this dynamic resolution controller.
+		 */
+		F32 m_max_scale;
+
+		/**
+		 The resolution scale of this dynamic resolution controller.
+		 */
+		F32 m_scale;
+
+		/**
+		 The smoothed frame time (in milliseconds) of this dynamic resolution
+		 controller. @c 0 if no frame time has been observed yet.
+		 */
+		F64 m_frame_time;
+
+		/**
+		 The previous error of this dynamic resolution controller.
+		 */
+		F64 m_error;
+
+		/**
+		 A flag indicating whether this dynamic resolution controller is
+		 adjusting the resolution scale.
+		 */
+		bool m_adjusting;
+	};
+}
\ No newline at end of file
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\factory.hpp"
+#include "renderer/factory.hpp"
 
 #pragma endregion
 
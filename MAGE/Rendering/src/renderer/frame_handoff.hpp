@@ -0,0 +1,395 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of frame handoffs between a submitting thread and a render
+	 thread (i.e. double-buffered frames).
+
+	 The submitting thread prepares and submits a frame, while the render
+	 thread renders the previously submitted frame. A frame is only prepared
+	 again after its previous rendering completed: the results the render
+	 thread stores in a frame (e.g., statistics) are read by the submitting
+	 thread while preparing that frame, without further synchronization.
+
+	 Frame handoffs are device-independent.
+
+	 @tparam		FrameT
+					The frame type.
+	 */
+	template< typename FrameT >
+	class FrameHandoff {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a frame handoff.
+
+		 @param[in]		idle
+						The function which is called (every millisecond,
+						without holding the lock of this frame handoff) while
+						the submitting thread waits for the render thread.
+		 */
+		explicit FrameHandoff(std::function< void() > idle = {})
+			: m_frames(),
+			m_frame_index(0u),
+			m_submitted(nullptr),
+			m_rendering(false),
+			m_stop(false),
+			m_exception(),
+			m_mutex(),
+			m_condition(),
+			m_idle(std::move(idle)),
+			m_render_thread() {}
+
+		/**
+		 Constructs a frame handoff from the given frame handoff.
+
+		 @param[in]		handoff
+						A reference to the frame handoff to copy.
+		 */
+		FrameHandoff(const FrameHandoff& handoff) = delete;
+
+		/**
+		 Constructs a frame handoff by moving the given frame handoff.
+
+		 @param[in]		handoff
+						A reference to the frame handoff to move.
+		 */
+		FrameHandoff(FrameHandoff&& handoff) = delete;
+
+		/**
+		 Destructs this frame handoff. The render thread is stopped.
+		 */
+		~FrameHandoff() {
+			Stop();
+		}
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given frame handoff to this frame handoff.
+
+		 @param[in]		handoff
+						A reference to the frame handoff to copy.
+		 @return		A reference to the copy of the given frame handoff
+						(i.e. this frame handoff).
+		 */
+		FrameHandoff& operator=(const FrameHandoff& handoff) = delete;
+
+		/**
+		 Moves the given frame handoff to this frame handoff.
+
+		 @param[in]		handoff
+						A reference to the frame handoff to move.
+		 @return		A reference to the moved frame handoff (i.e. this
+						frame handoff).
+		 */
+		FrameHandoff& operator=(FrameHandoff&& handoff) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the frames of this frame handoff.
+
+		 @pre			The render thread of this frame handoff is not
+						running.
+		 @return		A reference to the frames of this frame handoff.
+		 */
+		[[nodiscard]]
+		std::array< FrameT, 2 >& GetFrames() noexcept {
+			return m_frames;
+		}
+
+		/**
+		 Checks whether the render thread of this frame handoff is running.
+
+		 @return		@c true if the render thread of this frame handoff is
+						running. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsRunning() const noexcept {
+			return m_render_thread.joinable();
+		}
+
+		/**
+		 Starts the render thread of this frame handoff.
+
+		 @pre			The render thread of this frame handoff is not
+						running.
+		 @tparam		RenderT
+						The render function type. The render function must
+						accept @c FrameT& values. The exceptions thrown by
+						the render function are rethrown on the submitting
+						thread.
+		 @param[in]		render
+						The render function.
+		 */
+		template< typename RenderT >
+		void Start(RenderT render) {
+			m_stop          = false;
+			m_render_thread = std::thread(
+				[this, render = std::move(render)]() mutable noexcept {
+					Run(render);
+				});
+		}
+
+		/**
+		 Stops the render thread of this frame handoff. The submitted frame
+		 (if any) is rendered first. The exception of the render thread (if
+		 any) is rethrown on the next flush.
+		 */
+		void Stop() noexcept {
+			if (!IsRunning()) {
+				return;
+			}
+
+			{
+				std::unique_lock lock(m_mutex);
+				m_stop = true;
+				m_condition.notify_all();
+
+				// The render thread renders the submitted frame (if any)
+				// before stopping.
+				Wait(lock, [this]() noexcept {
+					return nullptr == m_submitted && !m_rendering;
+				});
+			}
+			m_render_thread.join();
+		}
+
+		/**
+		 Waits until all submitted frames of this frame handoff are
+		 rendered.
+
+		 @throws		...
+						Failed to render a submitted frame.
+		 */
+		void Flush() {
+			std::unique_lock lock(m_mutex);
+			Wait(lock, [this]() noexcept {
+				return nullptr == m_submitted && !m_rendering;
+			});
+
+			RethrowException();
+		}
+
+		/**
+		 Prepares and submits the next frame of this frame handoff to the
+		 render thread. The previous rendering of the next frame (if any) is
+		 completed before the next frame is prepared.
+
+		 @pre			The render thread of this frame handoff is running.
+		 @tparam		PrepareT
+						The prepare function type. The prepare function must
+						accept @c FrameT& values.
+		 @param[in]		prepare
+						The prepare function.
+		 @throws		...
+						Failed to render a previous frame.
+		 */
+		template< typename PrepareT >
+		void Submit(PrepareT&& prepare) {
+			{
+				// Wait until the render thread picked up the previously
+				// submitted frame. The render thread is then rendering the
+				// other frame (if any).
+				std::unique_lock lock(m_mutex);
+				Wait(lock, [this]() noexcept {
+					return nullptr == m_submitted;
+				});
+
+				RethrowException();
+			}
+
+			auto& frame = m_frames[m_frame_index];
+			prepare(frame);
+
+			{
+				const std::scoped_lock lock(m_mutex);
+				m_submitted = &frame;
+			}
+			m_condition.notify_all();
+
+			m_frame_index = 1u - m_frame_index;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Renders the submitted frames of this frame handoff until the render
+		 thread is stopped.
+
+		 @tparam		RenderT
+						The render function type.
+		 @param[in]		render
+						A reference to the render function.
+		 */
+		template< typename RenderT >
+		void Run(RenderT& render) noexcept {
+			while (true) {
+				FrameT* frame = nullptr;
+				{
+					std::unique_lock lock(m_mutex);
+					m_condition.wait(lock, [this]() noexcept {
+						return nullptr != m_submitted || m_stop;
+					});
+
+					// The submitted frame is rendered before stopping.
+					if (nullptr == m_submitted) {
+						return;
+					}
+
+					frame       = std::exchange(m_submitted, nullptr);
+					m_rendering = true;
+				}
+				m_condition.notify_all();
+
+				try {
+					render(*frame);
+				}
+				catch (...) {
+					const std::scoped_lock lock(m_mutex);
+					m_exception = std::current_exception();
+				}
+
+				{
+					const std::scoped_lock lock(m_mutex);
+					m_rendering = false;
+				}
+				m_condition.notify_all();
+			}
+		}
+
+		/**
+		 Waits until the given predicate is satisfied, while calling the
+		 idle function of this frame handoff.
+
+		 @pre			The given lock owns the mutex of this frame handoff.
+		 @tparam		PredicateT
+						The predicate type.
+		 @param[in]		lock
+						A reference to the lock.
+		 @param[in]		predicate
+						The predicate.
+		 */
+		template< typename PredicateT >
+		void Wait(std::unique_lock< std::mutex >& lock, PredicateT predicate) {
+			using std::chrono::milliseconds;
+
+			if (!m_idle) {
+				m_condition.wait(lock, predicate);
+				return;
+			}
+
+			while (!m_condition.wait_for(lock, milliseconds(1), predicate)) {
+				lock.unlock();
+				m_idle();
+				lock.lock();
+			}
+		}
+
+		/**
+		 Rethrows the exception (if any) of the render thread of this frame
+		 handoff.
+
+		 @pre			The mutex of this frame handoff is locked.
+		 */
+		void RethrowException() {
+			if (m_exception) {
+				std::rethrow_exception(std::exchange(m_exception, nullptr));
+			}
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The (double-buffered) frames of this frame handoff.
+		 */
+		std::array< FrameT, 2 > m_frames;
+
+		/**
+		 The index of the next frame to submit of this frame handoff.
+		 */
+		std::size_t m_frame_index;
+
+		/**
+		 A pointer to the submitted frame of this frame handoff which is not
+		 yet picked up by the render thread.
+		 */
+		FrameT* m_submitted;
+
+		/**
+		 A flag indicating whether the render thread of this frame handoff
+		 is rendering a frame.
+		 */
+		bool m_rendering;
+
+		/**
+		 A flag indicating whether the render thread of this frame handoff
+		 needs to stop.
+		 */
+		bool m_stop;
+
+		/**
+		 A pointer to the exception thrown by the render thread of this frame
+		 handoff.
+		 */
+		std::exception_ptr m_exception;
+
+		/**
+		 The mutex for accessing the submitted frame and the state of the
+		 render thread of this frame handoff.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 The condition variable for signalling submissions and completions
+		 of frames of this frame handoff.
+		 */
+		std::condition_variable m_condition;
+
+		/**
+		 The idle function of this frame handoff.
+		 */
+		std::function< void() > m_idle;
+
+		/**
+		 The render thread of this frame handoff.
+		 */
+		std::thread m_render_thread;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer/gpu_timer.hpp"
+#include "exception/exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Creates a query.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		type
+						The query type.
+		 @param[out]	query
+						A pointer to a pointer to the query.
+		 @throws		Exception
+						Failed to create the query.
+		 */
+		void CreateQuery(ID3D11Device& device,
+						 D3D11_QUERY type,
+						 NotNull< ID3D11Query** > query) {
+
+			D3D11_QUERY_DESC query_desc = {};
+			query_desc.Query = type;
+
+			const HRESULT result = device.CreateQuery(&query_desc, query);
+			ThrowIfFailed(result, "Query creation failed: {:08X}.", result);
+		}
+	}
+
+	GPUTimer::GPUTimer(ID3D11Device& device)
+		: m_frames{},
+		m_index(0u),
+		m_nb_pending(0u),
+		m_measuring(false),
+		m_time(0.0) {
+
+		for (auto& frame : m_frames) {
+			CreateQuery(device, D3D11_QUERY_TIMESTAMP_DISJOINT,
+						NotNull< ID3D11Query** >(frame.m_disjoint.ReleaseAndGetAddressOf()));
+			CreateQuery(device, D3D11_QUERY_TIMESTAMP,
+						NotNull< ID3D11Query** >(frame.m_begin.ReleaseAndGetAddressOf()));
+			CreateQuery(device, D3D11_QUERY_TIMESTAMP,
+						NotNull< ID3D11Query** >(frame.m_end.ReleaseAndGetAddressOf()));
+		}
+	}
+
+	GPUTimer::GPUTimer(GPUTimer&& timer) noexcept = default;
+
+	GPUTimer::~GPUTimer() = default;
+
+	GPUTimer& GPUTimer::operator=(GPUTimer&& timer) noexcept = default;
+
+	void GPUTimer::Begin(ID3D11DeviceContext& device_context) noexcept {
+		// Skip the current frame if all queries are still pending.
+		m_measuring = (m_nb_pending < m_frames.size());
+		if (!m_measuring) {
+			return;
+		}
+
+		const auto& frame = m_frames[m_index];
+		device_context.Begin(frame.m_disjoint.Get());
+		device_context.End(frame.m_begin.Get());
+	}
+
+	void GPUTimer::End(ID3D11DeviceContext& device_context) noexcept {
+		if (!m_measuring) {
+			return;
+		}
+
+		const auto& frame = m_frames[m_index];
+		device_context.End(frame.m_end.Get());
+		device_context.End(frame.m_disjoint.Get());
+
+		m_index = (m_index + 1u) % m_frames.size();
+		++m_nb_pending;
+		m_measuring = false;
+	}
+
+	bool GPUTimer::Resolve(ID3D11DeviceContext& device_context) noexcept {
+		bool resolved = false;
+
+		while (0u != m_nb_pending) {
+			const auto index
+				= (m_index + m_frames.size() - m_nb_pending) % m_frames.size();
+			const auto& frame = m_frames[index];
+
+			// Read back the queries without flushing the command buffer.
+			D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjoint = {};
+			if (S_OK != device_context.GetData(frame.m_disjoint.Get(),
+											   &disjoint, sizeof(disjoint),
+											   D3D11_ASYNC_GETDATA_DONOTFLUSH)) {
+				break;
+			}
+
+			U64 begin = 0u;
+			U64 end   = 0u;
+			if (S_OK != device_context.GetData(frame.m_begin.Get(),
+											   &begin, sizeof(begin),
+											   D3D11_ASYNC_GETDATA_DONOTFLUSH)
+			 || S_OK != device_context.GetData(frame.m_end.Get(),
+											   &end, sizeof(end),
+											   D3D11_ASYNC_GETDATA_DONOTFLUSH)) {
+				break;
+			}
+
+			--m_nb_pending;
+
+			// Discard the timestamps if the GPU frequency changed.
+			if (disjoint.Disjoint || 0u == disjoint.Frequency || end < begin) {
+				continue;
+			}
+
+			m_time = 1000.0 * static_cast< F64 >(end - begin)
+				            / static_cast< F64 >(disjoint.Frequency);
+			resolved = true;
+		}
+
+		return resolved;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,203 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "direct3d11.hpp"
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of GPU timers measuring the GPU time of frames with timestamp
+	 queries.
+
+	 The queries of a frame are read back a few frames later without
+	 stalling the CPU. If all queries are still pending, the frame is not
+	 measured.
+	 */
+	class GPUTimer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a GPU timer.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @throws		Exception
+						Failed to create the queries of this GPU timer.
+		 */
+		explicit GPUTimer(ID3D11Device& device);
+
+		/**
+		 Constructs a GPU timer from the given GPU timer.
+
+		 @param[in]		timer
+						A reference to the GPU timer to copy.
+		 */
+		GPUTimer(const GPUTimer& timer) = delete;
+
+		/**
+		 Constructs a GPU timer by moving the given GPU timer.
+
+		 @param[in]		timer
+						A reference to the GPU timer to move.
+		 */
+		GPUTimer(GPUTimer&& timer) noexcept;
+
+		/**
+		 Destructs this GPU timer.
+		 */
+		~GPUTimer();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given GPU timer to this GPU timer.
+
+		 @param[in]		timer
+						A reference to the GPU timer to copy.
+		 @return		A reference to the copy of the given GPU timer (i.e.
+						this GPU timer).
+		 */
+		GPUTimer& operator=(const GPUTimer& timer) = delete;
+
+		/**
+		 Moves the given GPU timer to this GPU timer.
+
+		 @param[in]		timer
+						A reference to the GPU timer to move.
+		 @return		A reference to the moved GPU timer (i.e. this GPU
+						timer).
+		 */
+		GPUTimer& operator=(GPUTimer&& timer) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Begins measuring the GPU time of the current frame.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 */
+		void Begin(ID3D11DeviceContext& device_context) noexcept;
+
+		/**
+		 Ends measuring the GPU time of the current frame.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 */
+		void End(ID3D11DeviceContext& device_context) noexcept;
+
+		/**
+		 Reads back the GPU times of the measured frames whose queries are
+		 available.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @return		@c true if the GPU time of at least one frame is read
+						back. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool Resolve(ID3D11DeviceContext& device_context) noexcept;
+
+		/**
+		 Returns the GPU time (in milliseconds) of the last read back frame
+		 of this GPU timer.
+
+		 @return		The GPU time (in milliseconds) of the last read back
+						frame of this GPU timer.
+		 */
+		[[nodiscard]]
+		F64 GetTime() const noexcept {
+			return m_time;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of the queries of a single measured frame.
+		 */
+		struct FrameQueries {
+
+		public:
+
+			/**
+			 A pointer to the timestamp disjoint query of this frame.
+			 */
+			ComPtr< ID3D11Query > m_disjoint;
+
+			/**
+			 A pointer to the timestamp query at the beginning of this frame.
+			 */
+			ComPtr< ID3D11Query > m_begin;
+
+			/**
+			 A pointer to the timestamp query at the end of this frame.
+			 */
+			ComPtr< ID3D11Query > m_end;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The queries of the measured frames of this GPU timer.
+		 */
+		std::array< FrameQueries, 4 > m_frames;
+
+		/**
+		 The index of the queries of the next measured frame of this GPU
+		 timer.
+		 */
+		std::size_t m_index;
+
+		/**
+		 The number of measured frames of this GPU timer which are not read
+		 back yet.
+		 */
+		std::size_t m_nb_pending;
+
+		/**
+		 A flag indicating whether this GPU timer measures the current frame.
+		 */
+		bool m_measuring;
+
+		/**
+		 The GPU time (in milliseconds) of the last read back frame of this
+		 GPU timer.
+		 */
+		F64 m_time;
+	};
+}
\ No newline at end of file
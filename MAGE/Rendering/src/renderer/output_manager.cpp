@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\output_manager.hpp"
-#include "renderer\pipeline.hpp"
-#include "exception\exception.hpp"
+#include "renderer/output_manager.hpp"
+#include "renderer/pipeline.hpp"
+#include "exception/exception.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\swap_chain.hpp"
+#include "renderer/swap_chain.hpp"
 
 #pragma endregion
 
@@ -3,8 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pass\aa_pass.hpp"
-#include "resource\shader\shader_factory.hpp"
+#include "renderer/pass/aa_pass.hpp"
+#include "system/profiler.hpp"
+#include "resource/shader/shader_factory.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -32,6 +33,8 @@ namespace mage::rendering {
 	void AAPass::DispatchPreprocess(const U32x2& viewport_size,
 									AntiAliasing aa) {
 
+		MAGE_PROFILE_SCOPE("AAPass::DispatchPreprocess");
+
 		// CS: Bind the compute shader.
 		switch (aa) {
 
@@ -57,6 +60,8 @@ namespace mage::rendering {
 	void AAPass::Dispatch(const U32x2& viewport_size,
 						  AntiAliasing aa) {
 
+		MAGE_PROFILE_SCOPE("AAPass::Dispatch");
+
 		// CS: Bind the compute shader.
 		switch (aa) {
 
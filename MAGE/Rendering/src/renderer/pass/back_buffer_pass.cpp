@@ -3,8 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pass\back_buffer_pass.hpp"
-#include "resource\shader\shader_factory.hpp"
+#include "renderer/pass/back_buffer_pass.hpp"
+#include "system/profiler.hpp"
+#include "resource/shader/shader_factory.hpp"
 
 #pragma endregion
 
@@ -54,6 +55,8 @@ namespace mage::rendering {
 	}
 
 	void BackBufferPass::Render() {
+		MAGE_PROFILE_SCOPE("BackBufferPass::Render");
+
 		// Bind the fixed state.
 		BindFixedState();
 
@@ -3,8 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pass\deferred_pass.hpp"
-#include "resource\shader\shader_factory.hpp"
+#include "renderer/pass/deferred_pass.hpp"
+#include "system/profiler.hpp"
+#include "resource/shader/shader_factory.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -54,6 +55,8 @@ namespace mage::rendering {
 	}
 
 	void DeferredPass::Render(BRDF brdf, bool vct) {
+		MAGE_PROFILE_SCOPE("DeferredPass::Render");
+
 		// Binds the fixed state.
 		BindFixedState();
 
@@ -68,6 +71,8 @@ namespace mage::rendering {
 	void DeferredPass::Dispatch(const U32x2& viewport_size,
 								BRDF brdf, bool vct) {
 
+		MAGE_PROFILE_SCOPE("DeferredPass::Dispatch");
+
 		const auto cs = CreateDeferredCS(m_resource_manager, brdf, vct);
 		// CS: Bind the compute shader.
 		cs->BindShader(m_device_context);
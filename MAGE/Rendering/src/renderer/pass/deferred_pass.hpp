@@ -5,9 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\configuration.hpp"
-#include "renderer\state_manager.hpp"
-#include "resource\rendering_resource_manager.hpp"
+#include "renderer/configuration.hpp"
+#include "renderer/state_manager.hpp"
+#include "resource/rendering_resource_manager.hpp"
 
 #pragma endregion
 
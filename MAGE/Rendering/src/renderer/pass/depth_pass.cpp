@@ -3,8 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pass\depth_pass.hpp"
-#include "resource\shader\shader_factory.hpp"
+#include "renderer/pass/depth_pass.hpp"
+#include "system/profiler.hpp"
+#include "resource/shader/shader_factory.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -83,6 +84,8 @@ namespace mage::rendering {
 	void XM_CALLCONV DepthPass::Render(const World& world,
 									   FXMMATRIX world_to_camera,
 									   CXMMATRIX camera_to_projection) {
+		MAGE_PROFILE_SCOPE("DepthPass::Render");
+
 		// Bind the projection data.
 		BindCamera(world_to_camera, camera_to_projection);
 
@@ -130,6 +133,8 @@ namespace mage::rendering {
 	void XM_CALLCONV DepthPass::RenderOccluders(const World& world,
 												FXMMATRIX world_to_camera,
 												CXMMATRIX camera_to_projection) {
+		MAGE_PROFILE_SCOPE("DepthPass::RenderOccluders");
+
 		// Bind the projection data.
 		BindCamera(world_to_camera, camera_to_projection);
 
@@ -184,7 +189,9 @@ namespace mage::rendering {
 		const auto  object_to_projection = object_to_world * world_to_projection;
 
 		// Apply view frustum culling.
+		++Pipeline::s_nb_culling_tests;
 		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
+			++Pipeline::s_nb_culled;
 			return;
 		}
 
@@ -193,7 +200,7 @@ namespace mage::rendering {
 		// Bind the mesh of the model.
 		model.BindMesh(m_device_context);
 		// Draw the model.
-		model.Draw(m_device_context);
+		model.Draw(m_device_context, object_to_projection, true);
 	}
 
 	void XM_CALLCONV DepthPass::RenderTransparent(const Model& model,
@@ -204,7 +211,9 @@ namespace mage::rendering {
 		const auto  object_to_projection = object_to_world * world_to_projection;
 
 		// Apply view frustum culling.
+		++Pipeline::s_nb_culling_tests;
 		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
+			++Pipeline::s_nb_culled;
 			return;
 		}
 
@@ -217,6 +226,6 @@ namespace mage::rendering {
 		// Bind the mesh of the model.
 		model.BindMesh(m_device_context);
 		// Draw the model.
-		model.Draw(m_device_context);
+		model.Draw(m_device_context, object_to_projection, true);
 	}
 }
\ No newline at end of file
@@ -5,9 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\state_manager.hpp"
-#include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
+#include "renderer/state_manager.hpp"
+#include "resource/rendering_resource_manager.hpp"
+#include "scene/rendering_world.hpp"
 
 #pragma endregion
 
@@ -3,9 +3,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pass\forward_pass.hpp"
-#include "resource\shader\shader_factory.hpp"
-#include "resource\texture\texture_factory.hpp"
+#include "renderer/pass/forward_pass.hpp"
+#include "system/profiler.hpp"
+#include "resource/shader/shader_factory.hpp"
+#include "resource/texture/texture_factory.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -119,6 +120,8 @@ namespace mage::rendering {
 	void XM_CALLCONV ForwardPass::Render(const World& world,
 										 FXMMATRIX world_to_projection,
 										 BRDF brdf, bool vct) const {
+		MAGE_PROFILE_SCOPE("ForwardPass::Render");
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -145,7 +148,7 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model, world_to_projection, true);
 		});
 
 		//---------------------------------------------------------------------
@@ -171,7 +174,7 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model, world_to_projection, true);
 		});
 
 		//---------------------------------------------------------------------
@@ -197,12 +200,14 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model, world_to_projection, true);
 		});
 	}
 
 	void XM_CALLCONV ForwardPass::RenderSolid(const World& world,
 											  FXMMATRIX world_to_projection) const {
+		MAGE_PROFILE_SCOPE("ForwardPass::RenderSolid");
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -221,12 +226,14 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model, world_to_projection, true);
 		});
 	}
 
 	void XM_CALLCONV ForwardPass::RenderGBuffer(const World& world,
 												FXMMATRIX world_to_projection) const {
+		MAGE_PROFILE_SCOPE("ForwardPass::RenderGBuffer");
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -252,7 +259,7 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model, world_to_projection, true);
 		});
 
 		//---------------------------------------------------------------------
@@ -277,12 +284,14 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model, world_to_projection, true);
 		});
 	}
 
 	void XM_CALLCONV ForwardPass::RenderEmissive(const World& world,
 												 FXMMATRIX world_to_projection) const {
+		MAGE_PROFILE_SCOPE("ForwardPass::RenderEmissive");
+
 		constexpr bool transparency = false;
 
 		// Bind the fixed opaque state.
@@ -309,7 +318,7 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model, world_to_projection, true);
 		});
 	}
 
@@ -317,6 +326,8 @@ namespace mage::rendering {
 													FXMMATRIX world_to_projection,
 													BRDF brdf,
 													bool vct) const {
+		MAGE_PROFILE_SCOPE("ForwardPass::RenderTransparent");
+
 		// Bind the fixed transparent state.
 		BindFixedTransparentState();
 
@@ -344,7 +355,7 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model, world_to_projection, true);
 		});
 
 		//---------------------------------------------------------------------
@@ -371,7 +382,7 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model, world_to_projection, true);
 		});
 
 		//---------------------------------------------------------------------
@@ -398,13 +409,15 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model, world_to_projection, true);
 		});
 	}
 
 	void XM_CALLCONV ForwardPass::RenderFalseColor(const World& world,
 												   FXMMATRIX world_to_projection,
 												   FalseColor false_color) const {
+		MAGE_PROFILE_SCOPE("ForwardPass::RenderFalseColor");
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -428,12 +441,14 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model, world_to_projection, true);
 		});
 	}
 
 	void XM_CALLCONV ForwardPass::RenderWireframe(const World& world,
 												  FXMMATRIX world_to_projection) {
+		MAGE_PROFILE_SCOPE("ForwardPass::RenderWireframe");
+
 		// Bind the fixed opaque state.
 		BindFixedWireframeState();
 
@@ -457,19 +472,22 @@ namespace mage::rendering {
 				return;
 			}
 
-			Render(model, world_to_projection);
+			Render(model, world_to_projection, false);
 		});
 	}
 
 	void XM_CALLCONV ForwardPass::Render(const Model& model,
-										 FXMMATRIX world_to_projection) const noexcept {
+										 FXMMATRIX world_to_projection,
+										 bool cone_culling) const noexcept {
 
 		const auto& transform            = model.GetOwner()->GetTransform();
 		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
 		const auto  object_to_projection = object_to_world * world_to_projection;
 
 		// Apply view frustum culling.
+		++Pipeline::s_nb_culling_tests;
 		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
+			++Pipeline::s_nb_culled;
 			return;
 		}
 
@@ -491,6 +509,6 @@ namespace mage::rendering {
 		// Bind the mesh of the model.
 		model.BindMesh(m_device_context);
 		// Draw the model.
-		model.Draw(m_device_context);
+		model.Draw(m_device_context, object_to_projection, cone_culling);
 	}
 }
\ No newline at end of file
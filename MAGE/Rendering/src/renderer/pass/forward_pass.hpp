@@ -5,10 +5,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\configuration.hpp"
-#include "renderer\state_manager.hpp"
-#include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
+#include "renderer/configuration.hpp"
+#include "renderer/state_manager.hpp"
+#include "resource/rendering_resource_manager.hpp"
+#include "scene/rendering_world.hpp"
 
 #pragma endregion
 
@@ -240,9 +240,14 @@ namespace mage::rendering {
 						A reference to the model.
 		 @param[in]		world_to_projection
 						The world-to-projection transformation matrix.
+		 @param[in]		cone_culling
+						@c true if back facing model clusters need to be
+						culled (i.e. back face culling is enabled). @c false
+						otherwise.
 		 */
 		void XM_CALLCONV Render(const Model& model,
-								FXMMATRIX world_to_projection) const noexcept;
+								FXMMATRIX world_to_projection,
+								bool cone_culling) const noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -3,7 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pass\lbuffer_pass.hpp"
+#include "renderer/pass/lbuffer_pass.hpp"
+#include "system/profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -48,6 +49,8 @@ namespace mage::rendering {
 		::Render(const World& world,
 				 FXMMATRIX world_to_projection) {
 
+		MAGE_PROFILE_SCOPE("LBufferPass::Render");
+
 		// Process the lights.
 		ProcessDirectionalLights(world, world_to_projection);
 		ProcessOmniLights(world, world_to_projection);
@@ -166,7 +169,9 @@ namespace mage::rendering {
 			const auto  light_to_projection = light_to_world * world_to_projection;
 
 			// Cull the light against the view frustum.
+			++Pipeline::s_nb_culling_tests;
 			if (BoundingFrustum::Cull(light_to_projection, light.GetAABB())) {
+				++Pipeline::s_nb_culled;
 				return;
 			}
 
@@ -237,7 +242,9 @@ namespace mage::rendering {
 			const auto  light_to_projection = light_to_world * world_to_projection;
 
 			// Cull the light against the view frustum.
+			++Pipeline::s_nb_culling_tests;
 			if (BoundingFrustum::Cull(light_to_projection, light.GetBoundingSphere())) {
+				++Pipeline::s_nb_culled;
 				return;
 			}
 
@@ -311,7 +318,9 @@ namespace mage::rendering {
 			const auto  light_to_projection = light_to_world * world_to_projection;
 
 			// Cull the light against the view frustum.
+			++Pipeline::s_nb_culling_tests;
 			if (BoundingFrustum::Cull(light_to_projection, light.GetAABB())) {
+				++Pipeline::s_nb_culled;
 				return;
 			}
 
@@ -413,6 +422,8 @@ namespace mage::rendering {
 	}
 
 	void XM_CALLCONV LBufferPass::RenderShadowMaps(const World& world) {
+		MAGE_PROFILE_SCOPE("LBufferPass::RenderShadowMaps");
+
 		// Bind the fixed state.
 		m_depth_pass->BindFixedState();
 
@@ -5,10 +5,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\buffer\structured_buffer.hpp"
-#include "renderer\buffer\scene_buffer.hpp"
-#include "renderer\buffer\shadow_map_buffer.hpp"
-#include "renderer\pass\depth_pass.hpp"
+#include "renderer/buffer/structured_buffer.hpp"
+#include "renderer/buffer/scene_buffer.hpp"
+#include "renderer/buffer/shadow_map_buffer.hpp"
+#include "renderer/pass/depth_pass.hpp"
 
 #pragma endregion
 
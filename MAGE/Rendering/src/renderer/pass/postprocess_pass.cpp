@@ -3,8 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pass\postprocess_pass.hpp"
-#include "resource\shader\shader_factory.hpp"
+#include "renderer/pass/postprocess_pass.hpp"
+#include "system/profiler.hpp"
+#include "resource/shader/shader_factory.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -22,7 +23,8 @@ namespace mage::rendering {
 		: m_device_context(device_context),
 		m_state_manager(state_manager),
 		m_resource_manager(resource_manager),
-		m_dof_cs(CreateDepthOfFieldCS(resource_manager)) {}
+		m_dof_cs(CreateDepthOfFieldCS(resource_manager)),
+		m_upsample_cs(CreateUpsampleCS(resource_manager)) {}
 
 	PostProcessPass::PostProcessPass(PostProcessPass&& pass) noexcept = default;
 
@@ -32,6 +34,8 @@ namespace mage::rendering {
 		::operator=(PostProcessPass&& pass) noexcept = default;
 
 	void PostProcessPass::DispatchDOF(const U32x2& viewport_size) const noexcept {
+		MAGE_PROFILE_SCOPE("PostProcessPass::DispatchDOF");
+
 		// CS: Bind the compute shader.
 		m_dof_cs->BindShader(m_device_context);
 
@@ -46,6 +50,8 @@ namespace mage::rendering {
 	void PostProcessPass::DispatchLDR(const U32x2& viewport_size,
 									  ToneMapping tone_mapping) const noexcept {
 
+		MAGE_PROFILE_SCOPE("PostProcessPass::DispatchLDR");
+
 		// CS: Bind the compute shader.
 		const auto cs = CreateLowDynamicRangeCS(m_resource_manager,
 												tone_mapping);
@@ -58,4 +64,18 @@ namespace mage::rendering {
 												   GROUP_SIZE_2D_DEFAULT);
 		Pipeline::Dispatch(m_device_context, nb_groups_x, nb_groups_y, 1u);
 	}
+
+	void PostProcessPass::DispatchUpsample(const U32x2& viewport_size) const noexcept {
+		MAGE_PROFILE_SCOPE("PostProcessPass::DispatchUpsample");
+
+		// CS: Bind the compute shader.
+		m_upsample_cs->BindShader(m_device_context);
+
+		// Dispatch the pass.
+		const auto nb_groups_x = GetNumberOfGroups(viewport_size[0],
+												   GROUP_SIZE_2D_DEFAULT);
+		const auto nb_groups_y = GetNumberOfGroups(viewport_size[1],
+												   GROUP_SIZE_2D_DEFAULT);
+		Pipeline::Dispatch(m_device_context, nb_groups_x, nb_groups_y, 1u);
+	}
 }
\ No newline at end of file
@@ -5,9 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\configuration.hpp"
-#include "renderer\state_manager.hpp"
-#include "resource\rendering_resource_manager.hpp"
+#include "renderer/configuration.hpp"
+#include "renderer/state_manager.hpp"
+#include "resource/rendering_resource_manager.hpp"
 
 #pragma endregion
 
@@ -110,6 +110,14 @@ namespace mage::rendering {
 		void DispatchLDR(const U32x2& viewport_size,
 						 ToneMapping tone_mapping) const noexcept;
 
+		/**
+		 Dispatches an upsample pass.
+
+		 @param[in]		viewport_size
+						A reference to the (output) viewport size.
+		 */
+		void DispatchUpsample(const U32x2& viewport_size) const noexcept;
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -135,5 +143,10 @@ namespace mage::rendering {
 		 A pointer to the compute shader of this post-process pass.
 		 */
 		ComputeShaderPtr m_dof_cs;
+
+		/**
+		 A pointer to the upsample compute shader of this post-process pass.
+		 */
+		ComputeShaderPtr m_upsample_cs;
 	};
 }
\ No newline at end of file
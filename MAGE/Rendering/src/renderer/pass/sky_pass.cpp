@@ -3,8 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pass\sky_pass.hpp"
-#include "resource\shader\shader_factory.hpp"
+#include "renderer/pass/sky_pass.hpp"
+#include "system/profiler.hpp"
+#include "resource/shader/shader_factory.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -61,6 +62,8 @@ namespace mage::rendering {
 	}
 
 	void SkyPass::Render(ID3D11ShaderResourceView* sky) const noexcept {
+		MAGE_PROFILE_SCOPE("SkyPass::Render");
+
 		if (!sky) {
 			return;
 		}
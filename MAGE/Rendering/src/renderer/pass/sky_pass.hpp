@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\state_manager.hpp"
-#include "resource\rendering_resource_manager.hpp"
+#include "renderer/state_manager.hpp"
+#include "resource/rendering_resource_manager.hpp"
 
 #pragma endregion
 
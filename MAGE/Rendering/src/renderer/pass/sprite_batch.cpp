@@ -3,18 +3,28 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pass\sprite_batch.hpp"
-#include "collection\vector.hpp"
-#include "resource\mesh\sprite_batch_mesh.hpp"
-#include "resource\mesh\vertex.hpp"
-#include "resource\texture\texture.hpp"
-#include "logging\logging.hpp"
+#include "renderer/pass/sprite_batch.hpp"
+#include "renderer/pass/sprite_sort.hpp"
+#include "collection/vector.hpp"
+#include "resource/mesh/sprite_batch_mesh.hpp"
+#include "resource/mesh/vertex.hpp"
+#include "resource/texture/texture.hpp"
+#include "logging/logging.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <unordered_map>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -23,138 +33,78 @@ namespace mage::rendering {
 	//-------------------------------------------------------------------------
 	// SpriteInfo
 	//-------------------------------------------------------------------------
-	namespace {
+	#pragma region
 
-		/**
-		 A struct of sprite info for a single sprite.
-		 */
-		struct alignas(16) SpriteInfo {
-
-		public:
-
-			//---------------------------------------------------------------------
-			// Class Member Variables
-			//---------------------------------------------------------------------
-
-			// Combine values from SpriteEffect with these internal-only flags.
-
-			/**
-			 Mask indicating whether the source region (top left, width and height)
-			 of sprite info structures is expressed in texels.
-			 */
-			static constexpr U32 s_source_in_texels = 4u;
-
-			/**
-			 Mask indicating whether the destination size (width and height) of
-			 sprite info structures is expressed in pixels.
-			 */
-			static constexpr U32 s_destination_size_in_pixels = 8u;
-
-			static_assert(((s_source_in_texels | s_destination_size_in_pixels)
-						  & static_cast< U32 >(SpriteEffect::MirrorXY)) == 0,
-						  "Flag bits must not overlap");
-
-			//---------------------------------------------------------------------
-			// Constructors and Destructors
-			//---------------------------------------------------------------------
-
-			/**
-			 Constructs a sprite info.
-			 */
-			SpriteInfo() noexcept
-				: m_source{},
-				m_destination{},
-				m_color{},
-				m_origin_rotation_depth{},
-				m_texture(nullptr),
-				m_flags(0u) {}
-
-			/**
-			 Constructs a sprite info from the given sprite info.
-
-			 @param[in]		sprite_info
-							A reference to the sprite info to copy.
-			 */
-			SpriteInfo(const SpriteInfo& sprite_info) noexcept = default;
-
-			/**
-			 Constructs a sprite info by moving the given sprite info.
-
-			 @param[in]		sprite_info
-							A reference to the sprite info to move.
-			 */
-			SpriteInfo(SpriteInfo&& sprite_info) noexcept = default;
-
-			/**
-			 Destructs this sprite info.
-			 */
-			~SpriteInfo() = default;
-
-			//---------------------------------------------------------------------
-			// Assignment Operators
-			//---------------------------------------------------------------------
-
-			/**
-			 Copies the given sprite info to this sprite info.
-
-			 @param[in]		sprite_info
-							A reference to the sprite info to copy.
-			 @return		A reference to the copy of the given sprite info (i.e.
-							this sprite info).
-			 */
-			SpriteInfo& operator=(const SpriteInfo& sprite_info) noexcept = default;
-
-			/**
-			 Moves the given sprite info to this sprite info.
-
-			 @param[in]		sprite_info
-							A reference to the sprite info to move.
-			 @return		A reference to the moved sprite info (i.e. this sprite
-							info).
-			 */
-			SpriteInfo& operator=(SpriteInfo&& sprite_info) noexcept = default;
-
-			//---------------------------------------------------------------------
-			// Member Variables
-			//---------------------------------------------------------------------
-
-			/**
-			 The texture source region (Left Top Width Height) of the sprite
-			 associated with this sprite info.
-			 */
-			F32x4A m_source;
-
-			/**
-			 The translation and scale (Tx Ty Sx Sy) of the sprite associated with
-			 this sprite info.
-			 */
-			F32x4A m_destination;
-
-			/**
-			 The (linear) RGBA color of the sprite associated with this sprite
-			 info.
-			 */
-			F32x4A m_color;
-
-			/**
-			 The origin, rotation and depth (Ox Oy R D) of the sprite associated
-			 with this sprite info.
-			 */
-			F32x4A m_origin_rotation_depth;
-
-			/**
-			 A pointer to the shader resource view of the texture associated
-			 with this sprite info.
-			 */
-			ID3D11ShaderResourceView* m_texture;
-
-			/**
-			 The flags of the sprite associated with this sprite info.
-			 */
-			U32 m_flags;
+	SpriteInfo::SpriteInfo(ID3D11ShaderResourceView* texture,
+						   const U32x2& texture_size,
+						   FXMVECTOR color,
+						   SpriteEffect effects,
+						   const SpriteTransform2D& transform,
+						   const RECT* source) noexcept
+		: SpriteInfo() {
+
+		// destination: [Tx Ty Sx Sy]
+		const XMVECTOR destination = {
+			transform.GetTranslationX(),
+			transform.GetTranslationY(),
+			transform.GetScaleX(),
+			transform.GetScaleY()
+		};
+		// origin_rotation_depth: [ROx ROy R D]
+		const XMVECTOR origin_rotation_depth = {
+			transform.GetRotationOriginX(),
+			transform.GetRotationOriginY(),
+			transform.GetRotation(),
+			transform.GetDepth()
 		};
+		auto flags = static_cast< U32 >(effects);
+		auto dst   = destination;
+
+		if (source) {
+			// If a source is given, the source region is represented in
+			// (absolute) texel coordinates.
+			const auto src = XMVectorLeftTopWidthHeight(*source);
+			m_source = XMStore< F32x4A >(src);
+
+			// If the destination size is relative to the texture region
+			// (i.e. multiplier), the destination size is represented in
+			// (absolute) pixel coordinates.
+			if (false == (flags & SpriteInfo::s_destination_size_in_pixels)) {
+				dst = XMVectorPermute< 0, 1, 6, 7 >(dst, dst * src);
+			}
+
+			flags |= SpriteInfo::s_source_in_texels
+				  |  SpriteInfo::s_destination_size_in_pixels;
+
+			//-----------------------------------------------------------------
+			// Source region    is represented in absolute texel coordinates.
+			// Destination size is represented in absolute pixel coordinates.
+			// E.g. SpriteText
+			//-----------------------------------------------------------------
+		}
+		else {
+			// If no source is given, the source region is represented in
+			// (relative) texel (UV) coordinates.
+			static const XMVECTORF32 src = { 0.0f, 0.0f, 1.0f, 1.0f };
+			m_source = XMStore< F32x4A >(src);
+
+			//-----------------------------------------------------------------
+			// Source region    is represented in relative texel coordinates.
+			// Destination size is represented in relative pixel coordinates.
+			// E.g. SpriteImage
+			//-----------------------------------------------------------------
+		}
+
+		m_destination           = XMStore< F32x4A >(dst);
+		m_color                 = XMStore< F32x4A >(color);
+		m_origin_rotation_depth = XMStore< F32x4A >(origin_rotation_depth);
+		m_texture               = texture;
+		m_texture_size          = texture_size;
+		m_flags                 = flags;
 	}
 
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// SpriteBatch::Impl
 	//-------------------------------------------------------------------------
@@ -247,6 +197,8 @@ namespace mage::rendering {
 		 @param[in]		texture
 						A pointer to the shader resource view of the texture to
 						draw.
+		 @param[in]		texture_size
+						The size [width, height] of the texture to draw.
 		 @param[in]		color
 						The (linear) RGBA color.
 		 @param[in]		effects
@@ -257,11 +209,21 @@ namespace mage::rendering {
 						A pointer the rectangular subregion of the texture.
 		 */
 		void XM_CALLCONV Draw(ID3D11ShaderResourceView* texture,
+			                  const U32x2& texture_size,
 			                  FXMVECTOR color,
 			                  SpriteEffect effects,
 			                  const SpriteTransform2D& transform,
 			                  const RECT* source = nullptr);
 
+		/**
+		 Draws the given sprites.
+
+		 @pre			This sprite batch is inside a begin/end pair.
+		 @param[in]		sprites
+						A span containing the sprites.
+		 */
+		void Draw(gsl::span< const SpriteInfo > sprites);
+
 		/**
 		 Ends the processing of a batch of sprites.
 
@@ -306,10 +268,15 @@ namespace mage::rendering {
 		 Draws a subbatch of sprites of the current batch of sprites
 		 of this sprite batch.
 
+		 The size of the texture is taken from the first sprite (i.e. stored
+		 at the creation of the sprite info data) instead of being queried
+		 from the texture.
+
 		 @pre			@a sprites is not equal to @c nullptr.
 		 @pre			@a sprites points to an array containing at least
 						@a nb_sprites sprite info data pointers which are not
 						equal to @c nullptr.
+		 @pre			@a nb_sprites is not equal to zero.
 		 @param[in]		texture
 						A pointer to the shader resource view of the texture
 						that needs to be rendered.
@@ -343,6 +310,36 @@ namespace mage::rendering {
 			                           FXMVECTOR texture_size,
 			                           FXMVECTOR inverse_texture_size) noexcept;
 
+		/**
+		 Prepares a group of {@link mage::rendering::SpriteBatch::Impl::s_sprites_per_group}
+		 sprites for rendering.
+
+		 The sprites are transposed to SoA form (i.e. each SIMD lane contains
+		 the data of a different sprite) and expanded together.
+
+		 @pre			@a sprites points to an array containing at least
+						{@link mage::rendering::SpriteBatch::Impl::s_sprites_per_group}
+						sprite info data pointers which are not equal to
+						@c nullptr.
+		 @pre			@a vertices is not equal to @c nullptr.
+		 @pre			@a vertices points to an array containing at least
+						{@link mage::rendering::SpriteBatch::Impl::s_sprites_per_group}
+						*
+						{@link mage::rendering::SpriteBatchMesh::s_vertices_per_sprite}.
+		 @param[in]		sprites
+						A pointer to the sprite info data pointers.
+		 @param[in]		vertices
+						A pointer to the vertices for the sprites.
+		 @param[in]		texture_size
+						The size of the texture (in the number of texels).
+		 @param[in]		inverse_texture_size
+						The inverse of @a texture_size.
+		 */
+		void XM_CALLCONV PrepareSprites(const SpriteInfo* const* sprites,
+			                            VertexPositionColorTexture* vertices,
+			                            FXMVECTOR texture_size,
+			                            FXMVECTOR inverse_texture_size) noexcept;
+
 		//---------------------------------------------------------------------
 		// Class Member Variables
 		//---------------------------------------------------------------------
@@ -353,6 +350,12 @@ namespace mage::rendering {
 		 */
 		static constexpr std::size_t s_initial_capacity = 64u;
 
+		/**
+		 The number of sprites which are prepared together for rendering
+		 (i.e. the number of SIMD lanes).
+		 */
+		static constexpr std::size_t s_sprites_per_group = 4u;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Rendering
 		//---------------------------------------------------------------------
@@ -406,6 +409,25 @@ namespace mage::rendering {
 		 batch.
 		 */
 		std::vector< const SpriteInfo* > m_sorted_sprites;
+
+		/**
+		 A vector containing the sort keys of the sprites of this sprite
+		 batch.
+		 */
+		std::vector< SpriteSortKey > m_sort_keys;
+
+		/**
+		 A vector used as scratch buffer for sorting the sort keys of the
+		 sprites of this sprite batch.
+		 */
+		std::vector< SpriteSortKey > m_sort_buffer;
+
+		/**
+		 A map containing the identifiers of the textures of the sprites of
+		 this sprite batch. The identifiers are assigned in order of first
+		 appearance.
+		 */
+		std::unordered_map< ID3D11ShaderResourceView*, U32 > m_texture_ids;
 	};
 
 	SpriteBatch::Impl::Impl(ID3D11Device& device,
@@ -416,7 +438,10 @@ namespace mage::rendering {
 		m_in_begin_end_pair(false),
 		m_sort_mode(SpriteSortMode::Deferred),
 		m_sprites(),
-		m_sorted_sprites() {
+		m_sorted_sprites(),
+		m_sort_keys(),
+		m_sort_buffer(),
+		m_texture_ids() {
 
 		m_sprites.reserve(s_initial_capacity);
 	}
@@ -447,85 +472,37 @@ namespace mage::rendering {
 	}
 
 	void XM_CALLCONV SpriteBatch::Impl::Draw(ID3D11ShaderResourceView* texture,
+											 const U32x2& texture_size,
 											 FXMVECTOR color,
 											 SpriteEffect effects,
 											 const SpriteTransform2D& transform,
 											 const RECT* source) {
 
-		// This SpriteBatch must already be in a begin/end pair.
-		Assert(m_in_begin_end_pair);
-
-		// destination: [Tx Ty Sx Sy]
-		const XMVECTOR destination = {
-			transform.GetTranslationX(),
-			transform.GetTranslationY(),
-			transform.GetScaleX(),
-			transform.GetScaleY()
-		};
-		// origin_rotation_depth: [ROx ROy R D]
-		const XMVECTOR origin_rotation_depth = {
-			transform.GetRotationOriginX(),
-			transform.GetRotationOriginY(),
-			transform.GetRotation(),
-			transform.GetDepth()
-		};
-		auto flags = static_cast< U32 >(effects);
-		auto dst   = destination;
-
-		SpriteInfo sprite;
-
-		if (source) {
-			// If a source is given, the source region is represented in
-			// (absolute) texel coordinates.
-			const auto src = XMVectorLeftTopWidthHeight(*source);
-			sprite.m_source = XMStore< F32x4A >(src);
-
-			// If the destination size is relative to the texture region
-			// (i.e. multiplier), the destination size is represented in
-			// (absolute) pixel coordinates.
-			if (false == (flags & SpriteInfo::s_destination_size_in_pixels)) {
-				dst = XMVectorPermute< 0, 1, 6, 7 >(dst, dst * src);
-			}
-
-			flags |= SpriteInfo::s_source_in_texels
-				  |  SpriteInfo::s_destination_size_in_pixels;
-
-			//-----------------------------------------------------------------
-			// Source region    is represented in absolute texel coordinates.
-			// Destination size is represented in absolute pixel coordinates.
-			// E.g. SpriteText
-			//-----------------------------------------------------------------
-		}
-		else {
-			// If no source is given, the source region is represented in
-			// (relative) texel (UV) coordinates.
-			static const XMVECTORF32 src = { 0.0f, 0.0f, 1.0f, 1.0f };
-			sprite.m_source = XMStore< F32x4A >(src);
+		const SpriteInfo sprite(texture, texture_size, color, effects,
+								transform, source);
+		Draw(gsl::make_span(&sprite, 1u));
+	}
 
-			//-----------------------------------------------------------------
-			// Source region    is represented in relative texel coordinates.
-			// Destination size is represented in relative pixel coordinates.
-			// E.g. SpriteImage
-			//-----------------------------------------------------------------
-		}
+	void SpriteBatch::Impl::Draw(gsl::span< const SpriteInfo > sprites) {
+		using std::cbegin;
+		using std::cend;
 
-		sprite.m_destination           = XMStore< F32x4A >(dst);
-		sprite.m_color                 = XMStore< F32x4A >(color);
-		sprite.m_origin_rotation_depth = XMStore< F32x4A >(origin_rotation_depth);
-		sprite.m_texture               = texture;
-		sprite.m_flags                 = flags;
+		// This SpriteBatch must already be in a begin/end pair.
+		Assert(m_in_begin_end_pair);
 
 		if (SpriteSortMode::Immediate == m_sort_mode) {
-			const auto sprites = &sprite;
-			Render(texture, &sprites, 1u);
+			for (const auto& sprite : sprites) {
+				const auto sprite_ptr = &sprite;
+				Render(sprite.m_texture, &sprite_ptr, 1u);
+			}
 		}
 		else {
-
-			if (m_sprites.size() == m_sprites.capacity()) {
-				m_sprites.reserve(2 * m_sprites.capacity());
+			const auto size = m_sprites.size() + sprites.size();
+			if (size > m_sprites.capacity()) {
+				m_sprites.reserve(std::max(size, 2 * m_sprites.capacity()));
 			}
 
-			m_sprites.push_back(std::move(sprite));
+			m_sprites.insert(m_sprites.cend(), cbegin(sprites), cend(sprites));
 		}
 	}
 
@@ -586,45 +563,61 @@ namespace mage::rendering {
 	}
 
 	void SpriteBatch::Impl::SortSprites() {
-		using std::begin;
-		using std::end;
-
 		m_sorted_sprites.reserve(m_sprites.capacity());
-		for (const auto& sprite : m_sprites) {
-			m_sorted_sprites.push_back(&sprite);
-		}
 
-		switch (m_sort_mode) {
+		const auto sort_mode = m_sort_mode;
+		if (SpriteSortMode::Deferred     == sort_mode
+			|| SpriteSortMode::Immediate == sort_mode) {
 
-		case SpriteSortMode::Texture: {
-			std::sort(begin(m_sorted_sprites), end(m_sorted_sprites),
-				      [](const SpriteInfo* lhs, const SpriteInfo* rhs) noexcept {
-					     return lhs->m_texture < rhs->m_texture;
-				      });
-			break;
+			for (const auto& sprite : m_sprites) {
+				m_sorted_sprites.push_back(&sprite);
+			}
+			return;
 		}
 
-		case SpriteSortMode::BackToFront: {
-			std::sort(begin(m_sorted_sprites), end(m_sorted_sprites),
-				      [](const SpriteInfo* lhs, const SpriteInfo* rhs) noexcept {
-					     return lhs->m_origin_rotation_depth[3]
-							  > rhs->m_origin_rotation_depth[3];
-				      });
-			break;
-		}
+		const bool use_texture = SpriteSortMode::Texture == sort_mode
+			                  || SpriteSortMode::BackToFrontThenTexture == sort_mode;
+		const bool use_depth   = SpriteSortMode::Texture != sort_mode;
 
-		case SpriteSortMode::FrontToBack: {
-			std::sort(begin(m_sorted_sprites), end(m_sorted_sprites),
-				      [](const SpriteInfo* lhs, const SpriteInfo* rhs) noexcept {
-					     return lhs->m_origin_rotation_depth[3]
-							  < rhs->m_origin_rotation_depth[3];
-				      });
-			break;
-		}
+		// Construct the sort keys: [depth (32 bits), texture (32 bits)]. The
+		// submission order is preserved by the stability of the sort.
+		m_sort_keys.clear();
+		m_sort_keys.reserve(m_sprites.size());
+		m_texture_ids.clear();
+
+		ID3D11ShaderResourceView* last_texture = nullptr;
+		U32 last_texture_id = 0u;
 
-		default: {
-			break;
+		for (std::size_t i = 0u; i < m_sprites.size(); ++i) {
+			const auto& sprite = m_sprites[i];
+			U64 key = 0u;
+
+			if (use_depth) {
+				auto depth = ToOrderedBits(sprite.m_origin_rotation_depth[3]);
+				if (SpriteSortMode::FrontToBack != sort_mode) {
+					depth = ~depth;
+				}
+				key |= static_cast< U64 >(depth) << 32u;
+			}
+
+			if (use_texture) {
+				// Consecutive sprites typically share their texture.
+				if (sprite.m_texture != last_texture || 0u == i) {
+					const auto id = static_cast< U32 >(m_texture_ids.size());
+					last_texture    = sprite.m_texture;
+					last_texture_id = m_texture_ids.try_emplace(last_texture,
+																id).first->second;
+				}
+				key |= last_texture_id;
+			}
+
+			m_sort_keys.push_back({ key, static_cast< U32 >(i) });
 		}
+
+		RadixSort(m_sort_keys, m_sort_buffer);
+
+		for (const auto& sort_key : m_sort_keys) {
+			m_sorted_sprites.push_back(&m_sprites[sort_key.m_index]);
 		}
 	}
 
@@ -635,7 +628,7 @@ namespace mage::rendering {
 		// Binds the texture.
 		Pipeline::PS::BindSRV(m_device_context, SLOT_SRV_SPRITE, texture);
 
-		const auto texture_size         = XMLoad(GetTexture2DSize(*texture));
+		const auto texture_size         = XMLoad(sprites[0]->m_texture_size);
 		const auto inverse_texture_size = XMVectorReciprocal(texture_size);
 
 		while (nb_sprites > 0u) {
@@ -672,7 +665,14 @@ namespace mage::rendering {
 				auto vertices = static_cast< VertexPositionColorTexture* >(mapped_buffer.pData)
 					+ m_mesh_position * SpriteBatchMesh::s_vertices_per_sprite;
 
-				for (std::size_t i = 0u; i < nb_sprites_to_render; ++i) {
+				std::size_t i = 0u;
+				for (; i + s_sprites_per_group <= nb_sprites_to_render;
+					 i += s_sprites_per_group) {
+
+					PrepareSprites(&sprites[i], vertices, texture_size, inverse_texture_size);
+					vertices += s_sprites_per_group * SpriteBatchMesh::s_vertices_per_sprite;
+				}
+				for (; i < nb_sprites_to_render; ++i) {
 					PrepareSprite(*sprites[i], vertices, texture_size, inverse_texture_size);
 					vertices += SpriteBatchMesh::s_vertices_per_sprite;
 				}
@@ -811,6 +811,132 @@ namespace mage::rendering {
 		}
 	}
 
+	void XM_CALLCONV SpriteBatch::Impl
+		::PrepareSprites(const SpriteInfo* const* sprites,
+		                 VertexPositionColorTexture* vertices,
+		                 FXMVECTOR texture_size,
+		                 FXMVECTOR inverse_texture_size) noexcept {
+
+		static_assert(4u == s_sprites_per_group,
+			          "The transposition must be updated to match");
+
+		// Transpose the sprite info data of the group (AoS) to SoA form.
+		// [L0 L1 L2 L3], [T0 T1 T2 T3], [W0 W1 W2 W3], [H0 H1 H2 H3]
+		const auto source = XMMatrixTranspose(XMMATRIX(
+			XMLoad(sprites[0]->m_source),
+			XMLoad(sprites[1]->m_source),
+			XMLoad(sprites[2]->m_source),
+			XMLoad(sprites[3]->m_source)));
+		// [Tx0 Tx1 Tx2 Tx3], [Ty0 ...], [Sx0 ...], [Sy0 ...]
+		const auto destination = XMMatrixTranspose(XMMATRIX(
+			XMLoad(sprites[0]->m_destination),
+			XMLoad(sprites[1]->m_destination),
+			XMLoad(sprites[2]->m_destination),
+			XMLoad(sprites[3]->m_destination)));
+		// [Ox0 Ox1 Ox2 Ox3], [Oy0 ...], [R0 ...], [D0 ...]
+		const auto origin_rotation_depth = XMMatrixTranspose(XMMATRIX(
+			XMLoad(sprites[0]->m_origin_rotation_depth),
+			XMLoad(sprites[1]->m_origin_rotation_depth),
+			XMLoad(sprites[2]->m_origin_rotation_depth),
+			XMLoad(sprites[3]->m_origin_rotation_depth)));
+
+		const auto flags = XMVectorSetInt(sprites[0]->m_flags,
+										  sprites[1]->m_flags,
+										  sprites[2]->m_flags,
+										  sprites[3]->m_flags);
+		const auto has_flag = [flags](U32 flag) noexcept {
+			const auto flag_v = XMVectorReplicateInt(flag);
+			return XMVectorEqualInt(XMVectorAndInt(flags, flag_v), flag_v);
+		};
+
+		auto source_x           = source.r[0];
+		auto source_y           = source.r[1];
+		auto source_width       = source.r[2];
+		auto source_height      = source.r[3];
+		auto destination_width  = destination.r[2];
+		auto destination_height = destination.r[3];
+
+		const auto non_0_source_width  = XMVectorSelect(
+			source_width,  g_XMEpsilon, XMVectorEqual(source_width,  XMVectorZero()));
+		const auto non_0_source_height = XMVectorSelect(
+			source_height, g_XMEpsilon, XMVectorEqual(source_height, XMVectorZero()));
+		auto origin_x = XMVectorDivide(origin_rotation_depth.r[0], non_0_source_width);
+		auto origin_y = XMVectorDivide(origin_rotation_depth.r[1], non_0_source_height);
+
+		const auto texture_width          = XMVectorSplatX(texture_size);
+		const auto texture_height         = XMVectorSplatY(texture_size);
+		const auto inverse_texture_width  = XMVectorSplatX(inverse_texture_size);
+		const auto inverse_texture_height = XMVectorSplatY(inverse_texture_size);
+
+		const auto in_texels = has_flag(SpriteInfo::s_source_in_texels);
+		source_x      = XMVectorSelect(source_x,      source_x      * inverse_texture_width,  in_texels);
+		source_y      = XMVectorSelect(source_y,      source_y      * inverse_texture_height, in_texels);
+		source_width  = XMVectorSelect(source_width,  source_width  * inverse_texture_width,  in_texels);
+		source_height = XMVectorSelect(source_height, source_height * inverse_texture_height, in_texels);
+		origin_x      = XMVectorSelect(origin_x * inverse_texture_width,  origin_x, in_texels);
+		origin_y      = XMVectorSelect(origin_y * inverse_texture_height, origin_y, in_texels);
+
+		// The maximum source region is always required for destination sizes
+		// which are not expressed in pixels.
+		const auto in_pixels = has_flag(SpriteInfo::s_destination_size_in_pixels);
+		destination_width  = XMVectorSelect(destination_width  * texture_width,
+											destination_width,  in_pixels);
+		destination_height = XMVectorSelect(destination_height * texture_height,
+											destination_height, in_pixels);
+
+		// The sines and cosines of all four rotations at once.
+		XMVECTOR sin;
+		XMVECTOR cos;
+		XMVectorSinCos(&sin, &cos, origin_rotation_depth.r[2]);
+
+		const auto mirror_x = has_flag(static_cast< U32 >(SpriteEffect::MirrorX));
+		const auto mirror_y = has_flag(static_cast< U32 >(SpriteEffect::MirrorY));
+
+		// Compute the position and texture coordinates of each corner of all
+		// four sprites.
+		F32x4A positions_x[SpriteBatchMesh::s_vertices_per_sprite];
+		F32x4A positions_y[SpriteBatchMesh::s_vertices_per_sprite];
+		F32x4A uvs_u[SpriteBatchMesh::s_vertices_per_sprite];
+		F32x4A uvs_v[SpriteBatchMesh::s_vertices_per_sprite];
+
+		for (std::size_t i = 0u; i < SpriteBatchMesh::s_vertices_per_sprite; ++i) {
+			const auto corner_x = (i & 1u) ? XMVectorSplatOne() : XMVectorZero();
+			const auto corner_y = (i & 2u) ? XMVectorSplatOne() : XMVectorZero();
+
+			// Compute the position coordinates.
+			const auto p0_x = (corner_x - origin_x) * destination_width;
+			const auto p0_y = (corner_y - origin_y) * destination_height;
+			// [x cos + y sin + Tx, x (-sin) + y cos + Ty]
+			const auto p_x  = XMVectorMultiplyAdd(p0_y, sin,
+				              XMVectorMultiplyAdd(p0_x, cos, destination.r[0]));
+			const auto p_y  = XMVectorMultiplyAdd(p0_y, cos,
+				              XMVectorNegativeMultiplySubtract(p0_x, sin, destination.r[1]));
+			positions_x[i]  = XMStore< F32x4A >(p_x);
+			positions_y[i]  = XMStore< F32x4A >(p_y);
+
+			// Compute the texture coordinates (mirrored corners).
+			const auto uv_corner_x = XMVectorSelect(corner_x, XMVectorSplatOne() - corner_x, mirror_x);
+			const auto uv_corner_y = XMVectorSelect(corner_y, XMVectorSplatOne() - corner_y, mirror_y);
+			uvs_u[i] = XMStore< F32x4A >(XMVectorMultiplyAdd(uv_corner_x, source_width,  source_x));
+			uvs_v[i] = XMStore< F32x4A >(XMVectorMultiplyAdd(uv_corner_y, source_height, source_y));
+		}
+
+		const auto depths = XMStore< F32x4A >(origin_rotation_depth.r[3]);
+
+		// Write the output vertices (sequentially).
+		for (std::size_t j = 0u; j < s_sprites_per_group; ++j) {
+			const auto& c = sprites[j]->m_color;
+			const RGBA color(c[0], c[1], c[2], c[3]);
+
+			for (std::size_t i = 0u; i < SpriteBatchMesh::s_vertices_per_sprite; ++i) {
+				vertices->m_p   = Point3(positions_x[i][j], positions_y[i][j], depths[j]);
+				vertices->m_c   = color;
+				vertices->m_tex = UV(uvs_u[i][j], uvs_v[i][j]);
+				++vertices;
+			}
+		}
+	}
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -834,12 +960,17 @@ namespace mage::rendering {
 	}
 
 	void XM_CALLCONV SpriteBatch::Draw(ID3D11ShaderResourceView* texture,
+									   const U32x2& texture_size,
 									   FXMVECTOR color,
 									   SpriteEffect effects,
 									   const SpriteTransform2D& transform,
 									   const RECT* source) {
 
-		m_impl->Draw(texture, color, effects, transform, source);
+		m_impl->Draw(texture, texture_size, color, effects, transform, source);
+	}
+
+	void SpriteBatch::Draw(gsl::span< const SpriteInfo > sprites) {
+		m_impl->Draw(sprites);
 	}
 
 	void SpriteBatch::End() {
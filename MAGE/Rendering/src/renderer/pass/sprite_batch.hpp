@@ -6,7 +6,16 @@
 #pragma region
 
 #include "direct3d11.hpp"
-#include "transform\transform.hpp"
+#include "transform/transform.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <gsl/span>
 
 #pragma endregion
 
@@ -50,19 +59,202 @@ namespace mage::rendering {
 	 @c Deferred,
 	 @c Immediate,
 	 @c Texture,
-	 @c BackToFront and
-	 @c FrontToBack.
+	 @c BackToFront,
+	 @c FrontToBack and
+	 @c BackToFrontThenTexture.
+
+	 All deferred sorting modes are stable: sprites with equal sort keys are
+	 drawn in FIFO order.
 	 */
 	enum class SpriteSortMode : U8 {
-		Deferred,	 // Deferred, FIFO order of the sprites.
-		Immediate,   // Immediate, FIFO order of the sprites.
-		Texture,     // Deferred sorting based on the texture of the sprites.
-		BackToFront, // Deferred, back-to-front sorting based on the depth
-		             // value of the sprites.
-		FrontToBack	 // Deferred, front-to-back sorting based on the depth
-		             // value of the sprites.
+		Deferred,	            // Deferred, FIFO order of the sprites.
+		Immediate,              // Immediate, FIFO order of the sprites.
+		Texture,                // Deferred sorting based on the texture of
+		                        // the sprites.
+		BackToFront,            // Deferred, back-to-front sorting based on
+		                        // the depth value of the sprites.
+		FrontToBack,	        // Deferred, front-to-back sorting based on
+		                        // the depth value of the sprites.
+		BackToFrontThenTexture  // Deferred, back-to-front sorting based on
+		                        // the depth value of the sprites and sorting
+		                        // based on the texture of the sprites with
+		                        // equal depth values.
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// SpriteInfo
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	#pragma warning( push )
+	#pragma warning( disable : 4324 ) // Added padding.
+
+	/**
+	 A struct of sprite info for a single sprite (i.e. a sprite queued for
+	 drawing by a sprite batch).
+	 */
+	struct alignas(16) SpriteInfo {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		// Combine values from SpriteEffect with these internal-only flags.
+
+		/**
+		 Mask indicating whether the source region (top left, width and height)
+		 of sprite info structures is expressed in texels.
+		 */
+		static constexpr U32 s_source_in_texels = 4u;
+
+		/**
+		 Mask indicating whether the destination size (width and height) of
+		 sprite info structures is expressed in pixels.
+		 */
+		static constexpr U32 s_destination_size_in_pixels = 8u;
+
+		static_assert(((s_source_in_texels | s_destination_size_in_pixels)
+					  & static_cast< U32 >(SpriteEffect::MirrorXY)) == 0,
+					  "Flag bits must not overlap");
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a sprite info.
+		 */
+		SpriteInfo() noexcept
+			: m_source{},
+			m_destination{},
+			m_color{},
+			m_origin_rotation_depth{},
+			m_texture(nullptr),
+			m_texture_size{},
+			m_flags(0u) {}
+
+		/**
+		 Constructs a sprite info.
+
+		 @param[in]		texture
+						A pointer to the shader resource view of the texture to
+						draw.
+		 @param[in]		texture_size
+						The size [width, height] of the texture to draw.
+		 @param[in]		color
+						The (linear) RGBA color.
+		 @param[in]		effects
+						The sprite effects to apply.
+		 @param[in]		transform
+						A reference to the sprite transform.
+		 @param[in]		source
+						A pointer the rectangular subregion of the texture.
+		 */
+		SpriteInfo(ID3D11ShaderResourceView* texture,
+				   const U32x2& texture_size,
+				   FXMVECTOR color,
+				   SpriteEffect effects,
+				   const SpriteTransform2D& transform,
+				   const RECT* source = nullptr) noexcept;
+
+		/**
+		 Constructs a sprite info from the given sprite info.
+
+		 @param[in]		sprite_info
+						A reference to the sprite info to copy.
+		 */
+		SpriteInfo(const SpriteInfo& sprite_info) noexcept = default;
+
+		/**
+		 Constructs a sprite info by moving the given sprite info.
+
+		 @param[in]		sprite_info
+						A reference to the sprite info to move.
+		 */
+		SpriteInfo(SpriteInfo&& sprite_info) noexcept = default;
+
+		/**
+		 Destructs this sprite info.
+		 */
+		~SpriteInfo() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given sprite info to this sprite info.
+
+		 @param[in]		sprite_info
+						A reference to the sprite info to copy.
+		 @return		A reference to the copy of the given sprite info (i.e.
+						this sprite info).
+		 */
+		SpriteInfo& operator=(const SpriteInfo& sprite_info) noexcept = default;
+
+		/**
+		 Moves the given sprite info to this sprite info.
+
+		 @param[in]		sprite_info
+						A reference to the sprite info to move.
+		 @return		A reference to the moved sprite info (i.e. this sprite
+						info).
+		 */
+		SpriteInfo& operator=(SpriteInfo&& sprite_info) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The texture source region (Left Top Width Height) of the sprite
+		 associated with this sprite info.
+		 */
+		F32x4A m_source;
+
+		/**
+		 The translation and scale (Tx Ty Sx Sy) of the sprite associated with
+		 this sprite info.
+		 */
+		F32x4A m_destination;
+
+		/**
+		 The (linear) RGBA color of the sprite associated with this sprite
+		 info.
+		 */
+		F32x4A m_color;
+
+		/**
+		 The origin, rotation and depth (Ox Oy R D) of the sprite associated
+		 with this sprite info.
+		 */
+		F32x4A m_origin_rotation_depth;
+
+		/**
+		 A pointer to the shader resource view of the texture associated
+		 with this sprite info.
+		 */
+		ID3D11ShaderResourceView* m_texture;
+
+		/**
+		 The size [width, height] of the texture associated with this sprite
+		 info. The size is stored at the creation of the sprite info, so the
+		 texture does not need to be queried while rendering.
+		 */
+		U32x2 m_texture_size;
+
+		/**
+		 The flags of the sprite associated with this sprite info.
+		 */
+		U32 m_flags;
 	};
 
+	#pragma warning( pop )
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -157,6 +349,8 @@ namespace mage::rendering {
 		 @param[in]		texture
 						A pointer to the shader resource view of the texture to
 						draw.
+		 @param[in]		texture_size
+						The size [width, height] of the texture to draw.
 		 @param[in]		color
 						The (linear) RGBA color.
 		 @param[in]		effects
@@ -167,11 +361,21 @@ namespace mage::rendering {
 						A pointer the rectangular subregion of the texture.
 		 */
 		void XM_CALLCONV Draw(ID3D11ShaderResourceView* texture,
+			                  const U32x2& texture_size,
 			                  FXMVECTOR color,
 			                  SpriteEffect effects,
 			                  const SpriteTransform2D& transform,
 			                  const RECT* source = nullptr);
 
+		/**
+		 Draws the given sprites (e.g., cached sprites of a text layout).
+
+		 @pre			This sprite batch is inside a begin/end pair.
+		 @param[in]		sprites
+						A span containing the sprites.
+		 */
+		void Draw(gsl::span< const SpriteInfo > sprites);
+
 		/**
 		 Ends the processing of a batch of sprites.
 
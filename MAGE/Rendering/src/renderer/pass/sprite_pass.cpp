@@ -3,8 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pass\sprite_pass.hpp"
-#include "resource\shader\shader_factory.hpp"
+#include "renderer/pass/sprite_pass.hpp"
+#include "system/profiler.hpp"
+#include "resource/shader/shader_factory.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -24,7 +25,8 @@ namespace mage::rendering {
 		m_state_manager(state_manager),
 		m_vs(CreateSpriteVS(resource_manager)),
 		m_ps(CreateSpritePS(resource_manager)),
-		m_sprite_batch(device, device_context) {}
+		m_sprite_batch(device, device_context),
+		m_texture_atlas(device) {}
 
 	SpritePass::SpritePass(SpritePass&& pass) noexcept = default;
 
@@ -55,20 +57,33 @@ namespace mage::rendering {
 	}
 
 	void SpritePass::Render(const World& world) {
+		MAGE_PROFILE_SCOPE("SpritePass::Render");
+
 		// Bind the fixed state.
 		BindFixedState();
 
 		m_sprite_batch.Begin();
 
 		// Processes the sprite images.
-		world.ForEach< SpriteImage >([&sprite_batch(m_sprite_batch)]
-		(const SpriteImage& sprite) {
+		world.ForEach< SpriteImage >([this](const SpriteImage& sprite) {
 			if (State::Active != sprite.GetState()) {
 				return;
 			}
 
+			// Draw the sprite from the texture atlas, if possible. Sprites
+			// sharing an atlas page do not break the current batch.
+			auto texture_region = sprite.GetBaseColorTextureRegion();
+			const auto texture = m_texture_atlas.Remap(m_device_context,
+													   sprite.GetBaseColorTexture(),
+													   texture_region);
+			if (texture) {
+				sprite.Draw(m_sprite_batch, texture,
+							m_texture_atlas.GetPageSize(), texture_region);
+				return;
+			}
+
 			// Draw the sprite.
-			sprite.Draw(sprite_batch);
+			sprite.Draw(m_sprite_batch);
 		});
 
 		// Processes the sprite texts.
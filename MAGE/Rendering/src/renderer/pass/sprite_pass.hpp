@@ -5,9 +5,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\state_manager.hpp"
-#include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
+#include "renderer/state_manager.hpp"
+#include "resource/rendering_resource_manager.hpp"
+#include "resource/texture/texture_atlas.hpp"
+#include "scene/rendering_world.hpp"
 
 #pragma endregion
 
@@ -142,5 +143,11 @@ namespace mage::rendering {
 		 The sprite batch of this sprite pass.
 		 */
 		SpriteBatch m_sprite_batch;
+
+		/**
+		 The texture atlas of this sprite pass containing the base color
+		 textures of the sprite images.
+		 */
+		TextureAtlas m_texture_atlas;
 	};
 }
\ No newline at end of file
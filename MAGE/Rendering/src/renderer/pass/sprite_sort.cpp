@@ -0,0 +1,80 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer/pass/sprite_sort.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	void RadixSort(std::vector< SpriteSortKey >& keys,
+				   std::vector< SpriteSortKey >& buffer) {
+
+		constexpr std::size_t nb_bits_per_pass = 8u;
+		constexpr std::size_t nb_buckets       = 1u << nb_bits_per_pass;
+		constexpr std::size_t nb_passes        = 64u / nb_bits_per_pass;
+
+		const auto nb_keys = keys.size();
+		if (0u == nb_keys) {
+			return;
+		}
+
+		buffer.resize(nb_keys);
+
+		// Compute the histograms of all passes at once.
+		std::array< std::array< U32, nb_buckets >, nb_passes > histograms = {};
+		for (const auto& key : keys) {
+			auto k = key.m_key;
+			for (std::size_t pass = 0u; pass < nb_passes; ++pass) {
+				++histograms[pass][k & (nb_buckets - 1u)];
+				k >>= nb_bits_per_pass;
+			}
+		}
+
+		auto* src = &keys;
+		auto* dst = &buffer;
+		for (std::size_t pass = 0u; pass < nb_passes; ++pass) {
+			auto& histogram = histograms[pass];
+			const auto shift = pass * nb_bits_per_pass;
+
+			// Skip passes which do not change the order.
+			if (nb_keys == histogram[((*src)[0].m_key >> shift)
+									 & (nb_buckets - 1u)]) {
+				continue;
+			}
+
+			// Convert the histogram to bucket offsets.
+			U32 offset = 0u;
+			for (auto& count : histogram) {
+				const auto nb = count;
+				count   = offset;
+				offset += nb;
+			}
+
+			for (const auto& key : *src) {
+				(*dst)[histogram[(key.m_key >> shift) & (nb_buckets - 1u)]++] = key;
+			}
+
+			std::swap(src, dst);
+		}
+
+		if (src != &keys) {
+			keys.swap(buffer);
+		}
+	}
+}
\ No newline at end of file
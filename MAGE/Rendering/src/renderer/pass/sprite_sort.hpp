@@ -0,0 +1,81 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/scalar_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A struct of sprite sort keys.
+
+	 Sprite sort keys are device-independent.
+	 */
+	struct SpriteSortKey {
+
+	public:
+
+		/**
+		 The key of the sprite.
+		 */
+		U64 m_key;
+
+		/**
+		 The index of the sprite (i.e. its submission order).
+		 */
+		U32 m_index;
+	};
+
+	/**
+	 Converts the given depth value to an unsigned integer with the same
+	 (ascending) ordering.
+
+	 @param[in]		depth
+					The depth value.
+	 @return		The unsigned integer with the same ordering as
+					@a depth.
+	 */
+	[[nodiscard]]
+	inline U32 ToOrderedBits(F32 depth) noexcept {
+		// Map -0.0f to +0.0f.
+		depth += 0.0f;
+
+		U32 bits;
+		std::memcpy(&bits, &depth, sizeof(bits));
+
+		// Negative values: flip all bits (reverses their order).
+		// Positive values: flip the sign bit.
+		return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+	}
+
+	/**
+	 Sorts the given sort keys by their keys using a stable LSD radix sort
+	 (8 bits per pass). Passes of which all keys share the same digit are
+	 skipped.
+
+	 @param[in,out]	keys
+					A reference to the vector containing the sort keys.
+	 @param[in,out]	buffer
+					A reference to the vector used as scratch buffer.
+	 */
+	void RadixSort(std::vector< SpriteSortKey >& keys,
+				   std::vector< SpriteSortKey >& buffer);
+}
\ No newline at end of file
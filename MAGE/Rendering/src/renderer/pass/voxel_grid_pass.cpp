@@ -3,8 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pass\voxel_grid_pass.hpp"
-#include "resource\shader\shader_factory.hpp"
+#include "renderer/pass/voxel_grid_pass.hpp"
+#include "system/profiler.hpp"
+#include "resource/shader/shader_factory.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -63,6 +64,8 @@ namespace mage::rendering {
 	}
 
 	void VoxelGridPass::Render(std::size_t resolution) const noexcept {
+		MAGE_PROFILE_SCOPE("VoxelGridPass::Render");
+
 		// Bind the fixed state.
 		BindFixedState();
 
@@ -3,9 +3,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pass\voxelization_pass.hpp"
-#include "renderer\state_manager.hpp"
-#include "resource\shader\shader_factory.hpp"
+#include "renderer/pass/voxelization_pass.hpp"
+#include "system/profiler.hpp"
+#include "renderer/state_manager.hpp"
+#include "resource/shader/shader_factory.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -97,6 +98,8 @@ namespace mage::rendering {
 	void XM_CALLCONV VoxelizationPass::Render(const World& world,
 											  FXMMATRIX world_to_projection,
 											  std::size_t resolution) {
+		MAGE_PROFILE_SCOPE("VoxelizationPass::Render");
+
 		SetupVoxelGrid(resolution);
 
 		m_voxel_grid->BindBeginVoxelizationBuffer(m_device_context);
@@ -199,7 +202,9 @@ namespace mage::rendering {
 		const auto  object_to_projection = object_to_world * world_to_projection;
 
 		// Apply view frustum culling.
+		++Pipeline::s_nb_culling_tests;
 		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
+			++Pipeline::s_nb_culled;
 			return;
 		}
 
@@ -225,6 +230,8 @@ namespace mage::rendering {
 	}
 
 	void VoxelizationPass::Dispatch() const noexcept {
+		MAGE_PROFILE_SCOPE("VoxelizationPass::Dispatch");
+
 		// CS: Bind the compute shader.
 		m_cs->BindShader(m_device_context);
 
@@ -5,10 +5,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\buffer\voxel_grid.hpp"
-#include "renderer\state_manager.hpp"
-#include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
+#include "renderer/buffer/voxel_grid.hpp"
+#include "renderer/state_manager.hpp"
+#include "resource/rendering_resource_manager.hpp"
+#include "scene/rendering_world.hpp"
 
 #pragma endregion
 
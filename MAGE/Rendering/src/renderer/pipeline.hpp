@@ -6,7 +6,7 @@
 #pragma region
 
 #include "direct3d11.hpp"
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -133,6 +133,7 @@ namespace mage::rendering {
 						   U32 map_flags,
 						   D3D11_MAPPED_SUBRESOURCE& mapped_resource) noexcept {
 
+			++s_nb_maps;
 			return device_context.Map(&resource,
 									  subresource,
 									  map_type,
@@ -1997,9 +1998,28 @@ namespace mage::rendering {
 
 		/**
 		 The number of draw calls
+
+		 The pipeline counters are only accessed by the thread rendering the
+		 frames. Use the pipeline statistics of the rendering manager
+		 instead.
 		 */
 		static U32 s_nb_draws;
 
+		/**
+		 The number of view frustum culling tests
+		 */
+		static U32 s_nb_culling_tests;
+
+		/**
+		 The number of objects culled by the view frustum culling tests
+		 */
+		static U32 s_nb_culled;
+
+		/**
+		 The number of resource maps
+		 */
+		static U32 s_nb_maps;
+
 	private:
 
 		//---------------------------------------------------------------------
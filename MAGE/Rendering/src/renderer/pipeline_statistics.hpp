@@ -0,0 +1,42 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/scalar_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A struct of pipeline statistics of a rendered frame.
+	 */
+	struct PipelineStatistics {
+
+		/**
+		 The number of draw calls.
+		 */
+		U32 m_nb_draws = 0u;
+
+		/**
+		 The number of view frustum culling tests.
+		 */
+		U32 m_nb_culling_tests = 0u;
+
+		/**
+		 The number of objects culled by the view frustum culling tests.
+		 */
+		U32 m_nb_culled = 0u;
+
+		/**
+		 The number of resource maps.
+		 */
+		U32 m_nb_maps = 0u;
+	};
+}
\ No newline at end of file
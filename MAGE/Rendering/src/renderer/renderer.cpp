@@ -3,21 +3,25 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\renderer.hpp"
-#include "renderer\output_manager.hpp"
-#include "renderer\pass\aa_pass.hpp"
-#include "renderer\pass\back_buffer_pass.hpp"
-#include "renderer\pass\bounding_volume_pass.hpp"
-#include "renderer\pass\deferred_pass.hpp"
-#include "renderer\pass\depth_pass.hpp"
-#include "renderer\pass\forward_pass.hpp"
-#include "renderer\pass\lbuffer_pass.hpp"
-#include "renderer\pass\postprocess_pass.hpp"
-#include "renderer\pass\sky_pass.hpp"
-#include "renderer\pass\sprite_pass.hpp"
-#include "renderer\pass\voxelization_pass.hpp"
-#include "renderer\pass\voxel_grid_pass.hpp"
-#include "renderer\buffer\scene_buffer.hpp"
+#include "renderer/renderer.hpp"
+#include "system/profiler.hpp"
+#include "system/telemetry.hpp"
+#include "renderer/dynamic_resolution.hpp"
+#include "renderer/gpu_timer.hpp"
+#include "renderer/output_manager.hpp"
+#include "renderer/pass/aa_pass.hpp"
+#include "renderer/pass/back_buffer_pass.hpp"
+#include "renderer/pass/bounding_volume_pass.hpp"
+#include "renderer/pass/deferred_pass.hpp"
+#include "renderer/pass/depth_pass.hpp"
+#include "renderer/pass/forward_pass.hpp"
+#include "renderer/pass/lbuffer_pass.hpp"
+#include "renderer/pass/postprocess_pass.hpp"
+#include "renderer/pass/sky_pass.hpp"
+#include "renderer/pass/sprite_pass.hpp"
+#include "renderer/pass/voxelization_pass.hpp"
+#include "renderer/pass/voxel_grid_pass.hpp"
+#include "renderer/buffer/scene_buffer.hpp"
 #include "imgui_impl_dx11.h"
 
 // Include HLSL bindings.
@@ -25,6 +29,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -129,10 +142,12 @@ namespace mage::rendering {
 						A reference to the world.
 		 @param[in]		time
 						A reference to the game time.
+		 @param[in]		gui
+						A reference to the GUI draw data.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void Render(const World& world, const GameTime& time);
+		void Render(const World& world, const GameTime& time, ImDrawData& gui);
 
 	private:
 
@@ -146,8 +161,18 @@ namespace mage::rendering {
 
 		void UpdateWorldBuffer(const GameTime& time);
 
+		void UpdateResolutionScale();
+
+		[[nodiscard]]
+		const Viewport GetViewport(const Camera& camera) const noexcept;
+
 		void Render(const World& world, const Camera& camera);
 
+		void XM_CALLCONV UpdateTextureStreaming(const World& world,
+												const Camera& camera,
+												FXMMATRIX world_to_camera,
+												CXMMATRIX camera_to_projection);
+
 		void XM_CALLCONV RenderForward(const World& world,
 									   const Camera& camera,
 									   FXMMATRIX world_to_projection);
@@ -207,6 +232,26 @@ namespace mage::rendering {
 		 */
 		UniquePtr< StateManager > m_state_manager;
 
+		//---------------------------------------------------------------------
+		// Member Variables: Dynamic Resolution
+		//---------------------------------------------------------------------
+
+		/**
+		 The GPU timer of this renderer.
+		 */
+		GPUTimer m_gpu_timer;
+
+		/**
+		 The dynamic resolution controller of this renderer.
+		 */
+		DynamicResolutionController m_resolution_controller;
+
+		/**
+		 The resolution scale of the rendered viewports of the current frame
+		 of this renderer.
+		 */
+		F32 m_resolution_scale;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Buffers
 		//---------------------------------------------------------------------
@@ -294,6 +339,9 @@ namespace mage::rendering {
 													 display_configuration,
 													 swap_chain)),
 		m_state_manager(MakeUnique< StateManager >(device)),
+		m_gpu_timer(device),
+		m_resolution_controller(display_configuration.GetTargetFrameTime()),
+		m_resolution_scale(1.0f),
 		m_world_buffer(device),
 		m_aa_pass(),
 		m_back_buffer_pass(),
@@ -377,7 +425,14 @@ namespace mage::rendering {
 		m_state_manager->BindPersistentState(m_device_context);
 	}
 
-	void Renderer::Impl::Render(const World& world, const GameTime& time) {
+	void Renderer::Impl::Render(const World& world,
+								const GameTime& time,
+								ImDrawData& gui) {
+		MAGE_PROFILE_SCOPE("Renderer::Render");
+
+		// Update the resolution scale of the rendered viewports.
+		UpdateResolutionScale();
+
 		// Update the buffers.
 		UpdateBuffers(world, time);
 
@@ -409,8 +464,7 @@ namespace mage::rendering {
 		m_sprite_pass->Render(world);
 
 		// GUI
-		ImGui::Render();
-		ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
+		ImGui_ImplDX11_RenderDrawData(&gui);
 
 		m_output_manager->BindEnd(m_device_context);
 
@@ -418,6 +472,10 @@ namespace mage::rendering {
 		// Back Buffer
 		//---------------------------------------------------------------------
 		m_back_buffer_pass->Render();
+
+		if (m_display_configuration.get().UsesDynamicResolution()) {
+			m_gpu_timer.End(m_device_context);
+		}
 	}
 
 	void Renderer::Impl::UpdateBuffers(const World& world,
@@ -429,7 +487,8 @@ namespace mage::rendering {
 		world.ForEach< Camera >([this](const Camera& camera) {
 			if (State::Active == camera.GetState()) {
 				camera.UpdateBuffer(m_device_context,
-									m_display_configuration.get().GetAA());
+									m_display_configuration.get().GetAA(),
+									m_resolution_scale);
 			}
 		});
 
@@ -490,7 +549,40 @@ namespace mage::rendering {
 		m_world_buffer.UpdateData(m_device_context, buffer);
 	}
 
+	void Renderer::Impl::UpdateResolutionScale() {
+		if (!m_display_configuration.get().UsesDynamicResolution()) {
+			m_resolution_scale = 1.0f;
+			return;
+		}
+
+		static auto& s_gpu_frame_time
+			= Telemetry::Get().GetGauge("GPU frame time (ms)");
+		static auto& s_resolution_scale
+			= Telemetry::Get().GetGauge("Resolution scale");
+
+		// Update the resolution scale with the GPU time of the last read
+		// back frame. The GPU times lag a few frames behind.
+		if (m_gpu_timer.Resolve(m_device_context)) {
+			const auto gpu_frame_time = m_gpu_timer.GetTime();
+			m_resolution_controller.Update(gpu_frame_time);
+			s_gpu_frame_time.Set(gpu_frame_time);
+		}
+
+		m_resolution_scale = m_resolution_controller.GetScale();
+		s_resolution_scale.Set(m_resolution_scale);
+
+		m_gpu_timer.Begin(m_device_context);
+	}
+
+	const Viewport Renderer::Impl
+		::GetViewport(const Camera& camera) const noexcept {
+
+		return Viewport(camera.GetViewport(), m_resolution_scale);
+	}
+
 	void Renderer::Impl::Render(const World& world, const Camera& camera) {
+		MAGE_PROFILE_SCOPE("Renderer::RenderCamera");
+
 		// Bind the camera to the pipeline.
 		camera.BindBuffer< Pipeline >(m_device_context,
 									  SLOT_CBUFFER_PRIMARY_CAMERA);
@@ -504,6 +596,10 @@ namespace mage::rendering {
 
 		const auto  render_mode          = camera.GetSettings().GetRenderMode();
 
+		// Report the on-screen sizes of the streamed textures.
+		UpdateTextureStreaming(world, camera, world_to_camera,
+							   camera_to_projection);
+
 		m_output_manager->BindBeginViewport(m_device_context);
 
 		//---------------------------------------------------------------------
@@ -618,7 +714,7 @@ namespace mage::rendering {
 		}
 
 		default: {
-			const Viewport viewport(camera.GetViewport(),
+			const Viewport viewport(GetViewport(camera),
 									m_display_configuration.get().GetAA());
 			viewport.Bind(m_device_context);
 			m_output_manager->BindBeginForward(m_device_context);
@@ -652,6 +748,72 @@ namespace mage::rendering {
 		RenderPostProcessing(camera);
 	}
 
+	void XM_CALLCONV Renderer::Impl
+		::UpdateTextureStreaming(const World& world,
+								 const Camera& camera,
+								 FXMMATRIX world_to_camera,
+								 CXMMATRIX camera_to_projection) {
+
+		auto& streamer = m_resource_manager.get().GetTextureStreamer();
+
+		const auto viewport_size = camera.GetViewport().GetSize();
+		const auto max_size      = static_cast< F32 >(
+			std::max(viewport_size[0], viewport_size[1]));
+		// The projected radius is relative to the viewport height.
+		const auto scale         = XMVectorGetY(camera_to_projection.r[1])
+			                     * 0.5f * static_cast< F32 >(viewport_size[1]);
+		const auto world_to_projection = world_to_camera * camera_to_projection;
+
+		world.ForEach< Model >([&](const Model& model) {
+			if (State::Active != model.GetState()) {
+				return;
+			}
+
+			const auto& transform            = model.GetOwner()->GetTransform();
+			const auto  object_to_world      = transform.GetObjectToWorldMatrix();
+			const auto  object_to_projection = object_to_world * world_to_projection;
+
+			// Apply view frustum culling.
+			if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
+				return;
+			}
+
+			// Project the bounding sphere of the model.
+			const auto& sphere           = model.GetBoundingSphere();
+			const auto  object_to_camera = object_to_world * world_to_camera;
+			const auto  centroid         = XMVector3TransformCoord(
+				sphere.Centroid(), object_to_camera);
+			const auto  world_scale      = XMVectorMax(
+				XMVector3Length(object_to_world.r[0]), XMVectorMax(
+				XMVector3Length(object_to_world.r[1]),
+				XMVector3Length(object_to_world.r[2])));
+			const auto  radius           = sphere.Radius()
+				                         * XMVectorGetX(world_scale);
+
+			F32 screen_size = max_size;
+			if (XMVectorGetX(XMVector3Length(centroid)) > radius) {
+				// The homogeneous w coordinate equals the depth for
+				// perspective projections and one for orthographic
+				// projections.
+				const auto w = XMVectorGetW(
+					XMVector3Transform(centroid, camera_to_projection));
+				screen_size = std::min(max_size, 2.0f * radius * scale
+					                             / std::max(w, 0.0001f));
+			}
+
+			const auto& material = model.GetMaterial();
+			if (const auto texture = material.GetBaseColorTexture(); texture) {
+				streamer.SetScreenSize(*texture, screen_size);
+			}
+			if (const auto texture = material.GetMaterialTexture(); texture) {
+				streamer.SetScreenSize(*texture, screen_size);
+			}
+			if (const auto texture = material.GetNormalTexture(); texture) {
+				streamer.SetScreenSize(*texture, screen_size);
+			}
+		});
+	}
+
 	void XM_CALLCONV Renderer::Impl::RenderForward(const World& world,
 												   const Camera& camera,
 												   FXMMATRIX world_to_projection) {
@@ -678,7 +840,7 @@ namespace mage::rendering {
 			m_lbuffer_pass->Render(world, world_to_projection);
 		}
 
-		const Viewport viewport(camera.GetViewport(),
+		const Viewport viewport(GetViewport(camera),
 								m_display_configuration.get().GetAA());
 		viewport.Bind(m_device_context);
 		m_output_manager->BindBeginForward(m_device_context);
@@ -737,7 +899,7 @@ namespace mage::rendering {
 			m_lbuffer_pass->Render(world, world_to_projection);
 		}
 
-		const Viewport viewport(camera.GetViewport(),
+		const Viewport viewport(GetViewport(camera),
 								m_display_configuration.get().GetAA());
 		viewport.Bind(m_device_context);
 		m_output_manager->BindBeginGBuffer(m_device_context);
@@ -790,7 +952,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		m_lbuffer_pass->Render(world, world_to_projection);
 
-		const Viewport viewport(camera.GetViewport(),
+		const Viewport viewport(GetViewport(camera),
 								m_display_configuration.get().GetAA());
 		viewport.Bind(m_device_context);
 		m_output_manager->BindBeginForward(m_device_context);
@@ -806,7 +968,7 @@ namespace mage::rendering {
 													  FXMMATRIX world_to_projection,
 													  FalseColor false_color) {
 
-		const Viewport viewport(camera.GetViewport(),
+		const Viewport viewport(GetViewport(camera),
 								m_display_configuration.get().GetAA());
 		viewport.Bind(m_device_context);
 		m_output_manager->BindBeginForward(m_device_context);
@@ -837,7 +999,7 @@ namespace mage::rendering {
 									voxel_grid_resolution);
 
 
-		const Viewport viewport(camera.GetViewport(),
+		const Viewport viewport(GetViewport(camera),
 								m_display_configuration.get().GetAA());
 		viewport.Bind(m_device_context);
 		m_output_manager->BindBeginForward(m_device_context);
@@ -849,7 +1011,7 @@ namespace mage::rendering {
 	}
 
 	void Renderer::Impl::RenderPostProcessing(const Camera& camera) {
-		const auto& viewport = camera.GetViewport();
+		const auto viewport = GetViewport(camera);
 		viewport.Bind(m_device_context);
 
 		m_output_manager->BindBeginPostProcessing(m_device_context);
@@ -864,13 +1026,33 @@ namespace mage::rendering {
 		}
 
 		m_output_manager->BindEndPostProcessing(m_device_context);
-		m_output_manager->BindEndViewport(m_device_context);
+
+		if (1.0f == m_resolution_scale) {
+			m_output_manager->BindEndViewport(m_device_context);
+
+			//-----------------------------------------------------------------
+			// Low Dynamic Range
+			//-----------------------------------------------------------------
+			m_postprocess_pass->DispatchLDR(viewport.GetSize(),
+											camera.GetSettings().GetToneMapping());
+			return;
+		}
+
+		// Write the LDR image of the scaled viewport to the free HDR buffer.
+		m_output_manager->BindPingPong(m_device_context);
 
 		//---------------------------------------------------------------------
 		// Low Dynamic Range
 		//---------------------------------------------------------------------
 		m_postprocess_pass->DispatchLDR(viewport.GetSize(),
 										camera.GetSettings().GetToneMapping());
+
+		m_output_manager->BindEndViewport(m_device_context);
+
+		//---------------------------------------------------------------------
+		// Upsample
+		//---------------------------------------------------------------------
+		m_postprocess_pass->DispatchUpsample(camera.GetViewport().GetSize());
 	}
 
 	void Renderer::Impl::RenderAA(const Camera& camera) {
@@ -884,7 +1066,7 @@ namespace mage::rendering {
 			//-----------------------------------------------------------------
 			// AA pre-processing
 			//-----------------------------------------------------------------
-			m_aa_pass->DispatchPreprocess(camera.GetViewport().GetSize(),
+			m_aa_pass->DispatchPreprocess(GetViewport(camera).GetSize(),
 										  AntiAliasing::FXAA);
 
 			m_output_manager->BindEndResolve(m_device_context);
@@ -893,7 +1075,7 @@ namespace mage::rendering {
 			//-----------------------------------------------------------------
 			// FXAA
 			//-----------------------------------------------------------------
-			m_aa_pass->Dispatch(camera.GetViewport().GetSize(),
+			m_aa_pass->Dispatch(GetViewport(camera).GetSize(),
 								AntiAliasing::FXAA);
 
 			break;
@@ -910,7 +1092,7 @@ namespace mage::rendering {
 			//-----------------------------------------------------------------
 			// MSAA/SSAA
 			//-----------------------------------------------------------------
-			m_aa_pass->Dispatch(camera.GetViewport().GetSize(), desc);
+			m_aa_pass->Dispatch(GetViewport(camera).GetSize(), desc);
 
 			m_output_manager->BindEndResolve(m_device_context);
 			break;
@@ -947,8 +1129,11 @@ namespace mage::rendering {
 		m_impl->BindPersistentState();
 	}
 
-	void Renderer::Render(const World& world, const GameTime& time) {
-		m_impl->Render(world, time);
+	void Renderer::Render(const World& world,
+						  const GameTime& time,
+						  ImDrawData& gui) {
+
+		m_impl->Render(world, time, gui);
 	}
 
 	#pragma endregion
@@ -5,16 +5,20 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\swap_chain.hpp"
-#include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
-#include "system\game_timer.hpp"
+#include "renderer/swap_chain.hpp"
+#include "resource/rendering_resource_manager.hpp"
+#include "scene/rendering_world.hpp"
+#include "system/game_timer.hpp"
 
 #pragma endregion
 
 //-----------------------------------------------------------------------------
 // Engine Declarations
 //-----------------------------------------------------------------------------
+
+// Forward declaration.
+struct ImDrawData;
+
 namespace mage::rendering {
 
 	/**
@@ -111,10 +115,12 @@ namespace mage::rendering {
 						A reference to the world.
 		 @param[in]		time
 						A reference to the game time.
+		 @param[in]		gui
+						A reference to the GUI draw data.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void Render(const World& world, const GameTime& time);
+		void Render(const World& world, const GameTime& time, ImDrawData& gui);
 
 	private:
 
@@ -5,9 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\state_manager.hpp"
-#include "renderer\factory.hpp"
-#include "exception\exception.hpp"
+#include "renderer/state_manager.hpp"
+#include "renderer/factory.hpp"
+#include "exception/exception.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
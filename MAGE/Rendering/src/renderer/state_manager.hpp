@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pipeline.hpp"
+#include "renderer/pipeline.hpp"
 
 #pragma endregion
 
@@ -3,10 +3,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\swap_chain.hpp"
-#include "renderer\pipeline.hpp"
-#include "loaders\texture_loader.hpp"
-#include "exception\exception.hpp"
+#include "renderer/swap_chain.hpp"
+#include "renderer/pipeline.hpp"
+#include "loaders/texture_loader.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
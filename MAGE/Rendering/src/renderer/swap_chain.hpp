@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "display\display_configuration.hpp"
+#include "display/display_configuration.hpp"
 
 #pragma endregion
 
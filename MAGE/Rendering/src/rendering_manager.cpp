@@ -4,18 +4,203 @@
 #pragma region
 
 #include "rendering_manager.hpp"
-#include "renderer\renderer.hpp"
+#include "renderer/frame_handoff.hpp"
+#include "renderer/renderer.hpp"
+#include "system/telemetry.hpp"
+#include "imgui.h"
 #include "imgui_impl_dx11.h"
 #include "imgui_impl_win32.h"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
 	U32 Pipeline::s_nb_draws = 0u;
+	U32 Pipeline::s_nb_culling_tests = 0u;
+	U32 Pipeline::s_nb_culled = 0u;
+	U32 Pipeline::s_nb_maps = 0u;
+
+	namespace {
+
+		/**
+		 Returns the pipeline statistics of the current frame.
+
+		 The pipeline counters are only accessed by the thread rendering the
+		 frames. The pipeline statistics are handed back to the other threads
+		 with the render snapshots.
+
+		 @return		The pipeline statistics of the current frame.
+		 */
+		[[nodiscard]]
+		const PipelineStatistics GetPipelineCounters() noexcept {
+			PipelineStatistics statistics;
+			statistics.m_nb_draws         = Pipeline::s_nb_draws;
+			statistics.m_nb_culling_tests = Pipeline::s_nb_culling_tests;
+			statistics.m_nb_culled        = Pipeline::s_nb_culled;
+			statistics.m_nb_maps          = Pipeline::s_nb_maps;
+			return statistics;
+		}
+
+		/**
+		 Resets the pipeline counters of the current frame.
+		 */
+		void ResetPipelineCounters() noexcept {
+			Pipeline::s_nb_draws         = 0u;
+			Pipeline::s_nb_culling_tests = 0u;
+			Pipeline::s_nb_culled        = 0u;
+			Pipeline::s_nb_maps          = 0u;
+		}
+
+		/**
+		 Publishes the given pipeline statistics as telemetry gauges.
+
+		 @param[in]		statistics
+						A reference to the pipeline statistics.
+		 */
+		void PublishPipelineTelemetry(const PipelineStatistics& statistics) {
+			static auto& s_nb_draws
+				= Telemetry::Get().GetGauge("Draw calls");
+			static auto& s_nb_culling_tests
+				= Telemetry::Get().GetGauge("Culling tests");
+			static auto& s_nb_culled
+				= Telemetry::Get().GetGauge("Culled objects");
+			static auto& s_nb_maps
+				= Telemetry::Get().GetGauge("Resource maps");
+
+			s_nb_draws.Set(statistics.m_nb_draws);
+			s_nb_culling_tests.Set(statistics.m_nb_culling_tests);
+			s_nb_culled.Set(statistics.m_nb_culled);
+			s_nb_maps.Set(statistics.m_nb_maps);
+		}
+
+		/**
+		 Dispatches the messages sent to the windows of the calling thread.
+
+		 The render thread presents to the swap chain of the window of the
+		 calling thread. DXGI sends messages to that window during the
+		 presentation (e.g., on ALT + ENTER, minimization or loss of the full
+		 screen mode) and blocks until they are processed, so the calling
+		 thread cannot block on the render thread without processing them.
+		 */
+		void DispatchSentMessages() noexcept {
+			// Dispatch the sent (i.e. non-queued) messages only. The posted
+			// messages remain queued for the message loop.
+			MSG msg;
+			PeekMessage(&msg, nullptr, 0u, 0u,
+						PM_NOREMOVE | PM_QS_SENDMESSAGE);
+		}
+
+		/**
+		 Copies the given ImGui vector to the given ImGui vector. The capacity
+		 of the destination vector is reused.
+
+		 @tparam		T
+						The element type.
+		 @param[in]		src
+						A reference to the source vector.
+		 @param[out]	dst
+						A reference to the destination vector.
+		 */
+		template< typename T >
+		void CopyVector(const ImVector< T >& src, ImVector< T >& dst) {
+			dst.resize(src.Size);
+			if (0 != src.Size) {
+				std::memcpy(dst.Data, src.Data,
+							static_cast< std::size_t >(src.size_in_bytes()));
+			}
+		}
+
+		/**
+		 A struct of render snapshots containing everything the render thread
+		 needs to render a frame.
+		 */
+		struct RenderSnapshot {
+
+			/**
+			 A pointer to the snapshot of the world.
+			 */
+			UniquePtr< World > m_world;
+
+			/**
+			 The game time.
+			 */
+			GameTime m_time;
+
+			/**
+			 The GUI draw data referring to the GUI draw lists of this
+			 render snapshot.
+			 */
+			ImDrawData m_gui;
+
+			/**
+			 A vector containing the GUI draw lists of this render snapshot.
+			 */
+			std::vector< UniquePtr< ImDrawList > > m_gui_lists;
+
+			/**
+			 A vector containing pointers to the GUI draw lists of this
+			 render snapshot.
+			 */
+			std::vector< ImDrawList* > m_gui_list_ptrs;
+
+			/**
+			 The pipeline statistics of the last rendering of this render
+			 snapshot.
+			 */
+			PipelineStatistics m_statistics;
+		};
+
+		/**
+		 Copies the given GUI draw data to the given render snapshot.
+
+		 @param[in]		gui
+						A reference to the GUI draw data.
+		 @param[out]	snapshot
+						A reference to the render snapshot.
+		 */
+		void SnapshotGUI(const ImDrawData& gui, RenderSnapshot& snapshot) {
+			const auto nb_lists = static_cast< std::size_t >(gui.CmdListsCount);
+
+			while (snapshot.m_gui_lists.size() < nb_lists) {
+				snapshot.m_gui_lists.push_back(
+					MakeUnique< ImDrawList >(ImGui::GetDrawListSharedData()));
+			}
+
+			snapshot.m_gui_list_ptrs.clear();
+			for (std::size_t i = 0u; i < nb_lists; ++i) {
+				const auto& src = *gui.CmdLists[i];
+				auto& dst       = *snapshot.m_gui_lists[i];
+
+				CopyVector(src.CmdBuffer, dst.CmdBuffer);
+				CopyVector(src.IdxBuffer, dst.IdxBuffer);
+				CopyVector(src.VtxBuffer, dst.VtxBuffer);
+				dst.Flags = src.Flags;
+
+				snapshot.m_gui_list_ptrs.push_back(&dst);
+			}
+
+			auto& dst         = snapshot.m_gui;
+			dst.Valid         = gui.Valid;
+			dst.CmdLists      = snapshot.m_gui_list_ptrs.data();
+			dst.CmdListsCount = gui.CmdListsCount;
+			dst.TotalIdxCount = gui.TotalIdxCount;
+			dst.TotalVtxCount = gui.TotalVtxCount;
+			dst.DisplayPos    = gui.DisplayPos;
+			dst.DisplaySize   = gui.DisplaySize;
+		}
+	}
 
 	//-------------------------------------------------------------------------
 	// Manager::Impl
@@ -58,7 +243,7 @@ namespace mage::rendering {
 		 @param[in]		manager
 						A reference to a rendering manager to move.
 		 */
-		Impl(Impl&& manager) noexcept;
+		Impl(Impl&& manager) = delete;
 
 		/**
 		 Destructs this rendering manager.
@@ -159,6 +344,52 @@ namespace mage::rendering {
 		 */
 		void BindPersistentState();
 
+		/**
+		 Checks whether this rendering manager renders on a separate render
+		 thread.
+
+		 @return		@c true if this rendering manager renders on a
+						separate render thread. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsPipelined() const noexcept {
+			return m_handoff.IsRunning();
+		}
+
+		/**
+		 Sets whether this rendering manager renders on a separate render
+		 thread.
+
+		 @param[in]		pipelined
+						@c true if this rendering manager needs to render on
+						a separate render thread. @c false otherwise.
+		 @throws		Exception
+						Failed to render a pending frame.
+		 */
+		void SetPipelined(bool pipelined);
+
+		/**
+		 Waits until all submitted frames of this rendering manager are
+		 rendered.
+
+		 @throws		Exception
+						Failed to render a submitted frame.
+		 */
+		void Flush();
+
+		/**
+		 Returns the pipeline statistics of the last rendered frame of this
+		 rendering manager which has been handed back to the calling thread.
+
+		 @return		The pipeline statistics of the last rendered frame of
+						this rendering manager which has been handed back to
+						the calling thread.
+		 */
+		[[nodiscard]]
+		const PipelineStatistics GetPipelineStatistics() const noexcept {
+			return m_statistics;
+		}
+
 		/**
 		 Updates this rendering manager.
 		 */
@@ -204,6 +435,35 @@ namespace mage::rendering {
 		 */
 		void SetupDevice();
 
+		/**
+		 Submits a render snapshot of the world of this rendering manager to
+		 the render thread. The pipeline statistics of the previous rendering
+		 of the render snapshot are handed back first.
+
+		 @param[in]		time
+						A reference to the game time.
+		 @throws		Exception
+						Failed to render a previous frame.
+		 */
+		void Submit(const GameTime& time);
+
+		/**
+		 Renders the given world.
+
+		 @param[in]		world
+						A reference to the world.
+		 @param[in]		time
+						A reference to the game time.
+		 @param[in]		gui
+						A reference to the GUI draw data.
+		 @return		The pipeline statistics of the rendered frame.
+		 @throws		Exception
+						Failed to render the world.
+		 */
+		const PipelineStatistics Render(const World& world,
+										const GameTime& time,
+										ImDrawData& gui);
+
 		//---------------------------------------------------------------------
 		// Member Variables: Display Configuration
 		//---------------------------------------------------------------------
@@ -256,6 +516,22 @@ namespace mage::rendering {
 		 A pointer to the renderer of this rendering manager.
 		 */
 		UniquePtr< Renderer > m_renderer;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Pipelining
+		//---------------------------------------------------------------------
+
+		/**
+		 The pipeline statistics of the last rendered frame of this rendering
+		 manager which has been handed back to the updating thread.
+		 */
+		PipelineStatistics m_statistics;
+
+		/**
+		 The handoff of the (double-buffered) render snapshots of this
+		 rendering manager to the render thread.
+		 */
+		FrameHandoff< RenderSnapshot > m_handoff;
 	};
 
 	Manager::Impl::Impl(NotNull< HWND > window,
@@ -269,14 +545,15 @@ namespace mage::rendering {
 		m_swap_chain(),
 		m_resource_manager(),
 		m_world(),
-		m_renderer() {
+		m_renderer(),
+		m_statistics(),
+		m_handoff(DispatchSentMessages) {
 
 		InitializeSystems();
 	}
 
-	Manager::Impl::Impl(Manager::Impl&& manager) noexcept = default;
-
 	Manager::Impl::~Impl() {
+		m_handoff.Stop();
 		UninitializeSystems();
 	}
 
@@ -370,18 +647,86 @@ namespace mage::rendering {
 		m_renderer->BindPersistentState();
 	}
 
+	void Manager::Impl::SetPipelined(bool pipelined) {
+		if (IsPipelined() == pipelined) {
+			return;
+		}
+
+		if (!pipelined) {
+			m_handoff.Stop();
+			// Rethrow the exception (if any) of the render thread.
+			m_handoff.Flush();
+			return;
+		}
+
+		for (auto& snapshot : m_handoff.GetFrames()) {
+			if (!snapshot.m_world) {
+				snapshot.m_world = MakeUnique< World >(*m_device.Get(),
+													   *m_display_configuration,
+													   *m_resource_manager);
+			}
+		}
+
+		m_handoff.Start([this](RenderSnapshot& snapshot) {
+			// The mip levels of the streamed textures are swapped in on the
+			// render thread, since the render thread binds them.
+			m_resource_manager->GetTextureStreamer().Update();
+
+			snapshot.m_statistics = Render(*snapshot.m_world,
+										   snapshot.m_time,
+										   snapshot.m_gui);
+		});
+	}
+
+	void Manager::Impl::Flush() {
+		m_handoff.Flush();
+	}
+
+	void Manager::Impl::Submit(const GameTime& time) {
+		m_handoff.Submit([this, &time](RenderSnapshot& snapshot) {
+			// The previous rendering of this render snapshot is completed.
+			m_statistics = snapshot.m_statistics;
+
+			snapshot.m_world->Snapshot(GetWorld());
+			snapshot.m_time = time;
+
+			ImGui::Render();
+			SnapshotGUI(*ImGui::GetDrawData(), snapshot);
+		});
+	}
+
 	void Manager::Impl::Update() {
+		m_resource_manager->Update();
+		if (!IsPipelined()) {
+			m_resource_manager->GetTextureStreamer().Update();
+		}
+
 		ImGui_ImplDX11_NewFrame();
 		ImGui_ImplWin32_NewFrame();
 		ImGui::NewFrame();
 	}
 
 	void Manager::Impl::Render(const GameTime& time) {
+		if (IsPipelined()) {
+			Submit(time);
+			return;
+		}
+
+		ImGui::Render();
+		m_statistics = Render(GetWorld(), time, *ImGui::GetDrawData());
+	}
+
+	const PipelineStatistics Manager::Impl::Render(const World& world,
+												   const GameTime& time,
+												   ImDrawData& gui) {
 		m_swap_chain->Clear();
-		Pipeline::s_nb_draws = 0u;
-		m_renderer->Render(GetWorld(), time);
+		ResetPipelineCounters();
+		m_renderer->Render(world, time, gui);
+		const auto statistics = GetPipelineCounters();
+		PublishPipelineTelemetry(statistics);
 
 		m_swap_chain->Present();
+		return statistics;
 	}
 
 	#pragma endregion
@@ -430,6 +775,24 @@ namespace mage::rendering {
 		m_impl->BindPersistentState();
 	}
 
+	[[nodiscard]]
+	bool Manager::IsPipelined() const noexcept {
+		return m_impl->IsPipelined();
+	}
+
+	void Manager::SetPipelined(bool pipelined) {
+		m_impl->SetPipelined(pipelined);
+	}
+
+	void Manager::Flush() {
+		m_impl->Flush();
+	}
+
+	[[nodiscard]]
+	const PipelineStatistics Manager::GetPipelineStatistics() const noexcept {
+		return m_impl->GetPipelineStatistics();
+	}
+
 	void Manager::Update() {
 		m_impl->Update();
 	}
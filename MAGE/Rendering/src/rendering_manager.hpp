@@ -5,10 +5,11 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\swap_chain.hpp"
-#include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
-#include "system\game_timer.hpp"
+#include "renderer/pipeline_statistics.hpp"
+#include "renderer/swap_chain.hpp"
+#include "resource/rendering_resource_manager.hpp"
+#include "scene/rendering_world.hpp"
+#include "system/game_timer.hpp"
 
 #pragma endregion
 
@@ -142,6 +143,59 @@ namespace mage::rendering {
 		 */
 		void BindPersistentState();
 
+		/**
+		 Checks whether this rendering manager renders on a separate render
+		 thread.
+
+		 @return		@c true if this rendering manager renders on a
+						separate render thread. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsPipelined() const noexcept;
+
+		/**
+		 Sets whether this rendering manager renders on a separate render
+		 thread.
+
+		 If pipelined, rendering a frame submits a render snapshot of the
+		 world (i.e. the components, their transforms and the GUI) to the
+		 render thread, and the next frame can be updated while the submitted
+		 frame is rendered. Otherwise, frames are rendered on the calling
+		 thread from the world itself.
+
+		 @param[in]		pipelined
+						@c true if this rendering manager needs to render on
+						a separate render thread. @c false otherwise.
+		 @throws		Exception
+						Failed to render a submitted frame.
+		 */
+		void SetPipelined(bool pipelined);
+
+		/**
+		 Waits until all submitted frames of this rendering manager are
+		 rendered. Call this method before accessing the swap chain or the
+		 device context outside the rendering manager.
+
+		 @throws		Exception
+						Failed to render a submitted frame.
+		 */
+		void Flush();
+
+		/**
+		 Returns the pipeline statistics of the last rendered frame of this
+		 rendering manager which has been handed back to the calling thread.
+
+		 If pipelined, the pipeline statistics of a frame are handed back
+		 with its render snapshot (i.e. two frames later). Otherwise, the
+		 pipeline statistics of the last rendered frame are returned.
+
+		 @return		The pipeline statistics of the last rendered frame of
+						this rendering manager which has been handed back to
+						the calling thread.
+		 */
+		[[nodiscard]]
+		const PipelineStatistics GetPipelineStatistics() const noexcept;
+
 		/**
 		 Updates this rendering manager.
 		 */
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "spectrum\color.hpp"
+#include "spectrum/color.hpp"
 
 #pragma endregion
 
@@ -0,0 +1,85 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/font/glyph_table.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	GlyphTable::GlyphTable()
+		: m_page_table{},
+		m_pages(s_page_size, s_no_glyph),
+		m_characters(),
+		m_first_index(0u) {}
+
+	GlyphTable::GlyphTable(const std::vector< U32 >& characters)
+		: GlyphTable() {
+
+		std::size_t i = 0u;
+		for (; i < characters.size(); ++i) {
+			const auto character = characters[i];
+			if (s_page_table_size <= character) {
+				// The characters are sorted.
+				break;
+			}
+
+			auto& page = m_page_table[character / s_page_size];
+			if (0u == page) {
+				page = static_cast< U16 >(GetNumberOfPages());
+				m_pages.resize(m_pages.size() + s_page_size, s_no_glyph);
+			}
+
+			m_pages[page * s_page_size + character % s_page_size]
+				= static_cast< U32 >(i);
+		}
+
+		m_pages.shrink_to_fit();
+
+		// Sparse high code points are binary searched.
+		m_characters.assign(characters.cbegin() + i, characters.cend());
+		m_first_index = static_cast< U32 >(i);
+	}
+
+	GlyphTable::GlyphTable(const GlyphTable& table) = default;
+
+	GlyphTable::GlyphTable(GlyphTable&& table) noexcept = default;
+
+	GlyphTable::~GlyphTable() = default;
+
+	GlyphTable& GlyphTable::operator=(const GlyphTable& table) = default;
+
+	GlyphTable& GlyphTable::operator=(GlyphTable&& table) noexcept = default;
+
+	[[nodiscard]]
+	U32 GlyphTable::Find(U32 character) const noexcept {
+		if (s_page_table_size > character) {
+			const auto page = m_page_table[character / s_page_size];
+			return m_pages[page * s_page_size + character % s_page_size];
+		}
+
+		if (const auto it = std::lower_bound(m_characters.cbegin(),
+											 m_characters.cend(), character);
+			it != m_characters.cend() && *it == character) {
+
+			return m_first_index
+				 + static_cast< U32 >(it - m_characters.cbegin());
+		}
+
+		return s_no_glyph;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,200 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+#include <limits>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of glyph tables (i.e. maps from characters to glyph indices).
+
+	 Characters of the Basic Multilingual Plane are looked up in a two-level
+	 page table: each block of 256 characters maps to a dense glyph page.
+	 Blocks without glyphs share an empty first glyph page. Other (sparse)
+	 characters are binary searched.
+
+	 Glyph tables are device-independent.
+	 */
+	class GlyphTable {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The glyph index of characters without a glyph.
+		 */
+		static constexpr U32 s_no_glyph = std::numeric_limits< U32 >::max();
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an (empty) glyph table.
+		 */
+		GlyphTable();
+
+		/**
+		 Constructs a glyph table for the given characters.
+
+		 @pre			The given characters are sorted.
+		 @param[in]		characters
+						A reference to a vector containing the characters. The
+						glyph index of each character is its index in
+						@a characters.
+		 */
+		explicit GlyphTable(const std::vector< U32 >& characters);
+
+		/**
+		 Constructs a glyph table from the given glyph table.
+
+		 @param[in]		table
+						A reference to the glyph table to copy.
+		 */
+		GlyphTable(const GlyphTable& table);
+
+		/**
+		 Constructs a glyph table by moving the given glyph table.
+
+		 @param[in]		table
+						A reference to the glyph table to move.
+		 */
+		GlyphTable(GlyphTable&& table) noexcept;
+
+		/**
+		 Destructs this glyph table.
+		 */
+		~GlyphTable();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given glyph table to this glyph table.
+
+		 @param[in]		table
+						A reference to the glyph table to copy.
+		 @return		A reference to the copy of the given glyph table (i.e.
+						this glyph table).
+		 */
+		GlyphTable& operator=(const GlyphTable& table);
+
+		/**
+		 Moves the given glyph table to this glyph table.
+
+		 @param[in]		table
+						A reference to the glyph table to move.
+		 @return		A reference to the moved glyph table (i.e. this glyph
+						table).
+		 */
+		GlyphTable& operator=(GlyphTable&& table) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the glyph index of the given character.
+
+		 @param[in]		character
+						The character.
+		 @return		@c s_no_glyph if the given character has no glyph.
+		 @return		The glyph index of the given character.
+		 */
+		[[nodiscard]]
+		U32 Find(U32 character) const noexcept;
+
+		/**
+		 Returns the number of glyph pages of this glyph table (including the
+		 empty first glyph page).
+
+		 @return		The number of glyph pages of this glyph table.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfPages() const noexcept {
+			return m_pages.size() / s_page_size;
+		}
+
+		/**
+		 Returns the memory usage (in bytes) of this glyph table.
+
+		 @return		The memory usage of this glyph table.
+		 */
+		[[nodiscard]]
+		std::size_t GetMemoryUsage() const noexcept {
+			return sizeof(GlyphTable)
+				 + m_pages.size()      * sizeof(U32)
+				 + m_characters.size() * sizeof(U32);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of characters per glyph page.
+		 */
+		static constexpr U32 s_page_size = 256u;
+
+		/**
+		 The number of characters covered by the page table (i.e. the Basic
+		 Multilingual Plane).
+		 */
+		static constexpr U32 s_page_table_size = 256u * s_page_size;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The page table of this glyph table (i.e. the index of the glyph page
+		 of each block of 256 characters of the Basic Multilingual Plane).
+		 Blocks without glyphs refer to the (empty) first glyph page.
+		 */
+		std::array< U16, 256u > m_page_table;
+
+		/**
+		 A vector containing the glyph pages of this glyph table (i.e. the
+		 glyph index of each character of a block of 256 characters).
+		 */
+		std::vector< U32 > m_pages;
+
+		/**
+		 A vector containing the (sorted) characters of this glyph table
+		 outside the Basic Multilingual Plane.
+		 */
+		std::vector< U32 > m_characters;
+
+		/**
+		 The glyph index of the first character of this glyph table outside
+		 the Basic Multilingual Plane.
+		 */
+		U32 m_first_index;
+	};
+}
\ No newline at end of file
@@ -3,9 +3,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\font\sprite_font.hpp"
-#include "loaders\sprite_font_loader.hpp"
-#include "exception\exception.hpp"
+#include "resource/font/sprite_font.hpp"
+#include "resource/texture/texture.hpp"
+#include "loaders/sprite_font_loader.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -14,6 +15,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <algorithm>
 #include <limits>
 
 #pragma endregion
@@ -99,7 +101,9 @@ namespace mage::rendering {
 		                   const SpriteFontDescriptor& desc)
 		: Resource< SpriteFont >(std::move(fname)),
 		m_texture_srv(),
+		m_texture_size(),
 		m_glyphs(),
+		m_glyph_table(),
 		m_default_glyph(nullptr),
 		m_line_spacing(0.0f) {
 
@@ -113,6 +117,17 @@ namespace mage::rendering {
 
 	SpriteFont::~SpriteFont() = default;
 
+	[[nodiscard]]
+	std::size_t SpriteFont::GetMemoryUsage() const noexcept {
+		using std::size;
+		const auto glyphs_memory_usage = size(m_glyphs) * sizeof(Glyph)
+			                           + m_glyph_table.GetMemoryUsage();
+		const auto texture_memory_usage = m_texture_srv
+			? GetTexture2DMemoryUsage(*m_texture_srv.Get()) : 0u;
+
+		return sizeof(SpriteFont) + glyphs_memory_usage + texture_memory_usage;
+	}
+
 	SpriteFont& SpriteFont::operator=(SpriteFont&& font) noexcept = default;
 
 	void SpriteFont::InitializeSpriteFont(const SpriteFontOutput& output) {
@@ -124,10 +139,19 @@ namespace mage::rendering {
 			                               GlyphLessThan());
 		ThrowIfFailed(sorted, "Sprite font glyphs are not sorted.");
 
+		std::vector< U32 > characters;
+		characters.reserve(m_glyphs.size());
+		for (const auto& glyph : m_glyphs) {
+			characters.push_back(glyph.m_character);
+		}
+		m_glyph_table = GlyphTable(characters);
+
 		SetLineSpacing(output.m_line_spacing);
 		SetDefaultCharacter(output.m_default_character);
 
-		m_texture_srv = std::move(output.m_texture_srv);
+		m_texture_srv  = std::move(output.m_texture_srv);
+		m_texture_size = m_texture_srv ? GetTexture2DSize(*m_texture_srv.Get())
+			                           : U32x2();
 	}
 
 	void SpriteFont::DrawText(SpriteBatch& sprite_batch,
@@ -136,6 +160,39 @@ namespace mage::rendering {
 		                      SpriteEffect effects,
 		                      const RGBA* color) const {
 
+		ForEachGlyphSprite(strings, transform, effects, color,
+			[this, &sprite_batch, effects](FXMVECTOR srgba,
+										   const SpriteTransform2D& sprite_transform,
+										   const RECT* source) {
+				sprite_batch.Draw(m_texture_srv.Get(), m_texture_size,
+								  srgba, effects,
+								  sprite_transform, source);
+			});
+	}
+
+	void SpriteFont::LayoutText(AlignedVector< SpriteInfo >& sprites,
+								gsl::span< const ColorString > strings,
+		                        const SpriteTransform2D& transform,
+		                        SpriteEffect effects,
+		                        const RGBA* color) const {
+
+		ForEachGlyphSprite(strings, transform, effects, color,
+			[this, &sprites, effects](FXMVECTOR srgba,
+									  const SpriteTransform2D& sprite_transform,
+									  const RECT* source) {
+				sprites.emplace_back(m_texture_srv.Get(), m_texture_size,
+									 srgba, effects,
+									 sprite_transform, source);
+			});
+	}
+
+	template< typename ActionT >
+	void SpriteFont::ForEachGlyphSprite(gsl::span< const ColorString > strings,
+		                                const SpriteTransform2D& transform,
+		                                SpriteEffect effects,
+		                                const RGBA* color,
+		                                ActionT&& action) const {
+
 		static_assert(static_cast< U8 >(SpriteEffect::MirrorX) == 1u &&
 			          static_cast< U8 >(SpriteEffect::MirrorY) == 2u,
 			          "The following tables must be updated to match");
@@ -205,11 +262,7 @@ namespace mage::rendering {
 						const auto srgba = (color) ? XMLoad(*color)
 							                       : XMLoad(str.GetColor());
 
-						sprite_batch.Draw(m_texture_srv.Get(),
-							              srgba,
-							              effects,
-							              sprite_transform,
-							              &glyph->m_sub_rectangle);
+						action(srgba, sprite_transform, &glyph->m_sub_rectangle);
 					}
 
 					x += width + glyph->m_advance_x;
@@ -331,23 +384,13 @@ namespace mage::rendering {
 
 	[[nodiscard]]
 	bool SpriteFont::ContainsCharacter(wchar_t character) const {
-		using std::cbegin;
-		using std::cend;
-
-		return std::binary_search(cbegin(m_glyphs), cend(m_glyphs),
-			                      character, GlyphLessThan());
+		return nullptr != FindGlyph(character);
 	}
 
 	[[nodiscard]]
 	const Glyph* SpriteFont::GetGlyph(wchar_t character) const {
-		using std::cbegin;
-		using std::cend;
-
-		if (const auto it = std::lower_bound(cbegin(m_glyphs), cend(m_glyphs),
-			                                 character, GlyphLessThan());
-			it != cend(m_glyphs) && it->m_character == character) {
-
-			return &(*it);
+		if (const auto glyph = FindGlyph(character); glyph) {
+			return glyph;
 		}
 
 		ThrowIfFailed((nullptr != m_default_glyph),
@@ -356,5 +399,11 @@ namespace mage::rendering {
 		return m_default_glyph;
 	}
 
+	[[nodiscard]]
+	const Glyph* SpriteFont::FindGlyph(wchar_t character) const noexcept {
+		const auto index = m_glyph_table.Find(static_cast< U32 >(character));
+		return (GlyphTable::s_no_glyph != index) ? &m_glyphs[index] : nullptr;
+	}
+
 	#pragma endregion
 }
\ No newline at end of file
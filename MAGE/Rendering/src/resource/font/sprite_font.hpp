@@ -5,11 +5,13 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\resource.hpp"
-#include "resource\font\color_string.hpp"
-#include "resource\font\sprite_font_descriptor.hpp"
-#include "resource\font\sprite_font_output.hpp"
-#include "renderer\pass\sprite_batch.hpp"
+#include "resource/resource.hpp"
+#include "resource/font/color_string.hpp"
+#include "resource/font/glyph_table.hpp"
+#include "resource/font/sprite_font_descriptor.hpp"
+#include "resource/font/sprite_font_output.hpp"
+#include "renderer/pass/sprite_batch.hpp"
+#include "collection/vector.hpp"
 
 #pragma endregion
 
@@ -125,6 +127,32 @@ namespace mage::rendering {
 			          SpriteEffect effects = SpriteEffect::None,
 		              const RGBA* color = nullptr) const;
 
+		/**
+		 Lays out the given text with this sprite font (i.e. appends a sprite
+		 for each visible glyph of the given text to the given sprites).
+		 The resulting sprites can be drawn with a sprite batch as long as
+		 the given text, transform, effects and color do not change.
+
+		 @param[in,out]	sprites
+						A reference to a vector containing the sprites.
+		 @param[in]		strings
+						The strings of the text.
+		 @param[in]		transform
+						A reference to the sprite transform.
+		 @param[in]		effects
+						The sprite effects to apply.
+		 @param[in]		color
+						A pointer to the (linear) color. If this pointer is
+						equal to @c nullptr, each string will be laid out in
+						its own color. Otherwise, each string is laid out in
+						this color.
+		 */
+		void LayoutText(AlignedVector< SpriteInfo >& sprites,
+			            gsl::span< const ColorString > strings,
+			            const SpriteTransform2D& transform,
+			            SpriteEffect effects = SpriteEffect::None,
+		                const RGBA* color = nullptr) const;
+
 		/**
 		 Returns the size of the given text with this sprite font (in pixels).
 
@@ -177,6 +205,14 @@ namespace mage::rendering {
 			return size(m_glyphs);
 		}
 
+		/**
+		 Returns the memory usage of this sprite font.
+
+		 @return		The memory usage (in bytes) of this sprite font.
+		 */
+		[[nodiscard]]
+		std::size_t GetMemoryUsage() const noexcept;
+
 		/**
 		 Returns the line spacing of this sprite font.
 
@@ -272,6 +308,17 @@ namespace mage::rendering {
 			return m_texture_srv.Get();
 		}
 
+		/**
+		 Returns the size of the texture of this sprite font.
+
+		 @return		The size [width, height] of the texture of this
+						sprite font.
+		 */
+		[[nodiscard]]
+		const U32x2 GetTextureSize() const noexcept {
+			return m_texture_size;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -289,6 +336,49 @@ namespace mage::rendering {
 		 */
 		void InitializeSpriteFont(const SpriteFontOutput& output);
 
+		/**
+		 Traverses the sprites of all visible glyphs of the given text.
+
+		 @tparam		ActionT
+						An action to perform on the sprites of all visible
+						glyphs. The action must accept a @c FXMVECTOR color,
+						a @c const @c SpriteTransform2D& transform and a
+						@c const @c RECT* source region.
+		 @param[in]		strings
+						The strings of the text.
+		 @param[in]		transform
+						A reference to the sprite transform.
+		 @param[in]		effects
+						The sprite effects to apply.
+		 @param[in]		color
+						A pointer to the (linear) color. If this pointer is
+						equal to @c nullptr, each string uses its own color.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ActionT >
+		void ForEachGlyphSprite(gsl::span< const ColorString > strings,
+			                    const SpriteTransform2D& transform,
+			                    SpriteEffect effects,
+			                    const RGBA* color,
+			                    ActionT&& action) const;
+
+		/**
+		 Returns the glyph of this sprite font corresponding to the given
+		 character.
+
+		 The character is looked up in the glyph table of this sprite font.
+
+		 @param[in]		character
+						The character.
+		 @return		@c nullptr if the given character does not match any
+						glyphs of this sprite font.
+		 @return		A pointer to the glyph of this sprite font corresponding
+						to the given character.
+		 */
+		[[nodiscard]]
+		const Glyph* FindGlyph(wchar_t character) const noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -298,11 +388,21 @@ namespace mage::rendering {
 		 */
 		ComPtr< ID3D11ShaderResourceView > m_texture_srv;
 
+		/**
+		 The size [width, height] of the texture of this sprite font.
+		 */
+		U32x2 m_texture_size;
+
 		/**
 		 A vector containing the glyphs of this sprite font.
 		 */
 		std::vector< Glyph > m_glyphs;
 
+		/**
+		 The glyph table of this sprite font.
+		 */
+		GlyphTable m_glyph_table;
+
 		/**
 		 A pointer to the default glyph of this sprite font.
 		 */
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\font\sprite_font_factory.hpp"
+#include "resource/font/sprite_font_factory.hpp"
 
 #pragma endregion
 
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\mesh.hpp"
+#include "resource/mesh/mesh.hpp"
 
 #pragma endregion
 
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pipeline.hpp"
+#include "renderer/pipeline.hpp"
 
 #pragma endregion
 
@@ -130,6 +130,19 @@ namespace mage::rendering {
 			return m_primitive_topology;
 		}
 
+		/**
+		 Returns the memory usage of the vertex and index buffer of this
+		 mesh.
+
+		 @return		The memory usage (in bytes) of this mesh.
+		 */
+		[[nodiscard]]
+		std::size_t GetMemoryUsage() const noexcept {
+			const std::size_t index_size
+				= (DXGI_FORMAT_R16_UINT == m_index_format) ? 2u : 4u;
+			return m_nb_vertices * m_vertex_size + m_nb_indices * index_size;
+		}
+
 		/**
 		 Binds this mesh.
 
@@ -312,6 +325,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\mesh.tpp"
+#include "resource/mesh/mesh.tpp"
 
 #pragma endregion
\ No newline at end of file
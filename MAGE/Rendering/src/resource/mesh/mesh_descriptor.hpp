@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\scalar_types.hpp"
+#include "type/scalar_types.hpp"
 
 #pragma endregion
 
@@ -41,12 +41,23 @@ namespace mage::rendering {
 						A flag indicating whether the face vertices should be
 						defined in clockwise order or not (i.e.
 						counterclockwise order).
+		 @param[in]		optimize
+						A flag indicating whether the mesh should be optimized
+						for the post-transform vertex cache and vertex fetch
+						when it is baked (i.e. exported as MDL file).
+		 @param[in]		optimize_overdraw
+						A flag indicating whether the mesh should additionally
+						be optimized for overdraw.
 		 */
 		constexpr explicit MeshDescriptor(
 			bool invert_handedness = false,
-			bool clockwise_order   = true) noexcept
+			bool clockwise_order   = true,
+			bool optimize          = false,
+			bool optimize_overdraw = false) noexcept
 			: m_invert_handedness(invert_handedness),
-			m_clockwise_order(clockwise_order) {}
+			m_clockwise_order(clockwise_order),
+			m_optimize(optimize),
+			m_optimize_overdraw(optimize_overdraw) {}
 
 		/**
 		 Constructs a mesh descriptor from the given mesh descriptor.
@@ -122,6 +133,31 @@ namespace mage::rendering {
 			return m_clockwise_order;
 		}
 
+		/**
+		 Checks whether the mesh should be optimized for the post-transform
+		 vertex cache and vertex fetch when it is baked according to this mesh
+		 descriptor.
+
+		 @return		@c true if the mesh should be optimized. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool Optimize() const noexcept {
+			return m_optimize;
+		}
+
+		/**
+		 Checks whether the mesh should additionally be optimized for overdraw
+		 according to this mesh descriptor.
+
+		 @return		@c true if the mesh should additionally be optimized
+						for overdraw. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool OptimizeOverdraw() const noexcept {
+			return m_optimize && m_optimize_overdraw;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -140,5 +176,18 @@ namespace mage::rendering {
 		 descriptor.
 		 */
 		bool m_clockwise_order;
+
+		/**
+		 A flag indicating whether the mesh should be optimized for the
+		 post-transform vertex cache and vertex fetch for this mesh
+		 descriptor.
+		 */
+		bool m_optimize;
+
+		/**
+		 A flag indicating whether the mesh should additionally be optimized
+		 for overdraw for this mesh descriptor.
+		 */
+		bool m_optimize_overdraw;
 	};
 }
\ No newline at end of file
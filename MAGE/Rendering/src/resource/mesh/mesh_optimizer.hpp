@@ -0,0 +1,181 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/geometry.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <gsl/span>
+#include <type_traits>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A struct of post-transform vertex cache statistics.
+	 */
+	struct VertexCacheStatistics {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The Average Cache Miss Ratio (ACMR) (i.e. the average number of
+		 transformed vertices per triangle). The ACMR lies in [0.5,3].
+		 */
+		F32 m_acmr = 0.0f;
+
+		/**
+		 The Average Transformed Vertex Ratio (ATVR) (i.e. the average number
+		 of times each referenced vertex is transformed). The optimal ATVR is
+		 equal to 1.
+		 */
+		F32 m_atvr = 0.0f;
+	};
+
+	/**
+	 A struct of mesh optimization reports.
+	 */
+	struct MeshOptimizationReport {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The post-transform vertex cache statistics before the optimization.
+		 */
+		VertexCacheStatistics m_before;
+
+		/**
+		 The post-transform vertex cache statistics after the optimization.
+		 */
+		VertexCacheStatistics m_after;
+	};
+
+	namespace details {
+
+		/**
+		 Checks whether the given vertex type has a position member @c m_p.
+
+		 @tparam		VertexT
+						The vertex type.
+		 */
+		template< typename VertexT, typename = void >
+		struct HasPosition : std::false_type {};
+
+		template< typename VertexT >
+		struct HasPosition< VertexT, std::void_t< decltype(
+			XMLoad(std::declval< const VertexT& >().m_p)) > >
+			: std::true_type {};
+	}
+
+	/**
+	 Computes the post-transform vertex cache statistics of the given indices
+	 by simulating a FIFO vertex cache.
+
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		indices
+					The indices of a triangle list.
+	 @param[in]		cache_size
+					The size of the simulated FIFO vertex cache.
+	 @return		The post-transform vertex cache statistics of the given
+					indices.
+	 */
+	template< typename IndexT >
+	[[nodiscard]]
+	const VertexCacheStatistics
+		ComputeVertexCacheStatistics(gsl::span< const IndexT > indices,
+									 std::size_t cache_size = 16u);
+
+	/**
+	 Reorders the triangles of the given indices for post-transform vertex
+	 cache locality.
+
+	 This uses the linear-speed vertex cache optimization algorithm of
+	 Tom Forsyth. The set of triangles and their winding order remain
+	 unchanged.
+
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	indices
+					The indices of a triangle list.
+	 */
+	template< typename IndexT >
+	void OptimizeVertexCache(gsl::span< IndexT > indices);
+
+	/**
+	 Reorders the clusters of triangles of the given (vertex cache optimized)
+	 indices to reduce overdraw.
+
+	 The triangles are split into clusters at the hard boundaries of the
+	 simulated FIFO vertex cache (i.e. triangles for which all vertices miss
+	 the cache). Clusters facing outwards of the centroid of all triangles are
+	 moved to the front, since these are more likely to occlude the others.
+	 The triangle order within each cluster remains unchanged.
+
+	 @tparam		VertexT
+					The vertex type. The vertex type must have a position
+					member @c m_p.
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	indices
+					The indices of a triangle list.
+	 @param[in]		vertices
+					A reference to a vector containing the vertices.
+	 @param[in]		cache_size
+					The size of the simulated FIFO vertex cache.
+	 */
+	template< typename VertexT, typename IndexT >
+	void OptimizeOverdraw(gsl::span< IndexT > indices,
+						  const std::vector< VertexT >& vertices,
+						  std::size_t cache_size = 16u);
+
+	/**
+	 Reorders the given vertices in order of first use by the given indices
+	 for vertex fetch locality, and remaps the given indices accordingly.
+
+	 Vertices which are not referenced by any index are moved to the end.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	vertices
+					A reference to a vector containing the vertices.
+	 @param[in,out]	indices
+					The indices of a triangle list.
+	 */
+	template< typename VertexT, typename IndexT >
+	void OptimizeVertexFetch(std::vector< VertexT >& vertices,
+							 gsl::span< IndexT > indices);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/mesh/mesh_optimizer.tpp"
+
+#pragma endregion
\ No newline at end of file
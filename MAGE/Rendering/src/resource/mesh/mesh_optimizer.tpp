@@ -0,0 +1,416 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace details {
+
+		/**
+		 The size of the LRU vertex cache used for scoring vertices.
+		 */
+		constexpr std::size_t g_vertex_cache_scoring_size = 32u;
+
+		/**
+		 Computes the score of a vertex.
+
+		 @param[in]		cache_position
+						The position of the vertex in the LRU vertex cache
+						(or -1 if the vertex is not in the cache).
+		 @param[in]		nb_triangles
+						The number of not yet emitted triangles using the
+						vertex.
+		 @return		The score of the vertex.
+		 */
+		[[nodiscard]]
+		inline F32 ComputeVertexScore(S32 cache_position,
+									  std::size_t nb_triangles) noexcept {
+
+			if (0u == nb_triangles) {
+				// No triangles left using this vertex.
+				return -1.0f;
+			}
+
+			F32 score = 0.0f;
+			if (3 > cache_position) {
+				// The vertices of the most recently emitted triangle get a
+				// fixed score to avoid favoring any of its edges.
+				score = (0 > cache_position) ? 0.0f : 0.75f;
+			}
+			else {
+				constexpr auto scaler = 1.0f
+					/ static_cast< F32 >(g_vertex_cache_scoring_size - 3u);
+				const auto s = 1.0f
+					- static_cast< F32 >(cache_position - 3) * scaler;
+				score = std::pow(s, 1.5f);
+			}
+
+			// Boost the score of vertices with few triangles left.
+			const auto valence_boost
+				= std::pow(static_cast< F32 >(nb_triangles), -0.5f);
+			return score + 2.0f * valence_boost;
+		}
+	}
+
+	template< typename IndexT >
+	[[nodiscard]]
+	const VertexCacheStatistics
+		ComputeVertexCacheStatistics(gsl::span< const IndexT > indices,
+									 std::size_t cache_size) {
+
+		const auto nb_indices   = static_cast< std::size_t >(indices.size());
+		const auto nb_triangles = nb_indices / 3u;
+		if (0u == nb_triangles || 0u == cache_size) {
+			return {};
+		}
+
+		std::vector< IndexT > cache(cache_size);
+		std::size_t cache_count = 0u;
+		std::size_t cache_head  = 0u;
+		std::size_t nb_misses   = 0u;
+
+		for (std::size_t i = 0u; i < 3u * nb_triangles; ++i) {
+			const auto index = indices[i];
+			const auto last  = cache.cbegin() + cache_count;
+			if (last != std::find(cache.cbegin(), last, index)) {
+				continue;
+			}
+
+			++nb_misses;
+
+			// Push the vertex into the FIFO cache.
+			if (cache_count < cache_size) {
+				cache[cache_count++] = index;
+			}
+			else {
+				cache[cache_head] = index;
+				cache_head = (cache_head + 1u) % cache_size;
+			}
+		}
+
+		std::vector< IndexT > vertices(indices.begin(), indices.end());
+		std::sort(vertices.begin(), vertices.end());
+		const auto nb_vertices = static_cast< std::size_t >(
+			std::unique(vertices.begin(), vertices.end()) - vertices.begin());
+
+		VertexCacheStatistics statistics;
+		statistics.m_acmr = static_cast< F32 >(nb_misses)
+			              / static_cast< F32 >(nb_triangles);
+		statistics.m_atvr = static_cast< F32 >(nb_misses)
+			              / static_cast< F32 >(nb_vertices);
+		return statistics;
+	}
+
+	template< typename IndexT >
+	void OptimizeVertexCache(gsl::span< IndexT > indices) {
+		using details::g_vertex_cache_scoring_size;
+		using details::ComputeVertexScore;
+
+		const auto nb_indices   = static_cast< std::size_t >(indices.size());
+		const auto nb_triangles = nb_indices / 3u;
+		if (2u > nb_triangles) {
+			return;
+		}
+
+		// Remap the indices to a compact range of local vertices.
+		std::vector< IndexT > vertices(indices.begin(),
+									   indices.begin() + 3u * nb_triangles);
+		std::sort(vertices.begin(), vertices.end());
+		vertices.erase(std::unique(vertices.begin(), vertices.end()),
+					   vertices.end());
+		const auto nb_vertices = vertices.size();
+
+		std::vector< U32 > local_indices(3u * nb_triangles);
+		for (std::size_t i = 0u; i < local_indices.size(); ++i) {
+			const auto it = std::lower_bound(vertices.cbegin(),
+											 vertices.cend(), indices[i]);
+			local_indices[i] = static_cast< U32 >(it - vertices.cbegin());
+		}
+
+		// Build the vertex-triangle adjacency.
+		std::vector< U32 > nb_remaining(nb_vertices, 0u);
+		for (const auto v : local_indices) {
+			++nb_remaining[v];
+		}
+
+		std::vector< U32 > offsets(nb_vertices, 0u);
+		std::exclusive_scan(nb_remaining.cbegin(), nb_remaining.cend(),
+							offsets.begin(), 0u);
+
+		std::vector< U32 > adjacency(local_indices.size());
+		{
+			auto fill = offsets;
+			for (std::size_t i = 0u; i < local_indices.size(); ++i) {
+				const auto v = local_indices[i];
+				adjacency[fill[v]++] = static_cast< U32 >(i / 3u);
+			}
+		}
+
+		// Compute the initial vertex and triangle scores.
+		std::vector< S32 > cache_positions(nb_vertices, -1);
+		std::vector< F32 > vertex_scores(nb_vertices);
+		for (std::size_t v = 0u; v < nb_vertices; ++v) {
+			vertex_scores[v] = ComputeVertexScore(-1, nb_remaining[v]);
+		}
+
+		std::vector< F32 > triangle_scores(nb_triangles);
+		std::vector< bool > emitted(nb_triangles, false);
+		for (std::size_t t = 0u; t < nb_triangles; ++t) {
+			triangle_scores[t] = vertex_scores[local_indices[3u * t]]
+				               + vertex_scores[local_indices[3u * t + 1u]]
+				               + vertex_scores[local_indices[3u * t + 2u]];
+		}
+
+		auto best = static_cast< std::size_t >(
+			std::max_element(triangle_scores.cbegin(), triangle_scores.cend())
+			- triangle_scores.cbegin());
+
+		std::vector< U32 > cache;
+		cache.reserve(g_vertex_cache_scoring_size + 3u);
+		std::vector< U32 > new_cache;
+		new_cache.reserve(g_vertex_cache_scoring_size + 3u);
+		std::vector< IndexT > output;
+		output.reserve(3u * nb_triangles);
+		std::size_t cursor = 0u;
+
+		for (std::size_t i = 0u; i < nb_triangles; ++i) {
+			if (nb_triangles == best) {
+				// No candidate in the cache: fall back to the next triangle
+				// in input order that has not been emitted yet.
+				while (emitted[cursor]) {
+					++cursor;
+				}
+				best = cursor;
+			}
+
+			// Emit the best triangle.
+			emitted[best] = true;
+			const U32* const tri = &local_indices[3u * best];
+			new_cache.clear();
+			for (std::size_t j = 0u; j < 3u; ++j) {
+				const auto v = tri[j];
+				output.push_back(vertices[v]);
+				if (new_cache.cend() == std::find(new_cache.cbegin(),
+												  new_cache.cend(), v)) {
+					new_cache.push_back(v);
+				}
+
+				// Remove the triangle from the adjacency of the vertex.
+				const auto first = adjacency.begin() + offsets[v];
+				const auto last  = first + nb_remaining[v];
+				std::iter_swap(std::find(first, last, static_cast< U32 >(best)),
+							   last - 1);
+				--nb_remaining[v];
+			}
+
+			// Update the LRU cache.
+			for (const auto v : cache) {
+				if (tri[0u] != v && tri[1u] != v && tri[2u] != v) {
+					new_cache.push_back(v);
+				}
+			}
+
+			for (std::size_t j = 0u; j < new_cache.size(); ++j) {
+				const auto v = new_cache[j];
+				cache_positions[v] = (j < g_vertex_cache_scoring_size)
+					               ? static_cast< S32 >(j) : -1;
+				vertex_scores[v] = ComputeVertexScore(cache_positions[v],
+													  nb_remaining[v]);
+			}
+
+			// Update the triangle scores and select the next best triangle.
+			best = nb_triangles;
+			F32 best_score = -1.0f;
+			for (const auto v : new_cache) {
+				const auto first = adjacency.cbegin() + offsets[v];
+				const auto last  = first + nb_remaining[v];
+				for (auto it = first; it != last; ++it) {
+					const auto t = *it;
+					const auto score
+						= vertex_scores[local_indices[3u * t]]
+						+ vertex_scores[local_indices[3u * t + 1u]]
+						+ vertex_scores[local_indices[3u * t + 2u]];
+					triangle_scores[t] = score;
+
+					if (best_score < score) {
+						best_score = score;
+						best = t;
+					}
+				}
+			}
+
+			const auto cache_size = std::min(new_cache.size(),
+											 g_vertex_cache_scoring_size);
+			cache.assign(new_cache.cbegin(), new_cache.cbegin() + cache_size);
+		}
+
+		std::copy(output.cbegin(), output.cend(), indices.begin());
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OptimizeOverdraw(gsl::span< IndexT > indices,
+						  const std::vector< VertexT >& vertices,
+						  std::size_t cache_size) {
+
+		static_assert(details::HasPosition< VertexT >::value,
+					  "OptimizeOverdraw requires vertices with a position m_p.");
+
+		const auto nb_indices   = static_cast< std::size_t >(indices.size());
+		const auto nb_triangles = nb_indices / 3u;
+		if (2u > nb_triangles || 0u == cache_size) {
+			return;
+		}
+
+		// Split the triangles into clusters at the hard boundaries of the
+		// simulated FIFO vertex cache.
+		std::vector< std::size_t > cluster_starts;
+		{
+			std::vector< IndexT > cache(cache_size);
+			std::size_t cache_count = 0u;
+			std::size_t cache_head  = 0u;
+
+			for (std::size_t t = 0u; t < nb_triangles; ++t) {
+				std::size_t nb_misses = 0u;
+				for (std::size_t j = 0u; j < 3u; ++j) {
+					const auto index = indices[3u * t + j];
+					const auto last  = cache.cbegin() + cache_count;
+					if (last != std::find(cache.cbegin(), last, index)) {
+						continue;
+					}
+
+					++nb_misses;
+
+					if (cache_count < cache_size) {
+						cache[cache_count++] = index;
+					}
+					else {
+						cache[cache_head] = index;
+						cache_head = (cache_head + 1u) % cache_size;
+					}
+				}
+
+				if (0u == t || 3u == nb_misses) {
+					cluster_starts.push_back(t);
+				}
+			}
+		}
+
+		const auto nb_clusters = cluster_starts.size();
+		if (2u > nb_clusters) {
+			return;
+		}
+		cluster_starts.push_back(nb_triangles);
+
+		// Compute the area-weighted centroid and normal of each cluster.
+		std::vector< XMFLOAT3 > centroids(nb_clusters);
+		std::vector< XMFLOAT3 > normals(nb_clusters);
+		auto mesh_centroid = XMVectorZero();
+		F32 mesh_area = 0.0f;
+
+		for (std::size_t c = 0u; c < nb_clusters; ++c) {
+			auto centroid = XMVectorZero();
+			auto normal   = XMVectorZero();
+			F32 area = 0.0f;
+
+			for (auto t = cluster_starts[c]; t < cluster_starts[c + 1u]; ++t) {
+				const auto p0 = XMLoad(vertices[indices[3u * t]].m_p);
+				const auto p1 = XMLoad(vertices[indices[3u * t + 1u]].m_p);
+				const auto p2 = XMLoad(vertices[indices[3u * t + 2u]].m_p);
+
+				// The length of the cross product is twice the area.
+				const auto n = XMVector3Cross(p1 - p0, p2 - p0);
+				const auto a = 0.5f * XMVectorGetX(XMVector3Length(n));
+
+				centroid += (p0 + p1 + p2) * (a / 3.0f);
+				normal   += n;
+				area     += a;
+			}
+
+			mesh_centroid += centroid;
+			mesh_area     += area;
+
+			if (0.0f < area) {
+				centroid /= area;
+			}
+
+			XMStoreFloat3(&centroids[c], centroid);
+			XMStoreFloat3(&normals[c], XMVector3Normalize(normal));
+		}
+
+		if (0.0f < mesh_area) {
+			mesh_centroid /= mesh_area;
+		}
+
+		// Sort the clusters from most to least outwards facing.
+		std::vector< F32 > sort_keys(nb_clusters);
+		for (std::size_t c = 0u; c < nb_clusters; ++c) {
+			const auto d = XMLoadFloat3(&centroids[c]) - mesh_centroid;
+			const auto n = XMLoadFloat3(&normals[c]);
+			sort_keys[c] = XMVectorGetX(XMVector3Dot(d, n));
+		}
+
+		std::vector< std::size_t > order(nb_clusters);
+		std::iota(order.begin(), order.end(), 0u);
+		std::stable_sort(order.begin(), order.end(),
+						 [&sort_keys](std::size_t lhs, std::size_t rhs) noexcept {
+							 return sort_keys[lhs] > sort_keys[rhs];
+						 });
+
+		std::vector< IndexT > output;
+		output.reserve(3u * nb_triangles);
+		for (const auto c : order) {
+			output.insert(output.cend(),
+						  indices.begin() + 3u * cluster_starts[c],
+						  indices.begin() + 3u * cluster_starts[c + 1u]);
+		}
+
+		std::copy(output.cbegin(), output.cend(), indices.begin());
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OptimizeVertexFetch(std::vector< VertexT >& vertices,
+							 gsl::span< IndexT > indices) {
+
+		constexpr auto s_unused = std::numeric_limits< std::size_t >::max();
+
+		const auto nb_vertices = vertices.size();
+		std::vector< std::size_t > remap(nb_vertices, s_unused);
+
+		// Assign new positions in order of first use.
+		std::size_t next = 0u;
+		for (auto& index : indices) {
+			auto& position = remap[static_cast< std::size_t >(index)];
+			if (s_unused == position) {
+				position = next++;
+			}
+			index = static_cast< IndexT >(position);
+		}
+
+		// Assign the remaining positions to the unreferenced vertices.
+		for (auto& position : remap) {
+			if (s_unused == position) {
+				position = next++;
+			}
+		}
+
+		std::vector< VertexT > output(nb_vertices);
+		for (std::size_t v = 0u; v < nb_vertices; ++v) {
+			output[remap[v]] = std::move(vertices[v]);
+		}
+
+		vertices = std::move(output);
+	}
+}
\ No newline at end of file
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\mesh.hpp"
-#include "renderer\buffer\buffer_lock.hpp"
+#include "resource/mesh/mesh.hpp"
+#include "renderer/buffer/buffer_lock.hpp"
 
 #pragma endregion
 
@@ -179,6 +179,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\primitive_batch_mesh.tpp"
+#include "resource/mesh/primitive_batch_mesh.tpp"
 
 #pragma endregion
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\sprite_batch_mesh.hpp"
+#include "resource/mesh/sprite_batch_mesh.hpp"
 
 #pragma endregion
 
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\primitive_batch_mesh.hpp"
-#include "resource\mesh\vertex.hpp"
+#include "resource/mesh/primitive_batch_mesh.hpp"
+#include "resource/mesh/vertex.hpp"
 
 #pragma endregion
 
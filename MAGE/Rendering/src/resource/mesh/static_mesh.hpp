@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\mesh.hpp"
+#include "resource/mesh/mesh.hpp"
 
 #pragma endregion
 
@@ -154,6 +154,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\static_mesh.tpp"
+#include "resource/mesh/static_mesh.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\factory.hpp"
-#include "exception\exception.hpp"
+#include "renderer/factory.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
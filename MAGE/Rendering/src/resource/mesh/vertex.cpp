@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\vertex.hpp"
+#include "resource/mesh/vertex.hpp"
 
 #pragma endregion
 
@@ -5,9 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pipeline.hpp"
-#include "geometry\geometry.hpp"
-#include "spectrum\spectrum.hpp"
+#include "renderer/pipeline.hpp"
+#include "geometry/geometry.hpp"
+#include "spectrum/spectrum.hpp"
 
 #pragma endregion
 
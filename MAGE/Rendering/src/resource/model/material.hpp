@@ -6,8 +6,8 @@
 #pragma region
 
 #include "math_utils.hpp"
-#include "spectrum\spectrum.hpp"
-#include "resource\texture\texture.hpp"
+#include "spectrum/spectrum.hpp"
+#include "resource/texture/texture.hpp"
 
 #pragma endregion
 
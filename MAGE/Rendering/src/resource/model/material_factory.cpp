@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\model\material_factory.hpp"
-#include "resource\texture\texture_factory.hpp"
+#include "resource/model/material_factory.hpp"
+#include "resource/texture/texture_factory.hpp"
 
 #pragma endregion
 
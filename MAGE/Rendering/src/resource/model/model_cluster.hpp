@@ -0,0 +1,174 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/bounding_volume.hpp"
+#include "collection/vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <gsl/span>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A struct of model clusters (i.e. contiguous, fixed-size ranges of
+	 triangles of a model part).
+	 */
+	struct alignas(16) ModelCluster {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The default maximum number of triangles of model clusters.
+		 */
+		static constexpr std::size_t s_max_nb_triangles = 64u;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether all triangles of this model cluster are back facing
+		 with regard to the given eye position.
+
+		 @param[in]		eye
+						The eye position (expressed in the same space as this
+						model cluster).
+		 @return		@c true if all triangles of this model cluster are
+						back facing with regard to the given eye position.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool XM_CALLCONV IsBackFacing(FXMVECTOR eye) const noexcept {
+			if (1.0f <= m_cone_cutoff) {
+				// Degenerate normal cone.
+				return false;
+			}
+
+			const auto d      = m_aabb.Centroid() - eye;
+			const auto axis   = XMLoad(m_cone_axis);
+			const auto radius = XMVectorGetX(XMVector3Length(m_aabb.Radius()));
+			const auto dist   = XMVectorGetX(XMVector3Length(d));
+			const auto dot    = XMVectorGetX(XMVector3Dot(d, axis));
+			return dot >= m_cone_cutoff * dist + radius;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables: Bounding Volumes
+		//---------------------------------------------------------------------
+
+		/**
+		 The AABB of this model cluster.
+		 */
+		AABB m_aabb;
+
+		/**
+		 The (normalized) axis of the normal cone of this model cluster.
+		 */
+		F32x3 m_cone_axis = { 0.0f, 0.0f, 0.0f };
+
+		/**
+		 The cutoff (i.e. the sine of the half angle) of the normal cone of
+		 this model cluster. A cutoff of 1 denotes a degenerate normal cone
+		 which never culls.
+		 */
+		F32 m_cone_cutoff = 1.0f;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Mesh
+		//---------------------------------------------------------------------
+
+		/**
+		 The start index of this model cluster in the mesh of the
+		 corresponding model.
+		 */
+		U32 m_start_index = 0u;
+
+		/**
+		 The number of indices of this model cluster in the mesh of the
+		 corresponding model.
+		 */
+		U32 m_nb_indices = 0u;
+	};
+
+	/**
+	 Builds the model clusters of the given range of indices.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		vertices
+					A reference to a vector containing the vertices.
+	 @param[in]		indices
+					The indices of a triangle list.
+	 @param[in]		start_index
+					The start index of the given indices in the mesh of the
+					corresponding model.
+	 @param[in]		max_nb_triangles
+					The maximum number of triangles per model cluster.
+	 @return		A vector containing the model clusters which cover all the
+					triangles of the given indices in order.
+	 */
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	AlignedVector< ModelCluster >
+		BuildModelClusters(const std::vector< VertexT >& vertices,
+						   gsl::span< const IndexT > indices,
+						   std::size_t start_index,
+						   std::size_t max_nb_triangles
+						   = ModelCluster::s_max_nb_triangles);
+
+	/**
+	 Culls the given model clusters against the view frustum and their
+	 normal cones, and traverses the (merged) index ranges of all the
+	 remaining model clusters.
+
+	 @tparam		ActionT
+					The action type.
+	 @param[in]		object_to_projection
+					The object-to-projection transformation matrix.
+	 @param[in]		clusters
+					A reference to a vector containing the model clusters.
+	 @param[in]		cone_culling
+					@c true if back facing model clusters need to be culled
+					(i.e. back face culling is enabled). @c false otherwise.
+	 @param[in]		action
+					A forwarding reference to an action to perform on all
+					visible index ranges. The action must accept a start index
+					and a number of indices as @c std::size_t values.
+	 */
+	template< typename ActionT >
+	void XM_CALLCONV
+		ForEachVisibleIndexRange(FXMMATRIX object_to_projection,
+								 const AlignedVector< ModelCluster >& clusters,
+								 bool cone_culling,
+								 ActionT&& action);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/model/model_cluster.tpp"
+
+#pragma endregion
\ No newline at end of file
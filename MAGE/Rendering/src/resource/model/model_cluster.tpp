@@ -0,0 +1,150 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	AlignedVector< ModelCluster >
+		BuildModelClusters(const std::vector< VertexT >& vertices,
+						   gsl::span< const IndexT > indices,
+						   std::size_t start_index,
+						   std::size_t max_nb_triangles) {
+
+		const auto nb_triangles
+			= static_cast< std::size_t >(indices.size()) / 3u;
+		max_nb_triangles = std::max< std::size_t >(max_nb_triangles, 1u);
+
+		AlignedVector< ModelCluster > clusters;
+		clusters.reserve((nb_triangles + max_nb_triangles - 1u)
+						 / max_nb_triangles);
+
+		std::vector< XMFLOAT3 > normals;
+		normals.reserve(max_nb_triangles);
+
+		for (std::size_t first = 0u; first < nb_triangles;
+			 first += max_nb_triangles) {
+
+			const auto last = std::min(first + max_nb_triangles, nb_triangles);
+
+			ModelCluster cluster;
+			cluster.m_start_index
+				= static_cast< U32 >(start_index + 3u * first);
+			cluster.m_nb_indices
+				= static_cast< U32 >(3u * (last - first));
+
+			// Compute the AABB and the average normal.
+			normals.clear();
+			auto axis = XMVectorZero();
+			for (auto t = first; t < last; ++t) {
+				const auto& v0 = vertices[indices[3u * t]];
+				const auto& v1 = vertices[indices[3u * t + 1u]];
+				const auto& v2 = vertices[indices[3u * t + 2u]];
+
+				cluster.m_aabb = AABB::Union(cluster.m_aabb, v0);
+				cluster.m_aabb = AABB::Union(cluster.m_aabb, v1);
+				cluster.m_aabb = AABB::Union(cluster.m_aabb, v2);
+
+				const auto p0 = XMLoad(v0.m_p);
+				const auto p1 = XMLoad(v1.m_p);
+				const auto p2 = XMLoad(v2.m_p);
+				const auto n  = XMVector3Cross(p1 - p0, p2 - p0);
+				if (XMVector3Equal(n, XMVectorZero())) {
+					// Degenerate triangles do not constrain the normal cone.
+					continue;
+				}
+
+				const auto unit_n = XMVector3Normalize(n);
+				normals.emplace_back();
+				XMStoreFloat3(&normals.back(), unit_n);
+				axis += unit_n;
+			}
+
+			// Compute the normal cone.
+			if (!normals.empty()
+				&& !XMVector3Equal(axis, XMVectorZero())) {
+
+				axis = XMVector3Normalize(axis);
+
+				auto min_dot = 1.0f;
+				for (const auto& normal : normals) {
+					const auto dot
+						= XMVectorGetX(XMVector3Dot(XMLoadFloat3(&normal), axis));
+					min_dot = std::min(min_dot, dot);
+				}
+
+				if (0.0f < min_dot) {
+					cluster.m_cone_axis   = XMStore< F32x3 >(axis);
+					cluster.m_cone_cutoff = std::sqrt(1.0f - min_dot * min_dot);
+				}
+			}
+
+			clusters.push_back(cluster);
+		}
+
+		return clusters;
+	}
+
+	template< typename ActionT >
+	void XM_CALLCONV
+		ForEachVisibleIndexRange(FXMMATRIX object_to_projection,
+								 const AlignedVector< ModelCluster >& clusters,
+								 bool cone_culling,
+								 ActionT&& action) {
+
+		const BoundingFrustum frustum(object_to_projection);
+
+		// The eye position (expressed in object space) is the point which is
+		// projected to infinity. Orthographic projections have no finite eye
+		// position, and are not subject to cone culling.
+		auto eye = XMVectorZero();
+		if (cone_culling) {
+			const auto projection_to_object
+				= XMMatrixInverse(nullptr, object_to_projection);
+			const auto h = XMVector4Transform(g_XMIdentityR2,
+											  projection_to_object);
+			const auto w = XMVectorGetW(h);
+			cone_culling = (1e-6f < std::abs(w));
+			eye = cone_culling ? h / w : eye;
+		}
+
+		std::size_t start      = 0u;
+		std::size_t nb_indices = 0u;
+
+		for (const auto& cluster : clusters) {
+			if (!frustum.Overlaps(cluster.m_aabb)
+				|| (cone_culling && cluster.IsBackFacing(eye))) {
+				continue;
+			}
+
+			if (start + nb_indices == cluster.m_start_index) {
+				// Merge adjacent index ranges.
+				nb_indices += cluster.m_nb_indices;
+				continue;
+			}
+
+			if (0u != nb_indices) {
+				action(start, nb_indices);
+			}
+
+			start      = cluster.m_start_index;
+			nb_indices = cluster.m_nb_indices;
+		}
+
+		if (0u != nb_indices) {
+			action(start, nb_indices);
+		}
+	}
+}
\ No newline at end of file
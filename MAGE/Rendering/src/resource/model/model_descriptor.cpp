@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\rendering_resource_manager.hpp"
+#include "resource/rendering_resource_manager.hpp"
 
 #pragma endregion
 
@@ -44,4 +44,21 @@ namespace mage::rendering {
 
 		return nullptr;
 	}
+
+	[[nodiscard]]
+	std::size_t ModelDescriptor::GetMemoryUsage() const noexcept {
+		std::size_t memory_usage = sizeof(ModelDescriptor)
+			                     + m_materials.size()   * sizeof(Material)
+			                     + m_model_parts.size() * sizeof(ModelPart);
+
+		if (m_mesh) {
+			memory_usage += m_mesh->GetMemoryUsage();
+		}
+
+		for (const auto& model_part : m_model_parts) {
+			memory_usage += model_part.m_clusters.size() * sizeof(ModelCluster);
+		}
+
+		return memory_usage;
+	}
 }
\ No newline at end of file
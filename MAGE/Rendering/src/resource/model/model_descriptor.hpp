@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\static_mesh.hpp"
-#include "loaders\model_loader.hpp"
+#include "resource/mesh/static_mesh.hpp"
+#include "loaders/model_loader.hpp"
 
 #pragma endregion
 
@@ -51,7 +51,8 @@ namespace mage::rendering {
 						A reference to the mesh descriptor.
 		 @param[in]		export_as_MDL
 						@c true if the model descriptor needs to be exported as
-						MDL file. @c false otherwise.
+						MDL file. @c false otherwise. Only exported models are
+						optimized (if requested by the mesh descriptor).
 		 @throws		Exception
 						Failed to initialize the model descriptor.
 		 */
@@ -170,6 +171,29 @@ namespace mage::rendering {
 		template< typename ActionT >
 		void ForEachModelPart(ActionT&& action) const;
 
+		/**
+		 Returns the memory usage of this model descriptor. The textures of
+		 the materials are not included, since these are accounted for
+		 separately.
+
+		 @return		The memory usage (in bytes) of this model descriptor.
+		 */
+		[[nodiscard]]
+		std::size_t GetMemoryUsage() const noexcept;
+
+		/**
+		 Returns the mesh optimization report of this model descriptor.
+
+		 @return		A reference to the post-transform vertex cache
+						statistics before and after the optimization of the
+						mesh of this model descriptor. Both are zero if the
+						mesh is not optimized (i.e. not baked).
+		 */
+		[[nodiscard]]
+		const MeshOptimizationReport& GetOptimizationReport() const noexcept {
+			return m_optimization_report;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -192,6 +216,11 @@ namespace mage::rendering {
 		 descriptor.
 		 */
 		AlignedVector< ModelPart > m_model_parts;
+
+		/**
+		 The mesh optimization report of this model descriptor.
+		 */
+		MeshOptimizationReport m_optimization_report;
 	};
 
 	#pragma endregion
@@ -214,6 +243,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\model\model_descriptor.tpp"
+#include "resource/model/model_descriptor.tpp"
 
 #pragma endregion
\ No newline at end of file
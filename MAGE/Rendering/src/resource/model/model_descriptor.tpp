@@ -14,11 +14,36 @@ namespace mage::rendering {
 		: Resource< ModelDescriptor >(std::move(fname)),
 		m_mesh(),
 		m_materials(),
-		m_model_parts() {
+		m_model_parts(),
+		m_optimization_report() {
 
 		ModelOutput< VertexT, IndexT > buffer;
 		loader::ImportModelFromFile(GetPath(), resource_manager, buffer, desc);
 
+		// The mesh is only optimized (and reported on) when it is baked, so
+		// that imported MDL files are used as is.
+		const auto optimize = export_as_MDL && desc.Optimize();
+		if (optimize) {
+			m_optimization_report
+				= buffer.OptimizeModelParts(desc.OptimizeOverdraw());
+			const auto& report = m_optimization_report;
+
+			// The report is part of the output of the bake, independent of
+			// the verbosity.
+			Log(MessageDisposition::Continue,
+				"{}: ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> {:.3f}.",
+				GetPath(),
+				report.m_before.m_acmr, report.m_after.m_acmr,
+				report.m_before.m_atvr, report.m_after.m_atvr);
+		}
+
+		// MDL files contain the model clusters of their model parts.
+		std::wstring extension(GetPath().extension());
+		TransformToLowerCase(extension);
+		if (optimize || L".mdl" != extension) {
+			buffer.ComputeModelClusters();
+		}
+
 		if (export_as_MDL) {
 			auto mdl_path = GetPath();
 			mdl_path.replace_extension(L".mdl");
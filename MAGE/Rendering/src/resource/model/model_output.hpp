@@ -5,10 +5,12 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "transform\transform.hpp"
-#include "geometry\bounding_volume.hpp"
-#include "resource\model\material.hpp"
-#include "collection\vector.hpp"
+#include "transform/transform.hpp"
+#include "geometry/bounding_volume.hpp"
+#include "resource/model/material.hpp"
+#include "resource/model/model_cluster.hpp"
+#include "resource/mesh/mesh_optimizer.hpp"
+#include "collection/vector.hpp"
 
 #pragma endregion
 
@@ -120,6 +122,13 @@ namespace mage::rendering {
 		 */
 		U32 m_nb_indices = 0u;
 
+		/**
+		 A vector containing the model clusters of this model part. Model
+		 parts which do not exceed a single model cluster have no model
+		 clusters.
+		 */
+		AlignedVector< ModelCluster > m_clusters;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Scene Graph
 		//---------------------------------------------------------------------
@@ -179,6 +188,42 @@ namespace mage::rendering {
 		 */
 		void NormalizeModelParts() noexcept;
 
+		/**
+		 Computes the model clusters of the model parts of this model output.
+
+		 @param[in]		max_nb_triangles
+						The maximum number of triangles per model cluster.
+		 */
+		void ComputeModelClusters(std::size_t max_nb_triangles
+								  = ModelCluster::s_max_nb_triangles);
+
+		/**
+		 Optimizes the model parts of this model output.
+
+		 The triangles of each model part are reordered for post-transform
+		 vertex cache locality (and optionally for overdraw), after which the
+		 vertices are reordered for vertex fetch locality. The index ranges of
+		 the model parts remain valid.
+
+		 @param[in]		optimize_overdraw
+						@c true if the triangles of each model part need to be
+						optimized for overdraw as well. @c false otherwise.
+		 @return		The post-transform vertex cache statistics of this
+						model output before and after the optimization.
+		 */
+		const MeshOptimizationReport
+			OptimizeModelParts(bool optimize_overdraw = false);
+
+		/**
+		 Computes the post-transform vertex cache statistics of this model
+		 output.
+
+		 @return		The post-transform vertex cache statistics of this
+						model output.
+		 */
+		[[nodiscard]]
+		const VertexCacheStatistics ComputeVertexCacheStatistics() const;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -226,6 +271,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\model\model_output.tpp"
+#include "resource/model/model_output.tpp"
 
 #pragma endregion
\ No newline at end of file
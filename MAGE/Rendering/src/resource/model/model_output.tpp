@@ -49,6 +49,63 @@ namespace mage::rendering {
 		NormalizeInObjectSpace();
 	}
 
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >
+		::ComputeModelClusters(std::size_t max_nb_triangles) {
+
+		for (auto& model_part : m_model_parts) {
+			model_part.m_clusters.clear();
+
+			if (model_part.m_nb_indices <= 3u * max_nb_triangles) {
+				continue;
+			}
+
+			const auto indices = gsl::make_span(
+				m_index_buffer.data() + model_part.m_start_index,
+				static_cast< std::ptrdiff_t >(model_part.m_nb_indices));
+
+			model_part.m_clusters
+				= BuildModelClusters(m_vertex_buffer,
+									 gsl::span< const IndexT >(indices),
+									 model_part.m_start_index,
+									 max_nb_triangles);
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	const MeshOptimizationReport ModelOutput< VertexT, IndexT >
+		::OptimizeModelParts(bool optimize_overdraw) {
+
+		MeshOptimizationReport report;
+		report.m_before = ComputeVertexCacheStatistics();
+
+		for (const auto& model_part : m_model_parts) {
+			const auto indices = gsl::make_span(
+				m_index_buffer.data() + model_part.m_start_index,
+				static_cast< std::ptrdiff_t >(model_part.m_nb_indices));
+
+			OptimizeVertexCache(indices);
+
+			if (optimize_overdraw) {
+				OptimizeOverdraw(indices, m_vertex_buffer);
+			}
+		}
+
+		OptimizeVertexFetch(m_vertex_buffer, gsl::make_span(m_index_buffer));
+
+		report.m_after = ComputeVertexCacheStatistics();
+		return report;
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	const VertexCacheStatistics ModelOutput< VertexT, IndexT >
+		::ComputeVertexCacheStatistics() const {
+
+		return rendering::ComputeVertexCacheStatistics(
+			gsl::make_span(std::as_const(m_index_buffer)));
+	}
+
 	template< typename VertexT, typename IndexT >
 	void ModelOutput< VertexT, IndexT >::NormalizeInWorldSpace() noexcept {
 		AABB aabb;
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\rendering_resource_manager.hpp"
+#include "resource/rendering_resource_manager.hpp"
 
 #pragma endregion
 
@@ -12,19 +12,101 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	namespace {
+
+		/**
+		 The default memory budget (in bytes) of model descriptors.
+		 */
+		constexpr std::size_t g_model_descriptor_memory_budget = 256u << 20u;
+
+		/**
+		 The default memory budget (in bytes) of sprite fonts.
+		 */
+		constexpr std::size_t g_sprite_font_memory_budget = 16u << 20u;
+
+		/**
+		 The default memory budget (in bytes) of textures.
+		 */
+		constexpr std::size_t g_texture_memory_budget = 512u << 20u;
+
+		/**
+		 The default memory budget (in bytes) of streamed textures.
+		 */
+		constexpr std::size_t g_texture_streaming_memory_budget = 384u << 20u;
+	}
+
 	ResourceManager::ResourceManager(ID3D11Device& device)
 		: m_device(device),
-		m_model_descriptor_pool(),
+		m_thread_pool(),
+		m_texture_streamer(device, m_thread_pool,
+						   g_texture_streaming_memory_budget),
+		m_model_descriptor_pool(g_model_descriptor_memory_budget),
 		m_vs_pool(),
 		m_hs_pool(),
 		m_ds_pool(),
 		m_gs_pool(),
 		m_ps_pool(),
 		m_cs_pool(),
-		m_sprite_font_pool(),
-		m_texture_pool() {}
+		m_sprite_font_pool(g_sprite_font_memory_budget),
+		m_texture_pool(g_texture_memory_budget),
+		m_model_descriptor_loader(),
+		m_sprite_font_loader(),
+		m_texture_loader(),
+		m_callbacks(),
+		m_progress_reporter() {}
+
+	ResourceManager::~ResourceManager() {
+		// Execute the in-flight loads and streaming tasks before destructing
+		// the resource pools and loaders these refer to.
+		m_thread_pool.Join();
+	}
+
+	[[nodiscard]]
+	std::size_t ResourceManager::GetNumberOfPendingLoads() const noexcept {
+		return m_model_descriptor_loader.size()
+			 + m_sprite_font_loader.size()
+			 + m_texture_loader.size();
+	}
+
+	void ResourceManager::Update() {
+		// Perform the actions of all completed asynchronous loads.
+		m_callbacks.Update();
+
+		// Account for the mip levels streamed in and out since the last
+		// update.
+		m_texture_pool.UpdateMemoryUsage();
+
+		// Evict unreferenced resources exceeding the memory budgets. Model
+		// descriptors are trimmed first, since these reference textures.
+		m_model_descriptor_pool.Trim();
+		m_sprite_font_pool.Trim();
+		m_texture_pool.Trim();
+
+		// Report the load progress.
+		const auto nb_completed = m_model_descriptor_loader.RemoveCompleted()
+			                    + m_sprite_font_loader.RemoveCompleted()
+			                    + m_texture_loader.RemoveCompleted();
+		const auto nb_pending   = GetNumberOfPendingLoads();
+
+		if (!m_progress_reporter) {
+			if (0u == nb_pending) {
+				return;
+			}
+
+			m_progress_reporter = MakeUnique< ProgressReporter >(
+				"Loading resources",
+				static_cast< U32 >(nb_completed + nb_pending));
+		}
+
+		m_progress_reporter->Update(static_cast< U32 >(nb_completed));
 
-	ResourceManager::ResourceManager(ResourceManager&& manager) noexcept = default;
+		if (0u == nb_pending) {
+			m_progress_reporter->Done();
+			m_progress_reporter.reset();
+		}
+	}
 
-	ResourceManager::~ResourceManager() = default;
+	void ResourceManager::CancelCallbacks() noexcept {
+		m_callbacks.clear();
+	}
 }
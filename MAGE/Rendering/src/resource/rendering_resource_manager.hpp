@@ -5,10 +5,14 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\resource_pool.hpp"
-#include "resource\model\model_descriptor.hpp"
-#include "resource\shader\shader.hpp"
-#include "resource\font\sprite_font.hpp"
+#include "resource/resource_pool.hpp"
+#include "resource/resource_loader.hpp"
+#include "resource/resource_callbacks.hpp"
+#include "logging/logging.hpp"
+#include "logging/progress_reporter.hpp"
+#include "resource/model/model_descriptor.hpp"
+#include "resource/shader/shader.hpp"
+#include "resource/font/sprite_font.hpp"
 
 #pragma endregion
 
@@ -59,6 +63,12 @@ namespace mage::rendering {
 			 type.
 			 */
 			using pool_type = ResourcePool< std::wstring, const ResourceT >;
+
+			/**
+			 The loader type of resource loaders loading resources of the
+			 given type.
+			 */
+			using loader_type = ResourceLoader< std::wstring, const ResourceT >;
 		};
 
 		/**
@@ -113,6 +123,26 @@ namespace mage::rendering {
 		template< typename ResourceT >
 		using value_type = typename pool_type< ResourceT >::value_type;
 
+		/**
+		 The loader type of resource loaders loading resources of the given
+		 type.
+
+		 @tparam		ResourceT
+						The resource type.
+		 */
+		template< typename ResourceT >
+		using loader_type = typename ResourceRecord< ResourceT >::loader_type;
+
+		/**
+		 The handle type of resources of the given type which are loaded
+		 asynchronously.
+
+		 @tparam		ResourceT
+						The resource type.
+		 */
+		template< typename ResourceT >
+		using handle_type = typename loader_type< ResourceT >::handle_type;
+
 		#pragma endregion
 
 		//---------------------------------------------------------------------
@@ -137,11 +167,13 @@ namespace mage::rendering {
 
 		/**
 		 Constructs a resource manager by moving the given resource manager.
+		 Resource managers cannot be moved, since the texture streamer and the
+		 in-flight asynchronous loads refer to the resource manager.
 
 		 @param[in]		manager
 						A reference to the resource manager to move.
 		 */
-		ResourceManager(ResourceManager&& manager) noexcept;
+		ResourceManager(ResourceManager&& manager) = delete;
 
 		/**
 		 Destructs this resource manager.
@@ -163,7 +195,9 @@ namespace mage::rendering {
 		ResourceManager& operator=(const ResourceManager& manager) = delete;
 
 		/**
-		 Moves the given resource manager to this resource manager.
+		 Moves the given resource manager to this resource manager. Resource
+		 managers cannot be moved, since the texture streamer and the
+		 in-flight asynchronous loads refer to the resource manager.
 
 		 @param[in]		manager
 						A reference to the resource manager to move.
@@ -377,13 +411,19 @@ namespace mage::rendering {
 						The resource type.
 		 @param[in]		fname
 						The filename (the globally unique identifier).
+		 @param[in]		stream
+						@c true if the texture needs to be streamed (i.e. its
+						more detailed mip levels are loaded on demand, based on
+						the on-screen size reported to the texture streamer of
+						this resource manager). @c false otherwise.
 		 @return		A pointer to the texture.
 		 @throws		Exception
 						Failed to create the texture.
 		 */
 		template< typename ResourceT >
 		typename std::enable_if_t< std::is_same_v< Texture, ResourceT >,
-			TexturePtr > GetOrCreate(const std::wstring& fname);
+			TexturePtr > GetOrCreate(const std::wstring& fname,
+									 bool stream = false);
 
 		/**
 		 Creates a texture (if not existing).
@@ -406,6 +446,117 @@ namespace mage::rendering {
 									 const D3D11_TEXTURE2D_DESC& desc,
 									 const D3D11_SUBRESOURCE_DATA& initial_data);
 
+		/**
+		 Creates a resource (if not existing) asynchronously.
+
+		 The resource is created on one of the worker threads of this resource
+		 manager. Concurrent requests for the same resource share a single
+		 in-flight load.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @tparam		ArgsT
+						The argument types for creating the resource.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @param[in]		args
+						A reference to the arguments for creating the resource
+						(see the corresponding @c GetOrCreate member method).
+						The arguments are copied.
+		 @return		A handle to the resource.
+		 */
+		template< typename ResourceT, typename... ArgsT >
+		[[nodiscard]]
+		typename std::enable_if_t< !is_shader_v< ResourceT >,
+			handle_type< ResourceT > > GetOrCreateAsync(const std::wstring& fname,
+														const ArgsT&... args);
+
+		/**
+		 Registers the given action to be performed on the resource of the
+		 given handle, once it is loaded. The action is performed on the
+		 thread calling @c Update. If the resource fails to load, the action
+		 is not performed.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		handle
+						A reference to the handle to the resource.
+		 @param[in]		action
+						A forwarding reference to the action to perform. The
+						action must accept a pointer to the resource.
+		 */
+		template< typename ResourceT, typename ActionT >
+		void OnLoaded(const ResourceHandle< ResourceT >& handle,
+					  ActionT&& action);
+
+		/**
+		 Returns the statistics of the resource pool containing resources of
+		 the given type of this resource manager.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @return		The statistics of the resource pool containing
+						resources of the given type of this resource manager.
+		 */
+		template< typename ResourceT >
+		[[nodiscard]]
+		const ResourcePoolStatistics GetStatistics() const noexcept;
+
+		/**
+		 Sets the memory budget of the resource pool containing resources of
+		 the given type of this resource manager to the given budget.
+
+		 Unreferenced resources are kept warm (e.g., for switching back to a
+		 previous scene) until the memory usage exceeds the memory budget, at
+		 which point they are evicted in least recently used order.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @param[in]		memory_budget
+						The memory budget (in bytes).
+		 */
+		template< typename ResourceT >
+		typename std::enable_if_t< !is_shader_v< ResourceT > >
+			SetMemoryBudget(std::size_t memory_budget) noexcept;
+
+		/**
+		 Returns the texture streamer of this resource manager.
+
+		 @return		A reference to the texture streamer of this resource
+						manager.
+		 */
+		[[nodiscard]]
+		TextureStreamer& GetTextureStreamer() noexcept {
+			return m_texture_streamer;
+		}
+
+		/**
+		 Returns the number of pending asynchronous loads of this resource
+		 manager.
+
+		 @return		The number of pending asynchronous loads of this
+						resource manager.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfPendingLoads() const noexcept;
+
+		/**
+		 Updates this resource manager (i.e. performs the actions of all
+		 completed asynchronous loads, reports the load progress and evicts
+		 unreferenced resources exceeding the memory budgets). The texture
+		 streamer is updated separately by the thread rendering the
+		 streamed textures.
+		 */
+		void Update();
+
+		/**
+		 Discards the actions of all pending asynchronous loads of this
+		 resource manager. The loads themselves are not cancelled.
+		 */
+		void CancelCallbacks() noexcept;
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -438,6 +589,19 @@ namespace mage::rendering {
 		[[nodiscard]]
 		const typename pool_type< ResourceT >& GetPool() const noexcept;
 
+		/**
+		 Returns the resource loader loading resources of the given type of
+		 this resource manager.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @return		A reference to the the resource loader loading
+						resources of the given type of this resource manager.
+		 */
+		template< typename ResourceT >
+		[[nodiscard]]
+		typename loader_type< ResourceT >& GetLoader() noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -447,6 +611,24 @@ namespace mage::rendering {
 		 */
 		ID3D11Device& m_device;
 
+		/**
+		 The worker threads of this resource manager.
+
+		 The thread pool is constructed before and joined (in the destructor)
+		 before all other members, since the texture streamer enqueues tasks
+		 and these tasks refer to the resource pools and loaders of this
+		 resource manager.
+		 */
+		ThreadPool m_thread_pool;
+
+		/**
+		 The texture streamer of this resource manager.
+
+		 The texture streamer must be destructed after the texture resource
+		 pool, since streamed textures unregister themselves on destruction.
+		 */
+		TextureStreamer m_texture_streamer;
+
 		/**
 		 The model descriptor resource pool of this resource manager.
 		 */
@@ -491,6 +673,33 @@ namespace mage::rendering {
 		 The texture resource pool of this resource manager.
 		 */
 		typename pool_type< Texture > m_texture_pool;
+
+		/**
+		 The model descriptor resource loader of this resource manager.
+		 */
+		typename loader_type< ModelDescriptor > m_model_descriptor_loader;
+
+		/**
+		 The sprite font resource loader of this resource manager.
+		 */
+		typename loader_type< SpriteFont > m_sprite_font_loader;
+
+		/**
+		 The texture resource loader of this resource manager.
+		 */
+		typename loader_type< Texture > m_texture_loader;
+
+		/**
+		 The actions of the pending asynchronous loads of this resource
+		 manager.
+		 */
+		ResourceCallbacks m_callbacks;
+
+		/**
+		 A pointer to the progress reporter of the current batch of
+		 asynchronous loads of this resource manager.
+		 */
+		UniquePtr< ProgressReporter > m_progress_reporter;
 	};
 }
 
@@ -499,6 +708,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\rendering_resource_manager.tpp"
+#include "resource/rendering_resource_manager.tpp"
 
 #pragma endregion
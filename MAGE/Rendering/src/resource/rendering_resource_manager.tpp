@@ -97,6 +97,37 @@ namespace mage::rendering {
 
 	#pragma endregion
 
+	//-------------------------------------------------------------------------
+	// ResourceManager: GetLoader
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	template<>
+	[[nodiscard]]
+	inline ResourceManager::loader_type< ModelDescriptor >&
+		ResourceManager::GetLoader< ModelDescriptor >() noexcept {
+
+		return m_model_descriptor_loader;
+	}
+
+	template<>
+	[[nodiscard]]
+	inline ResourceManager::loader_type< SpriteFont >&
+		ResourceManager::GetLoader< SpriteFont >() noexcept {
+
+		return m_sprite_font_loader;
+	}
+
+	template<>
+	[[nodiscard]]
+	inline ResourceManager::loader_type< Texture >&
+		ResourceManager::GetLoader< Texture >() noexcept {
+
+		return m_texture_loader;
+	}
+
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// ResourceManager: Remaining
 	//-------------------------------------------------------------------------
@@ -214,7 +245,13 @@ namespace mage::rendering {
 	template< typename ResourceT >
 	inline typename std::enable_if_t< std::is_same_v< Texture, ResourceT >,
 		TexturePtr >
-		ResourceManager::GetOrCreate(const std::wstring& fname) {
+		ResourceManager::GetOrCreate(const std::wstring& fname, bool stream) {
+
+		if (stream) {
+			return GetPool< ResourceT >().GetOrCreate(fname, m_device,
+													  key_type< ResourceT >(fname),
+													  m_texture_streamer);
+		}
 
 		return GetPool< ResourceT >().GetOrCreate(fname, m_device,
 												  key_type< ResourceT >(fname));
@@ -232,5 +269,47 @@ namespace mage::rendering {
 												  desc, initial_data);
 	}
 
+	template< typename ResourceT >
+	[[nodiscard]]
+	inline const ResourcePoolStatistics
+		ResourceManager::GetStatistics() const noexcept {
+
+		return GetPool< ResourceT >().GetStatistics();
+	}
+
+	template< typename ResourceT >
+	inline typename std::enable_if_t< !is_shader_v< ResourceT > >
+		ResourceManager::SetMemoryBudget(std::size_t memory_budget) noexcept {
+
+		GetPool< ResourceT >().SetMemoryBudget(memory_budget);
+	}
+
+	template< typename ResourceT, typename... ArgsT >
+	[[nodiscard]]
+	typename std::enable_if_t< !is_shader_v< ResourceT >,
+		ResourceManager::handle_type< ResourceT > >
+		ResourceManager::GetOrCreateAsync(const std::wstring& fname,
+										  const ArgsT&... args) {
+
+		if (auto resource = Get< ResourceT >(fname); resource) {
+			// The resource is already loaded.
+			std::promise< SharedPtr< value_type< ResourceT > > > promise;
+			promise.set_value(std::move(resource));
+			return handle_type< ResourceT >(promise.get_future().share());
+		}
+
+		return GetLoader< ResourceT >().GetOrLoad(fname, m_thread_pool,
+			[this, fname, args...]() {
+				return GetOrCreate< ResourceT >(fname, args...);
+			});
+	}
+
+	template< typename ResourceT, typename ActionT >
+	void ResourceManager::OnLoaded(const ResourceHandle< ResourceT >& handle,
+								   ActionT&& action) {
+
+		m_callbacks.OnLoaded(handle, std::forward< ActionT >(action));
+	}
+
 	#pragma endregion
 }
\ No newline at end of file
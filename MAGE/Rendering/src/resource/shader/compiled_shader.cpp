@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\compiled_shader.hpp"
-#include "exception\exception.hpp"
+#include "resource/shader/compiled_shader.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
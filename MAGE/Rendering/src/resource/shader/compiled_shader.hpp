@@ -6,7 +6,7 @@
 #pragma region
 
 #include "direct3d11.hpp"
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -384,6 +384,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\compiled_shader.hpp"
+#include "resource/shader/compiled_shader.hpp"
 
 #pragma endregion
\ No newline at end of file
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\shader.hpp"
+#include "resource/shader/shader.hpp"
 
 #pragma endregion
 
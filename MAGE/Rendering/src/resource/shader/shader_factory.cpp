@@ -3,27 +3,27 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\shader_factory.hpp"
-#include "resource\mesh\vertex.hpp"
+#include "resource/shader/shader_factory.hpp"
+#include "resource/mesh/vertex.hpp"
 
 // Back Buffer
-#include "backbuffer\back_buffer_PS.hpp"
+#include "backbuffer/back_buffer_PS.hpp"
 
 // GBuffer: Opaque
-#include "gbuffer\gbuffer_PS.hpp"
+#include "gbuffer/gbuffer_PS.hpp"
 // GBuffer: Opaque + TSNM
-#include "gbuffer\gbuffer_tsnm_PS.hpp"
+#include "gbuffer/gbuffer_tsnm_PS.hpp"
 
 // Sky
-#include "sky\sky_VS.hpp"
-#include "sky\sky_PS.hpp"
+#include "sky/sky_VS.hpp"
+#include "sky/sky_PS.hpp"
 
 // Sprite
-#include "sprite\sprite_VS.hpp"
-#include "sprite\sprite_PS.hpp"
+#include "sprite/sprite_VS.hpp"
+#include "sprite/sprite_PS.hpp"
 
 // Transform
-#include "transform\transform_VS.hpp"
+#include "transform/transform_VS.hpp"
 
 #pragma endregion
 
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\configuration.hpp"
-#include "resource\rendering_resource_manager.hpp"
+#include "renderer/configuration.hpp"
+#include "resource/rendering_resource_manager.hpp"
 
 #pragma endregion
 
@@ -443,6 +443,17 @@ namespace mage::rendering {
 	ComputeShaderPtr CreateLowDynamicRangeCS(ResourceManager& resource_manager,
 											 ToneMapping tone_mapping);
 
+	/**
+	 Creates an upsample compute shader.
+
+	 @param[in,out]	resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the upsample compute shader.
+	 @throws		Exception
+					Failed to create the compute shader.
+	 */
+	ComputeShaderPtr CreateUpsampleCS(ResourceManager& resource_manager);
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -677,6 +688,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\shader_factory.tpp"
+#include "resource/shader/shader_factory.tpp"
 
 #pragma endregion
\ No newline at end of file
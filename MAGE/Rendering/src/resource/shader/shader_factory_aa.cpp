@@ -3,16 +3,16 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\shader_factory.hpp"
-#include "resource\mesh\vertex.hpp"
+#include "resource/shader/shader_factory.hpp"
+#include "resource/mesh/vertex.hpp"
 
 // FXAA
-#include "aa\aa_preprocess_CS.hpp"
-#include "aa\fxaa_CS.hpp"
+#include "aa/aa_preprocess_CS.hpp"
+#include "aa/fxaa_CS.hpp"
 // MSAA
-#include "aa\msaa_resolve_CS.hpp"
+#include "aa/msaa_resolve_CS.hpp"
 // SSAA
-#include "aa\ssaa_resolve_CS.hpp"
+#include "aa/ssaa_resolve_CS.hpp"
 
 #pragma endregion
 
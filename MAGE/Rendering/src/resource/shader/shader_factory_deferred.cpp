@@ -3,31 +3,31 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\shader_factory.hpp"
-#include "resource\mesh\vertex.hpp"
+#include "resource/shader/shader_factory.hpp"
+#include "resource/mesh/vertex.hpp"
 
 // Deferred: Opaque
-#include "deferred\deferred_blinn_phong_CS.hpp"
-#include "deferred\deferred_cook_torrance_CS.hpp"
-#include "deferred\deferred_emissive_CS.hpp"
-#include "deferred\deferred_frostbite_CS.hpp"
-#include "deferred\deferred_lambertian_CS.hpp"
+#include "deferred/deferred_blinn_phong_CS.hpp"
+#include "deferred/deferred_cook_torrance_CS.hpp"
+#include "deferred/deferred_emissive_CS.hpp"
+#include "deferred/deferred_frostbite_CS.hpp"
+#include "deferred/deferred_lambertian_CS.hpp"
 // Deferred: Opaque + VCT
-#include "deferred\deferred_vct_blinn_phong_CS.hpp"
-#include "deferred\deferred_vct_cook_torrance_CS.hpp"
-#include "deferred\deferred_vct_frostbite_CS.hpp"
-#include "deferred\deferred_vct_lambertian_CS.hpp"
+#include "deferred/deferred_vct_blinn_phong_CS.hpp"
+#include "deferred/deferred_vct_cook_torrance_CS.hpp"
+#include "deferred/deferred_vct_frostbite_CS.hpp"
+#include "deferred/deferred_vct_lambertian_CS.hpp"
 // Deferred MSAA: Opaque
-#include "deferred\deferred_msaa_blinn_phong_PS.hpp"
-#include "deferred\deferred_msaa_cook_torrance_PS.hpp"
-#include "deferred\deferred_msaa_emissive_PS.hpp"
-#include "deferred\deferred_msaa_frostbite_PS.hpp"
-#include "deferred\deferred_msaa_lambertian_PS.hpp"
+#include "deferred/deferred_msaa_blinn_phong_PS.hpp"
+#include "deferred/deferred_msaa_cook_torrance_PS.hpp"
+#include "deferred/deferred_msaa_emissive_PS.hpp"
+#include "deferred/deferred_msaa_frostbite_PS.hpp"
+#include "deferred/deferred_msaa_lambertian_PS.hpp"
 // Deferred MSAA: Opaque + VCT
-#include "deferred\deferred_msaa_vct_blinn_phong_PS.hpp"
-#include "deferred\deferred_msaa_vct_cook_torrance_PS.hpp"
-#include "deferred\deferred_msaa_vct_frostbite_PS.hpp"
-#include "deferred\deferred_msaa_vct_lambertian_PS.hpp"
+#include "deferred/deferred_msaa_vct_blinn_phong_PS.hpp"
+#include "deferred/deferred_msaa_vct_cook_torrance_PS.hpp"
+#include "deferred/deferred_msaa_vct_frostbite_PS.hpp"
+#include "deferred/deferred_msaa_vct_lambertian_PS.hpp"
 
 #pragma endregion
 
@@ -3,14 +3,14 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\shader_factory.hpp"
-#include "resource\mesh\vertex.hpp"
+#include "resource/shader/shader_factory.hpp"
+#include "resource/mesh/vertex.hpp"
 
 // Depth: Opaque
-#include "depth\depth_VS.hpp"
+#include "depth/depth_VS.hpp"
 // Depth: Transparent
-#include "depth\depth_transparent_VS.hpp"
-#include "depth\depth_transparent_PS.hpp"
+#include "depth/depth_transparent_VS.hpp"
+#include "depth/depth_transparent_PS.hpp"
 
 #pragma endregion
 
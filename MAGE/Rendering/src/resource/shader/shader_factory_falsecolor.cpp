@@ -3,29 +3,29 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\shader_factory.hpp"
-#include "resource\mesh\vertex.hpp"
+#include "resource/shader/shader_factory.hpp"
+#include "resource/mesh/vertex.hpp"
 
 // False Color
-#include "falsecolor\constant_color_PS.hpp"
-#include "falsecolor\constant_color_texture_PS.hpp"
-#include "falsecolor\constant_texture_PS.hpp"
-#include "falsecolor\base_color_PS.hpp"
-#include "falsecolor\base_color_coefficient_PS.hpp"
-#include "falsecolor\base_color_texture_PS.hpp"
-#include "falsecolor\material_PS.hpp"
-#include "falsecolor\material_coefficient_PS.hpp"
-#include "falsecolor\material_texture_PS.hpp"
-#include "falsecolor\roughness_PS.hpp"
-#include "falsecolor\roughness_coefficient_PS.hpp"
-#include "falsecolor\roughness_texture_PS.hpp"
-#include "falsecolor\metalness_PS.hpp"
-#include "falsecolor\metalness_coefficient_PS.hpp"
-#include "falsecolor\metalness_texture_PS.hpp"
-#include "falsecolor\shading_normal_PS.hpp"
-#include "falsecolor\tsnm_shading_normal_PS.hpp"
-#include "falsecolor\depth_PS.hpp"
-#include "falsecolor\distance_PS.hpp"
+#include "falsecolor/constant_color_PS.hpp"
+#include "falsecolor/constant_color_texture_PS.hpp"
+#include "falsecolor/constant_texture_PS.hpp"
+#include "falsecolor/base_color_PS.hpp"
+#include "falsecolor/base_color_coefficient_PS.hpp"
+#include "falsecolor/base_color_texture_PS.hpp"
+#include "falsecolor/material_PS.hpp"
+#include "falsecolor/material_coefficient_PS.hpp"
+#include "falsecolor/material_texture_PS.hpp"
+#include "falsecolor/roughness_PS.hpp"
+#include "falsecolor/roughness_coefficient_PS.hpp"
+#include "falsecolor/roughness_texture_PS.hpp"
+#include "falsecolor/metalness_PS.hpp"
+#include "falsecolor/metalness_coefficient_PS.hpp"
+#include "falsecolor/metalness_texture_PS.hpp"
+#include "falsecolor/shading_normal_PS.hpp"
+#include "falsecolor/tsnm_shading_normal_PS.hpp"
+#include "falsecolor/depth_PS.hpp"
+#include "falsecolor/distance_PS.hpp"
 
 #pragma endregion
 
@@ -3,52 +3,52 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\shader_factory.hpp"
-#include "resource\mesh\vertex.hpp"
+#include "resource/shader/shader_factory.hpp"
+#include "resource/mesh/vertex.hpp"
 
-#include "forward\forward_solid_PS.hpp"
+#include "forward/forward_solid_PS.hpp"
 // Forward: Opaque
-#include "forward\forward_blinn_phong_PS.hpp"
-#include "forward\forward_cook_torrance_PS.hpp"
-#include "forward\forward_emissive_PS.hpp"
-#include "forward\forward_frostbite_PS.hpp"
-#include "forward\forward_lambertian_PS.hpp"
+#include "forward/forward_blinn_phong_PS.hpp"
+#include "forward/forward_cook_torrance_PS.hpp"
+#include "forward/forward_emissive_PS.hpp"
+#include "forward/forward_frostbite_PS.hpp"
+#include "forward/forward_lambertian_PS.hpp"
 // Forward: Opaque + VCT
-#include "forward\forward_vct_blinn_phong_PS.hpp"
-#include "forward\forward_vct_cook_torrance_PS.hpp"
-#include "forward\forward_vct_frostbite_PS.hpp"
-#include "forward\forward_vct_lambertian_PS.hpp"
+#include "forward/forward_vct_blinn_phong_PS.hpp"
+#include "forward/forward_vct_cook_torrance_PS.hpp"
+#include "forward/forward_vct_frostbite_PS.hpp"
+#include "forward/forward_vct_lambertian_PS.hpp"
 // Forward: Opaque + TSNM
-#include "forward\forward_tsnm_blinn_phong_PS.hpp"
-#include "forward\forward_tsnm_cook_torrance_PS.hpp"
-#include "forward\forward_tsnm_frostbite_PS.hpp"
-#include "forward\forward_tsnm_lambertian_PS.hpp"
+#include "forward/forward_tsnm_blinn_phong_PS.hpp"
+#include "forward/forward_tsnm_cook_torrance_PS.hpp"
+#include "forward/forward_tsnm_frostbite_PS.hpp"
+#include "forward/forward_tsnm_lambertian_PS.hpp"
 // Forward: Opaque + VCT + TSNM
-#include "forward\forward_vct_tsnm_blinn_phong_PS.hpp"
-#include "forward\forward_vct_tsnm_cook_torrance_PS.hpp"
-#include "forward\forward_vct_tsnm_frostbite_PS.hpp"
-#include "forward\forward_vct_tsnm_lambertian_PS.hpp"
+#include "forward/forward_vct_tsnm_blinn_phong_PS.hpp"
+#include "forward/forward_vct_tsnm_cook_torrance_PS.hpp"
+#include "forward/forward_vct_tsnm_frostbite_PS.hpp"
+#include "forward/forward_vct_tsnm_lambertian_PS.hpp"
 // Forward: Transparent
-#include "forward\forward_transparent_blinn_phong_PS.hpp"
-#include "forward\forward_transparent_cook_torrance_PS.hpp"
-#include "forward\forward_transparent_emissive_PS.hpp"
-#include "forward\forward_transparent_frostbite_PS.hpp"
-#include "forward\forward_transparent_lambertian_PS.hpp"
+#include "forward/forward_transparent_blinn_phong_PS.hpp"
+#include "forward/forward_transparent_cook_torrance_PS.hpp"
+#include "forward/forward_transparent_emissive_PS.hpp"
+#include "forward/forward_transparent_frostbite_PS.hpp"
+#include "forward/forward_transparent_lambertian_PS.hpp"
 // Forward: Transparent + VCT
-#include "forward\forward_transparent_vct_blinn_phong_PS.hpp"
-#include "forward\forward_transparent_vct_cook_torrance_PS.hpp"
-#include "forward\forward_transparent_vct_frostbite_PS.hpp"
-#include "forward\forward_transparent_vct_lambertian_PS.hpp"
+#include "forward/forward_transparent_vct_blinn_phong_PS.hpp"
+#include "forward/forward_transparent_vct_cook_torrance_PS.hpp"
+#include "forward/forward_transparent_vct_frostbite_PS.hpp"
+#include "forward/forward_transparent_vct_lambertian_PS.hpp"
 // Forward: Transparent + TSNM
-#include "forward\forward_transparent_tsnm_blinn_phong_PS.hpp"
-#include "forward\forward_transparent_tsnm_cook_torrance_PS.hpp"
-#include "forward\forward_transparent_tsnm_frostbite_PS.hpp"
-#include "forward\forward_transparent_tsnm_lambertian_PS.hpp"
+#include "forward/forward_transparent_tsnm_blinn_phong_PS.hpp"
+#include "forward/forward_transparent_tsnm_cook_torrance_PS.hpp"
+#include "forward/forward_transparent_tsnm_frostbite_PS.hpp"
+#include "forward/forward_transparent_tsnm_lambertian_PS.hpp"
 // Forward: Transparent + VCT + TSNM
-#include "forward\forward_transparent_vct_tsnm_blinn_phong_PS.hpp"
-#include "forward\forward_transparent_vct_tsnm_cook_torrance_PS.hpp"
-#include "forward\forward_transparent_vct_tsnm_frostbite_PS.hpp"
-#include "forward\forward_transparent_vct_tsnm_lambertian_PS.hpp"
+#include "forward/forward_transparent_vct_tsnm_blinn_phong_PS.hpp"
+#include "forward/forward_transparent_vct_tsnm_cook_torrance_PS.hpp"
+#include "forward/forward_transparent_vct_tsnm_frostbite_PS.hpp"
+#include "forward/forward_transparent_vct_tsnm_lambertian_PS.hpp"
 
 #pragma endregion
 
@@ -3,17 +3,19 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\shader_factory.hpp"
-#include "resource\mesh\vertex.hpp"
+#include "resource/shader/shader_factory.hpp"
+#include "resource/mesh/vertex.hpp"
 
 // Depth-of-Field
-#include "postprocessing\dof_CS.hpp"
+#include "postprocessing/dof_CS.hpp"
 // Low Dynamic Range
-#include "postprocessing\ldr_aces_filmic_CS.hpp"
-#include "postprocessing\ldr_max3_CS.hpp"
-#include "postprocessing\ldr_none_CS.hpp"
-#include "postprocessing\ldr_reinhard_CS.hpp"
-#include "postprocessing\ldr_uncharted_CS.hpp"
+#include "postprocessing/ldr_aces_filmic_CS.hpp"
+#include "postprocessing/ldr_max3_CS.hpp"
+#include "postprocessing/ldr_none_CS.hpp"
+#include "postprocessing/ldr_reinhard_CS.hpp"
+#include "postprocessing/ldr_uncharted_CS.hpp"
+// Upsample
+#include "postprocessing/upsample_CS.hpp"
 
 #pragma endregion
 
@@ -75,4 +77,16 @@ namespace mage::rendering {
 	}
 
 	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Factory Methods: Upsample
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	ComputeShaderPtr CreateUpsampleCS(ResourceManager& resource_manager) {
+		return CreateCS(resource_manager,
+						MAGE_SHADER_ARGS(g_upsample_CS));
+	}
+
+	#pragma endregion
 }
\ No newline at end of file
@@ -3,14 +3,14 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\shader_factory.hpp"
-#include "resource\mesh\vertex.hpp"
+#include "resource/shader/shader_factory.hpp"
+#include "resource/mesh/vertex.hpp"
 
 // Primitive
-#include "primitive\line_cube_VS.hpp"
-#include "primitive\line_cube_PS.hpp"
-#include "primitive\far_fullscreen_triangle_VS.hpp"
-#include "primitive\near_fullscreen_triangle_VS.hpp"
+#include "primitive/line_cube_VS.hpp"
+#include "primitive/line_cube_PS.hpp"
+#include "primitive/far_fullscreen_triangle_VS.hpp"
+#include "primitive/near_fullscreen_triangle_VS.hpp"
 
 #pragma endregion
 
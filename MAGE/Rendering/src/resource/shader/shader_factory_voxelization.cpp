@@ -3,22 +3,22 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\shader_factory.hpp"
-#include "resource\mesh\vertex.hpp"
+#include "resource/shader/shader_factory.hpp"
+#include "resource/mesh/vertex.hpp"
 
 // Voxelization
-#include "voxelization\voxelization_CS.hpp"
-#include "voxelization\voxelization_VS.hpp"
-#include "voxelization\voxelization_GS.hpp"
+#include "voxelization/voxelization_CS.hpp"
+#include "voxelization/voxelization_VS.hpp"
+#include "voxelization/voxelization_GS.hpp"
 // Voxelization: Opaque
-#include "voxelization\voxelization_emissive_PS.hpp"
-#include "voxelization\voxelization_lambertian_PS.hpp"
+#include "voxelization/voxelization_emissive_PS.hpp"
+#include "voxelization/voxelization_lambertian_PS.hpp"
 // Voxelization: Opaque + TSNM
-#include "voxelization\voxelization_tsnm_lambertian_PS.hpp"
+#include "voxelization/voxelization_tsnm_lambertian_PS.hpp"
 // Voxel Grid
-#include "voxelization\voxel_grid_VS.hpp"
-#include "voxelization\voxel_grid_GS.hpp"
-#include "voxelization\voxel_grid_PS.hpp"
+#include "voxelization/voxel_grid_VS.hpp"
+#include "voxelization/voxel_grid_GS.hpp"
+#include "voxelization/voxel_grid_PS.hpp"
 
 #pragma endregion
 
@@ -0,0 +1,174 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/texture/atlas_packer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	AtlasPacker::AtlasPacker(U32 width, U32 height)
+		: m_skyline(),
+		m_width(width),
+		m_height(height),
+		m_used_area(0u),
+		m_nb_rectangles(0u) {
+
+		Clear();
+	}
+
+	AtlasPacker::AtlasPacker(const AtlasPacker& packer) = default;
+
+	AtlasPacker::AtlasPacker(AtlasPacker&& packer) noexcept = default;
+
+	AtlasPacker::~AtlasPacker() = default;
+
+	AtlasPacker& AtlasPacker::operator=(const AtlasPacker& packer) = default;
+
+	AtlasPacker& AtlasPacker::operator=(AtlasPacker&& packer) noexcept = default;
+
+	[[nodiscard]]
+	std::optional< U32x2 > AtlasPacker::Pack(U32 width, U32 height) {
+		if (0u == width || 0u == height) {
+			return {};
+		}
+
+		// Find the segment which minimizes the top edge of the rectangle
+		// (ties are broken by the narrowest segment).
+		auto best_index  = m_skyline.size();
+		auto best_top    = m_height;
+		auto best_bottom = m_height + 1u;
+		auto best_width  = m_width  + 1u;
+
+		for (std::size_t i = 0u; i < m_skyline.size(); ++i) {
+			const auto top = Fit(i, width, height);
+			if (!top) {
+				continue;
+			}
+
+			const auto bottom = *top + height;
+			if (bottom < best_bottom
+				|| (bottom == best_bottom && m_skyline[i].m_width < best_width)) {
+
+				best_index  = i;
+				best_top    = *top;
+				best_bottom = bottom;
+				best_width  = m_skyline[i].m_width;
+			}
+		}
+
+		if (m_skyline.size() == best_index) {
+			return {};
+		}
+
+		const U32x2 position(m_skyline[best_index].m_x, best_top);
+		AddSkylineLevel(best_index, best_top, width, height);
+
+		m_used_area += static_cast< U64 >(width) * height;
+		++m_nb_rectangles;
+
+		return position;
+	}
+
+	void AtlasPacker::Clear() noexcept {
+		m_skyline.clear();
+		m_skyline.push_back({ 0u, 0u, m_width });
+		m_used_area     = 0u;
+		m_nb_rectangles = 0u;
+	}
+
+	[[nodiscard]]
+	F32 AtlasPacker::GetOccupancy() const noexcept {
+		const auto area = static_cast< U64 >(m_width) * m_height;
+		return (0u == area) ? 0.0f
+			                : static_cast< F32 >(m_used_area)
+			                / static_cast< F32 >(area);
+	}
+
+	[[nodiscard]]
+	F32 AtlasPacker::GetFragmentation() const noexcept {
+		U64 area = 0u;
+		for (const auto& segment : m_skyline) {
+			area += static_cast< U64 >(segment.m_width) * segment.m_y;
+		}
+
+		return (0u == area) ? 0.0f
+			                : static_cast< F32 >(area - m_used_area)
+			                / static_cast< F32 >(area);
+	}
+
+	[[nodiscard]]
+	std::optional< U32 > AtlasPacker::Fit(std::size_t index,
+										  U32 width, U32 height) const noexcept {
+
+		const auto left = m_skyline[index].m_x;
+		if (m_width < width || m_width - width < left) {
+			return {};
+		}
+
+		// The rectangle rests on the highest segment it spans.
+		U32 top = 0u;
+		for (auto width_left = width; 0u < width_left; ++index) {
+			const auto& segment = m_skyline[index];
+			top = std::max(top, segment.m_y);
+			if (m_height < height || m_height - height < top) {
+				return {};
+			}
+
+			width_left -= std::min(width_left, segment.m_width);
+		}
+
+		return top;
+	}
+
+	void AtlasPacker::AddSkylineLevel(std::size_t index,
+									  U32 top, U32 width, U32 height) {
+
+		const Segment level = { m_skyline[index].m_x, top + height, width };
+		m_skyline.insert(m_skyline.begin() + index, level);
+
+		// Shrink or remove the segments covered by the new level.
+		const auto right = level.m_x + level.m_width;
+		for (auto i = index + 1u; i < m_skyline.size();) {
+			auto& segment = m_skyline[i];
+			if (right <= segment.m_x) {
+				break;
+			}
+
+			const auto segment_right = segment.m_x + segment.m_width;
+			if (segment_right <= right) {
+				m_skyline.erase(m_skyline.begin() + i);
+				continue;
+			}
+
+			segment.m_width = segment_right - right;
+			segment.m_x     = right;
+			break;
+		}
+
+		// Merge adjacent segments at the same height.
+		for (std::size_t i = 0u; i + 1u < m_skyline.size();) {
+			if (m_skyline[i].m_y == m_skyline[i + 1u].m_y) {
+				m_skyline[i].m_width += m_skyline[i + 1u].m_width;
+				m_skyline.erase(m_skyline.begin() + i + 1u);
+			}
+			else {
+				++i;
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,257 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/vector_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <optional>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of atlas packers.
+
+	 An atlas packer packs rectangles into a fixed-size page using the
+	 skyline bottom-left heuristic: the top edge of the packed rectangles is
+	 represented as a sequence of horizontal segments, and each rectangle is
+	 placed at the position which minimizes its top edge. Rectangles are
+	 packed incrementally and are never moved.
+
+	 Atlas packers are device-independent.
+	 */
+	class AtlasPacker {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an atlas packer.
+
+		 @param[in]		width
+						The width of the page.
+		 @param[in]		height
+						The height of the page.
+		 */
+		explicit AtlasPacker(U32 width, U32 height);
+
+		/**
+		 Constructs an atlas packer from the given atlas packer.
+
+		 @param[in]		packer
+						A reference to the atlas packer to copy.
+		 */
+		AtlasPacker(const AtlasPacker& packer);
+
+		/**
+		 Constructs an atlas packer by moving the given atlas packer.
+
+		 @param[in]		packer
+						A reference to the atlas packer to move.
+		 */
+		AtlasPacker(AtlasPacker&& packer) noexcept;
+
+		/**
+		 Destructs this atlas packer.
+		 */
+		~AtlasPacker();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given atlas packer to this atlas packer.
+
+		 @param[in]		packer
+						A reference to the atlas packer to copy.
+		 @return		A reference to the copy of the given atlas packer (i.e.
+						this atlas packer).
+		 */
+		AtlasPacker& operator=(const AtlasPacker& packer);
+
+		/**
+		 Moves the given atlas packer to this atlas packer.
+
+		 @param[in]		packer
+						A reference to the atlas packer to move.
+		 @return		A reference to the moved atlas packer (i.e. this atlas
+						packer).
+		 */
+		AtlasPacker& operator=(AtlasPacker&& packer) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Packs a rectangle of the given size.
+
+		 @param[in]		width
+						The width of the rectangle.
+		 @param[in]		height
+						The height of the rectangle.
+		 @return		The position [left, top] of the packed rectangle, if
+						the rectangle fits in the page of this atlas packer.
+		 */
+		[[nodiscard]]
+		std::optional< U32x2 > Pack(U32 width, U32 height);
+
+		/**
+		 Removes all packed rectangles of this atlas packer.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Returns the size of the page of this atlas packer.
+
+		 @return		The size [width, height] of the page of this atlas
+						packer.
+		 */
+		[[nodiscard]]
+		const U32x2 GetSize() const noexcept {
+			return { m_width, m_height };
+		}
+
+		/**
+		 Returns the number of packed rectangles of this atlas packer.
+
+		 @return		The number of packed rectangles of this atlas packer.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfRectangles() const noexcept {
+			return m_nb_rectangles;
+		}
+
+		/**
+		 Returns the occupancy of this atlas packer.
+
+		 @return		The ratio of the area of all packed rectangles to the
+						area of the page of this atlas packer.
+		 */
+		[[nodiscard]]
+		F32 GetOccupancy() const noexcept;
+
+		/**
+		 Returns the fragmentation of this atlas packer.
+
+		 @return		The ratio of the unused area below the skyline to the
+						area below the skyline of this atlas packer (i.e. the
+						area which can no longer be packed).
+		 */
+		[[nodiscard]]
+		F32 GetFragmentation() const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of skyline segments.
+		 */
+		struct Segment {
+
+		public:
+
+			/**
+			 The left position of this segment.
+			 */
+			U32 m_x = 0u;
+
+			/**
+			 The top position of this segment.
+			 */
+			U32 m_y = 0u;
+
+			/**
+			 The width of this segment.
+			 */
+			U32 m_width = 0u;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the top position of a rectangle of the given size placed at
+		 the left position of the given segment.
+
+		 @param[in]		index
+						The index of the segment.
+		 @param[in]		width
+						The width of the rectangle.
+		 @param[in]		height
+						The height of the rectangle.
+		 @return		The top position of the rectangle, if the rectangle
+						fits in the page of this atlas packer.
+		 */
+		[[nodiscard]]
+		std::optional< U32 > Fit(std::size_t index,
+								 U32 width, U32 height) const noexcept;
+
+		/**
+		 Adds a rectangle of the given size at the left position of the given
+		 segment to the skyline of this atlas packer.
+
+		 @param[in]		index
+						The index of the segment.
+		 @param[in]		top
+						The top position of the rectangle.
+		 @param[in]		width
+						The width of the rectangle.
+		 @param[in]		height
+						The height of the rectangle.
+		 */
+		void AddSkylineLevel(std::size_t index, U32 top, U32 width, U32 height);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The skyline segments (from left to right) of this atlas packer.
+		 */
+		std::vector< Segment > m_skyline;
+
+		/**
+		 The width of the page of this atlas packer.
+		 */
+		U32 m_width;
+
+		/**
+		 The height of the page of this atlas packer.
+		 */
+		U32 m_height;
+
+		/**
+		 The area of all packed rectangles of this atlas packer.
+		 */
+		U64 m_used_area;
+
+		/**
+		 The number of packed rectangles of this atlas packer.
+		 */
+		std::size_t m_nb_rectangles;
+	};
+}
\ No newline at end of file
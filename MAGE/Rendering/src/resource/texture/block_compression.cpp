@@ -0,0 +1,631 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/texture/block_compression.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 The interpolation weights (out of 64) of BC7 4-bit indices.
+		 */
+		constexpr U32 g_bc7_weights[16] = {
+			0u, 4u, 9u, 13u, 17u, 21u, 26u, 30u,
+			34u, 38u, 43u, 47u, 51u, 55u, 60u, 64u
+		};
+
+		/**
+		 A class of little endian bit writers for writing compressed blocks.
+		 */
+		class BitWriter {
+
+		public:
+
+			explicit BitWriter(gsl::span< U8 > output) noexcept
+				: m_output(output),
+				m_position(0u) {
+
+				std::fill(m_output.begin(), m_output.end(), U8(0u));
+			}
+
+			void Write(U32 value, U32 nb_bits) noexcept {
+				for (U32 i = 0u; i < nb_bits; ++i, ++m_position) {
+					if (0u != ((value >> i) & 1u)) {
+						m_output[m_position >> 3u]
+							|= static_cast< U8 >(1u << (m_position & 7u));
+					}
+				}
+			}
+
+		private:
+
+			gsl::span< U8 > m_output;
+
+			std::size_t m_position;
+		};
+
+		/**
+		 Computes the principal axis of the first @a N channels of the given
+		 texel block.
+
+		 @tparam		N
+						The number of channels.
+		 @param[in]		texels
+						A reference to the texel block.
+		 @param[out]	mean
+						The mean of the texel block.
+		 @param[out]	axis
+						The (normalized) principal axis of the texel block.
+		 */
+		template< std::size_t N >
+		void ComputePrincipalAxis(const TexelBlock& texels,
+								  F32 (&mean)[N], F32 (&axis)[N]) noexcept {
+
+			F32 min[N];
+			F32 max[N];
+			for (std::size_t c = 0u; c < N; ++c) {
+				mean[c] = 0.0f;
+				min[c]  = std::numeric_limits< F32 >::max();
+				max[c]  = std::numeric_limits< F32 >::lowest();
+			}
+
+			for (const auto& texel : texels) {
+				for (std::size_t c = 0u; c < N; ++c) {
+					const auto v = static_cast< F32 >(texel[c]);
+					mean[c] += v;
+					min[c]   = std::min(min[c], v);
+					max[c]   = std::max(max[c], v);
+				}
+			}
+			for (std::size_t c = 0u; c < N; ++c) {
+				mean[c] /= 16.0f;
+			}
+
+			F32 covariance[N][N] = {};
+			for (const auto& texel : texels) {
+				F32 d[N];
+				for (std::size_t c = 0u; c < N; ++c) {
+					d[c] = static_cast< F32 >(texel[c]) - mean[c];
+				}
+				for (std::size_t i = 0u; i < N; ++i) {
+					for (std::size_t j = 0u; j < N; ++j) {
+						covariance[i][j] += d[i] * d[j];
+					}
+				}
+			}
+
+			// Power iteration, starting from the diagonal of the bounding
+			// box.
+			for (std::size_t c = 0u; c < N; ++c) {
+				axis[c] = max[c] - min[c];
+			}
+
+			for (U32 iteration = 0u; iteration < 8u; ++iteration) {
+				F32 next[N] = {};
+				for (std::size_t i = 0u; i < N; ++i) {
+					for (std::size_t j = 0u; j < N; ++j) {
+						next[i] += covariance[i][j] * axis[j];
+					}
+				}
+
+				F32 length = 0.0f;
+				for (std::size_t c = 0u; c < N; ++c) {
+					length = std::max(length, std::abs(next[c]));
+				}
+				if (0.0f == length) {
+					break;
+				}
+				for (std::size_t c = 0u; c < N; ++c) {
+					axis[c] = next[c] / length;
+				}
+			}
+
+			F32 length = 0.0f;
+			for (std::size_t c = 0u; c < N; ++c) {
+				length += axis[c] * axis[c];
+			}
+			length = std::sqrt(length);
+			for (std::size_t c = 0u; c < N; ++c) {
+				axis[c] = (0.0f < length) ? axis[c] / length : 0.0f;
+			}
+		}
+
+		/**
+		 Computes the endpoints of the first @a N channels of the given texel
+		 block along its principal axis.
+
+		 @tparam		N
+						The number of channels.
+		 @param[in]		texels
+						A reference to the texel block.
+		 @param[out]	endpoint0
+						The endpoint with the largest projection.
+		 @param[out]	endpoint1
+						The endpoint with the smallest projection.
+		 */
+		template< std::size_t N >
+		void ComputeEndpoints(const TexelBlock& texels,
+							  F32 (&endpoint0)[N], F32 (&endpoint1)[N]) noexcept {
+
+			F32 mean[N];
+			F32 axis[N];
+			ComputePrincipalAxis(texels, mean, axis);
+
+			F32 min_t = 0.0f;
+			F32 max_t = 0.0f;
+			for (const auto& texel : texels) {
+				F32 t = 0.0f;
+				for (std::size_t c = 0u; c < N; ++c) {
+					t += (static_cast< F32 >(texel[c]) - mean[c]) * axis[c];
+				}
+				min_t = std::min(min_t, t);
+				max_t = std::max(max_t, t);
+			}
+
+			for (std::size_t c = 0u; c < N; ++c) {
+				endpoint0[c] = std::clamp(mean[c] + max_t * axis[c], 0.0f, 255.0f);
+				endpoint1[c] = std::clamp(mean[c] + min_t * axis[c], 0.0f, 255.0f);
+			}
+		}
+
+		/**
+		 Fits the endpoints of the first @a N channels of the given texel
+		 block to the given interpolation weights (least squares).
+
+		 @tparam		N
+						The number of channels.
+		 @param[in]		texels
+						A reference to the texel block.
+		 @param[in]		weights
+						The interpolation weight of the second endpoint of
+						each texel.
+		 @param[out]	endpoint0
+						The first endpoint.
+		 @param[out]	endpoint1
+						The second endpoint.
+		 @return		@c true if the endpoints are fitted. @c false
+						otherwise (i.e. the system is singular).
+		 */
+		template< std::size_t N >
+		bool FitEndpoints(const TexelBlock& texels, const F32 (&weights)[16],
+						  F32 (&endpoint0)[N], F32 (&endpoint1)[N]) noexcept {
+
+			F32 aa = 0.0f;
+			F32 ab = 0.0f;
+			F32 bb = 0.0f;
+			F32 ax[N] = {};
+			F32 bx[N] = {};
+			for (std::size_t i = 0u; i < 16u; ++i) {
+				const auto b = weights[i];
+				const auto a = 1.0f - b;
+				aa += a * a;
+				ab += a * b;
+				bb += b * b;
+				for (std::size_t c = 0u; c < N; ++c) {
+					const auto x = static_cast< F32 >(texels[i][c]);
+					ax[c] += a * x;
+					bx[c] += b * x;
+				}
+			}
+
+			const auto det = aa * bb - ab * ab;
+			if (std::abs(det) < 1e-6f) {
+				return false;
+			}
+
+			const auto inv_det = 1.0f / det;
+			for (std::size_t c = 0u; c < N; ++c) {
+				endpoint0[c] = std::clamp((bb * ax[c] - ab * bx[c]) * inv_det,
+										  0.0f, 255.0f);
+				endpoint1[c] = std::clamp((aa * bx[c] - ab * ax[c]) * inv_det,
+										  0.0f, 255.0f);
+			}
+
+			return true;
+		}
+
+		//---------------------------------------------------------------------
+		// BC1
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		U16 QuantizeRGB565(const F32 (&color)[3]) noexcept {
+			const auto r = static_cast< U32 >(color[0] * (31.0f / 255.0f) + 0.5f);
+			const auto g = static_cast< U32 >(color[1] * (63.0f / 255.0f) + 0.5f);
+			const auto b = static_cast< U32 >(color[2] * (31.0f / 255.0f) + 0.5f);
+			return static_cast< U16 >((std::min(r, 31u) << 11u)
+									| (std::min(g, 63u) <<  5u)
+									|  std::min(b, 31u));
+		}
+
+		void ExpandRGB565(U16 color, U32 (&output)[3]) noexcept {
+			const U32 r = (color >> 11u) & 31u;
+			const U32 g = (color >>  5u) & 63u;
+			const U32 b =  color         & 31u;
+			output[0] = (r << 3u) | (r >> 2u);
+			output[1] = (g << 2u) | (g >> 4u);
+			output[2] = (b << 3u) | (b >> 2u);
+		}
+
+		/**
+		 Computes the (4-color) BC1 indices of the given texel block.
+
+		 @return		The squared error of the given endpoints.
+		 */
+		U32 ComputeBC1Indices(const TexelBlock& texels, U16 c0, U16 c1,
+							  U8 (&indices)[16]) noexcept {
+
+			U32 palette[4][3];
+			ExpandRGB565(c0, palette[0]);
+			ExpandRGB565(c1, palette[1]);
+			for (std::size_t c = 0u; c < 3u; ++c) {
+				palette[2][c] = (2u * palette[0][c] +      palette[1][c]) / 3u;
+				palette[3][c] = (     palette[0][c] + 2u * palette[1][c]) / 3u;
+			}
+
+			U32 total_error = 0u;
+			for (std::size_t i = 0u; i < 16u; ++i) {
+				U32 best_error = std::numeric_limits< U32 >::max();
+				for (U8 j = 0u; j < 4u; ++j) {
+					U32 error = 0u;
+					for (std::size_t c = 0u; c < 3u; ++c) {
+						const auto d = static_cast< S32 >(texels[i][c])
+							         - static_cast< S32 >(palette[j][c]);
+						error += static_cast< U32 >(d * d);
+					}
+					if (error < best_error) {
+						best_error = error;
+						indices[i] = j;
+					}
+				}
+				total_error += best_error;
+			}
+
+			return total_error;
+		}
+
+		//---------------------------------------------------------------------
+		// BC4
+		//---------------------------------------------------------------------
+
+		/**
+		 Computes the BC4 indices of the given channel of the given texel
+		 block.
+
+		 @return		The squared error of the given palette.
+		 */
+		U32 ComputeBC4Indices(const TexelBlock& texels, std::size_t channel,
+							  const U32 (&palette)[8],
+							  U8 (&indices)[16]) noexcept {
+
+			U32 total_error = 0u;
+			for (std::size_t i = 0u; i < 16u; ++i) {
+				U32 best_error = std::numeric_limits< U32 >::max();
+				for (U8 j = 0u; j < 8u; ++j) {
+					const auto d = static_cast< S32 >(texels[i][channel])
+						         - static_cast< S32 >(palette[j]);
+					const auto error = static_cast< U32 >(d * d);
+					if (error < best_error) {
+						best_error = error;
+						indices[i] = j;
+					}
+				}
+				total_error += best_error;
+			}
+
+			return total_error;
+		}
+
+		//---------------------------------------------------------------------
+		// BC7
+		//---------------------------------------------------------------------
+
+		/**
+		 Quantizes the given endpoint to 7 bits per channel and a p-bit.
+		 */
+		void QuantizeBC7Endpoint(const F32 (&endpoint)[4],
+								 U32 (&quantized)[4], U32& p_bit) noexcept {
+			F32 best_error = std::numeric_limits< F32 >::max();
+			for (U32 p = 0u; p < 2u; ++p) {
+				U32 q[4];
+				F32 error = 0.0f;
+				for (std::size_t c = 0u; c < 4u; ++c) {
+					const auto v = (endpoint[c] - static_cast< F32 >(p)) * 0.5f;
+					q[c] = static_cast< U32 >(std::clamp(v + 0.5f, 0.0f, 127.0f));
+					const auto d = static_cast< F32 >((q[c] << 1u) | p) - endpoint[c];
+					error += d * d;
+				}
+				if (error < best_error) {
+					best_error = error;
+					p_bit      = p;
+					std::copy(q, q + 4u, quantized);
+				}
+			}
+		}
+
+		/**
+		 Computes the BC7 mode 6 indices of the given texel block.
+
+		 @return		The squared error of the given endpoints.
+		 */
+		U32 ComputeBC7Indices(const TexelBlock& texels,
+							  const U32 (&e0)[4], const U32 (&e1)[4],
+							  U8 (&indices)[16]) noexcept {
+
+			U32 palette[16][4];
+			for (std::size_t j = 0u; j < 16u; ++j) {
+				const auto w = g_bc7_weights[j];
+				for (std::size_t c = 0u; c < 4u; ++c) {
+					palette[j][c] = ((64u - w) * e0[c] + w * e1[c] + 32u) >> 6u;
+				}
+			}
+
+			U32 total_error = 0u;
+			for (std::size_t i = 0u; i < 16u; ++i) {
+				U32 best_error = std::numeric_limits< U32 >::max();
+				for (U8 j = 0u; j < 16u; ++j) {
+					U32 error = 0u;
+					for (std::size_t c = 0u; c < 4u; ++c) {
+						const auto d = static_cast< S32 >(texels[i][c])
+							         - static_cast< S32 >(palette[j][c]);
+						error += static_cast< U32 >(d * d);
+					}
+					if (error < best_error) {
+						best_error = error;
+						indices[i] = j;
+					}
+				}
+				total_error += best_error;
+			}
+
+			return total_error;
+		}
+
+		/**
+		 Encodes the given BC7 mode 6 endpoints of the given texel block.
+
+		 @return		The squared error of the given endpoints.
+		 */
+		U32 EncodeBC7Endpoints(const TexelBlock& texels,
+							   const F32 (&endpoint0)[4],
+							   const F32 (&endpoint1)[4],
+							   U32 (&q0)[4], U32& p0,
+							   U32 (&q1)[4], U32& p1,
+							   U8 (&indices)[16]) noexcept {
+
+			QuantizeBC7Endpoint(endpoint0, q0, p0);
+			QuantizeBC7Endpoint(endpoint1, q1, p1);
+
+			U32 e0[4];
+			U32 e1[4];
+			for (std::size_t c = 0u; c < 4u; ++c) {
+				e0[c] = (q0[c] << 1u) | p0;
+				e1[c] = (q1[c] << 1u) | p1;
+			}
+
+			return ComputeBC7Indices(texels, e0, e1, indices);
+		}
+	}
+
+	void CompressBC1Block(const TexelBlock& texels,
+						  gsl::span< U8, 8 > output) noexcept {
+
+		F32 endpoint0[3];
+		F32 endpoint1[3];
+		ComputeEndpoints(texels, endpoint0, endpoint1);
+
+		U8  indices[16];
+		U16 c0    = QuantizeRGB565(endpoint0);
+		U16 c1    = QuantizeRGB565(endpoint1);
+		U32 error = ComputeBC1Indices(texels, c0, c1, indices);
+
+		// Refine the endpoints once.
+		if (0u != error && c0 != c1) {
+			constexpr F32 weights[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+			F32 texel_weights[16];
+			for (std::size_t i = 0u; i < 16u; ++i) {
+				texel_weights[i] = weights[indices[i]];
+			}
+
+			if (FitEndpoints(texels, texel_weights, endpoint0, endpoint1)) {
+				U8 refined_indices[16];
+				const auto refined_c0    = QuantizeRGB565(endpoint0);
+				const auto refined_c1    = QuantizeRGB565(endpoint1);
+				const auto refined_error = ComputeBC1Indices(
+					texels, refined_c0, refined_c1, refined_indices);
+
+				if (refined_error < error) {
+					c0    = refined_c0;
+					c1    = refined_c1;
+					error = refined_error;
+					std::copy(refined_indices, refined_indices + 16u, indices);
+				}
+			}
+		}
+
+		// The first endpoint must be larger to select the 4-color mode.
+		if (c0 < c1) {
+			std::swap(c0, c1);
+			for (auto& index : indices) {
+				index ^= 1u;
+			}
+		}
+		else if (c0 == c1) {
+			std::fill(indices, indices + 16u, U8(0u));
+		}
+
+		U32 bits = 0u;
+		for (std::size_t i = 0u; i < 16u; ++i) {
+			bits |= static_cast< U32 >(indices[i]) << (2u * i);
+		}
+
+		BitWriter writer(output);
+		writer.Write(c0,   16u);
+		writer.Write(c1,   16u);
+		writer.Write(bits, 32u);
+	}
+
+	void CompressBC3Block(const TexelBlock& texels,
+						  gsl::span< U8, 16 > output) noexcept {
+
+		CompressBC4Block(texels, 3u, output.subspan< 0, 8 >());
+		CompressBC1Block(texels,     output.subspan< 8, 8 >());
+	}
+
+	void CompressBC4Block(const TexelBlock& texels, std::size_t channel,
+						  gsl::span< U8, 8 > output) noexcept {
+
+		// The range of all values, and of the values other than 0 and 255.
+		U32 a0 = 0u;
+		U32 a1 = 255u;
+		U32 b0 = 255u;
+		U32 b1 = 0u;
+		for (const auto& texel : texels) {
+			const U32 v = texel[channel];
+			a0 = std::max(a0, v);
+			a1 = std::min(a1, v);
+			if (0u < v && 255u > v) {
+				b0 = std::min(b0, v);
+				b1 = std::max(b1, v);
+			}
+		}
+
+		BitWriter writer(output);
+
+		if (a0 == a1) {
+			// All indices select the first endpoint.
+			writer.Write(a0, 8u);
+			writer.Write(a1, 8u);
+			return;
+		}
+
+		// The first endpoint is larger: 8-value mode.
+		U32 palette[8] = { a0, a1 };
+		for (U32 i = 1u; i < 7u; ++i) {
+			palette[i + 1u] = ((7u - i) * a0 + i * a1 + 3u) / 7u;
+		}
+
+		U8  indices[16];
+		U32 error = ComputeBC4Indices(texels, channel, palette, indices);
+
+		// The first endpoint is not larger: 6-value mode, which represents 0
+		// and 255 exactly and interpolates the remaining values only.
+		if (0u != error && b0 <= b1) {
+			U32 palette6[8] = { b0, b1 };
+			for (U32 i = 1u; i < 5u; ++i) {
+				palette6[i + 1u] = ((5u - i) * b0 + i * b1 + 2u) / 5u;
+			}
+			palette6[6] = 0u;
+			palette6[7] = 255u;
+
+			U8 indices6[16];
+			if (const auto error6 = ComputeBC4Indices(texels, channel,
+													  palette6, indices6);
+				error6 < error) {
+
+				a0 = b0;
+				a1 = b1;
+				std::copy(indices6, indices6 + 16u, indices);
+			}
+		}
+
+		writer.Write(a0, 8u);
+		writer.Write(a1, 8u);
+		for (const auto index : indices) {
+			writer.Write(index, 3u);
+		}
+	}
+
+	void CompressBC5Block(const TexelBlock& texels,
+						  gsl::span< U8, 16 > output) noexcept {
+
+		CompressBC4Block(texels, 0u, output.subspan< 0, 8 >());
+		CompressBC4Block(texels, 1u, output.subspan< 8, 8 >());
+	}
+
+	void CompressBC7Block(const TexelBlock& texels,
+						  gsl::span< U8, 16 > output) noexcept {
+
+		F32 endpoint0[4];
+		F32 endpoint1[4];
+		ComputeEndpoints(texels, endpoint0, endpoint1);
+
+		U32 q0[4];
+		U32 q1[4];
+		U32 p0 = 0u;
+		U32 p1 = 0u;
+		U8  indices[16];
+		U32 error = EncodeBC7Endpoints(texels, endpoint0, endpoint1,
+									   q0, p0, q1, p1, indices);
+
+		// Refine the endpoints once.
+		if (0u != error) {
+			F32 texel_weights[16];
+			for (std::size_t i = 0u; i < 16u; ++i) {
+				texel_weights[i] = g_bc7_weights[indices[i]] / 64.0f;
+			}
+
+			if (FitEndpoints(texels, texel_weights, endpoint0, endpoint1)) {
+				U32 refined_q0[4];
+				U32 refined_q1[4];
+				U32 refined_p0 = 0u;
+				U32 refined_p1 = 0u;
+				U8  refined_indices[16];
+				const auto refined_error = EncodeBC7Endpoints(
+					texels, endpoint0, endpoint1,
+					refined_q0, refined_p0, refined_q1, refined_p1,
+					refined_indices);
+
+				if (refined_error < error) {
+					std::copy(refined_q0, refined_q0 + 4u, q0);
+					std::copy(refined_q1, refined_q1 + 4u, q1);
+					p0 = refined_p0;
+					p1 = refined_p1;
+					std::copy(refined_indices, refined_indices + 16u, indices);
+				}
+			}
+		}
+
+		// The most significant bit of the first (anchor) index is implicit.
+		if (8u <= indices[0]) {
+			std::swap(q0, q1);
+			std::swap(p0, p1);
+			for (auto& index : indices) {
+				index = static_cast< U8 >(15u - index);
+			}
+		}
+
+		BitWriter writer(output);
+		// Mode 6
+		writer.Write(1u << 6u, 7u);
+		for (std::size_t c = 0u; c < 4u; ++c) {
+			writer.Write(q0[c], 7u);
+			writer.Write(q1[c], 7u);
+		}
+		writer.Write(p0, 1u);
+		writer.Write(p1, 1u);
+		writer.Write(indices[0], 3u);
+		for (std::size_t i = 1u; i < 16u; ++i) {
+			writer.Write(indices[i], 4u);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/vector_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+#include <gsl/span>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A 4x4 block of RGBA texels (in row-major order).
+	 */
+	using TexelBlock = std::array< U8x4, 16u >;
+
+	/**
+	 Compresses the given texel block to a BC1 block. The alpha channel is
+	 ignored (i.e. the block is opaque).
+
+	 @param[in]		texels
+					A reference to the texel block.
+	 @param[out]	output
+					The BC1 block.
+	 */
+	void CompressBC1Block(const TexelBlock& texels,
+						  gsl::span< U8, 8 > output) noexcept;
+
+	/**
+	 Compresses the given texel block to a BC3 block.
+
+	 @param[in]		texels
+					A reference to the texel block.
+	 @param[out]	output
+					The BC3 block.
+	 */
+	void CompressBC3Block(const TexelBlock& texels,
+						  gsl::span< U8, 16 > output) noexcept;
+
+	/**
+	 Compresses the given channel of the given texel block to a BC4 block.
+	 The 6-value mode (which represents 0 and 255 exactly) is used instead of
+	 the 8-value mode if it has a smaller error.
+
+	 @pre			@a channel < 4.
+	 @param[in]		texels
+					A reference to the texel block.
+	 @param[in]		channel
+					The channel of the texel block.
+	 @param[out]	output
+					The BC4 block.
+	 */
+	void CompressBC4Block(const TexelBlock& texels, std::size_t channel,
+						  gsl::span< U8, 8 > output) noexcept;
+
+	/**
+	 Compresses the red and green channel of the given texel block to a BC5
+	 block.
+
+	 @param[in]		texels
+					A reference to the texel block.
+	 @param[out]	output
+					The BC5 block.
+	 */
+	void CompressBC5Block(const TexelBlock& texels,
+						  gsl::span< U8, 16 > output) noexcept;
+
+	/**
+	 Compresses the given texel block to a BC7 block. Only BC7 mode 6 (i.e.
+	 a single RGBA subset with 4-bit indices) is used.
+
+	 @param[in]		texels
+					A reference to the texel block.
+	 @param[out]	output
+					The BC7 block.
+	 */
+	void CompressBC7Block(const TexelBlock& texels,
+						  gsl::span< U8, 16 > output) noexcept;
+}
\ No newline at end of file
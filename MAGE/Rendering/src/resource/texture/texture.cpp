@@ -3,9 +3,21 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\texture\texture.hpp"
-#include "loaders\texture_loader.hpp"
-#include "exception\exception.hpp"
+#include "resource/texture/texture.hpp"
+#include "resource/texture/texture_format.hpp"
+#include "loaders/texture_loader.hpp"
+#include "loaders/dds/dds_loader.hpp"
+#include "string/string_utils.hpp"
+#include "exception/exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
 
 #pragma endregion
 
@@ -42,6 +54,40 @@ namespace mage::rendering {
 		return { desc.Width, desc.Height };
 	}
 
+	[[nodiscard]]
+	std::size_t GetTexture2DMemoryUsage(
+		ID3D11ShaderResourceView& texture_srv) noexcept {
+
+		ComPtr< ID3D11Resource > resource;
+		texture_srv.GetResource(&resource);
+
+		ComPtr< ID3D11Texture2D > texture;
+		if (FAILED(resource.As(&texture))) {
+			return 0u;
+		}
+
+		D3D11_TEXTURE2D_DESC desc;
+		texture->GetDesc(&desc);
+
+		const bool block_compressed = IsBlockCompressed(desc.Format);
+		const std::size_t bits_per_pixel = BitsPerPixel(desc.Format);
+
+		std::size_t nb_bits = 0u;
+		for (U32 mip = 0u; mip < desc.MipLevels; ++mip) {
+			std::size_t width  = std::max(desc.Width  >> mip, 1u);
+			std::size_t height = std::max(desc.Height >> mip, 1u);
+			if (block_compressed) {
+				// Block-compressed formats are stored in 4x4 blocks.
+				width  = (width  + 3u) & ~std::size_t(3u);
+				height = (height + 3u) & ~std::size_t(3u);
+			}
+
+			nb_bits += width * height * bits_per_pixel;
+		}
+
+		return desc.ArraySize * (nb_bits / 8u);
+	}
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -51,9 +97,78 @@ namespace mage::rendering {
 
 	Texture::Texture(ID3D11Device& device, std::wstring fname)
 		: Resource< Texture >(std::move(fname)),
-		m_texture_srv() {
+		m_texture_srv(),
+		m_size(),
+		m_memory_usage(0u),
+		m_streamer() {
 
-		loader::ImportTextureFromFile(GetPath(), device,
+		// Decode the texture data.
+		TextureData data;
+		loader::ImportTextureFromFile(GetPath(), data);
+
+		// Create the texture.
+		loader::CreateTexture(data, device,
+			NotNull< ID3D11ShaderResourceView** >(m_texture_srv.ReleaseAndGetAddressOf()));
+
+		m_size         = { data.GetDescriptor().m_width,
+						   data.GetDescriptor().m_height };
+		m_memory_usage = data.GetSize();
+	}
+
+	Texture::Texture(ID3D11Device& device, std::wstring fname,
+					 TextureStreamer& streamer)
+		: Resource< Texture >(std::move(fname)),
+		m_texture_srv(),
+		m_size(),
+		m_memory_usage(0u),
+		m_streamer() {
+
+		std::wstring extension(GetPath().extension());
+		TransformToLowerCase(extension);
+
+		TextureData data;
+		TextureDescriptor desc;
+		U32 mip_tail_level = 0u;
+
+		if (L".dds" == extension) {
+			loader::ImportDDSTextureDescriptorFromFile(GetPath(), desc);
+			mip_tail_level = TextureStreamer::GetMipTailLevel(desc);
+		}
+
+		// Decode the texture data (i.e. only the mip tail, if streamed).
+		if (0u != mip_tail_level) {
+			loader::ImportDDSTextureFromFile(GetPath(), data, mip_tail_level);
+		}
+		else {
+			loader::ImportTextureFromFile(GetPath(), data);
+		}
+
+		// Create the texture.
+		loader::CreateTexture(data, device,
+			NotNull< ID3D11ShaderResourceView** >(m_texture_srv.ReleaseAndGetAddressOf()));
+
+		// The size of streamed textures is the size of the most detailed mip
+		// level (i.e. not of the loaded mip tail).
+		const auto& size_desc = (0u != mip_tail_level) ? desc
+			                                           : data.GetDescriptor();
+		m_size         = { size_desc.m_width, size_desc.m_height };
+		m_memory_usage = data.GetSize();
+
+		if (0u != mip_tail_level) {
+			streamer.Register(*this, desc, mip_tail_level);
+			m_streamer = &streamer;
+		}
+	}
+
+	Texture::Texture(ID3D11Device& device, std::wstring guid,
+					 const TextureData& data)
+		: Resource< Texture >(std::move(guid)),
+		m_texture_srv(),
+		m_size(data.GetDescriptor().m_width, data.GetDescriptor().m_height),
+		m_memory_usage(data.GetSize()),
+		m_streamer() {
+
+		loader::CreateTexture(data, device,
 			NotNull< ID3D11ShaderResourceView** >(m_texture_srv.ReleaseAndGetAddressOf()));
 	}
 
@@ -61,7 +176,10 @@ namespace mage::rendering {
 					 const D3D11_TEXTURE2D_DESC& desc,
 					 const D3D11_SUBRESOURCE_DATA& initial_data)
 		: Resource< Texture >(std::move(guid)),
-		m_texture_srv() {
+		m_texture_srv(),
+		m_size(desc.Width, desc.Height),
+		m_memory_usage(0u),
+		m_streamer() {
 
 		ComPtr< ID3D11Texture2D > texture;
 
@@ -78,13 +196,15 @@ namespace mage::rendering {
 				texture.Get(), nullptr, m_texture_srv.ReleaseAndGetAddressOf());
 			ThrowIfFailed(result, "Texture SRV creation failed: {:08X}.", result);
 		}
-	}
-
-	Texture::Texture(Texture&& texture) noexcept = default;
 
-	Texture::~Texture() = default;
+		m_memory_usage = GetTexture2DMemoryUsage(*m_texture_srv.Get());
+	}
 
-	Texture& Texture::operator=(Texture&& texture) noexcept = default;
+	Texture::~Texture() {
+		if (m_streamer) {
+			m_streamer->Unregister(*this);
+		}
+	}
 
 	#pragma endregion
 }
\ No newline at end of file
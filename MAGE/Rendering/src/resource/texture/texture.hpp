@@ -5,8 +5,19 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\resource.hpp"
-#include "renderer\pipeline.hpp"
+#include "resource/resource.hpp"
+#include "resource/texture/texture_data.hpp"
+#include "resource/texture/texture_streamer.hpp"
+#include "renderer/pipeline.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
 
 #pragma endregion
 
@@ -43,6 +54,19 @@ namespace mage::rendering {
 	[[nodiscard]]
 	const U32x2 GetTexture2DSize(ID3D11Texture2D& texture) noexcept;
 
+	/**
+	 Returns the (estimated) memory usage of the given 2D texture.
+
+	 @param[in]		texture_srv
+					A reference to the (texture) shader resource view.
+	 @return		The memory usage (in bytes) of all subresources of the
+					given 2D texture. If the resource of the given shader
+					resource view is not a @c ID3D11Texture2D, 0 is returned.
+	 */
+	[[nodiscard]]
+	std::size_t GetTexture2DMemoryUsage(
+		ID3D11ShaderResourceView& texture_srv) noexcept;
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -73,6 +97,44 @@ namespace mage::rendering {
 		 */
 		explicit Texture(ID3D11Device& device, std::wstring fname);
 
+		/**
+		 Constructs a streamed texture.
+
+		 If the texture is streamable (i.e. a DDS file with a large enough
+		 mip chain), only the mip tail is loaded and the more detailed mip
+		 levels are streamed in by the given texture streamer. Otherwise, the
+		 texture is loaded completely.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @param[in,out]	streamer
+						A reference to the texture streamer. The texture
+						streamer must outlive the texture.
+		 @throws		Exception
+						Failed to construct the texture.
+		 */
+		explicit Texture(ID3D11Device& device,
+						 std::wstring fname,
+						 TextureStreamer& streamer);
+
+		/**
+		 Constructs a texture from the given (decoded) texture data.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		guid
+						The globally unique identifier.
+		 @param[in]		data
+						A reference to the texture data.
+		 @throws		Exception
+						Failed to construct the texture.
+		 */
+		explicit Texture(ID3D11Device& device,
+						 std::wstring guid,
+						 const TextureData& data);
+
 		/**
 		 Constructs a 2D texture.
 
@@ -106,7 +168,7 @@ namespace mage::rendering {
 		 @param[in]		texture
 						A reference to the texture to move.
 		 */
-		Texture(Texture&& texture) noexcept;
+		Texture(Texture&& texture) = delete;
 
 		/**
 		 Destructs this texture.
@@ -134,7 +196,7 @@ namespace mage::rendering {
 						A reference to the texture to move.
 		 @return		A reference to the moved texture (i.e. this texture).
 		 */
-		Texture& operator=(Texture&& texture) noexcept;
+		Texture& operator=(Texture&& texture) = delete;
 
 		//---------------------------------------------------------------------
 		// Member Methods
@@ -150,6 +212,49 @@ namespace mage::rendering {
 			return m_texture_srv.Get();
 		}
 
+		/**
+		 Returns the size of this texture.
+
+		 The size is stored at the creation of this texture. For streamed
+		 textures, the size of the most detailed mip level is returned,
+		 independent of the mip levels which are resident.
+
+		 @return		The size [width, height] of this texture.
+		 */
+		[[nodiscard]]
+		const U32x2 GetSize() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Returns the memory usage of this texture.
+
+		 @return		The memory usage (in bytes) of this texture.
+		 */
+		[[nodiscard]]
+		std::size_t GetMemoryUsage() const noexcept {
+			return m_memory_usage.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 Sets the shader resource view of this texture to the given shader
+		 resource view (i.e. swaps in other mip levels of a streamed
+		 texture).
+
+		 @param[in]		texture_srv
+						A pointer to the shader resource view.
+		 @param[in]		memory_usage
+						The memory usage (in bytes) of the given shader
+						resource view.
+		 */
+		void SetShaderResourceView(
+			ComPtr< ID3D11ShaderResourceView > texture_srv,
+			std::size_t memory_usage) noexcept {
+
+			m_texture_srv = std::move(texture_srv);
+			m_memory_usage.store(memory_usage, std::memory_order_relaxed);
+		}
+
 		/**
 		 Binds this texture.
 
@@ -178,6 +283,22 @@ namespace mage::rendering {
 		 A pointer to the shader resource view of this texture.
 		 */
 		ComPtr< ID3D11ShaderResourceView > m_texture_srv;
+
+		/**
+		 The size [width, height] of this texture.
+		 */
+		U32x2 m_size;
+
+		/**
+		 The memory usage (in bytes) of this texture. The memory usage is
+		 queried by the texture pool from loader threads.
+		 */
+		std::atomic< std::size_t > m_memory_usage;
+
+		/**
+		 A pointer to the texture streamer of this texture.
+		 */
+		TextureStreamer* m_streamer;
 	};
 
 	#pragma endregion
@@ -0,0 +1,224 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/texture/texture_atlas.hpp"
+#include "resource/texture/texture_format.hpp"
+#include "exception/exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Rounds the given size up to a multiple of the block size of
+		 block-compressed formats.
+
+		 @param[in]		size
+						The size (in texels).
+		 @return		The given size rounded up to a multiple of 4.
+		 */
+		[[nodiscard]]
+		constexpr U32 AlignToBlockSize(U32 size) noexcept {
+			return (size + 3u) & ~3u;
+		}
+	}
+
+	TextureAtlas::TextureAtlas(ID3D11Device& device, U32 page_size)
+		: m_device(device),
+		m_pages(),
+		m_entries(),
+		m_page_size(AlignToBlockSize(page_size)) {}
+
+	TextureAtlas::TextureAtlas(TextureAtlas&& atlas) noexcept = default;
+
+	TextureAtlas::~TextureAtlas() = default;
+
+	TextureAtlas& TextureAtlas::operator=(TextureAtlas&& atlas) noexcept = default;
+
+	[[nodiscard]]
+	ID3D11ShaderResourceView* TextureAtlas
+		::Remap(ID3D11DeviceContext& device_context,
+				const TexturePtr& texture,
+				RECT& texture_region) {
+
+		if (!texture) {
+			return nullptr;
+		}
+
+		// Textures destructed in the meantime may share their address with
+		// the given texture.
+		auto it = m_entries.find(texture.get());
+		if (m_entries.end() == it || it->second.m_texture.expired()) {
+			it = m_entries.insert_or_assign(texture.get(),
+											Add(device_context, texture)).first;
+		}
+
+		const auto& entry = it->second;
+		if (s_no_page == entry.m_page) {
+			return nullptr;
+		}
+
+		const auto left = static_cast< LONG >(entry.m_position[0]);
+		const auto top  = static_cast< LONG >(entry.m_position[1]);
+
+		if (0 == texture_region.left  && 0 == texture_region.top
+			&& 0 == texture_region.right && 0 == texture_region.bottom) {
+
+			texture_region.right  = static_cast< LONG >(entry.m_size[0]);
+			texture_region.bottom = static_cast< LONG >(entry.m_size[1]);
+		}
+
+		texture_region.left   += left;
+		texture_region.top    += top;
+		texture_region.right  += left;
+		texture_region.bottom += top;
+
+		return m_pages[entry.m_page].m_texture_srv.Get();
+	}
+
+	void TextureAtlas::Clear() noexcept {
+		m_entries.clear();
+		m_pages.clear();
+	}
+
+	[[nodiscard]]
+	const TextureAtlas::Entry TextureAtlas
+		::Add(ID3D11DeviceContext& device_context, const TexturePtr& texture) {
+
+		Entry entry;
+		entry.m_texture = texture;
+
+		const auto texture_srv = texture->Get();
+		if (!texture_srv) {
+			return entry;
+		}
+
+		// Only the most detailed mip level of (non-array) 2D textures can be
+		// contained.
+		D3D11_SHADER_RESOURCE_VIEW_DESC srv_desc;
+		texture_srv->GetDesc(&srv_desc);
+		if (D3D11_SRV_DIMENSION_TEXTURE2D != srv_desc.ViewDimension
+			|| 0u != srv_desc.Texture2D.MostDetailedMip) {
+			return entry;
+		}
+
+		ComPtr< ID3D11Resource > resource;
+		texture_srv->GetResource(&resource);
+		ComPtr< ID3D11Texture2D > source;
+		if (FAILED(resource.As(&source))) {
+			return entry;
+		}
+
+		D3D11_TEXTURE2D_DESC desc;
+		source->GetDesc(&desc);
+		if (1u != desc.ArraySize || 1u != desc.SampleDesc.Count
+			|| s_max_texture_size < desc.Width
+			|| s_max_texture_size < desc.Height) {
+			return entry;
+		}
+
+		// Pack the texture in the first page with a matching format.
+		const auto width  = AlignToBlockSize(desc.Width)  + s_padding;
+		const auto height = AlignToBlockSize(desc.Height) + s_padding;
+
+		std::optional< U32x2 > position;
+		auto page_index = s_no_page;
+		for (std::size_t i = 0u; i < m_pages.size() && s_no_page == page_index; ++i) {
+			if (srv_desc.Format != m_pages[i].m_format) {
+				continue;
+			}
+
+			position = m_pages[i].m_packer.Pack(width, height);
+			if (position) {
+				page_index = i;
+			}
+		}
+
+		// Create a new page, if no page has enough space left.
+		if (s_no_page == page_index) {
+			CreatePage(srv_desc.Format);
+
+			position = m_pages.back().m_packer.Pack(width, height);
+			if (!position) {
+				return entry;
+			}
+
+			page_index = m_pages.size() - 1u;
+		}
+
+		entry.m_page     = page_index;
+		entry.m_position = *position;
+		entry.m_size     = { desc.Width, desc.Height };
+
+		// Copy the most detailed mip level of the texture to the page.
+		device_context.CopySubresourceRegion(m_pages[entry.m_page].m_texture.Get(),
+											 0u,
+											 entry.m_position[0],
+											 entry.m_position[1],
+											 0u,
+											 source.Get(),
+											 D3D11CalcSubresource(0u, 0u, desc.MipLevels),
+											 nullptr);
+
+		return entry;
+	}
+
+	void TextureAtlas::CreatePage(DXGI_FORMAT format) {
+		Page page = {
+			nullptr,
+			nullptr,
+			AtlasPacker(m_page_size, m_page_size),
+			format
+		};
+
+		// The page is cleared to transparent black, so the padding between
+		// textures does not contain garbage.
+		const bool block_compressed = IsBlockCompressed(format);
+		const auto nb_rows          = block_compressed ? m_page_size / 4u
+			                                           : m_page_size;
+		const auto row_pitch        = block_compressed
+			? (m_page_size / 4u) * BitsPerPixel(format) * 2u
+			: m_page_size * BitsPerPixel(format) / 8u;
+		const std::vector< U8 > pixels(static_cast< std::size_t >(row_pitch)
+									   * nb_rows, 0u);
+
+		D3D11_TEXTURE2D_DESC desc = {};
+		desc.Width              = m_page_size;
+		desc.Height             = m_page_size;
+		desc.MipLevels          = 1u;
+		desc.ArraySize          = 1u;
+		desc.Format             = format;
+		desc.SampleDesc.Count   = 1u;
+		desc.SampleDesc.Quality = 0u;
+		desc.Usage              = D3D11_USAGE_DEFAULT;
+		desc.BindFlags          = D3D11_BIND_SHADER_RESOURCE;
+
+		D3D11_SUBRESOURCE_DATA initial_data = {};
+		initial_data.pSysMem     = pixels.data();
+		initial_data.SysMemPitch = row_pitch;
+
+		// Create the texture.
+		{
+			const HRESULT result = m_device.get().CreateTexture2D(
+				&desc, &initial_data, page.m_texture.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "Atlas page creation failed: {:08X}.", result);
+		}
+
+		// Create the SRV.
+		{
+			const HRESULT result = m_device.get().CreateShaderResourceView(
+				page.m_texture.Get(), nullptr,
+				page.m_texture_srv.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "Atlas page SRV creation failed: {:08X}.", result);
+		}
+
+		m_pages.push_back(std::move(page));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,318 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/texture/atlas_packer.hpp"
+#include "resource/texture/texture.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <unordered_map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of texture atlases.
+
+	 A texture atlas copies the most detailed mip level of small 2D textures
+	 into shared atlas pages at runtime. Each page contains textures of a
+	 single format. Textures are added incrementally on first use and are
+	 never moved.
+	 */
+	class TextureAtlas {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The default size (in texels) of the pages of texture atlases.
+		 */
+		static constexpr U32 s_default_page_size = 2048u;
+
+		/**
+		 The maximum size (in texels) of the textures of texture atlases.
+
+		 Textures of at most this size are never streamed, so their shader
+		 resource view never changes.
+		 */
+		static constexpr U32 s_max_texture_size = 128u;
+
+		/**
+		 The padding (in texels) between the textures of texture atlases to
+		 avoid bleeding while filtering. The padding is a multiple of the
+		 block size of block-compressed formats.
+		 */
+		static constexpr U32 s_padding = 4u;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a texture atlas.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		page_size
+						The size (in texels) of the pages.
+		 */
+		explicit TextureAtlas(ID3D11Device& device,
+							  U32 page_size = s_default_page_size);
+
+		/**
+		 Constructs a texture atlas from the given texture atlas.
+
+		 @param[in]		atlas
+						A reference to the texture atlas to copy.
+		 */
+		TextureAtlas(const TextureAtlas& atlas) = delete;
+
+		/**
+		 Constructs a texture atlas by moving the given texture atlas.
+
+		 @param[in]		atlas
+						A reference to the texture atlas to move.
+		 */
+		TextureAtlas(TextureAtlas&& atlas) noexcept;
+
+		/**
+		 Destructs this texture atlas.
+		 */
+		~TextureAtlas();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given texture atlas to this texture atlas.
+
+		 @param[in]		atlas
+						A reference to the texture atlas to copy.
+		 @return		A reference to the copy of the given texture atlas
+						(i.e. this texture atlas).
+		 */
+		TextureAtlas& operator=(const TextureAtlas& atlas) = delete;
+
+		/**
+		 Moves the given texture atlas to this texture atlas.
+
+		 @param[in]		atlas
+						A reference to the texture atlas to move.
+		 @return		A reference to the moved texture atlas (i.e. this
+						texture atlas).
+		 */
+		TextureAtlas& operator=(TextureAtlas&& atlas) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Remaps the given texture region of the given texture to this texture
+		 atlas. The given texture is added to this texture atlas, if needed.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		texture
+						A pointer to the texture.
+		 @param[in,out]	texture_region
+						A reference to the texture region (in texels) of the
+						given texture. If every member variable of the
+						rectangle is zero, the full texture region is
+						considered. The texture region is rewritten to the
+						texture region of the atlas page, if the given texture
+						is contained in this texture atlas.
+		 @return		@c nullptr, if the given texture cannot be contained in
+						this texture atlas.
+		 @return		A pointer to the shader resource view of the atlas
+						page containing the given texture.
+		 @throws		Exception
+						Failed to create an atlas page.
+		 */
+		[[nodiscard]]
+		ID3D11ShaderResourceView* Remap(ID3D11DeviceContext& device_context,
+										const TexturePtr& texture,
+										RECT& texture_region);
+
+		/**
+		 Returns the size of the pages of this texture atlas.
+
+		 @return		The size [width, height] (in texels) of the pages of
+						this texture atlas.
+		 */
+		[[nodiscard]]
+		const U32x2 GetPageSize() const noexcept {
+			return { m_page_size, m_page_size };
+		}
+
+		/**
+		 Removes all textures and pages of this texture atlas.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Returns the number of pages of this texture atlas.
+
+		 @return		The number of pages of this texture atlas.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfPages() const noexcept {
+			return m_pages.size();
+		}
+
+		/**
+		 Returns the occupancy of the given page of this texture atlas.
+
+		 @pre			@a index < GetNumberOfPages().
+		 @param[in]		index
+						The index of the page.
+		 @return		The occupancy of the given page of this texture atlas.
+		 */
+		[[nodiscard]]
+		F32 GetOccupancy(std::size_t index) const noexcept {
+			return m_pages[index].m_packer.GetOccupancy();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of atlas pages.
+		 */
+		struct Page {
+
+		public:
+
+			/**
+			 A pointer to the 2D texture of this atlas page.
+			 */
+			ComPtr< ID3D11Texture2D > m_texture;
+
+			/**
+			 A pointer to the shader resource view of this atlas page.
+			 */
+			ComPtr< ID3D11ShaderResourceView > m_texture_srv;
+
+			/**
+			 The atlas packer of this atlas page.
+			 */
+			AtlasPacker m_packer;
+
+			/**
+			 The format of this atlas page.
+			 */
+			DXGI_FORMAT m_format;
+		};
+
+		/**
+		 A struct of atlas entries.
+		 */
+		struct Entry {
+
+		public:
+
+			/**
+			 A pointer to the texture of this atlas entry.
+			 */
+			std::weak_ptr< const Texture > m_texture;
+
+			/**
+			 The index of the atlas page of this atlas entry.
+			 */
+			std::size_t m_page = s_no_page;
+
+			/**
+			 The position [left, top] (in texels) of this atlas entry.
+			 */
+			U32x2 m_position;
+
+			/**
+			 The size [width, height] (in texels) of this atlas entry.
+			 */
+			U32x2 m_size;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The page index indicating no atlas page (i.e. the texture cannot be
+		 contained).
+		 */
+		static constexpr std::size_t s_no_page = ~std::size_t(0u);
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Adds the given texture to this texture atlas.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		texture
+						A pointer to the texture.
+		 @return		The atlas entry of the given texture.
+		 @throws		Exception
+						Failed to create an atlas page.
+		 */
+		[[nodiscard]]
+		const Entry Add(ID3D11DeviceContext& device_context,
+						const TexturePtr& texture);
+
+		/**
+		 Creates an atlas page with the given format.
+
+		 @param[in]		format
+						The format.
+		 @throws		Exception
+						Failed to create the atlas page.
+		 */
+		void CreatePage(DXGI_FORMAT format);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the device of this texture atlas.
+		 */
+		std::reference_wrapper< ID3D11Device > m_device;
+
+		/**
+		 The pages of this texture atlas.
+		 */
+		std::vector< Page > m_pages;
+
+		/**
+		 A map containing the atlas entries of this texture atlas.
+		 */
+		std::unordered_map< const Texture*, Entry > m_entries;
+
+		/**
+		 The size (in texels) of the pages of this texture atlas.
+		 */
+		U32 m_page_size;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/texture/texture_data.hpp"
+#include "resource/texture/texture_format.hpp"
+#include "exception/exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// Utilities
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	namespace {
+
+		/**
+		 Checks whether the given DXGI format is a packed or planar (video)
+		 format.
+
+		 @param[in]		format
+						The DXGI format.
+		 @return		@c true if the given DXGI format is a packed or planar
+						format. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool IsPackedOrPlanar(DXGI_FORMAT format) noexcept {
+			switch (format) {
+
+			case DXGI_FORMAT_R8G8_B8G8_UNORM:
+			case DXGI_FORMAT_G8R8_G8B8_UNORM:
+			case DXGI_FORMAT_YUY2:
+			case DXGI_FORMAT_Y210:
+			case DXGI_FORMAT_Y216:
+			case DXGI_FORMAT_NV11:
+			case DXGI_FORMAT_NV12:
+			case DXGI_FORMAT_P010:
+			case DXGI_FORMAT_P016:
+			case DXGI_FORMAT_420_OPAQUE:
+				return true;
+			default:
+				return false;
+
+			}
+		}
+	}
+
+	void ComputePitch(DXGI_FORMAT format, U32 width, U32 height,
+					  std::size_t& row_pitch, std::size_t& slice_pitch) {
+
+		const std::size_t bits_per_pixel = BitsPerPixel(format);
+		ThrowIfFailed((0u != bits_per_pixel) && !IsPackedOrPlanar(format),
+					  "Unsupported texture format: {}.",
+					  static_cast< U32 >(format));
+
+		if (IsBlockCompressed(format)) {
+			// A 4x4 block contains 16 pixels.
+			const std::size_t bytes_per_block = 2u * bits_per_pixel;
+			const std::size_t nb_blocks_wide
+				= std::max< std::size_t >((width  + 3u) / 4u, 1u);
+			const std::size_t nb_blocks_high
+				= std::max< std::size_t >((height + 3u) / 4u, 1u);
+
+			row_pitch   = nb_blocks_wide * bytes_per_block;
+			slice_pitch = nb_blocks_high * row_pitch;
+		}
+		else {
+			// Round up to the nearest byte.
+			row_pitch   = (width * bits_per_pixel + 7u) / 8u;
+			slice_pitch = height * row_pitch;
+		}
+	}
+
+	[[nodiscard]]
+	const TextureDescriptor GetMipChain(const TextureDescriptor& desc,
+										U32 first_mip_level) noexcept {
+		auto chain = desc;
+		chain.m_width         = std::max(desc.m_width  >> first_mip_level, 1u);
+		chain.m_height        = std::max(desc.m_height >> first_mip_level, 1u);
+		chain.m_depth         = std::max(desc.m_depth  >> first_mip_level, 1u);
+		chain.m_nb_mip_levels = desc.m_nb_mip_levels - first_mip_level;
+		return chain;
+	}
+
+	[[nodiscard]]
+	std::vector< TextureSubresource >
+		ComputeSubresources(const TextureDescriptor& desc) {
+
+		ThrowIfFailed(0u != desc.m_width && 0u != desc.m_height
+					  && 0u != desc.m_depth,
+					  "Invalid texture size: {}x{}x{}.",
+					  desc.m_width, desc.m_height, desc.m_depth);
+		ThrowIfFailed(0u != desc.m_array_size && 0u != desc.m_nb_mip_levels
+					  && D3D11_REQ_MIP_LEVELS >= desc.m_nb_mip_levels,
+					  "Invalid texture array size or number of mip levels: {}, {}.",
+					  desc.m_array_size, desc.m_nb_mip_levels);
+
+		switch (desc.m_dimension) {
+
+		case D3D11_RESOURCE_DIMENSION_TEXTURE1D:
+			ThrowIfFailed(1u == desc.m_height && 1u == desc.m_depth
+						  && !desc.m_cube_map,
+						  "Invalid 1D texture.");
+			break;
+		case D3D11_RESOURCE_DIMENSION_TEXTURE2D:
+			ThrowIfFailed(1u == desc.m_depth
+						  && (!desc.m_cube_map || 0u == desc.m_array_size % 6u),
+						  "Invalid 2D texture.");
+			break;
+		case D3D11_RESOURCE_DIMENSION_TEXTURE3D:
+			ThrowIfFailed(1u == desc.m_array_size && !desc.m_cube_map,
+						  "Invalid 3D texture.");
+			break;
+		default:
+			throw Exception("Unsupported texture dimension: {}.",
+							static_cast< U32 >(desc.m_dimension));
+
+		}
+
+		std::vector< TextureSubresource > subresources;
+		subresources.reserve(static_cast< std::size_t >(desc.m_array_size)
+							 * desc.m_nb_mip_levels);
+
+		std::size_t offset = 0u;
+		for (U32 item = 0u; item < desc.m_array_size; ++item) {
+			U32 width  = desc.m_width;
+			U32 height = desc.m_height;
+			U32 depth  = desc.m_depth;
+
+			for (U32 mip = 0u; mip < desc.m_nb_mip_levels; ++mip) {
+				TextureSubresource subresource;
+				ComputePitch(desc.m_format, width, height,
+							 subresource.m_row_pitch, subresource.m_slice_pitch);
+				subresource.m_offset = offset;
+				subresource.m_size   = subresource.m_slice_pitch * depth;
+				subresource.m_width  = width;
+				subresource.m_height = height;
+				subresource.m_depth  = depth;
+
+				offset += subresource.m_size;
+				subresources.push_back(subresource);
+
+				width  = std::max(width  >> 1u, 1u);
+				height = std::max(height >> 1u, 1u);
+				depth  = std::max(depth  >> 1u, 1u);
+			}
+		}
+
+		return subresources;
+	}
+
+	[[nodiscard]]
+	std::vector< std::size_t >
+		ComputeMipLevelSizes(const TextureDescriptor& desc) {
+
+		const auto subresources = ComputeSubresources(desc);
+
+		std::vector< std::size_t > sizes(desc.m_nb_mip_levels, 0u);
+		for (std::size_t i = 0u; i < subresources.size(); ++i) {
+			sizes[i % desc.m_nb_mip_levels] += subresources[i].m_size;
+		}
+
+		return sizes;
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// TextureData
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	TextureData::TextureData() noexcept
+		: m_desc(),
+		m_subresources(),
+		m_pixels() {}
+
+	TextureData::TextureData(TextureData&& data) noexcept = default;
+
+	TextureData::~TextureData() = default;
+
+	TextureData& TextureData::operator=(TextureData&& data) noexcept = default;
+
+	void TextureData::Initialize(const TextureDescriptor& desc) {
+		// Compute the layout of all subresources.
+		m_subresources = ComputeSubresources(desc);
+		m_desc         = desc;
+
+		// Allocate the pixel data of all subresources.
+		const auto& last = m_subresources.back();
+		m_pixels.resize(last.m_offset + last.m_size);
+	}
+
+	void TextureData::Clear() noexcept {
+		m_desc = {};
+		m_subresources.clear();
+		m_pixels.clear();
+		m_pixels.shrink_to_fit();
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -0,0 +1,473 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "direct3d11.hpp"
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// Utilities
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Computes the row and slice pitch of a surface of the given DXGI format and
+	 size.
+
+	 @param[in]		format
+					The DXGI format.
+	 @param[in]		width
+					The width of the surface (in pixels).
+	 @param[in]		height
+					The height of the surface (in pixels).
+	 @param[out]	row_pitch
+					A reference to the row pitch (in bytes). For
+					block-compressed formats, a row contains a row of 4x4
+					blocks.
+	 @param[out]	slice_pitch
+					A reference to the slice pitch (in bytes).
+	 @throws		Exception
+					The given DXGI format is not supported.
+	 */
+	void ComputePitch(DXGI_FORMAT format, U32 width, U32 height,
+					  std::size_t& row_pitch, std::size_t& slice_pitch);
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// TextureDescriptor
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of texture descriptors (i.e. device-independent descriptions of
+	 the dimension, format, size and mip chain of textures).
+	 */
+	struct TextureDescriptor {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The resource dimension of this texture descriptor.
+		 */
+		D3D11_RESOURCE_DIMENSION m_dimension = D3D11_RESOURCE_DIMENSION_UNKNOWN;
+
+		/**
+		 The DXGI format of this texture descriptor.
+		 */
+		DXGI_FORMAT m_format = DXGI_FORMAT_UNKNOWN;
+
+		/**
+		 The width (in pixels) of the most detailed mip level of this texture
+		 descriptor.
+		 */
+		U32 m_width = 0u;
+
+		/**
+		 The height (in pixels) of the most detailed mip level of this texture
+		 descriptor.
+		 */
+		U32 m_height = 0u;
+
+		/**
+		 The depth (in pixels) of the most detailed mip level of this texture
+		 descriptor.
+		 */
+		U32 m_depth = 0u;
+
+		/**
+		 The number of texture array items of this texture descriptor (i.e.
+		 six times the number of cubes for cube maps).
+		 */
+		U32 m_array_size = 0u;
+
+		/**
+		 The number of mip levels of this texture descriptor.
+		 */
+		U32 m_nb_mip_levels = 0u;
+
+		/**
+		 A flag indicating whether this texture descriptor describes a cube
+		 map.
+		 */
+		bool m_cube_map = false;
+	};
+
+	/**
+	 Returns the texture descriptor of the mip chain of the given texture
+	 descriptor starting at the given mip level.
+
+	 @pre			@a first_mip_level < @a desc.m_nb_mip_levels.
+	 @param[in]		desc
+					A reference to the texture descriptor.
+	 @param[in]		first_mip_level
+					The first (i.e. most detailed) mip level to keep.
+	 @return		The texture descriptor of the mip chain of the given
+					texture descriptor starting at the given mip level.
+	 */
+	[[nodiscard]]
+	const TextureDescriptor GetMipChain(const TextureDescriptor& desc,
+										U32 first_mip_level) noexcept;
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// TextureSubresource
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of texture subresources (i.e. the layout of a single mip level
+	 of a single texture array item in the pixel data of a texture data).
+	 */
+	struct TextureSubresource {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The offset (in bytes) of this texture subresource in the pixel data.
+		 */
+		std::size_t m_offset = 0u;
+
+		/**
+		 The size (in bytes) of this texture subresource.
+		 */
+		std::size_t m_size = 0u;
+
+		/**
+		 The row pitch (in bytes) of this texture subresource.
+		 */
+		std::size_t m_row_pitch = 0u;
+
+		/**
+		 The slice pitch (in bytes) of this texture subresource.
+		 */
+		std::size_t m_slice_pitch = 0u;
+
+		/**
+		 The width (in pixels) of this texture subresource.
+		 */
+		U32 m_width = 0u;
+
+		/**
+		 The height (in pixels) of this texture subresource.
+		 */
+		U32 m_height = 0u;
+
+		/**
+		 The depth (in pixels) of this texture subresource.
+		 */
+		U32 m_depth = 0u;
+	};
+
+	/**
+	 Computes the layout of all subresources of the given texture descriptor.
+	 The subresources are stored contiguously in the subresource order of
+	 Direct3D 11 (i.e. all mip levels of the first texture array item, then
+	 all mip levels of the second texture array item, etc.), which is also
+	 the order of the pixel data in DDS files.
+
+	 @param[in]		desc
+					A reference to the texture descriptor.
+	 @return		The subresources of the given texture descriptor.
+	 @throws		Exception
+					The given texture descriptor is invalid.
+	 */
+	[[nodiscard]]
+	std::vector< TextureSubresource >
+		ComputeSubresources(const TextureDescriptor& desc);
+
+	/**
+	 Computes the memory usage of each mip level (of all texture array items)
+	 of the given texture descriptor.
+
+	 @param[in]		desc
+					A reference to the texture descriptor.
+	 @return		The memory usage (in bytes) of each mip level of the given
+					texture descriptor.
+	 @throws		Exception
+					The given texture descriptor is invalid.
+	 */
+	[[nodiscard]]
+	std::vector< std::size_t >
+		ComputeMipLevelSizes(const TextureDescriptor& desc);
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// TextureData
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of texture data (i.e. device-independent texture descriptions
+	 and pixel data of all subresources, stored contiguously in the
+	 subresource order of Direct3D 11).
+
+	 Texture data can be constructed and filled on any thread.
+	 */
+	class TextureData {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an (empty) texture data.
+		 */
+		TextureData() noexcept;
+
+		/**
+		 Constructs a texture data from the given texture data.
+
+		 @param[in]		data
+						A reference to the texture data to copy.
+		 */
+		TextureData(const TextureData& data) = delete;
+
+		/**
+		 Constructs a texture data by moving the given texture data.
+
+		 @param[in]		data
+						A reference to the texture data to move.
+		 */
+		TextureData(TextureData&& data) noexcept;
+
+		/**
+		 Destructs this texture data.
+		 */
+		~TextureData();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given texture data to this texture data.
+
+		 @param[in]		data
+						A reference to the texture data to copy.
+		 @return		A reference to the copy of the given texture data (i.e.
+						this texture data).
+		 */
+		TextureData& operator=(const TextureData& data) = delete;
+
+		/**
+		 Moves the given texture data to this texture data.
+
+		 @param[in]		data
+						A reference to the texture data to move.
+		 @return		A reference to the moved texture data (i.e. this
+						texture data).
+		 */
+		TextureData& operator=(TextureData&& data) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Initializes this texture data. The layout of all subresources is
+		 computed and the (uninitialized) pixel data is allocated.
+
+		 @param[in]		desc
+						A reference to the texture descriptor.
+		 @throws		Exception
+						Failed to initialize the texture data.
+		 */
+		void Initialize(const TextureDescriptor& desc);
+
+		/**
+		 Clears this texture data.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Checks whether this texture data is empty.
+
+		 @return		@c true if this texture data is empty. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_pixels.empty();
+		}
+
+		/**
+		 Returns the texture descriptor of this texture data.
+
+		 @return		A reference to the texture descriptor of this texture
+						data.
+		 */
+		[[nodiscard]]
+		const TextureDescriptor& GetDescriptor() const noexcept {
+			return m_desc;
+		}
+
+		/**
+		 Sets the DXGI format of this texture data to the given DXGI format
+		 (e.g., to reinterpret the pixel data as sRGB).
+
+		 @pre			The given DXGI format has the same number of bits per
+						pixel as the DXGI format of this texture data.
+		 @param[in]		format
+						The DXGI format.
+		 */
+		void SetFormat(DXGI_FORMAT format) noexcept {
+			m_desc.m_format = format;
+		}
+
+		/**
+		 Returns the number of subresources of this texture data.
+
+		 @return		The number of subresources of this texture data.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfSubresources() const noexcept {
+			return m_subresources.size();
+		}
+
+		/**
+		 Returns the index of the subresource of this texture data
+		 corresponding to the given mip level and texture array item.
+
+		 @param[in]		mip_level
+						The mip level.
+		 @param[in]		item
+						The texture array item.
+		 @return		The index of the subresource.
+		 */
+		[[nodiscard]]
+		std::size_t GetSubresourceIndex(U32 mip_level, U32 item) const noexcept {
+			return mip_level
+				 + static_cast< std::size_t >(item) * m_desc.m_nb_mip_levels;
+		}
+
+		/**
+		 Returns the subresource of this texture data at the given index.
+
+		 @pre			@a index < @c GetNumberOfSubresources().
+		 @param[in]		index
+						The index of the subresource.
+		 @return		A reference to the subresource of this texture data
+						at the given index.
+		 */
+		[[nodiscard]]
+		const TextureSubresource& GetSubresource(std::size_t index) const noexcept {
+			return m_subresources[index];
+		}
+
+		/**
+		 Returns the pixel data of the subresource of this texture data at the
+		 given index.
+
+		 @pre			@a index < @c GetNumberOfSubresources().
+		 @param[in]		index
+						The index of the subresource.
+		 @return		A pointer to the pixel data of the subresource of this
+						texture data at the given index.
+		 */
+		[[nodiscard]]
+		U8* GetPixels(std::size_t index) noexcept {
+			return m_pixels.data() + m_subresources[index].m_offset;
+		}
+
+		/**
+		 Returns the pixel data of the subresource of this texture data at the
+		 given index.
+
+		 @pre			@a index < @c GetNumberOfSubresources().
+		 @param[in]		index
+						The index of the subresource.
+		 @return		A pointer to the pixel data of the subresource of this
+						texture data at the given index.
+		 */
+		[[nodiscard]]
+		const U8* GetPixels(std::size_t index) const noexcept {
+			return m_pixels.data() + m_subresources[index].m_offset;
+		}
+
+		/**
+		 Returns the pixel data of all subresources of this texture data.
+
+		 @return		A pointer to the pixel data of this texture data.
+		 */
+		[[nodiscard]]
+		U8* GetPixels() noexcept {
+			return m_pixels.data();
+		}
+
+		/**
+		 Returns the pixel data of all subresources of this texture data.
+
+		 @return		A pointer to the pixel data of this texture data.
+		 */
+		[[nodiscard]]
+		const U8* GetPixels() const noexcept {
+			return m_pixels.data();
+		}
+
+		/**
+		 Returns the size (in bytes) of the pixel data of all subresources of
+		 this texture data.
+
+		 @return		The size of the pixel data of this texture data.
+		 */
+		[[nodiscard]]
+		std::size_t GetSize() const noexcept {
+			return m_pixels.size();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The texture descriptor of this texture data.
+		 */
+		TextureDescriptor m_desc;
+
+		/**
+		 The subresources of this texture data.
+		 */
+		std::vector< TextureSubresource > m_subresources;
+
+		/**
+		 The pixel data of all subresources of this texture data.
+		 */
+		std::vector< U8 > m_pixels;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
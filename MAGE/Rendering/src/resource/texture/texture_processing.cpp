@@ -0,0 +1,510 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/texture/texture_processing.hpp"
+#include "resource/texture/texture_format.hpp"
+#include "resource/texture/block_compression.hpp"
+#include "parallel/parallel.hpp"
+#include "exception/exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 Calls the given function for all indices in [0, @a count) on all
+		 system cores. The given function must not throw.
+
+		 @tparam		FunctionT
+						The function type.
+		 @param[in]		count
+						The number of indices.
+		 @param[in]		function
+						A reference to the function.
+		 */
+		template< typename FunctionT >
+		void ParallelFor(std::size_t count, const FunctionT& function) {
+			std::atomic< std::size_t > next = 0u;
+			const auto work = [&next, count, &function]() noexcept {
+				for (auto i = next++; i < count; i = next++) {
+					function(i);
+				}
+			};
+
+			const auto nb_threads = std::min(
+				static_cast< std::size_t >(NumberOfSystemCores()), count);
+
+			std::vector< std::thread > threads;
+			for (std::size_t i = 1u; i < nb_threads; ++i) {
+				threads.emplace_back(work);
+			}
+			work();
+
+			for (auto& thread : threads) {
+				thread.join();
+			}
+		}
+
+		/**
+		 Checks whether the given DXGI format is supported as input format.
+
+		 @param[in]		format
+						The DXGI format.
+		 @return		@c true if the given DXGI format is supported as
+						input format. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool IsSupportedInputFormat(DXGI_FORMAT format) noexcept {
+			return DXGI_FORMAT_R8G8B8A8_UNORM      == format
+				|| DXGI_FORMAT_R8G8B8A8_UNORM_SRGB == format;
+		}
+
+		/**
+		 Converts the given sRGB value to linear space.
+
+		 @param[in]		value
+						The sRGB value in [0, 1].
+		 @return		The linear value in [0, 1].
+		 */
+		[[nodiscard]]
+		F32 SRGBToLinear(F32 value) noexcept {
+			return (0.04045f >= value) ? value / 12.92f
+				: std::pow((value + 0.055f) / 1.055f, 2.4f);
+		}
+
+		/**
+		 Converts the given linear value to sRGB space.
+
+		 @param[in]		value
+						The linear value in [0, 1].
+		 @return		The sRGB value in [0, 1].
+		 */
+		[[nodiscard]]
+		F32 LinearToSRGB(F32 value) noexcept {
+			return (0.0031308f >= value) ? value * 12.92f
+				: 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+		}
+
+		/**
+		 Converts the given normalized value to an 8-bit unorm value.
+
+		 @param[in]		value
+						The normalized value.
+		 @return		The 8-bit unorm value.
+		 */
+		[[nodiscard]]
+		U8 ToUNorm(F32 value) noexcept {
+			return static_cast< U8 >(
+				std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+		}
+
+		/**
+		 A struct of floating point RGBA images (i.e. intermediate mip
+		 levels).
+		 */
+		struct Image {
+
+		public:
+
+			/**
+			 Returns the texel at the given position of this image.
+
+			 @param[in]		x
+							The x coordinate.
+			 @param[in]		y
+							The y coordinate.
+			 @return		A reference to the texel at the given position
+							of this image.
+			 */
+			[[nodiscard]]
+			F32x4& operator()(U32 x, U32 y) noexcept {
+				return m_texels[y * m_width + x];
+			}
+
+			/**
+			 Returns the texel at the given position of this image.
+
+			 @param[in]		x
+							The x coordinate.
+			 @param[in]		y
+							The y coordinate.
+			 @return		A reference to the texel at the given position
+							of this image.
+			 */
+			[[nodiscard]]
+			const F32x4& operator()(U32 x, U32 y) const noexcept {
+				return m_texels[y * m_width + x];
+			}
+
+			/**
+			 The width (in pixels) of this image.
+			 */
+			U32 m_width = 0u;
+
+			/**
+			 The height (in pixels) of this image.
+			 */
+			U32 m_height = 0u;
+
+			/**
+			 The texels of this image (in row-major order).
+			 */
+			std::vector< F32x4 > m_texels;
+		};
+
+		/**
+		 Decodes the given 8-bit RGBA subresource to the given image. sRGB
+		 colors are converted to linear space and normals to [-1, 1].
+
+		 @param[in]		pixels
+						A pointer to the pixels of the subresource.
+		 @param[in]		row_pitch
+						The row pitch (in bytes) of the subresource.
+		 @param[in]		usage
+						The texture usage.
+		 @param[in]		srgb
+						@c true if the subresource contains sRGB colors.
+		 @param[in,out]	image
+						A reference to the (sized) image.
+		 */
+		void Decode(const U8* pixels, U32 row_pitch,
+					TextureUsage usage, bool srgb, Image& image) {
+
+			// Lookup table for decoding sRGB values.
+			std::array< F32, 256u > srgb_lut;
+			for (std::size_t i = 0u; i < srgb_lut.size(); ++i) {
+				srgb_lut[i] = SRGBToLinear(i / 255.0f);
+			}
+
+			for (U32 y = 0u; y < image.m_height; ++y) {
+				const auto row = pixels + y * row_pitch;
+				for (U32 x = 0u; x < image.m_width; ++x) {
+					const auto texel = row + 4u * x;
+					auto& output     = image(x, y);
+
+					for (std::size_t c = 0u; c < 3u; ++c) {
+						output[c] = srgb ? srgb_lut[texel[c]] : texel[c] / 255.0f;
+						if (TextureUsage::Normal == usage) {
+							output[c] = 2.0f * output[c] - 1.0f;
+						}
+					}
+					output[3u] = texel[3u] / 255.0f;
+				}
+			}
+		}
+
+		/**
+		 Encodes the given image to the given 8-bit RGBA subresource (i.e.
+		 the inverse of @c Decode).
+
+		 @param[in]		image
+						A reference to the image.
+		 @param[in]		usage
+						The texture usage.
+		 @param[in]		srgb
+						@c true if the subresource contains sRGB colors.
+		 @param[out]	pixels
+						A pointer to the pixels of the subresource.
+		 @param[in]		row_pitch
+						The row pitch (in bytes) of the subresource.
+		 */
+		void Encode(const Image& image, TextureUsage usage, bool srgb,
+					U8* pixels, U32 row_pitch) noexcept {
+
+			for (U32 y = 0u; y < image.m_height; ++y) {
+				const auto row = pixels + y * row_pitch;
+				for (U32 x = 0u; x < image.m_width; ++x) {
+					const auto& input = image(x, y);
+					const auto texel  = row + 4u * x;
+
+					for (std::size_t c = 0u; c < 3u; ++c) {
+						auto value = input[c];
+						if (TextureUsage::Normal == usage) {
+							value = 0.5f * value + 0.5f;
+						}
+						texel[c] = ToUNorm(srgb ? LinearToSRGB(value) : value);
+					}
+					texel[3u] = ToUNorm(input[3u]);
+				}
+			}
+		}
+
+		/**
+		 Downsamples the given image to the given image with a separable
+		 [1 3 3 1] filter (clamped addressing). Normals are renormalized.
+
+		 @param[in]		input
+						A reference to the input image.
+		 @param[in]		usage
+						The texture usage.
+		 @param[in,out]	output
+						A reference to the (sized) output image.
+		 */
+		void Downsample(const Image& input, TextureUsage usage, Image& output) {
+			static constexpr F32 s_weights[] = {
+				1.0f / 8.0f, 3.0f / 8.0f, 3.0f / 8.0f, 1.0f / 8.0f
+			};
+
+			const auto sample = [&input](S32 x, S32 y) noexcept {
+				x = std::clamp(x, 0, static_cast< S32 >(input.m_width)  - 1);
+				y = std::clamp(y, 0, static_cast< S32 >(input.m_height) - 1);
+				return input(static_cast< U32 >(x), static_cast< U32 >(y));
+			};
+
+			// Dimensions of size one are not filtered.
+			const auto filter_x = 1u < input.m_width;
+			const auto filter_y = 1u < input.m_height;
+
+			ParallelFor(output.m_height, [&](std::size_t i) noexcept {
+				const auto y = static_cast< U32 >(i);
+				for (U32 x = 0u; x < output.m_width; ++x) {
+					F32x4 result(0.0f);
+
+					for (S32 j = 0; j < 4; ++j) {
+						const auto sy = filter_y ? static_cast< S32 >(2u * y) + j - 1
+												 : static_cast< S32 >(y);
+						const auto wy = filter_y ? s_weights[j] : 0.25f;
+
+						for (S32 k = 0; k < 4; ++k) {
+							const auto sx = filter_x ? static_cast< S32 >(2u * x) + k - 1
+													 : static_cast< S32 >(x);
+							const auto wx = filter_x ? s_weights[k] : 0.25f;
+
+							const auto& texel = sample(sx, sy);
+							for (std::size_t c = 0u; c < 4u; ++c) {
+								result[c] += wx * wy * texel[c];
+							}
+						}
+					}
+
+					if (TextureUsage::Normal == usage) {
+						const auto length = std::sqrt(result[0u] * result[0u]
+													+ result[1u] * result[1u]
+													+ result[2u] * result[2u]);
+						if (0.0f < length) {
+							for (std::size_t c = 0u; c < 3u; ++c) {
+								result[c] /= length;
+							}
+						}
+					}
+
+					output(x, y) = result;
+				}
+			});
+		}
+
+		/**
+		 Gathers the texel block at the given block position of the given
+		 8-bit RGBA subresource. Texels outside the subresource are clamped.
+
+		 @param[in]		pixels
+						A pointer to the pixels of the subresource.
+		 @param[in]		subresource
+						A reference to the subresource.
+		 @param[in]		block_x
+						The x coordinate of the block.
+		 @param[in]		block_y
+						The y coordinate of the block.
+		 @param[out]	texels
+						A reference to the texel block.
+		 */
+		void GatherBlock(const U8* pixels, const TextureSubresource& subresource,
+						 U32 block_x, U32 block_y, TexelBlock& texels) noexcept {
+
+			for (U32 j = 0u; j < 4u; ++j) {
+				const auto y   = std::min(4u * block_y + j, subresource.m_height - 1u);
+				const auto row = pixels + y * subresource.m_row_pitch;
+
+				for (U32 i = 0u; i < 4u; ++i) {
+					const auto x     = std::min(4u * block_x + i, subresource.m_width - 1u);
+					const auto texel = row + 4u * x;
+					auto& output     = texels[4u * j + i];
+					for (std::size_t c = 0u; c < 4u; ++c) {
+						output[c] = texel[c];
+					}
+				}
+			}
+		}
+	}
+
+	[[nodiscard]]
+	DXGI_FORMAT GetCompressedFormat(const TextureData& data,
+									TextureUsage usage) noexcept {
+
+		const auto& desc = data.GetDescriptor();
+
+		switch (usage) {
+
+		case TextureUsage::Normal:
+			return DXGI_FORMAT_BC5_UNORM;
+
+		case TextureUsage::Material:
+			return DXGI_FORMAT_BC7_UNORM;
+
+		default: {
+			// Opaque base colors use BC1, base colors with alpha use BC3.
+			auto opaque = true;
+			for (std::size_t i = 3u; i < data.GetSize() && opaque; i += 4u) {
+				opaque = (255u == data.GetPixels()[i]);
+			}
+
+			const auto format = opaque ? DXGI_FORMAT_BC1_UNORM
+									   : DXGI_FORMAT_BC3_UNORM;
+			return (DXGI_FORMAT_R8G8B8A8_UNORM_SRGB == desc.m_format)
+				? ConvertToSRGB(format) : format;
+		}
+
+		}
+	}
+
+	void GenerateMipMaps(const TextureData& input,
+						 TextureUsage usage,
+						 TextureData& output) {
+
+		auto desc = input.GetDescriptor();
+		ThrowIfFailed(IsSupportedInputFormat(desc.m_format),
+					  "Unsupported texture format for mip generation: {}.",
+					  static_cast< U32 >(desc.m_format));
+		ThrowIfFailed((D3D11_RESOURCE_DIMENSION_TEXTURE2D == desc.m_dimension),
+					  "Unsupported texture dimension for mip generation: {}.",
+					  static_cast< U32 >(desc.m_dimension));
+
+		const auto srgb = (DXGI_FORMAT_R8G8B8A8_UNORM_SRGB == desc.m_format);
+
+		U32 nb_mip_levels = 1u;
+		for (auto size = std::max(desc.m_width, desc.m_height);
+			 1u < size; size >>= 1u) {
+			++nb_mip_levels;
+		}
+
+		desc.m_nb_mip_levels = nb_mip_levels;
+		output.Initialize(desc);
+
+		for (U32 item = 0u; item < desc.m_array_size; ++item) {
+			const auto input_index = input.GetSubresourceIndex(0u, item);
+			const auto& input_subresource = input.GetSubresource(input_index);
+
+			Image image;
+			image.m_width  = input_subresource.m_width;
+			image.m_height = input_subresource.m_height;
+			image.m_texels.resize(std::size_t(image.m_width) * image.m_height);
+			Decode(input.GetPixels(input_index), input_subresource.m_row_pitch,
+				   usage, srgb, image);
+
+			for (U32 mip_level = 0u; mip_level < nb_mip_levels; ++mip_level) {
+				if (0u != mip_level) {
+					Image next;
+					next.m_width  = std::max(image.m_width  >> 1u, 1u);
+					next.m_height = std::max(image.m_height >> 1u, 1u);
+					next.m_texels.resize(std::size_t(next.m_width) * next.m_height);
+					Downsample(image, usage, next);
+					image = std::move(next);
+				}
+
+				const auto index = output.GetSubresourceIndex(mip_level, item);
+				Encode(image, usage, srgb, output.GetPixels(index),
+					   output.GetSubresource(index).m_row_pitch);
+			}
+		}
+	}
+
+	void CompressTexture(const TextureData& input,
+						 DXGI_FORMAT format,
+						 TextureData& output) {
+
+		auto desc = input.GetDescriptor();
+		ThrowIfFailed(IsSupportedInputFormat(desc.m_format),
+					  "Unsupported texture format for compression: {}.",
+					  static_cast< U32 >(desc.m_format));
+		ThrowIfFailed((1u == desc.m_depth),
+					  "Unsupported texture depth for compression: {}.",
+					  desc.m_depth);
+
+		void (*compress)(const TexelBlock&, U8*) noexcept = nullptr;
+		switch (format) {
+
+		case DXGI_FORMAT_BC1_UNORM:
+		case DXGI_FORMAT_BC1_UNORM_SRGB:
+			compress = [](const TexelBlock& texels, U8* block) noexcept {
+				CompressBC1Block(texels, gsl::span< U8, 8 >(block, 8));
+			};
+			break;
+		case DXGI_FORMAT_BC3_UNORM:
+		case DXGI_FORMAT_BC3_UNORM_SRGB:
+			compress = [](const TexelBlock& texels, U8* block) noexcept {
+				CompressBC3Block(texels, gsl::span< U8, 16 >(block, 16));
+			};
+			break;
+		case DXGI_FORMAT_BC4_UNORM:
+			compress = [](const TexelBlock& texels, U8* block) noexcept {
+				CompressBC4Block(texels, 0u, gsl::span< U8, 8 >(block, 8));
+			};
+			break;
+		case DXGI_FORMAT_BC5_UNORM:
+			compress = [](const TexelBlock& texels, U8* block) noexcept {
+				CompressBC5Block(texels, gsl::span< U8, 16 >(block, 16));
+			};
+			break;
+		case DXGI_FORMAT_BC7_UNORM:
+		case DXGI_FORMAT_BC7_UNORM_SRGB:
+			compress = [](const TexelBlock& texels, U8* block) noexcept {
+				CompressBC7Block(texels, gsl::span< U8, 16 >(block, 16));
+			};
+			break;
+		default:
+			throw Exception("Unsupported texture compression format: {}.",
+							static_cast< U32 >(format));
+
+		}
+
+		const U32 block_size = BitsPerPixel(format) * 2u;
+
+		desc.m_format = format;
+		output.Initialize(desc);
+
+		// Each job compresses a single row of blocks of a single subresource.
+		std::vector< std::pair< std::size_t, U32 > > jobs;
+		for (std::size_t i = 0u; i < input.GetNumberOfSubresources(); ++i) {
+			const auto& subresource = input.GetSubresource(i);
+			const auto nb_rows = std::max((subresource.m_height + 3u) / 4u, 1u);
+			for (U32 row = 0u; row < nb_rows; ++row) {
+				jobs.emplace_back(i, row);
+			}
+		}
+
+		ParallelFor(jobs.size(), [&](std::size_t job) noexcept {
+			const auto [index, block_y] = jobs[job];
+			const auto& subresource = input.GetSubresource(index);
+			const auto pixels = input.GetPixels(index);
+			const auto blocks = output.GetPixels(index)
+							  + block_y * output.GetSubresource(index).m_row_pitch;
+
+			const auto nb_columns = std::max((subresource.m_width + 3u) / 4u, 1u);
+			TexelBlock texels;
+			for (U32 block_x = 0u; block_x < nb_columns; ++block_x) {
+				GatherBlock(pixels, subresource, block_x, block_y, texels);
+				compress(texels, blocks + block_x * block_size);
+			}
+		});
+	}
+}
\ No newline at end of file
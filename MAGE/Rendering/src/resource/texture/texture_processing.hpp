@@ -0,0 +1,97 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/texture/texture_data.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 An enumeration of the different texture usages.
+
+	 This contains:
+	 @c BaseColor (sRGB color with optional alpha),
+	 @c Material (linear, uncorrelated channels) and
+	 @c Normal (linear, tangent-space normals decoded from the red and green
+	 channels).
+	 */
+	enum class TextureUsage : U8 {
+		BaseColor = 0,
+		Material,
+		Normal
+	};
+
+	/**
+	 Returns the block-compressed DXGI format for the given texture data and
+	 usage.
+
+	 Base color textures are compressed to BC1 (opaque) or BC3 (with alpha),
+	 material textures to BC7 and normal maps to BC5. sRGB texture data
+	 results in sRGB formats.
+
+	 @param[in]		data
+					A reference to the (uncompressed) texture data.
+	 @param[in]		usage
+					The texture usage.
+	 @return		The block-compressed DXGI format for the given texture
+					data and usage.
+	 */
+	[[nodiscard]]
+	DXGI_FORMAT GetCompressedFormat(const TextureData& data,
+									TextureUsage usage) noexcept;
+
+	/**
+	 Generates the complete mip chain of the given texture data.
+
+	 The mip levels are downsampled with a separable [1 3 3 1] filter. sRGB
+	 texture data is filtered in linear space and normal maps are
+	 renormalized. The work is distributed over all system cores.
+
+	 @pre			The format of the given texture data is
+					@c DXGI_FORMAT_R8G8B8A8_UNORM or
+					@c DXGI_FORMAT_R8G8B8A8_UNORM_SRGB.
+	 @param[in]		input
+					A reference to the 2D texture data. Only the most
+					detailed mip level is used.
+	 @param[in]		usage
+					The texture usage.
+	 @param[out]	output
+					A reference to the texture data with the complete mip
+					chain.
+	 @throws		Exception
+					Failed to generate the mip chain.
+	 */
+	void GenerateMipMaps(const TextureData& input,
+						 TextureUsage usage,
+						 TextureData& output);
+
+	/**
+	 Compresses the given texture data to the given block-compressed format.
+	 All subresources are compressed. The work is distributed over all
+	 system cores.
+
+	 @pre			The format of the given texture data is
+					@c DXGI_FORMAT_R8G8B8A8_UNORM or
+					@c DXGI_FORMAT_R8G8B8A8_UNORM_SRGB.
+	 @param[in]		input
+					A reference to the texture data.
+	 @param[in]		format
+					The block-compressed DXGI format (BC1, BC3, BC4, BC5 or
+					BC7).
+	 @param[out]	output
+					A reference to the compressed texture data.
+	 @throws		Exception
+					Failed to compress the texture data.
+	 */
+	void CompressTexture(const TextureData& input,
+						 DXGI_FORMAT format,
+						 TextureData& output);
+}
\ No newline at end of file
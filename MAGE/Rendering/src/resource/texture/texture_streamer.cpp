@@ -0,0 +1,215 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/texture/texture_streamer.hpp"
+#include "resource/texture/texture.hpp"
+#include "loaders/dds/dds_loader.hpp"
+#include "loaders/texture_loader.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 The maximum size (in pixels) of the mip tail of streamed textures.
+		 */
+		constexpr U32 g_mip_tail_size = 128u;
+
+		/**
+		 The maximum number of pending requests of texture streamers.
+		 */
+		constexpr std::size_t g_max_nb_pending_requests = 4u;
+	}
+
+	[[nodiscard]]
+	U32 TextureStreamer::GetMipTailLevel(const TextureDescriptor& desc) noexcept {
+		// Only (non-cube map) 2D textures with a mip chain are streamed.
+		if (D3D11_RESOURCE_DIMENSION_TEXTURE2D != desc.m_dimension
+			|| desc.m_cube_map || 1u >= desc.m_nb_mip_levels) {
+			return 0u;
+		}
+
+		const auto size = std::max(desc.m_width, desc.m_height);
+
+		U32 mip_level = 0u;
+		while (g_mip_tail_size < (size >> mip_level)
+			   && mip_level + 1u < desc.m_nb_mip_levels) {
+			++mip_level;
+		}
+
+		return mip_level;
+	}
+
+	TextureStreamer::TextureStreamer(ID3D11Device& device,
+									 ThreadPool& thread_pool,
+									 std::size_t memory_budget)
+		: m_device(device),
+		m_thread_pool(thread_pool),
+		m_scheduler(memory_budget),
+		m_slots(),
+		m_indices(),
+		m_completions(),
+		m_serial(0u),
+		m_mutex() {}
+
+	TextureStreamer::~TextureStreamer() = default;
+
+	void TextureStreamer::Register(Texture& texture,
+								   const TextureDescriptor& desc,
+								   U32 resident_mip_level) {
+
+		const std::scoped_lock lock(m_mutex);
+
+		const auto index = m_scheduler.Register(ComputeMipLevelSizes(desc),
+												std::max(desc.m_width, desc.m_height),
+												resident_mip_level);
+		if (m_slots.size() <= index) {
+			m_slots.resize(index + 1u);
+		}
+
+		m_slots[index] = { &texture, ++m_serial };
+		m_indices[&texture] = index;
+	}
+
+	void TextureStreamer::Unregister(const Texture& texture) noexcept {
+		const std::scoped_lock lock(m_mutex);
+
+		const auto it = m_indices.find(&texture);
+		if (m_indices.end() == it) {
+			return;
+		}
+
+		m_scheduler.Unregister(it->second);
+		m_slots[it->second] = {};
+		m_indices.erase(it);
+	}
+
+	void TextureStreamer::SetScreenSize(const Texture& texture,
+										F32 screen_size) noexcept {
+
+		const std::scoped_lock lock(m_mutex);
+
+		if (const auto it = m_indices.find(&texture);
+			m_indices.end() != it) {
+
+			m_scheduler.SetScreenSize(it->second, screen_size);
+		}
+	}
+
+	void TextureStreamer::Update() {
+		std::vector< std::pair< TextureStreamingRequest, U64 > > requests;
+		std::vector< std::filesystem::path > paths;
+
+		{
+			const std::scoped_lock lock(m_mutex);
+
+			// Swap in the mip levels of all completed requests. Completions
+			// of unregistered (or reused) slots are discarded.
+			for (auto& completion : m_completions) {
+				const auto& request = completion.m_request;
+				auto& slot          = m_slots[request.m_index];
+				if (completion.m_serial != slot.m_serial) {
+					continue;
+				}
+
+				if (completion.m_texture_srv) {
+					slot.m_texture->SetShaderResourceView(
+						std::move(completion.m_texture_srv),
+						completion.m_memory_usage);
+					m_scheduler.OnCompleted(request);
+				}
+				else {
+					m_scheduler.OnFailed(request);
+				}
+			}
+			m_completions.clear();
+
+			// Issue new requests.
+			const auto nb_pending = m_scheduler.GetNumberOfPendingRequests();
+			if (g_max_nb_pending_requests <= nb_pending) {
+				return;
+			}
+
+			for (const auto& request
+				 : m_scheduler.Schedule(g_max_nb_pending_requests - nb_pending)) {
+
+				const auto& slot = m_slots[request.m_index];
+				requests.emplace_back(request, slot.m_serial);
+				paths.push_back(slot.m_texture->GetPath());
+			}
+		}
+
+		for (std::size_t i = 0u; i < requests.size(); ++i) {
+			const auto [request, serial] = requests[i];
+			// The task queues its own completion; the future is discarded.
+			auto future = m_thread_pool.Enqueue(
+				[this, request, serial, path = std::move(paths[i])]() {
+					Stream(request, serial, path);
+				});
+		}
+	}
+
+	void TextureStreamer::Stream(const TextureStreamingRequest& request,
+								 U64 serial,
+								 const std::filesystem::path& path) noexcept {
+		Completion completion;
+		completion.m_request = request;
+		completion.m_serial  = serial;
+
+		try {
+			// Import the mip chain starting at the requested mip level and
+			// create the texture. The device is free-threaded.
+			TextureData data;
+			loader::ImportDDSTextureFromFile(path, data, request.m_mip_level);
+			loader::CreateTexture(data, m_device,
+				NotNull< ID3D11ShaderResourceView** >(
+					completion.m_texture_srv.ReleaseAndGetAddressOf()));
+
+			completion.m_memory_usage = data.GetSize();
+		}
+		catch (const std::exception& e) {
+			MAGE_WARNING("Texture streaming failed: {}", e.what());
+			completion.m_texture_srv.Reset();
+		}
+
+		const std::scoped_lock lock(m_mutex);
+		m_completions.push_back(std::move(completion));
+	}
+
+	[[nodiscard]]
+	std::size_t TextureStreamer::GetMemoryUsage() const noexcept {
+		const std::scoped_lock lock(m_mutex);
+
+		return m_scheduler.GetMemoryUsage();
+	}
+
+	void TextureStreamer::SetMemoryBudget(std::size_t memory_budget) noexcept {
+		const std::scoped_lock lock(m_mutex);
+
+		m_scheduler.SetMemoryBudget(memory_budget);
+	}
+
+	[[nodiscard]]
+	std::size_t TextureStreamer::GetNumberOfPendingRequests() const noexcept {
+		const std::scoped_lock lock(m_mutex);
+
+		return m_scheduler.GetNumberOfPendingRequests();
+	}
+}
\ No newline at end of file
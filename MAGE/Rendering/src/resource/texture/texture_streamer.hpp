@@ -0,0 +1,331 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/texture/texture_streaming_scheduler.hpp"
+#include "resource/texture/texture_data.hpp"
+#include "parallel/thread_pool.hpp"
+#include "direct3d11.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	class Texture;
+}
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of texture streamers.
+
+	 Streamed textures are created with only the least detailed mip levels
+	 (i.e. the mip tail) resident, so that these are usable immediately. More
+	 detailed mip levels are streamed in (and out) on the worker threads of a
+	 thread pool, prioritized by the on-screen size of the streamed textures
+	 and limited by a global memory budget.
+
+	 Textures can be (un)registered from any thread. All other member methods
+	 must be called from the thread updating the texture streamer.
+	 */
+	class TextureStreamer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the mip tail level of the given texture descriptor (i.e. the
+		 most detailed mip level which is always resident).
+
+		 @param[in]		desc
+						A reference to the texture descriptor.
+		 @return		The mip tail level of the given texture descriptor.
+		 @return		0, if textures with the given texture descriptor
+						should not be streamed.
+		 */
+		[[nodiscard]]
+		static U32 GetMipTailLevel(const TextureDescriptor& desc) noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a texture streamer.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in,out]	thread_pool
+						A reference to the thread pool for streaming. The
+						thread pool must be destructed before this texture
+						streamer.
+		 @param[in]		memory_budget
+						The memory budget (in bytes) of all streamed textures.
+		 */
+		explicit TextureStreamer(ID3D11Device& device,
+								 ThreadPool& thread_pool,
+								 std::size_t memory_budget);
+
+		/**
+		 Constructs a texture streamer from the given texture streamer.
+
+		 @param[in]		streamer
+						A reference to the texture streamer to copy.
+		 */
+		TextureStreamer(const TextureStreamer& streamer) = delete;
+
+		/**
+		 Constructs a texture streamer by moving the given texture streamer.
+
+		 @param[in]		streamer
+						A reference to the texture streamer to move.
+		 */
+		TextureStreamer(TextureStreamer&& streamer) = delete;
+
+		/**
+		 Destructs this texture streamer.
+		 */
+		~TextureStreamer();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given texture streamer to this texture streamer.
+
+		 @param[in]		streamer
+						A reference to the texture streamer to copy.
+		 @return		A reference to the copy of the given texture streamer
+						(i.e. this texture streamer).
+		 */
+		TextureStreamer& operator=(const TextureStreamer& streamer) = delete;
+
+		/**
+		 Moves the given texture streamer to this texture streamer.
+
+		 @param[in]		streamer
+						A reference to the texture streamer to move.
+		 @return		A reference to the moved texture streamer (i.e. this
+						texture streamer).
+		 */
+		TextureStreamer& operator=(TextureStreamer&& streamer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Registers the given texture.
+
+		 @param[in,out]	texture
+						A reference to the texture. The texture must unregister
+						itself before it is destructed.
+		 @param[in]		desc
+						A reference to the texture descriptor of the
+						(complete) texture.
+		 @param[in]		resident_mip_level
+						The most detailed resident mip level of the texture.
+		 @throws		Exception
+						Failed to register the texture.
+		 */
+		void Register(Texture& texture,
+					  const TextureDescriptor& desc,
+					  U32 resident_mip_level);
+
+		/**
+		 Unregisters the given texture. Pending requests of the texture are
+		 discarded.
+
+		 @param[in]		texture
+						A reference to the texture.
+		 */
+		void Unregister(const Texture& texture) noexcept;
+
+		/**
+		 Reports the on-screen size of the given texture for the current
+		 frame. Unregistered textures are ignored.
+
+		 @param[in]		texture
+						A reference to the texture.
+		 @param[in]		screen_size
+						The on-screen size (in pixels).
+		 */
+		void SetScreenSize(const Texture& texture, F32 screen_size) noexcept;
+
+		/**
+		 Updates this texture streamer (i.e. swaps in the mip levels of all
+		 completed requests and issues new requests based on the on-screen
+		 sizes reported since the previous update).
+		 */
+		void Update();
+
+		/**
+		 Returns the memory usage (in bytes) of all streamed textures of this
+		 texture streamer.
+
+		 @return		The memory usage of this texture streamer.
+		 */
+		[[nodiscard]]
+		std::size_t GetMemoryUsage() const noexcept;
+
+		/**
+		 Sets the memory budget (in bytes) of all streamed textures of this
+		 texture streamer to the given memory budget.
+
+		 @param[in]		memory_budget
+						The memory budget.
+		 */
+		void SetMemoryBudget(std::size_t memory_budget) noexcept;
+
+		/**
+		 Returns the number of pending requests of this texture streamer.
+
+		 @return		The number of pending requests of this texture
+						streamer.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfPendingRequests() const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of streamed texture slots.
+		 */
+		struct Slot {
+
+		public:
+
+			/**
+			 A pointer to the texture of this slot.
+			 */
+			Texture* m_texture = nullptr;
+
+			/**
+			 The serial number of this slot (to detect reuse).
+			 */
+			U64 m_serial = 0u;
+		};
+
+		/**
+		 A struct of completed requests.
+		 */
+		struct Completion {
+
+		public:
+
+			/**
+			 The completed request.
+			 */
+			TextureStreamingRequest m_request;
+
+			/**
+			 The serial number of the slot of the completed request.
+			 */
+			U64 m_serial = 0u;
+
+			/**
+			 A pointer to the shader resource view of the completed request.
+			 If @c nullptr, the request failed.
+			 */
+			ComPtr< ID3D11ShaderResourceView > m_texture_srv;
+
+			/**
+			 The memory usage (in bytes) of the completed request.
+			 */
+			std::size_t m_memory_usage = 0u;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Streams the given request on the calling thread.
+
+		 @param[in]		request
+						A reference to the request.
+		 @param[in]		serial
+						The serial number of the slot of the request.
+		 @param[in]		path
+						A reference to the path of the texture.
+		 */
+		void Stream(const TextureStreamingRequest& request,
+					U64 serial,
+					const std::filesystem::path& path) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the device of this texture streamer.
+		 */
+		ID3D11Device& m_device;
+
+		/**
+		 A reference to the thread pool of this texture streamer.
+		 */
+		ThreadPool& m_thread_pool;
+
+		/**
+		 The scheduler of this texture streamer.
+		 */
+		TextureStreamingScheduler m_scheduler;
+
+		/**
+		 The slots of this texture streamer (indexed by the indices of the
+		 scheduler).
+		 */
+		std::vector< Slot > m_slots;
+
+		/**
+		 A map containing the scheduler index of each streamed texture of
+		 this texture streamer.
+		 */
+		std::unordered_map< const Texture*, std::size_t > m_indices;
+
+		/**
+		 The completed requests of this texture streamer.
+		 */
+		std::vector< Completion > m_completions;
+
+		/**
+		 The next serial number of this texture streamer.
+		 */
+		U64 m_serial;
+
+		/**
+		 The mutex for accessing the member variables of this texture
+		 streamer.
+		 */
+		mutable std::mutex m_mutex;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,242 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/texture/texture_streaming_scheduler.hpp"
+#include "exception/exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	TextureStreamingScheduler
+		::TextureStreamingScheduler(std::size_t memory_budget) noexcept
+		: m_entries(),
+		m_free_indices(),
+		m_nb_pending_requests(0u),
+		m_memory_usage(0u),
+		m_memory_budget(memory_budget) {}
+
+	TextureStreamingScheduler::TextureStreamingScheduler(
+		TextureStreamingScheduler&& scheduler) noexcept = default;
+
+	TextureStreamingScheduler::~TextureStreamingScheduler() = default;
+
+	TextureStreamingScheduler& TextureStreamingScheduler
+		::operator=(TextureStreamingScheduler&& scheduler) noexcept = default;
+
+	std::size_t TextureStreamingScheduler
+		::Register(const std::vector< std::size_t >& mip_level_sizes,
+				   U32 size,
+				   U32 resident_mip_level) {
+
+		ThrowIfFailed(!mip_level_sizes.empty() && 0u != size,
+					  "Invalid streamed texture: {} mip levels, size {}.",
+					  mip_level_sizes.size(), size);
+
+		const auto nb_mip_levels = static_cast< U32 >(mip_level_sizes.size());
+
+		Entry entry;
+
+		// Compute the memory usage of the mip chain starting at each mip level.
+		entry.m_mip_chain_sizes.assign(nb_mip_levels + 1u, 0u);
+		for (auto mip = nb_mip_levels; 0u < mip; --mip) {
+			entry.m_mip_chain_sizes[mip - 1u]
+				= entry.m_mip_chain_sizes[mip] + mip_level_sizes[mip - 1u];
+		}
+
+		entry.m_size               = size;
+		entry.m_tail_mip_level     = std::min(resident_mip_level,
+											  nb_mip_levels - 1u);
+		entry.m_resident_mip_level = entry.m_tail_mip_level;
+		entry.m_used               = true;
+
+		m_memory_usage += entry.m_mip_chain_sizes[entry.m_resident_mip_level];
+
+		if (m_free_indices.empty()) {
+			m_entries.push_back(std::move(entry));
+			return m_entries.size() - 1u;
+		}
+
+		const auto index = m_free_indices.back();
+		m_free_indices.pop_back();
+		m_entries[index] = std::move(entry);
+		return index;
+	}
+
+	void TextureStreamingScheduler::Unregister(std::size_t index) noexcept {
+		auto& entry = m_entries[index];
+
+		m_memory_usage -= entry.m_mip_chain_sizes[entry.m_resident_mip_level];
+		if (s_no_mip_level != entry.m_pending_mip_level) {
+			if (entry.m_pending_mip_level < entry.m_resident_mip_level) {
+				// Release the reservation of the pending request.
+				m_memory_usage
+					-= entry.m_mip_chain_sizes[entry.m_pending_mip_level]
+					 - entry.m_mip_chain_sizes[entry.m_resident_mip_level];
+			}
+			--m_nb_pending_requests;
+		}
+
+		entry = Entry();
+		m_free_indices.push_back(index);
+	}
+
+	void TextureStreamingScheduler::SetScreenSize(std::size_t index,
+												  F32 screen_size) noexcept {
+		auto& entry = m_entries[index];
+		entry.m_screen_size = std::max(entry.m_screen_size, screen_size);
+	}
+
+	[[nodiscard]]
+	std::vector< TextureStreamingRequest >
+		TextureStreamingScheduler::Schedule(std::size_t max_nb_requests) {
+
+		// Collect the textures with too few (streaming in) and too many
+		// (streaming out) resident mip levels.
+		std::vector< std::size_t > stream_in;
+		std::vector< std::size_t > stream_out;
+		for (std::size_t i = 0u; i < m_entries.size(); ++i) {
+			const auto& entry = m_entries[i];
+			if (!entry.m_used || entry.m_failed
+				|| s_no_mip_level != entry.m_pending_mip_level) {
+				continue;
+			}
+
+			const auto desired_mip_level = GetDesiredMipLevel(entry);
+			if (desired_mip_level < entry.m_resident_mip_level) {
+				stream_in.push_back(i);
+			}
+			else if (desired_mip_level > entry.m_resident_mip_level) {
+				stream_out.push_back(i);
+			}
+		}
+
+		// Stream in the largest deficits first, and stream out the smallest
+		// deficits first.
+		const auto compare = [this](std::size_t lhs, std::size_t rhs) noexcept {
+			return GetPriority(m_entries[lhs]) > GetPriority(m_entries[rhs]);
+		};
+		std::stable_sort(stream_in.begin(), stream_in.end(), compare);
+		std::stable_sort(stream_out.rbegin(), stream_out.rend(), compare);
+
+		std::vector< TextureStreamingRequest > requests;
+		auto out_it = stream_out.cbegin();
+
+		for (const auto index : stream_in) {
+			if (max_nb_requests <= requests.size()) {
+				break;
+			}
+
+			auto& entry = m_entries[index];
+			const auto mip_level = entry.m_resident_mip_level - 1u;
+			const auto cost = entry.m_mip_chain_sizes[mip_level]
+				            - entry.m_mip_chain_sizes[entry.m_resident_mip_level];
+
+			if (m_memory_budget < m_memory_usage + cost) {
+				// Stream out textures to make room. The memory is released
+				// once the stream-out requests complete.
+				for (; out_it != stream_out.cend()
+					   && max_nb_requests > requests.size(); ++out_it) {
+
+					auto& out_entry = m_entries[*out_it];
+					out_entry.m_pending_mip_level = GetDesiredMipLevel(out_entry);
+					requests.push_back({ *out_it, out_entry.m_pending_mip_level });
+					++m_nb_pending_requests;
+				}
+				break;
+			}
+
+			// Reserve the memory of the requested mip level.
+			m_memory_usage += cost;
+			entry.m_pending_mip_level = mip_level;
+			requests.push_back({ index, mip_level });
+			++m_nb_pending_requests;
+		}
+
+		// Reset the on-screen sizes.
+		for (auto& entry : m_entries) {
+			entry.m_screen_size = 0.0f;
+		}
+
+		return requests;
+	}
+
+	void TextureStreamingScheduler
+		::OnCompleted(const TextureStreamingRequest& request) noexcept {
+
+		auto& entry = m_entries[request.m_index];
+		if (!entry.m_used || request.m_mip_level != entry.m_pending_mip_level) {
+			return;
+		}
+
+		if (request.m_mip_level > entry.m_resident_mip_level) {
+			// Release the memory of the streamed out mip levels.
+			m_memory_usage
+				-= entry.m_mip_chain_sizes[entry.m_resident_mip_level]
+				 - entry.m_mip_chain_sizes[request.m_mip_level];
+		}
+
+		entry.m_resident_mip_level = request.m_mip_level;
+		entry.m_pending_mip_level  = s_no_mip_level;
+		--m_nb_pending_requests;
+	}
+
+	void TextureStreamingScheduler
+		::OnFailed(const TextureStreamingRequest& request) noexcept {
+
+		auto& entry = m_entries[request.m_index];
+		if (!entry.m_used || request.m_mip_level != entry.m_pending_mip_level) {
+			return;
+		}
+
+		if (request.m_mip_level < entry.m_resident_mip_level) {
+			// Release the reservation of the streamed in mip levels.
+			m_memory_usage
+				-= entry.m_mip_chain_sizes[request.m_mip_level]
+				 - entry.m_mip_chain_sizes[entry.m_resident_mip_level];
+		}
+
+		// Never stream this texture again.
+		entry.m_tail_mip_level    = entry.m_resident_mip_level;
+		entry.m_failed            = true;
+		entry.m_pending_mip_level = s_no_mip_level;
+		--m_nb_pending_requests;
+	}
+
+	[[nodiscard]]
+	U32 TextureStreamingScheduler::GetDesiredMipLevel(const Entry& entry) noexcept {
+		if (0.0f >= entry.m_screen_size) {
+			return entry.m_tail_mip_level;
+		}
+
+		// One texel per pixel.
+		const auto ratio = static_cast< F32 >(entry.m_size) / entry.m_screen_size;
+		if (1.0f >= ratio) {
+			return 0u;
+		}
+
+		const auto mip_level = static_cast< U32 >(std::floor(std::log2(ratio)));
+		return std::min(mip_level, entry.m_tail_mip_level);
+	}
+
+	[[nodiscard]]
+	F32 TextureStreamingScheduler::GetPriority(const Entry& entry) noexcept {
+		const auto size = std::max(entry.m_size >> entry.m_resident_mip_level, 1u);
+		return entry.m_screen_size / static_cast< F32 >(size);
+	}
+}
\ No newline at end of file
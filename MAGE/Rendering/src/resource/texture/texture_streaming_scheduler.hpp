@@ -0,0 +1,422 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// TextureStreamingRequest
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of texture streaming requests.
+	 */
+	struct TextureStreamingRequest {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The index of the streamed texture of this texture streaming request.
+		 */
+		std::size_t m_index = 0u;
+
+		/**
+		 The requested most detailed resident mip level of this texture
+		 streaming request.
+		 */
+		U32 m_mip_level = 0u;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// TextureStreamingScheduler
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of texture streaming schedulers.
+
+	 A texture streaming scheduler keeps track of the resident mip level of
+	 each streamed texture, and decides which mip levels to stream in or out
+	 based on the on-screen size of the streamed textures and a global memory
+	 budget. Textures are refined one mip level at a time, largest on-screen
+	 texel deficit first.
+
+	 Texture streaming schedulers are not thread-safe, do not perform any I/O
+	 and do not depend on the texture format (i.e. only the memory usage of
+	 each mip level is known).
+	 */
+	class TextureStreamingScheduler {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a texture streaming scheduler.
+
+		 @param[in]		memory_budget
+						The memory budget (in bytes) of all resident mip
+						levels. The least detailed mip levels, which are
+						resident at registration, are always kept.
+		 */
+		explicit TextureStreamingScheduler(std::size_t memory_budget) noexcept;
+
+		/**
+		 Constructs a texture streaming scheduler from the given texture
+		 streaming scheduler.
+
+		 @param[in]		scheduler
+						A reference to the texture streaming scheduler to copy.
+		 */
+		TextureStreamingScheduler(
+			const TextureStreamingScheduler& scheduler) = delete;
+
+		/**
+		 Constructs a texture streaming scheduler by moving the given texture
+		 streaming scheduler.
+
+		 @param[in]		scheduler
+						A reference to the texture streaming scheduler to move.
+		 */
+		TextureStreamingScheduler(
+			TextureStreamingScheduler&& scheduler) noexcept;
+
+		/**
+		 Destructs this texture streaming scheduler.
+		 */
+		~TextureStreamingScheduler();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given texture streaming scheduler to this texture
+		 streaming scheduler.
+
+		 @param[in]		scheduler
+						A reference to the texture streaming scheduler to copy.
+		 @return		A reference to the copy of the given texture streaming
+						scheduler (i.e. this texture streaming scheduler).
+		 */
+		TextureStreamingScheduler& operator=(
+			const TextureStreamingScheduler& scheduler) = delete;
+
+		/**
+		 Moves the given texture streaming scheduler to this texture streaming
+		 scheduler.
+
+		 @param[in]		scheduler
+						A reference to the texture streaming scheduler to move.
+		 @return		A reference to the moved texture streaming scheduler
+						(i.e. this texture streaming scheduler).
+		 */
+		TextureStreamingScheduler& operator=(
+			TextureStreamingScheduler&& scheduler) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Registers a streamed texture.
+
+		 @param[in]		mip_level_sizes
+						A reference to the memory usage (in bytes) of each mip
+						level of the (complete) texture (see
+						@c ComputeMipLevelSizes).
+		 @param[in]		size
+						The size (in pixels) of the largest dimension of the
+						most detailed mip level of the texture.
+		 @param[in]		resident_mip_level
+						The most detailed resident mip level. This mip level
+						and all less detailed mip levels are never streamed
+						out.
+		 @return		The index of the streamed texture.
+		 @throws		Exception
+						The given texture has no mip levels or has a size of
+						zero.
+		 */
+		std::size_t Register(const std::vector< std::size_t >& mip_level_sizes,
+							 U32 size,
+							 U32 resident_mip_level);
+
+		/**
+		 Unregisters the streamed texture at the given index. Pending requests
+		 of the streamed texture are discarded.
+
+		 @param[in]		index
+						The index of the streamed texture.
+		 */
+		void Unregister(std::size_t index) noexcept;
+
+		/**
+		 Reports the on-screen size of the streamed texture at the given index
+		 for the current frame. The maximum of all reported sizes is used.
+
+		 @param[in]		index
+						The index of the streamed texture.
+		 @param[in]		screen_size
+						The on-screen size (in pixels).
+		 */
+		void SetScreenSize(std::size_t index, F32 screen_size) noexcept;
+
+		/**
+		 Schedules the next streaming requests, based on the on-screen sizes
+		 reported since the previous call. The reported on-screen sizes are
+		 reset afterwards.
+
+		 @param[in]		max_nb_requests
+						The maximum number of requests.
+		 @return		The scheduled requests. A request is pending until
+						@c OnCompleted or @c OnFailed is called.
+		 */
+		[[nodiscard]]
+		std::vector< TextureStreamingRequest >
+			Schedule(std::size_t max_nb_requests);
+
+		/**
+		 Notifies this texture streaming scheduler that the given request has
+		 completed successfully.
+
+		 @param[in]		request
+						A reference to the request.
+		 */
+		void OnCompleted(const TextureStreamingRequest& request) noexcept;
+
+		/**
+		 Notifies this texture streaming scheduler that the given request has
+		 failed.
+
+		 @param[in]		request
+						A reference to the request.
+		 */
+		void OnFailed(const TextureStreamingRequest& request) noexcept;
+
+		/**
+		 Returns the most detailed resident mip level of the streamed texture
+		 at the given index.
+
+		 @param[in]		index
+						The index of the streamed texture.
+		 @return		The most detailed resident mip level of the streamed
+						texture at the given index.
+		 */
+		[[nodiscard]]
+		U32 GetResidentMipLevel(std::size_t index) const noexcept {
+			return m_entries[index].m_resident_mip_level;
+		}
+
+		/**
+		 Returns the number of streamed textures of this texture streaming
+		 scheduler.
+
+		 @return		The number of streamed textures of this texture
+						streaming scheduler.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfTextures() const noexcept {
+			return m_entries.size() - m_free_indices.size();
+		}
+
+		/**
+		 Returns the number of pending requests of this texture streaming
+		 scheduler.
+
+		 @return		The number of pending requests of this texture
+						streaming scheduler.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfPendingRequests() const noexcept {
+			return m_nb_pending_requests;
+		}
+
+		/**
+		 Returns the memory usage (in bytes) of all resident (and pending)
+		 mip levels of this texture streaming scheduler.
+
+		 @return		The memory usage of this texture streaming scheduler.
+		 */
+		[[nodiscard]]
+		std::size_t GetMemoryUsage() const noexcept {
+			return m_memory_usage;
+		}
+
+		/**
+		 Returns the memory budget (in bytes) of this texture streaming
+		 scheduler.
+
+		 @return		The memory budget of this texture streaming scheduler.
+		 */
+		[[nodiscard]]
+		std::size_t GetMemoryBudget() const noexcept {
+			return m_memory_budget;
+		}
+
+		/**
+		 Sets the memory budget (in bytes) of this texture streaming scheduler
+		 to the given memory budget.
+
+		 @param[in]		memory_budget
+						The memory budget.
+		 */
+		void SetMemoryBudget(std::size_t memory_budget) noexcept {
+			m_memory_budget = memory_budget;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of streamed textures.
+		 */
+		struct Entry {
+
+		public:
+
+			/**
+			 The memory usage (in bytes) of the mip chain starting at each mip
+			 level of this streamed texture.
+			 */
+			std::vector< std::size_t > m_mip_chain_sizes;
+
+			/**
+			 The size (in pixels) of the most detailed mip level of this
+			 streamed texture.
+			 */
+			U32 m_size = 0u;
+
+			/**
+			 The least detailed mip level which can be streamed out of this
+			 streamed texture.
+			 */
+			U32 m_tail_mip_level = 0u;
+
+			/**
+			 The most detailed resident mip level of this streamed texture.
+			 */
+			U32 m_resident_mip_level = 0u;
+
+			/**
+			 The pending mip level of this streamed texture.
+			 */
+			U32 m_pending_mip_level = s_no_mip_level;
+
+			/**
+			 The on-screen size (in pixels) of this streamed texture.
+			 */
+			F32 m_screen_size = 0.0f;
+
+			/**
+			 A flag indicating whether streaming this streamed texture failed.
+			 */
+			bool m_failed = false;
+
+			/**
+			 A flag indicating whether this entry is in use.
+			 */
+			bool m_used = false;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The mip level value indicating no mip level.
+		 */
+		static constexpr U32 s_no_mip_level = ~0u;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the desired most detailed mip level of the given streamed
+		 texture, based on its on-screen size.
+
+		 @param[in]		entry
+						A reference to the streamed texture.
+		 @return		The desired most detailed mip level of the given
+						streamed texture.
+		 */
+		[[nodiscard]]
+		static U32 GetDesiredMipLevel(const Entry& entry) noexcept;
+
+		/**
+		 Returns the priority of the given streamed texture (i.e. the ratio
+		 of its on-screen size to the size of its most detailed resident mip
+		 level).
+
+		 @param[in]		entry
+						A reference to the streamed texture.
+		 @return		The priority of the given streamed texture.
+		 */
+		[[nodiscard]]
+		static F32 GetPriority(const Entry& entry) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The streamed textures of this texture streaming scheduler.
+		 */
+		std::vector< Entry > m_entries;
+
+		/**
+		 The indices of the unused entries of this texture streaming
+		 scheduler.
+		 */
+		std::vector< std::size_t > m_free_indices;
+
+		/**
+		 The number of pending requests of this texture streaming scheduler.
+		 */
+		std::size_t m_nb_pending_requests;
+
+		/**
+		 The memory usage (in bytes) of all resident (and pending) mip levels
+		 of this texture streaming scheduler.
+		 */
+		std::size_t m_memory_usage;
+
+		/**
+		 The memory budget (in bytes) of this texture streaming scheduler.
+		 */
+		std::size_t m_memory_budget;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\node.hpp"
-#include "scene\camera\camera.hpp"
+#include "scene/node.hpp"
+#include "scene/camera/camera.hpp"
 
 #pragma endregion
 
@@ -52,10 +52,21 @@ namespace mage::rendering {
 
 	Camera::~Camera() = default;
 
+	Camera& Camera::operator=(const Camera& camera) noexcept {
+		Component::operator=(camera);
+
+		m_clipping_planes = camera.m_clipping_planes;
+		m_lens            = camera.m_lens;
+		m_viewport        = camera.m_viewport;
+		m_settings        = camera.m_settings;
+		return *this;
+	}
+
 	Camera& Camera::operator=(Camera&& camera) noexcept = default;
 
 	void Camera::UpdateBuffer(ID3D11DeviceContext& device_context,
-							  AntiAliasing aa) const {
+							  AntiAliasing aa,
+							  F32 resolution_scale) const {
 		Assert(HasOwner());
 
 		CameraBuffer buffer;
@@ -74,23 +85,31 @@ namespace mage::rendering {
 			buffer.m_camera_to_world         = XMMatrixTranspose(camera_to_world);
 		}
 
+		const auto viewport = Viewport(m_viewport, resolution_scale);
+
 		// Viewport
 		{
-			buffer.m_viewport_top_left       = static_cast< F32x2 >(m_viewport.GetTopLeft());
-			buffer.m_viewport_resolution     = m_viewport.GetSize();
+			buffer.m_viewport_top_left       = static_cast< F32x2 >(viewport.GetTopLeft());
+			buffer.m_viewport_resolution     = viewport.GetSize();
 			buffer.m_viewport_inv_resolution = XMStore< F32x2 >(
 				XMVectorReciprocal(XMLoad(buffer.m_viewport_resolution)));
 		}
 
 		// SS Viewport
 		{
-			const auto ss_viewport              = Viewport(m_viewport, aa);
+			const auto ss_viewport              = Viewport(viewport, aa);
 			buffer.m_ss_viewport_top_left       = static_cast< F32x2 >(ss_viewport.GetTopLeft());
 			buffer.m_ss_viewport_resolution     = ss_viewport.GetSize();
 			buffer.m_ss_viewport_inv_resolution = XMStore< F32x2 >(
 				XMVectorReciprocal(XMLoad(buffer.m_ss_viewport_resolution)));
 		}
 
+		// Output Viewport
+		{
+			buffer.m_output_viewport_top_left   = static_cast< F32x2 >(m_viewport.GetTopLeft());
+			buffer.m_output_viewport_resolution = m_viewport.GetSize();
+		}
+
 		// Fog and Sky
 		{
 			const auto& fog           = m_settings.GetFog();
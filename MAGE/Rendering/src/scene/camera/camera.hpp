@@ -5,15 +5,15 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\component.hpp"
-#include "scene\camera\viewport.hpp"
-#include "renderer\configuration.hpp"
-#include "renderer\buffer\constant_buffer.hpp"
-#include "renderer\buffer\scene_buffer.hpp"
-#include "resource\texture\texture.hpp"
-#include "transform\transform.hpp"
-#include "geometry\geometry.hpp"
-#include "spectrum\color.hpp"
+#include "scene/component.hpp"
+#include "scene/camera/viewport.hpp"
+#include "renderer/configuration.hpp"
+#include "renderer/buffer/constant_buffer.hpp"
+#include "renderer/buffer/scene_buffer.hpp"
+#include "resource/texture/texture.hpp"
+#include "transform/transform.hpp"
+#include "geometry/geometry.hpp"
+#include "spectrum/color.hpp"
 
 #pragma endregion
 
@@ -1001,14 +1001,15 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Copies the given camera to this camera.
+		 Copies the given camera to this camera. The buffer of this camera is
+		 preserved.
 
 		 @param[in]		camera
 						A reference to the camera to copy.
 		 @return		A reference to the copy of the given camera (i.e. this
 						camera).
 		 */
-		Camera& operator=(const Camera& camera) = delete;
+		Camera& operator=(const Camera& camera) noexcept;
 
 		/**
 		 Moves the given camera to this camera.
@@ -1146,9 +1147,13 @@ namespace mage::rendering {
 						A reference to the device context.
 		 @param[in]		aa
 						The anti-aliasing mode.
+		 @param[in]		resolution_scale
+						The resolution scale of the rendered viewport of this
+						camera.
 		 */
 		void UpdateBuffer(ID3D11DeviceContext& device_context,
-						  AntiAliasing aa) const;
+						  AntiAliasing aa,
+						  F32 resolution_scale) const;
 
 		/**
 		 Binds the buffer of this camera to the given pipeline stage.
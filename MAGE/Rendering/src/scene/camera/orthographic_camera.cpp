@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\camera\orthographic_camera.hpp"
+#include "scene/camera/orthographic_camera.hpp"
 
 #pragma endregion
 
@@ -21,6 +21,9 @@ namespace mage::rendering {
 
 	OrthographicCamera::~OrthographicCamera() = default;
 
+	OrthographicCamera& OrthographicCamera
+		::operator=(const OrthographicCamera& camera) noexcept = default;
+
 	OrthographicCamera& OrthographicCamera
 		::operator=(OrthographicCamera&& camera) noexcept = default;
 }
\ No newline at end of file
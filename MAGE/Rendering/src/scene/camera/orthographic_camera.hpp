@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\camera\camera.hpp"
+#include "scene/camera/camera.hpp"
 
 #pragma endregion
 
@@ -71,7 +71,7 @@ namespace mage::rendering {
 		 @return		A reference to the copy of the given orthographic
 						camera (i.e. this orthographic camera).
 		 */
-		OrthographicCamera& operator=(const OrthographicCamera& camera) = delete;
+		OrthographicCamera& operator=(const OrthographicCamera& camera) noexcept;
 
 		/**
 		 Moves the given orthographic camera to this orthographic camera.
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\camera\perspective_camera.hpp"
+#include "scene/camera/perspective_camera.hpp"
 
 #pragma endregion
 
@@ -22,6 +22,9 @@ namespace mage::rendering {
 
 	PerspectiveCamera::~PerspectiveCamera() = default;
 
+	PerspectiveCamera& PerspectiveCamera
+		::operator=(const PerspectiveCamera& camera) noexcept = default;
+
 	PerspectiveCamera& PerspectiveCamera
 		::operator=(PerspectiveCamera&& camera) noexcept = default;
 }
\ No newline at end of file
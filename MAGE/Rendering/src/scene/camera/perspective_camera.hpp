@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\camera\camera.hpp"
+#include "scene/camera/camera.hpp"
 
 #pragma endregion
 
@@ -144,7 +144,7 @@ namespace mage::rendering {
 		 @return		A reference to the copy of the given perspective
 						camera (i.e. this perspective camera).
 		 */
-		PerspectiveCamera& operator=(const PerspectiveCamera& camera) = delete;
+		PerspectiveCamera& operator=(const PerspectiveCamera& camera) noexcept;
 
 		/**
 		 Moves the given perspective camera to this perspective camera.
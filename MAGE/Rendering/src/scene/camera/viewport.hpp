@@ -6,8 +6,18 @@
 #pragma region
 
 #include "math.hpp"
-#include "renderer\configuration.hpp"
-#include "renderer\pipeline.hpp"
+#include "renderer/configuration.hpp"
+#include "renderer/pipeline.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
 
 #pragma endregion
 
@@ -90,6 +100,25 @@ namespace mage::rendering {
 			m_viewport.Height   *= multiplier;
 		}
 
+		/**
+		 Constructs a viewport by scaling the given viewport with the given
+		 resolution scale. The scaled viewport is aligned to whole pixels and
+		 covers at least one pixel.
+
+		 @param[in]		viewport
+						A reference to the viewport to scale.
+		 @param[in]		scale
+						The resolution scale.
+		 */
+		explicit Viewport(const Viewport& viewport, F32 scale) noexcept
+			: Viewport(viewport) {
+
+			m_viewport.TopLeftX = std::floor(m_viewport.TopLeftX * scale);
+			m_viewport.TopLeftY = std::floor(m_viewport.TopLeftY * scale);
+			m_viewport.Width    = std::max(1.0f, std::floor(m_viewport.Width  * scale));
+			m_viewport.Height   = std::max(1.0f, std::floor(m_viewport.Height * scale));
+		}
+
 		~Viewport() = default;
 
 		//---------------------------------------------------------------------
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\light\ambient_light.hpp"
+#include "scene/light/ambient_light.hpp"
 
 #pragma endregion
 
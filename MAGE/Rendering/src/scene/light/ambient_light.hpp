@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\component.hpp"
-#include "spectrum\spectrum.hpp"
+#include "scene/component.hpp"
+#include "spectrum/spectrum.hpp"
 
 #pragma endregion
 
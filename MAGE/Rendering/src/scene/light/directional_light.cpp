@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\light\directional_light.hpp"
-#include "scene\node.hpp"
+#include "scene/light/directional_light.hpp"
+#include "scene/node.hpp"
 
 #pragma endregion
 
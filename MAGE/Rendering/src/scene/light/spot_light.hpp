@@ -5,9 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\component.hpp"
-#include "spectrum\spectrum.hpp"
-#include "geometry\bounding_volume.hpp"
+#include "scene/component.hpp"
+#include "spectrum/spectrum.hpp"
+#include "geometry/bounding_volume.hpp"
 
 #pragma endregion
 
@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\node.hpp"
-#include "scene\model\model.hpp"
+#include "scene/node.hpp"
+#include "scene/model/model.hpp"
 
 #pragma endregion
 
@@ -21,6 +21,7 @@ namespace mage::rendering {
 		m_mesh(),
 		m_start_index(0u),
 		m_nb_indices(0u),
+		m_clusters(),
 		m_texture_transform(),
 		m_material(),
 		m_light_occlusion(true) {}
@@ -29,6 +30,21 @@ namespace mage::rendering {
 
 	Model::~Model() = default;
 
+	Model& Model::operator=(const Model& model) {
+		Component::operator=(model);
+
+		m_aabb              = model.m_aabb;
+		m_sphere            = model.m_sphere;
+		m_mesh              = model.m_mesh;
+		m_start_index       = model.m_start_index;
+		m_nb_indices        = model.m_nb_indices;
+		m_clusters          = model.m_clusters;
+		m_texture_transform = model.m_texture_transform;
+		m_material          = model.m_material;
+		m_light_occlusion   = model.m_light_occlusion;
+		return *this;
+	}
+
 	Model& Model::operator=(Model&& model) noexcept = default;
 
 	void Model::SetMesh(SharedPtr< const Mesh > mesh,
@@ -42,6 +58,22 @@ namespace mage::rendering {
 		m_mesh        = mesh;
 		m_start_index = start_index;
 		m_nb_indices  = nb_indices;
+		m_clusters.Set({});
+	}
+
+	void XM_CALLCONV Model::Draw(ID3D11DeviceContext& device_context,
+								 FXMMATRIX object_to_projection,
+								 bool cone_culling) const noexcept {
+		if (GetClusters().empty()) {
+			Draw(device_context);
+			return;
+		}
+
+		ForEachVisibleIndexRange(object_to_projection, GetClusters(), cone_culling,
+			[this, &device_context](std::size_t start_index,
+									std::size_t nb_indices) {
+				m_mesh->Draw(device_context, start_index, nb_indices);
+			});
 	}
 
 	void Model::UpdateBuffer(ID3D11DeviceContext& device_context) const {
@@ -58,11 +90,12 @@ namespace mage::rendering {
 		buffer.m_normal_to_world      = world_to_object;
 		buffer.m_texture_transform    = XMMatrixTranspose(texture_transform);
 		// Material
-		buffer.m_base_color           = m_material.IsEmissive()
-			                          ? m_material.GetRadianceSpectrum()
-			                          : m_material.GetBaseColor();
-		buffer.m_roughness            = m_material.GetRoughness();
-		buffer.m_metalness            = m_material.GetMetalness();
+		const auto& material          = GetMaterial();
+		buffer.m_base_color           = material.IsEmissive()
+			                          ? material.GetRadianceSpectrum()
+			                          : material.GetBaseColor();
+		buffer.m_roughness            = material.GetRoughness();
+		buffer.m_metalness            = material.GetMetalness();
 
 		// Update the model buffer.
 		m_buffer.UpdateData(device_context, buffer);
@@ -5,13 +5,15 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\component.hpp"
-#include "resource\mesh\mesh.hpp"
-#include "resource\model\material.hpp"
-#include "geometry\bounding_volume.hpp"
-#include "transform\transform.hpp"
-#include "renderer\buffer\constant_buffer.hpp"
-#include "renderer\buffer\scene_buffer.hpp"
+#include "scene/component.hpp"
+#include "resource/mesh/mesh.hpp"
+#include "resource/model/material.hpp"
+#include "resource/model/model_cluster.hpp"
+#include "geometry/bounding_volume.hpp"
+#include "transform/transform.hpp"
+#include "renderer/buffer/constant_buffer.hpp"
+#include "renderer/buffer/scene_buffer.hpp"
+#include "type/versioned.hpp"
 
 #pragma endregion
 
@@ -68,14 +70,17 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Copies the given model to this model.
+		 Copies the given model to this model. The buffer of this model is
+		 preserved. The model clusters and the material of the given model
+		 are only copied if they changed since their last copy to this
+		 model.
 
 		 @param[in]		model
 						A reference to the model to copy.
 		 @return		A reference to the copy of the given model (i.e. this
 						model).
 		 */
-		Model& operator=(const Model& model) = delete;
+		Model& operator=(const Model& model);
 
 		/**
 		 Moves the given model to this model.
@@ -110,6 +115,28 @@ namespace mage::rendering {
 					 const AABB& aabb,
 					 const BoundingSphere& bs) noexcept;
 
+		/**
+		 Sets the model clusters of this model to the given model clusters.
+
+		 @param[in]		clusters
+						A vector containing the model clusters covering the
+						index range of this model (or no model clusters).
+		 */
+		void SetClusters(AlignedVector< ModelCluster > clusters) noexcept {
+			m_clusters.Set(std::move(clusters));
+		}
+
+		/**
+		 Returns the model clusters of this model.
+
+		 @return		A reference to a vector containing the model clusters
+						of this model.
+		 */
+		[[nodiscard]]
+		const AlignedVector< ModelCluster >& GetClusters() const noexcept {
+			return m_clusters.Get();
+		}
+
 		/**
 		 Returns the AABB of this model.
 
@@ -185,6 +212,24 @@ namespace mage::rendering {
 			m_mesh->Draw(device_context, m_start_index, m_nb_indices);
 		}
 
+		/**
+		 Draws the model clusters of this model which are not culled.
+
+		 If this model has no model clusters, this model is drawn completely.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		object_to_projection
+						The object-to-projection transformation matrix.
+		 @param[in]		cone_culling
+						@c true if back facing model clusters need to be
+						culled (i.e. back face culling is enabled). @c false
+						otherwise.
+		 */
+		void XM_CALLCONV Draw(ID3D11DeviceContext& device_context,
+							  FXMMATRIX object_to_projection,
+							  bool cone_culling) const noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Methods: Appearance
 		//---------------------------------------------------------------------
@@ -210,13 +255,16 @@ namespace mage::rendering {
 		}
 
 		/**
-		 Returns the material of this model.
+		 Returns the material of this model. The material is copied again
+		 on the next copy of this model.
 
+		 @pre			The returned reference is not used to change the
+						material after this model has been copied.
 		 @return		A reference to the material of this model.
 		 */
 		[[nodiscard]]
 		Material& GetMaterial() noexcept {
-			return m_material;
+			return m_material.GetMutable();
 		}
 
 		/**
@@ -226,7 +274,7 @@ namespace mage::rendering {
 		 */
 		[[nodiscard]]
 		const Material& GetMaterial() const noexcept {
-			return m_material;
+			return m_material.Get();
 		}
 
 		//---------------------------------------------------------------------
@@ -347,6 +395,11 @@ namespace mage::rendering {
 		 */
 		std::size_t m_nb_indices;
 
+		/**
+		 A vector containing the model clusters of this model.
+		 */
+		Versioned< AlignedVector< ModelCluster > > m_clusters;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Appearance
 		//---------------------------------------------------------------------
@@ -359,7 +412,7 @@ namespace mage::rendering {
 		/**
 		 The material of this model.
 		 */
-		Material m_material;
+		Versioned< Material > m_material;
 
 		//---------------------------------------------------------------------
 		// Member Variables: Occlusion
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\rendering_world.hpp"
+#include "scene/rendering_world.hpp"
 
 #pragma endregion
 
@@ -12,6 +12,62 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	namespace {
+
+		/**
+		 Sets the given snapshot components to a snapshot of the active
+		 components of the given components.
+
+		 @tparam		ComponentT
+						The component type.
+		 @tparam		CreateT
+						The type of the component creation function.
+		 @param[in]		components
+						A reference to a vector containing the components.
+		 @param[in,out]	snapshots
+						A reference to a vector containing the snapshot
+						components.
+		 @param[in,out]	nodes
+						A reference to a vector containing the nodes owning
+						the snapshot components.
+		 @param[in]		create
+						The component creation function appending a snapshot
+						component.
+		 */
+		template< typename ComponentT, typename CreateT >
+		void SnapshotComponents(const AlignedVector< ComponentT >& components,
+								AlignedVector< ComponentT >& snapshots,
+								AlignedVector< Node >& nodes,
+								CreateT&& create) {
+			std::size_t index = 0u;
+			for (const auto& component : components) {
+				if (State::Active != component.GetState()) {
+					continue;
+				}
+
+				if (snapshots.size() == index) {
+					// Each snapshot component is owned by a dedicated node.
+					const auto node = AddElement(nodes);
+					node->Set(node);
+					node->Add(create());
+				}
+
+				auto& snapshot = snapshots[index];
+				snapshot = component;
+				if (component.HasOwner()) {
+					snapshot.GetOwner()->GetTransform().Snapshot(
+						component.GetOwner()->GetTransform());
+				}
+
+				++index;
+			}
+
+			for (; index < snapshots.size(); ++index) {
+				snapshots[index].SetState(State::Passive);
+			}
+		}
+	}
+
 	World::World(ID3D11Device& device,
 				 DisplayConfiguration& display_configuration,
 				 ResourceManager& resource_manager)
@@ -26,7 +82,8 @@ namespace mage::rendering {
 		m_spot_lights(),
 		m_models(),
 		m_sprite_images(),
-		m_sprite_texts() {}
+		m_sprite_texts(),
+		m_nodes() {}
 
 	World::World(World&& world) noexcept = default;
 
@@ -44,5 +101,27 @@ namespace mage::rendering {
 		m_models.clear();
 		m_sprite_images.clear();
 		m_sprite_texts.clear();
+		m_nodes.clear();
+	}
+
+	void World::Snapshot(const World& world) {
+		SnapshotComponents(world.m_perspective_cameras, m_perspective_cameras,
+						   m_nodes, [this]() { return Create< PerspectiveCamera >(); });
+		SnapshotComponents(world.m_orthographic_cameras, m_orthographic_cameras,
+						   m_nodes, [this]() { return Create< OrthographicCamera >(); });
+		SnapshotComponents(world.m_ambient_lights, m_ambient_lights,
+						   m_nodes, [this]() { return Create< AmbientLight >(); });
+		SnapshotComponents(world.m_directional_lights, m_directional_lights,
+						   m_nodes, [this]() { return Create< DirectionalLight >(); });
+		SnapshotComponents(world.m_omni_lights, m_omni_lights,
+						   m_nodes, [this]() { return Create< OmniLight >(); });
+		SnapshotComponents(world.m_spot_lights, m_spot_lights,
+						   m_nodes, [this]() { return Create< SpotLight >(); });
+		SnapshotComponents(world.m_models, m_models,
+						   m_nodes, [this]() { return Create< Model >(); });
+		SnapshotComponents(world.m_sprite_images, m_sprite_images,
+						   m_nodes, [this]() { return Create< SpriteImage >(); });
+		SnapshotComponents(world.m_sprite_texts, m_sprite_texts,
+						   m_nodes, [this]() { return Create< SpriteText >(); });
 	}
 }
\ No newline at end of file
@@ -5,18 +5,18 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "display\display_configuration.hpp"
-#include "resource\rendering_resource_manager.hpp"
-#include "scene\node.hpp"
-#include "scene\camera\orthographic_camera.hpp"
-#include "scene\camera\perspective_camera.hpp"
-#include "scene\light\ambient_light.hpp"
-#include "scene\light\directional_light.hpp"
-#include "scene\light\omni_light.hpp"
-#include "scene\light\spot_light.hpp"
-#include "scene\model\model.hpp"
-#include "scene\sprite\sprite_image.hpp"
-#include "scene\sprite\sprite_text.hpp"
+#include "display/display_configuration.hpp"
+#include "resource/rendering_resource_manager.hpp"
+#include "scene/node.hpp"
+#include "scene/camera/orthographic_camera.hpp"
+#include "scene/camera/perspective_camera.hpp"
+#include "scene/light/ambient_light.hpp"
+#include "scene/light/directional_light.hpp"
+#include "scene/light/omni_light.hpp"
+#include "scene/light/spot_light.hpp"
+#include "scene/model/model.hpp"
+#include "scene/sprite/sprite_image.hpp"
+#include "scene/sprite/sprite_text.hpp"
 
 #pragma endregion
 
@@ -116,6 +116,21 @@ namespace mage::rendering {
 		 */
 		void Clear() noexcept;
 
+		/**
+		 Sets the components of this world to a snapshot of the active
+		 components of the given world.
+
+		 The components of this world are reused across snapshots. Each
+		 component of this world is owned by a dedicated node of this world,
+		 whose transform is a snapshot of the transform of the owner of the
+		 corresponding component of the given world. The remaining components
+		 of this world are made passive.
+
+		 @param[in]		world
+						A reference to the world.
+		 */
+		void Snapshot(const World& world);
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -185,6 +200,12 @@ namespace mage::rendering {
 		 A vector containing the sprite texts of this world.
 		 */
 		AlignedVector< SpriteText > m_sprite_texts;
+
+		/**
+		 A vector containing the nodes owning the components of this world,
+		 if this world is a snapshot.
+		 */
+		AlignedVector< Node > m_nodes;
 	};
 }
 
@@ -193,6 +214,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\rendering_world.tpp"
+#include "scene/rendering_world.tpp"
 
 #pragma endregion
\ No newline at end of file
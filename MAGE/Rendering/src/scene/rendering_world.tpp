@@ -5,10 +5,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\scene_utils.hpp"
-#include "resource\font\sprite_font_factory.hpp"
-#include "resource\model\material_factory.hpp"
-#include "resource\texture\texture_factory.hpp"
+#include "scene/scene_utils.hpp"
+#include "resource/font/sprite_font_factory.hpp"
+#include "resource/model/material_factory.hpp"
+#include "resource/texture/texture_factory.hpp"
 
 #pragma endregion
 
@@ -0,0 +1,186 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "collection/vector.hpp"
+#include "type/versioned.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of layout caches (i.e. cached sprites which are only laid out
+	 again after the cache has been invalidated).
+
+	 Each invalidation updates the version of a layout cache (i.e. the
+	 version of the laid out state). A copy of a layout cache keeps its
+	 cached sprites if it already holds the version of the copied cache.
+
+	 Layout caches are device-independent.
+
+	 @tparam		SpriteT
+					The sprite type.
+	 */
+	template< typename SpriteT >
+	class LayoutCache {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an (invalid) layout cache.
+		 */
+		LayoutCache() = default;
+
+		/**
+		 Constructs an (invalid) layout cache from the given layout cache.
+		 The cached sprites and the version of the given layout cache are
+		 not copied.
+
+		 @param[in]		cache
+						A reference to the layout cache to copy.
+		 */
+		LayoutCache([[maybe_unused]] const LayoutCache& cache)
+			: m_sprites(),
+			m_valid(false),
+			m_version() {}
+
+		/**
+		 Constructs a layout cache by moving the given layout cache.
+
+		 @param[in]		cache
+						A reference to the layout cache to move.
+		 */
+		LayoutCache(LayoutCache&& cache) noexcept = default;
+
+		/**
+		 Destructs this layout cache.
+		 */
+		~LayoutCache() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given layout cache to this layout cache. The cached
+		 sprites of the given layout cache are not copied. This layout cache
+		 is invalidated, unless it already holds the version of the given
+		 layout cache.
+
+		 @param[in]		cache
+						A reference to the layout cache to copy.
+		 @return		A reference to the copy of the given layout cache
+						(i.e. this layout cache).
+		 */
+		LayoutCache& operator=(const LayoutCache& cache) noexcept {
+			if (m_version != cache.m_version) {
+				m_valid   = false;
+				m_version = cache.m_version;
+			}
+
+			return *this;
+		}
+
+		/**
+		 Moves the given layout cache to this layout cache.
+
+		 @param[in]		cache
+						A reference to the layout cache to move.
+		 @return		A reference to the moved layout cache (i.e. this
+						layout cache).
+		 */
+		LayoutCache& operator=(LayoutCache&& cache) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the sprites of this layout cache are valid.
+
+		 @return		@c true if the sprites of this layout cache are
+						valid. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsValid() const noexcept {
+			return m_valid;
+		}
+
+		/**
+		 Invalidates the sprites of this layout cache. The version of this
+		 layout cache is updated.
+		 */
+		void Invalidate() noexcept {
+			m_valid = false;
+			m_version.Update();
+		}
+
+		/**
+		 Returns the version of this layout cache.
+
+		 @return		A reference to the version of this layout cache.
+		 */
+		[[nodiscard]]
+		const Version& GetVersion() const noexcept {
+			return m_version;
+		}
+
+		/**
+		 Returns the sprites of this layout cache. The sprites are laid out
+		 again (with the given layout function) only if this layout cache is
+		 invalid.
+
+		 @tparam		LayoutT
+						The layout function type. The layout function must
+						accept @c AlignedVector< SpriteT >& values to which
+						the sprites are appended.
+		 @param[in]		layout
+						The layout function.
+		 @return		A reference to the vector containing the (valid)
+						sprites of this layout cache.
+		 */
+		template< typename LayoutT >
+		const AlignedVector< SpriteT >& Get(LayoutT&& layout) {
+			if (!m_valid) {
+				m_sprites.clear();
+				layout(m_sprites);
+				m_valid = true;
+			}
+
+			return m_sprites;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the cached sprites of this layout cache.
+		 */
+		AlignedVector< SpriteT > m_sprites;
+
+		/**
+		 A flag indicating whether the sprites of this layout cache are
+		 valid.
+		 */
+		bool m_valid = false;
+
+		/**
+		 The version of this layout cache.
+		 */
+		Version m_version;
+	};
+}
\ No newline at end of file
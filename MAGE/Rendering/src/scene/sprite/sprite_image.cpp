@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\sprite\sprite_image.hpp"
+#include "scene/sprite/sprite_image.hpp"
 
 #pragma endregion
 
@@ -33,8 +33,15 @@ namespace mage::rendering {
 		::operator=(SpriteImage&& sprite) noexcept = default;
 
 	void SpriteImage::Draw(SpriteBatch& sprite_batch) const {
+		if (!m_base_color_texture) {
+			return;
+		}
+
+		const auto texture_size = m_base_color_texture->GetSize();
+
 		if (HasMaximumBaseColorTextureRegion()) {
 			sprite_batch.Draw(GetBaseColorSRV(),
+				              texture_size,
 				              XMLoad(m_base_color),
 				              m_sprite_effects,
 				              m_sprite_transform,
@@ -42,10 +49,24 @@ namespace mage::rendering {
 		}
 		else {
 			sprite_batch.Draw(GetBaseColorSRV(),
+				              texture_size,
 				              XMLoad(m_base_color),
 				              m_sprite_effects,
 				              m_sprite_transform,
 				              &m_base_color_texture_region);
 		}
 	}
+
+	void SpriteImage::Draw(SpriteBatch& sprite_batch,
+						   ID3D11ShaderResourceView* texture,
+						   const U32x2& texture_size,
+						   const RECT& texture_region) const {
+
+		sprite_batch.Draw(texture,
+						  texture_size,
+						  XMLoad(m_base_color),
+						  m_sprite_effects,
+						  m_sprite_transform,
+						  &texture_region);
+	}
 }
\ No newline at end of file
@@ -5,10 +5,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\component.hpp"
-#include "renderer\pass\sprite_batch.hpp"
-#include "resource\texture\texture.hpp"
-#include "spectrum\spectrum.hpp"
+#include "scene/component.hpp"
+#include "renderer/pass/sprite_batch.hpp"
+#include "resource/texture/texture.hpp"
+#include "spectrum/spectrum.hpp"
 
 #pragma endregion
 
@@ -94,6 +94,27 @@ namespace mage::rendering {
 		 */
 		void Draw(SpriteBatch& sprite_batch) const;
 
+		/**
+		 Draws this sprite image with the given texture and texture region
+		 instead of the base color texture and base color texture region of
+		 this sprite image (e.g., an atlas page containing the base color
+		 texture).
+
+		 @param[in,out]	sprite_batch
+						A reference to the sprite batch used for rendering this
+						sprite image.
+		 @param[in]		texture
+						A pointer to the shader resource view of the texture.
+		 @param[in]		texture_size
+						The size [width, height] of the texture.
+		 @param[in]		texture_region
+						A reference to the texture region (in texels).
+		 */
+		void Draw(SpriteBatch& sprite_batch,
+				  ID3D11ShaderResourceView* texture,
+				  const U32x2& texture_size,
+				  const RECT& texture_region) const;
+
 		//---------------------------------------------------------------------
 		// Member Methods
 		//---------------------------------------------------------------------
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\sprite\sprite_text.hpp"
+#include "scene/sprite/sprite_text.hpp"
 
 #pragma endregion
 
@@ -19,15 +19,42 @@ namespace mage::rendering {
 		m_strings(),
 		m_text_effect_color(RGBA(1.0f)),
 		m_text_effect(TextEffect::None),
-		m_font() {}
-
-	SpriteText::SpriteText(const SpriteText& sprite) = default;
+		m_font(),
+		m_layout() {}
+
+	SpriteText::SpriteText(const SpriteText& sprite)
+		: Component(sprite),
+		m_sprite_transform(sprite.m_sprite_transform),
+		m_sprite_effects(sprite.m_sprite_effects),
+		m_strings(sprite.m_strings),
+		m_text_effect_color(sprite.m_text_effect_color),
+		m_text_effect(sprite.m_text_effect),
+		m_font(sprite.m_font),
+		m_layout() {}
 
 	SpriteText::SpriteText(SpriteText&& sprite) noexcept = default;
 
 	SpriteText::~SpriteText() = default;
 
-	SpriteText& SpriteText::operator=(const SpriteText& sprite) = default;
+	SpriteText& SpriteText::operator=(const SpriteText& sprite) {
+		Component::operator=(sprite);
+
+		// Each change of the laid out state updates the version of the
+		// layout cache: the state (e.g., the strings) and the cached sprites
+		// are kept if this sprite text already holds the version of the
+		// given sprite text (e.g., a render snapshot of an unchanged text).
+		if (m_layout.GetVersion() != sprite.m_layout.GetVersion()) {
+			m_sprite_transform  = sprite.m_sprite_transform;
+			m_sprite_effects    = sprite.m_sprite_effects;
+			m_strings           = sprite.m_strings;
+			m_text_effect_color = sprite.m_text_effect_color;
+			m_text_effect       = sprite.m_text_effect;
+			m_font              = sprite.m_font;
+			m_layout            = sprite.m_layout;
+		}
+
+		return *this;
+	}
 
 	SpriteText& SpriteText::operator=(SpriteText&& sprite) noexcept = default;
 
@@ -36,6 +63,15 @@ namespace mage::rendering {
 			return;
 		}
 
+		// Lay out the text again only if it has been invalidated.
+		const auto& sprites = m_layout.Get([this](auto& layout_sprites) {
+			LayoutText(layout_sprites);
+		});
+
+		sprite_batch.Draw(gsl::make_span(sprites));
+	}
+
+	void SpriteText::LayoutText(AlignedVector< SpriteInfo >& sprites) const {
 		SpriteTransform2D effect_transform(m_sprite_transform);
 
 		switch (m_text_effect) {
@@ -43,18 +79,18 @@ namespace mage::rendering {
 		case TextEffect::Outline: {
 			// -1, -1
 			effect_transform.AddTranslation(-1.0f, -1.0f);
-			m_font->DrawText(sprite_batch,
-							 gsl::make_span(m_strings),
-				             effect_transform,
-							 m_sprite_effects,
-							 &m_text_effect_color);
+			m_font->LayoutText(sprites,
+							   gsl::make_span(m_strings),
+							   effect_transform,
+							   m_sprite_effects,
+							   &m_text_effect_color);
 			// +1, -1
 			effect_transform.AddTranslationX(2.0f);
-			m_font->DrawText(sprite_batch,
-							 gsl::make_span(m_strings),
-				             effect_transform,
-							 m_sprite_effects,
-							 &m_text_effect_color);
+			m_font->LayoutText(sprites,
+							   gsl::make_span(m_strings),
+							   effect_transform,
+							   m_sprite_effects,
+							   &m_text_effect_color);
 
 			[[fallthrough]];
 		}
@@ -62,27 +98,27 @@ namespace mage::rendering {
 		case TextEffect::DropShadow: {
 			// +1, +1
 			effect_transform.AddTranslationY(2.0f);
-			m_font->DrawText(sprite_batch,
-							 gsl::make_span(m_strings),
-				             effect_transform,
-							 m_sprite_effects,
-							 &m_text_effect_color);
+			m_font->LayoutText(sprites,
+							   gsl::make_span(m_strings),
+							   effect_transform,
+							   m_sprite_effects,
+							   &m_text_effect_color);
 			// -1, +1
 			effect_transform.AddTranslationX(-2.0f);
-			m_font->DrawText(sprite_batch,
-							 gsl::make_span(m_strings),
-				             effect_transform,
-							 m_sprite_effects,
-							 &m_text_effect_color);
+			m_font->LayoutText(sprites,
+							   gsl::make_span(m_strings),
+							   effect_transform,
+							   m_sprite_effects,
+							   &m_text_effect_color);
 
 			[[fallthrough]];
 		}
 
 		default: {
-			m_font->DrawText(sprite_batch,
-							 gsl::make_span(m_strings),
-				             m_sprite_transform,
-							 m_sprite_effects);
+			m_font->LayoutText(sprites,
+							   gsl::make_span(m_strings),
+							   m_sprite_transform,
+							   m_sprite_effects);
 		}
 
 		}
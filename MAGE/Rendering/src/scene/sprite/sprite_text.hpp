@@ -5,8 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\component.hpp"
-#include "resource\font\sprite_font.hpp"
+#include "scene/component.hpp"
+#include "scene/sprite/layout_cache.hpp"
+#include "resource/font/sprite_font.hpp"
 
 #pragma endregion
 
@@ -53,7 +54,8 @@ namespace mage::rendering {
 		SpriteText();
 
 		/**
-		 Constructs a sprite text from the given sprite text.
+		 Constructs a sprite text from the given sprite text. The cached
+		 sprites of the glyphs of the given sprite text are not copied.
 
 		 @param[in]		sprite
 						A reference to the sprite text to copy.
@@ -78,7 +80,11 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Copies the given sprite text to this sprite text.
+		 Copies the given sprite text to this sprite text. The cached sprites
+		 of the glyphs of the given sprite text are not copied, and the
+		 sprites of the glyphs of this sprite text are laid out again on the
+		 next draw. Nothing is copied (or laid out again) if the given sprite
+		 text did not change since its last copy to this sprite text.
 
 		 @param[in]		sprite
 						A reference to the sprite text to copy.
@@ -104,6 +110,11 @@ namespace mage::rendering {
 		/**
 		 Draws this sprite text.
 
+		 The sprites of the glyphs are cached and only laid out again after
+		 the text, font, sprite transform, sprite effects or text effect of
+		 this sprite text have been set or accessed through a non-const
+		 accessor.
+
 		 @param[in,out]	sprite_batch
 						A reference to the sprite batch used for rendering this
 						sprite text.
@@ -115,13 +126,15 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Returns the sprite transform of this sprite text.
+		 Returns the sprite transform of this sprite text. The cached sprites
+		 of the glyphs of this sprite text are invalidated.
 
 		 @return		A reference to the sprite transform of this sprite
 						text.
 		 */
 		[[nodiscard]]
 		SpriteTransform2D& GetSpriteTransform() noexcept {
+			m_layout.Invalidate();
 			return m_sprite_transform;
 		}
 
@@ -159,6 +172,7 @@ namespace mage::rendering {
 		 */
 		void SetSpriteEffects(SpriteEffect sprite_effects) noexcept {
 			m_sprite_effects = sprite_effects;
+			m_layout.Invalidate();
 		}
 
 		//---------------------------------------------------------------------
@@ -170,6 +184,7 @@ namespace mage::rendering {
 		 */
 		void ClearText() noexcept {
 			m_strings.clear();
+			m_layout.Invalidate();
 		}
 
 		/**
@@ -213,6 +228,7 @@ namespace mage::rendering {
 		 */
 		void AppendText(const ColorString& text) {
 			m_strings.push_back(text);
+			m_layout.Invalidate();
 		}
 
 		/**
@@ -223,10 +239,12 @@ namespace mage::rendering {
 		 */
 		void AppendText(ColorString&& text) {
 			m_strings.push_back(std::move(text));
+			m_layout.Invalidate();
 		}
 
 		/**
-		 Traverses all color strings of this sprite text.
+		 Traverses all color strings of this sprite text. The cached sprites
+		 of the glyphs of this sprite text are invalidated.
 
 		 @tparam		ActionT
 						An action to perform on all color strings of this
@@ -256,13 +274,15 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Returns the (linear) text effect color of this sprite text.
+		 Returns the (linear) text effect color of this sprite text. The
+		 cached sprites of the glyphs of this sprite text are invalidated.
 
 		 @return		A reference to the (linear) text effect color of this
 						sprite text.
 		 */
 		[[nodiscard]]
 		RGBA& GetTextEffectColor() noexcept {
+			m_layout.Invalidate();
 			return m_text_effect_color;
 		}
 
@@ -295,6 +315,7 @@ namespace mage::rendering {
 		 */
 		void SetTextEffect(TextEffect text_effect) noexcept {
 			m_text_effect = text_effect;
+			m_layout.Invalidate();
 		}
 
 		//---------------------------------------------------------------------
@@ -330,10 +351,26 @@ namespace mage::rendering {
 		 */
 		void SetFont(SpriteFontPtr font) noexcept {
 			m_font = std::move(font);
+			m_layout.Invalidate();
 		}
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Member Methods: Layout
+		//---------------------------------------------------------------------
+
+		/**
+		 Lays out the text of this sprite text (i.e. appends the sprites of
+		 the glyphs, including the text effect, to the given sprites).
+
+		 @pre			The font of this sprite text is not equal to
+						@c nullptr.
+		 @param[in,out]	sprites
+						A reference to a vector containing the sprites.
+		 */
+		void LayoutText(AlignedVector< SpriteInfo >& sprites) const;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Transform
 		//---------------------------------------------------------------------
@@ -383,6 +420,16 @@ namespace mage::rendering {
 		 A pointer to the sprite font of this sprite text.
 		 */
 		SpriteFontPtr m_font;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Layout
+		//---------------------------------------------------------------------
+
+		/**
+		 The layout cache containing the cached sprites of the glyphs of this
+		 sprite text.
+		 */
+		mutable LayoutCache< SpriteInfo > m_layout;
 	};
 
 	#pragma warning( pop )
@@ -393,6 +440,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\sprite\sprite_text.tpp"
+#include "scene/sprite/sprite_text.tpp"
 
 #pragma endregion
\ No newline at end of file
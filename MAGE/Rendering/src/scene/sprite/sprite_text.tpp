@@ -7,6 +7,8 @@ namespace mage::rendering {
 
 	template< typename ActionT >
 	void SpriteText::ForEachColorString(ActionT&& action) {
+		m_layout.Invalidate();
+
 		for (auto& str : m_strings) {
 			action(str);
 		}
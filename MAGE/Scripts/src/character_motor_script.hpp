@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\script\behavior_script.hpp"
+#include "scene/script/behavior_script.hpp"
 
 #pragma endregion
 
@@ -4,7 +4,10 @@
 #pragma region
 
 #include "editor_script.hpp"
-#include "scene\scene.hpp"
+#include "scene/scene.hpp"
+#include "system/profiler.hpp"
+#include "system/telemetry.hpp"
+#include "logging/logging.hpp"
 #include "imgui.h"
 
 #pragma endregion
@@ -796,7 +799,7 @@ namespace mage::script {
 
 			const auto base_color_tex = sprite.GetBaseColorTexture();
 			const auto texture_resolution = !base_color_tex ? U32x2(1u, 1u)
-				: rendering::GetTexture2DSize(*sprite.GetBaseColorSRV());
+				: base_color_tex->GetSize();
 
 			//-----------------------------------------------------------------
 			// Sprite transform
@@ -859,7 +862,7 @@ namespace mage::script {
 
 			const auto font = sprite.GetFont();
 			const auto texture_resolution = !font ? U32x2(1u, 1u)
-				: rendering::GetTexture2DSize(*sprite.GetFontSRV());
+				: font->GetTextureSize();
 
 			//-----------------------------------------------------------------
 			// Sprite transform
@@ -1253,6 +1256,127 @@ namespace mage::script {
 
 			ImGui::End();
 		}
+
+		void DrawWidget(const char* name,
+						const ResourcePoolStatistics& statistics) {
+
+			if (ImGui::TreeNode(name)) {
+				constexpr F32 mebibyte = 1024.0f * 1024.0f;
+
+				ImGui::Text("Resources: %zu (%zu unreferenced)",
+							statistics.m_nb_resources,
+							statistics.m_nb_unreferenced_resources);
+				ImGui::Text("Memory: %.1f MiB (peak: %.1f MiB, budget: %.1f MiB)",
+							statistics.m_memory_usage      / mebibyte,
+							statistics.m_peak_memory_usage / mebibyte,
+							statistics.m_memory_budget     / mebibyte);
+				ImGui::Text("Hit Rate: %.1f%%",
+							100.0f * statistics.GetHitRate());
+				ImGui::TreePop();
+			}
+		}
+
+		void DrawResources(const rendering::ResourceManager& resource_manager) {
+			using namespace rendering;
+
+			ImGui::Begin("Resources");
+
+			DrawWidget("Models",
+					   resource_manager.GetStatistics< ModelDescriptor >());
+			DrawWidget("Textures",
+					   resource_manager.GetStatistics< Texture >());
+			DrawWidget("Sprite Fonts",
+					   resource_manager.GetStatistics< SpriteFont >());
+
+			ImGui::End();
+		}
+
+		void DrawProfiler() {
+			auto& profiler = Profiler::Get();
+
+			ImGui::Begin("Profiler");
+
+			if (profiler.IsCapturing()) {
+				ImGui::Text("Capturing...");
+			}
+			else if (ImGui::Button("Capture")) {
+				// Capture a number of frames as a Chrome trace.
+				profiler.Capture("profile.json", 60u);
+			}
+			ImGui::SameLine();
+			if (ImGui::Button("Reset")) {
+				profiler.ResetStatistics();
+			}
+
+			ImGui::Columns(5, "Profile Scopes");
+			ImGui::Text("Scope");         ImGui::NextColumn();
+			ImGui::Text("Calls");         ImGui::NextColumn();
+			ImGui::Text("Last (ms)");     ImGui::NextColumn();
+			ImGui::Text("Average (ms)");  ImGui::NextColumn();
+			ImGui::Text("Max (ms)");      ImGui::NextColumn();
+			ImGui::Separator();
+
+			for (const auto& statistics : profiler.GetStatistics()) {
+				// Indent nested profile scopes.
+				ImGui::Text("%*s%s", static_cast< int >(2u * statistics.m_depth), "",
+							statistics.m_name);
+				ImGui::NextColumn();
+				ImGui::Text("%u",   statistics.m_nb_calls);     ImGui::NextColumn();
+				ImGui::Text("%.3f", statistics.m_last_time);    ImGui::NextColumn();
+				ImGui::Text("%.3f", statistics.m_average_time); ImGui::NextColumn();
+				ImGui::Text("%.3f", statistics.m_max_time);     ImGui::NextColumn();
+			}
+
+			ImGui::Columns(1);
+			ImGui::End();
+		}
+
+		void DrawTelemetry() {
+			auto& telemetry = Telemetry::Get();
+
+			ImGui::Begin("Telemetry");
+
+			try {
+				if (ImGui::Button("Export CSV")) {
+					telemetry.ExportCSV("telemetry.csv");
+				}
+				ImGui::SameLine();
+				if (ImGui::Button("Export JSON")) {
+					telemetry.ExportJSON("telemetry.json");
+				}
+			}
+			catch (const std::exception& e) {
+				MAGE_WARNING("Telemetry export failed: {}", e.what());
+			}
+
+			ImGui::Columns(6, "Telemetry Metrics");
+			ImGui::Text("Metric");        ImGui::NextColumn();
+			ImGui::Text("Frame");         ImGui::NextColumn();
+			ImGui::Text("Total");         ImGui::NextColumn();
+			ImGui::Text("Mean");          ImGui::NextColumn();
+			ImGui::Text("p95");           ImGui::NextColumn();
+			ImGui::Text("p99");           ImGui::NextColumn();
+			ImGui::Separator();
+
+			for (const auto& sample : telemetry.GetSnapshot()) {
+				ImGui::Text("%s",   sample.m_name);             ImGui::NextColumn();
+				ImGui::Text("%.0f", sample.m_value);            ImGui::NextColumn();
+				ImGui::Text("%.0f", sample.m_total);            ImGui::NextColumn();
+				if (TelemetryType::Histogram == sample.m_type) {
+					ImGui::Text("%.1f", sample.m_mean);           ImGui::NextColumn();
+					ImGui::Text("%.0f", sample.m_percentiles[1]); ImGui::NextColumn();
+					ImGui::Text("%.0f", sample.m_percentiles[2]); ImGui::NextColumn();
+				}
+				else {
+					ImGui::NextColumn();
+					ImGui::NextColumn();
+					ImGui::NextColumn();
+				}
+			}
+
+			ImGui::Columns(1);
+			ImGui::End();
+		}
 	}
 
 	//-------------------------------------------------------------------------
@@ -1296,6 +1420,12 @@ namespace mage::script {
 		const auto config = engine.GetRenderingManager().GetDisplayConfiguration();
 		const auto display_resolution = config.GetDisplayResolution();
 		DrawInspector(m_selected, display_resolution);
+
+		DrawResources(engine.GetRenderingManager().GetResourceManager());
+
+		DrawProfiler();
+
+		DrawTelemetry();
 	}
 
 	#pragma endregion
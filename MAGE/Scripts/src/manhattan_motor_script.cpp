@@ -4,7 +4,7 @@
 #pragma region
 
 #include "manhattan_motor_script.hpp"
-#include "exception\exception.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -4,7 +4,7 @@
 #pragma region
 
 #include "mouse_look_script.hpp"
-#include "exception\exception.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -4,8 +4,8 @@
 #pragma region
 
 #include "stats_script.hpp"
-#include "system\system_usage.hpp"
-#include "exception\exception.hpp"
+#include "system/system_usage.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -72,6 +72,7 @@ namespace mage::script {
 		m_text->SetText(L"FPS: ");
 		m_text->AppendText({ std::to_wstring(m_fps), color });
 		m_text->AppendText(Format(L"\nSPF: {:.2f}ms\nCPU: {:.1f}%\nRAM: {}MB\nDCs: {}",
-								  m_spf, m_cpu, m_ram, rendering::Pipeline::s_nb_draws));
+								  m_spf, m_cpu, m_ram,
+								  engine.GetRenderingManager().GetPipelineStatistics().m_nb_draws));
 	}
 }
\ No newline at end of file
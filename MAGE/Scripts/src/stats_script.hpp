@@ -5,9 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\script\behavior_script.hpp"
-#include "scene\sprite\sprite_text.hpp"
-#include "system\cpu_monitor.hpp"
+#include "scene/script/behavior_script.hpp"
+#include "scene/sprite/sprite_text.hpp"
+#include "system/cpu_monitor.hpp"
 
 #pragma endregion
 
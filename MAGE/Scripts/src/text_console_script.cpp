@@ -4,7 +4,7 @@
 #pragma region
 
 #include "text_console_script.hpp"
-#include "exception\exception.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
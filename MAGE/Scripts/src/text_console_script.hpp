@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "scene\script\behavior_script.hpp"
-#include "scene\sprite\sprite_text.hpp"
+#include "scene/script/behavior_script.hpp"
+#include "scene/sprite/sprite_text.hpp"
 
 #pragma endregion
 
@@ -4,8 +4,8 @@
 #pragma region
 
 #include "voxel_grid_anchor_script.hpp"
-#include "scene\camera\camera.hpp"
-#include "exception\exception.hpp"
+#include "scene/camera/camera.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
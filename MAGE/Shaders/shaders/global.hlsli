@@ -242,6 +242,24 @@ CBUFFER(PrimaryCamera, SLOT_CBUFFER_PRIMARY_CAMERA) {
 	 objects in perfect focus expressed in camera space) of this camera.
 	 */
 	float    g_focus_distance              : packoffset(c21.y);
+
+	//-------------------------------------------------------------------------
+	// Member Variables: Dynamic Resolution
+	//-------------------------------------------------------------------------
+
+	/**
+	 The top left corner of the output camera viewport (i.e. the unscaled
+	 camera viewport).
+	 */
+	float2   g_output_viewport_top_left    : packoffset(c22);
+
+	/**
+	 The resolution of the output camera viewport (i.e. the unscaled camera
+	 viewport).
+	 .x = the output viewport width
+	 .y = the output viewport height
+	 */
+	uint2    g_output_viewport_resolution  : packoffset(c22.z);
 }
 
 //-----------------------------------------------------------------------------
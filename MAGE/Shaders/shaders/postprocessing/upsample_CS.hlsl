@@ -0,0 +1,71 @@
+//-----------------------------------------------------------------------------
+// Engine Configuration
+//-----------------------------------------------------------------------------
+// Defines			                        | Default
+//-----------------------------------------------------------------------------
+// GROUP_SIZE                               | GROUP_SIZE_2D_DEFAULT
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "global.hlsli"
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#ifndef GROUP_SIZE
+	#define GROUP_SIZE GROUP_SIZE_2D_DEFAULT
+#endif
+
+//-----------------------------------------------------------------------------
+// SRVs
+//-----------------------------------------------------------------------------
+TEXTURE_2D(g_input_image_texture,     float4, SLOT_SRV_IMAGE);
+
+//-----------------------------------------------------------------------------
+// UAVs
+//-----------------------------------------------------------------------------
+RW_TEXTURE_2D(g_output_image_texture, float4, SLOT_UAV_IMAGE);
+
+//-----------------------------------------------------------------------------
+// Compute Shader
+//-----------------------------------------------------------------------------
+[numthreads(GROUP_SIZE, GROUP_SIZE, 1)]
+void CS(uint3 thread_id : SV_DispatchThreadID) {
+	const uint2 p_output_viewport = thread_id.xy;
+
+	[branch]
+	if (any(g_output_viewport_resolution <= p_output_viewport)) {
+		return;
+	}
+
+	const uint2 p_output_display
+		= (uint2)(g_output_viewport_top_left + p_output_viewport);
+
+	[branch]
+	if (any(g_display_resolution <= p_output_display)) {
+		return;
+	}
+
+	// Map the center of the output pixel to the (scaled) viewport. The
+	// samples are clamped to the (scaled) viewport, since the remainder of
+	// the input image does not belong to this viewport.
+	const float2 uv         = (p_output_viewport + 0.5f)
+		                    / g_output_viewport_resolution;
+	const float2 p_max      = g_viewport_resolution - 1.0f;
+	const float2 p_viewport = clamp(uv * g_viewport_resolution - 0.5f,
+									0.0f, p_max);
+
+	// Bilinear filtering
+	const float2 p0      = floor(p_viewport);
+	const float2 p1      = min(p0 + 1.0f, p_max);
+	const float2 weights = p_viewport - p0;
+
+	const float4 c00 = g_input_image_texture[(uint2)ViewportToDisplay(float2(p0.x, p0.y))];
+	const float4 c10 = g_input_image_texture[(uint2)ViewportToDisplay(float2(p1.x, p0.y))];
+	const float4 c01 = g_input_image_texture[(uint2)ViewportToDisplay(float2(p0.x, p1.y))];
+	const float4 c11 = g_input_image_texture[(uint2)ViewportToDisplay(float2(p1.x, p1.y))];
+
+	g_output_image_texture[p_output_display]
+		= lerp(lerp(c00, c10, weights.x), lerp(c01, c11, weights.x), weights.y);
+}
\ No newline at end of file
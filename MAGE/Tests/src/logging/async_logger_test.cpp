@@ -0,0 +1,172 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "logging/async_logger.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	/**
+	 Returns the lines written to the given stream.
+	 */
+	[[nodiscard]]
+	std::vector< std::string > ReadLines(std::FILE* stream) {
+		std::vector< std::string > lines;
+
+		std::rewind(stream);
+		char line[AsyncLogger::s_record_size + 1u];
+		while (std::fgets(line, sizeof(line), stream)) {
+			lines.emplace_back(line, std::strlen(line));
+		}
+
+		return lines;
+	}
+
+	void TestNotRunning() {
+		AsyncLogger logger;
+
+		// Records must be written synchronously.
+		MAGE_CHECK(!logger.Push("", "record"));
+		logger.Flush();
+		MAGE_CHECK(0u == logger.GetNumberOfWrittenRecords());
+	}
+
+	void TestFlush() {
+		const auto stream = std::tmpfile();
+		constexpr std::size_t nb_threads = 4u;
+		constexpr std::size_t nb_records = 5000u;
+
+		AsyncLogger logger;
+		logger.Start(LogOverflowPolicy::Block, NotNull< std::FILE* >(stream));
+
+		std::vector< std::thread > threads;
+		for (std::size_t t = 0u; t < nb_threads; ++t) {
+			threads.emplace_back([&logger, t]() {
+				for (std::size_t i = 0u; i < nb_records; ++i) {
+					MAGE_CHECK(logger.Push("[Test] ", "{} {}", t, i));
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+
+		// All pushed records are written when Flush returns.
+		logger.Flush();
+		MAGE_CHECK(nb_threads * nb_records == logger.GetNumberOfWrittenRecords());
+
+		const auto lines = ReadLines(stream);
+		MAGE_CHECK(nb_threads * nb_records == lines.size());
+
+		// The records of each thread are written in order.
+		std::vector< std::size_t > next(nb_threads, 0u);
+		for (const auto& line : lines) {
+			std::size_t t = 0u, i = 0u;
+			MAGE_CHECK(2 == std::sscanf(line.c_str(), "[Test] %zu %zu", &t, &i));
+			MAGE_CHECK(t < nb_threads && next[t]++ == i);
+		}
+
+		logger.Stop();
+		std::fclose(stream);
+	}
+
+	void TestStop() {
+		const auto stream = std::tmpfile();
+		constexpr std::size_t nb_threads = 4u;
+
+		AsyncLogger logger;
+		logger.Start(LogOverflowPolicy::Block, NotNull< std::FILE* >(stream));
+
+		// Keep pushing records while the logger stops.
+		std::atomic< std::size_t > nb_pushed = 0u;
+		std::atomic< std::size_t > nb_started = 0u;
+		std::vector< std::thread > threads;
+		for (std::size_t t = 0u; t < nb_threads; ++t) {
+			threads.emplace_back([&]() {
+				++nb_started;
+				while (logger.Push("", "record")) {
+					++nb_pushed;
+				}
+			});
+		}
+
+		while (nb_threads != nb_started || 0u == nb_pushed) {
+			std::this_thread::yield();
+		}
+		logger.Stop();
+
+		for (auto& thread : threads) {
+			thread.join();
+		}
+
+		// Every accepted record is written.
+		MAGE_CHECK(nb_pushed == logger.GetNumberOfWrittenRecords());
+		MAGE_CHECK(nb_pushed == ReadLines(stream).size());
+
+		std::fclose(stream);
+	}
+
+	void TestDrop() {
+		const auto stream = std::tmpfile();
+		constexpr std::size_t nb_threads = 8u;
+		constexpr std::size_t nb_records = 4u * AsyncLogger::s_nb_records;
+
+		AsyncLogger logger;
+		logger.Start(LogOverflowPolicy::Drop, NotNull< std::FILE* >(stream));
+
+		std::vector< std::thread > threads;
+		for (std::size_t t = 0u; t < nb_threads; ++t) {
+			threads.emplace_back([&logger]() {
+				for (std::size_t i = 0u; i < nb_records; ++i) {
+					MAGE_CHECK(logger.Push("", "{:>256}", i));
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+
+		logger.Stop();
+
+		// Every record is either written or dropped.
+		const auto nb_written = ReadLines(stream).size();
+		MAGE_CHECK(nb_written == logger.GetNumberOfWrittenRecords());
+		MAGE_CHECK(nb_threads * nb_records
+				   == nb_written + logger.GetNumberOfDroppedRecords());
+
+		std::printf("  %zu records written, %llu records dropped\n",
+					nb_written,
+					static_cast< unsigned long long >(
+						logger.GetNumberOfDroppedRecords()));
+
+		std::fclose(stream);
+	}
+}
+
+int main() {
+	test::Run("AsyncLoggerNotRunning", TestNotRunning);
+	test::Run("AsyncLoggerFlush",      TestFlush);
+	test::Run("AsyncLoggerStop",       TestStop);
+	test::Run("AsyncLoggerDrop",       TestDrop);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
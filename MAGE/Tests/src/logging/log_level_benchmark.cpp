@@ -0,0 +1,132 @@
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+// Compile out the debug, info and warning messages of this benchmark.
+#undef  MAGE_LOG_LEVEL
+#define MAGE_LOG_LEVEL 3
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "logging/logging.hpp"
+#include "memory/allocation_counter.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <chrono>
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	/**
+	 The null device to which the messages are written.
+	 */
+	#ifdef _WIN32
+	constexpr const char* g_null_device = "NUL";
+	#else
+	constexpr const char* g_null_device = "/dev/null";
+	#endif
+
+	/**
+	 A format argument of this benchmark only. The log functions which are
+	 instantiated with this argument are not shared with the libraries (which
+	 are compiled with another log level).
+	 */
+	struct Argument {
+
+		U64 m_value;
+	};
+
+	/**
+	 The sink of the benchmarked loops (i.e. the work which is not compiled
+	 out).
+	 */
+	volatile U64 g_sink = 0u;
+
+	/**
+	 Runs the given number of iterations of the given loop body and reports
+	 the time and the allocations per iteration.
+	 */
+	template< typename BodyT >
+	[[nodiscard]]
+	U64 Benchmark(const char* name, std::size_t nb_iterations, BodyT&& body) {
+		const auto nb_allocations = GetNumberOfAllocations();
+		const auto start          = Clock::now();
+		for (std::size_t i = 0u; i < nb_iterations; ++i) {
+			body(i);
+			g_sink = i;
+		}
+		const std::chrono::duration< double, std::nano > time
+			= Clock::now() - start;
+		const auto allocations = GetNumberOfAllocations() - nb_allocations;
+
+		std::fprintf(stderr, "  %-32s %8.2f ns/iteration %6.2f allocations/iteration\n",
+					 name, time.count() / nb_iterations,
+					 static_cast< double >(allocations) / nb_iterations);
+		return allocations;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	const std::size_t nb_iterations = (1 < argc) ? std::stoul(argv[1]) : 10000000u;
+
+	std::fprintf(stderr, "%zu iterations, log level %d\n",
+				 nb_iterations, MAGE_LOG_LEVEL);
+
+	// The logged error messages are discarded.
+	if (!std::freopen(g_null_device, "w", stdout)) {
+		std::fprintf(stderr, "Redirecting stdout to %s failed.\n", g_null_device);
+		return 1;
+	}
+
+	// The logging configuration is verbose: only the log level disables the
+	// debug and info messages.
+	MAGE_CHECK(LoggingConfiguration::Get().IsVerbose());
+
+	MAGE_CHECK(0u == Benchmark("empty loop", nb_iterations,
+		[]([[maybe_unused]] std::size_t i) noexcept {}));
+
+	// Disabled levels: nothing is logged, formatted or allocated.
+	MAGE_CHECK(0u == Benchmark("disabled Debug", nb_iterations,
+		[](std::size_t i) {
+			Debug("debug {}", Argument{ i });
+		}));
+	MAGE_CHECK(0u == Benchmark("disabled Info", nb_iterations,
+		[](std::size_t i) {
+			Info("info {}", Argument{ i });
+		}));
+	MAGE_CHECK(0u == Benchmark("disabled MAGE_WARNING", nb_iterations,
+		[]([[maybe_unused]] std::size_t i) {
+			MAGE_WARNING("warning {}", Argument{ i });
+		}));
+
+	// An enabled level for comparison: all but the first messages of the
+	// rate limiting window are suppressed by the log site.
+	static_cast< void >(Benchmark("enabled, suppressed MAGE_ERROR", nb_iterations,
+		[](std::size_t i) {
+			MAGE_ERROR("error {}", i);
+		}));
+
+	return test::GetExitCode();
+}
\ No newline at end of file
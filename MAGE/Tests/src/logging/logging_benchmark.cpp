@@ -0,0 +1,123 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "logging/logging.hpp"
+#include "memory/allocation_counter.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	/**
+	 The null device to which the messages are written by default.
+	 */
+	#ifdef _WIN32
+	constexpr const char* g_null_device = "NUL";
+	#else
+	constexpr const char* g_null_device = "/dev/null";
+	#endif
+
+	/**
+	 Logs the given number of warnings in bursts of the given size and
+	 reports the time spent on the logging thread and the time until all
+	 warnings are written. The asynchronous logger is flushed after each
+	 burst, outside the time spent on the logging thread.
+
+	 The warnings bypass the rate limiter of Warning (which would suppress
+	 all but a few warnings per second), and are logged with the prefix and
+	 the disposition of Warning.
+	 */
+	void Benchmark(const char* name,
+				   std::size_t nb_messages, std::size_t burst_size) {
+
+		std::chrono::duration< double, std::milli > log_time(0.0);
+		U64 allocations = 0u;
+
+		const auto start = Clock::now();
+		for (std::size_t i = 0u; i < nb_messages;) {
+			const auto end = std::min(nb_messages, i + burst_size);
+
+			const auto nb_allocations = GetNumberOfAllocations();
+			const auto burst_start    = Clock::now();
+			for (; i < end; ++i) {
+				details::Log("Warning: ", MessageDisposition::Continue,
+							 "Warning {} of {}: {:.3f}", i, nb_messages, 0.5 * i);
+			}
+			log_time    += Clock::now() - burst_start;
+			allocations += GetNumberOfAllocations() - nb_allocations;
+
+			if (AsyncLogger::IsEnabled()) {
+				AsyncLogger::Get().Flush();
+			}
+		}
+		const std::chrono::duration< double, std::milli > total_time
+			= Clock::now() - start;
+
+		std::fprintf(stderr,
+					 "  %-14s %8.1f ms logging thread %8.1f ms total "
+					 "%8.1f ns/message %6.2f allocations/message\n",
+					 name, log_time.count(), total_time.count(),
+					 1.0e6 * log_time.count() / nb_messages,
+					 static_cast< double >(allocations) / nb_messages);
+	}
+}
+
+int main(int argc, char* argv[]) {
+	const std::size_t nb_messages = (1 < argc) ? std::stoul(argv[1]) : 1000000u;
+	const std::size_t burst_size  = (2 < argc) ? std::stoul(argv[2])
+											   : AsyncLogger::s_nb_records;
+
+	const char* const output      = (3 < argc) ? argv[3] : g_null_device;
+
+	std::fprintf(stderr, "%zu warnings, bursts of %zu warnings, output %s\n",
+				 nb_messages, burst_size, output);
+
+	// Both paths write to the standard output, which is redirected to the
+	// output file. The asynchronous path only takes the console I/O off the
+	// logging thread if the drain thread has a core of its own.
+	if (!std::freopen(output, "w", stdout)) {
+		std::fprintf(stderr, "Redirecting stdout to %s failed.\n", output);
+		return 1;
+	}
+
+	// The synchronous path: each message is written to the console on the
+	// logging thread (while the global asynchronous logger is not running).
+	MAGE_CHECK(!AsyncLogger::IsEnabled());
+	Benchmark("sync", nb_messages, nb_messages);
+
+	// The asynchronous path: each message is formatted on the logging thread
+	// and written by the drain thread. No messages are dropped: sustained
+	// logging is limited by the drain thread once the records are full,
+	// whereas bursts fitting in the records are not.
+	auto& logger = AsyncLogger::Get();
+	logger.Start(LogOverflowPolicy::Block);
+	MAGE_CHECK(AsyncLogger::IsEnabled());
+	Benchmark("async", nb_messages, nb_messages);
+	Benchmark("async (bursts)", nb_messages, burst_size);
+	MAGE_CHECK(2u * nb_messages == logger.GetNumberOfWrittenRecords());
+	MAGE_CHECK(0u == logger.GetNumberOfDroppedRecords());
+	logger.Stop();
+
+	return test::GetExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,231 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	/**
+	 The maximum number of logged messages per format string and per second.
+	 */
+	constexpr std::size_t g_max_nb_messages = 10u;
+
+	/**
+	 The number of messages logged per format string.
+	 */
+	constexpr std::size_t g_nb_messages = 25u;
+
+	/**
+	 Returns the lines written to the given stream since the given position
+	 and moves the given position to the end of the stream.
+	 */
+	[[nodiscard]]
+	std::vector< std::string > ReadLines(std::FILE* stream, long& position) {
+		AsyncLogger::Get().Flush();
+
+		std::vector< std::string > lines;
+
+		std::fseek(stream, position, SEEK_SET);
+		char line[AsyncLogger::s_record_size + 1u];
+		while (std::fgets(line, sizeof(line), stream)) {
+			lines.emplace_back(line, std::strlen(line));
+		}
+		position = std::ftell(stream);
+
+		return lines;
+	}
+
+	[[nodiscard]]
+	std::size_t Count(const std::vector< std::string >& lines,
+					  const std::string& line) {
+		return static_cast< std::size_t >(
+			std::count(lines.cbegin(), lines.cend(), line));
+	}
+
+	/**
+	 Logs a warning message of a single call site.
+	 */
+	void LogWindow(std::size_t i) {
+		MAGE_WARNING("window {}", i);
+	}
+
+	void TestRateLimit(std::FILE* stream, long& position) {
+		for (std::size_t i = 0u; i < g_nb_messages; ++i) {
+			MAGE_WARNING("rate limit {}", i);
+			MAGE_ERROR("other rate limit {}", i);
+		}
+
+		// Each call site is limited separately.
+		auto lines = ReadLines(stream, position);
+		MAGE_CHECK(2u * g_max_nb_messages == lines.size());
+		MAGE_CHECK(1u == Count(lines, "Warning: rate limit 0\n"));
+		MAGE_CHECK(1u == Count(lines, "Error:   other rate limit 9\n"));
+		MAGE_CHECK(0u == Count(lines, "Warning: rate limit 10\n"));
+
+		// The suppressed messages are reported once.
+		ReportSuppressedMessages();
+		ReportSuppressedMessages();
+		lines = ReadLines(stream, position);
+		MAGE_CHECK(2u == lines.size());
+		MAGE_CHECK(1u == Count(lines, "Warning: 15 similar messages suppressed.\n"));
+		MAGE_CHECK(1u == Count(lines, "Error:   15 similar messages suppressed.\n"));
+	}
+
+	void TestRateLimitWide(std::FILE* stream, long& position) {
+		auto& logger = AsyncLogger::Get();
+
+		// Wide records cannot be read back from a byte-oriented stream on
+		// every platform, so count the written records instead.
+		logger.Flush();
+		const auto nb_written = logger.GetNumberOfWrittenRecords();
+
+		for (std::size_t i = 0u; i < g_nb_messages; ++i) {
+			MAGE_WARNING(L"wide rate limit {}", i);
+		}
+
+		logger.Flush();
+		MAGE_CHECK(nb_written + g_max_nb_messages
+				   == logger.GetNumberOfWrittenRecords());
+
+		ReportSuppressedMessages();
+		logger.Flush();
+		MAGE_CHECK(nb_written + g_max_nb_messages + 1u
+				   == logger.GetNumberOfWrittenRecords());
+
+		static_cast< void >(ReadLines(stream, position));
+	}
+
+	void TestRateLimitWindow(std::FILE* stream, long& position) {
+		for (std::size_t i = 0u; i < g_nb_messages; ++i) {
+			LogWindow(i);
+		}
+
+		// The suppressed messages are reported with the first message of the
+		// next rate limiting window.
+		std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+		LogWindow(g_nb_messages);
+
+		const auto lines = ReadLines(stream, position);
+		MAGE_CHECK(g_max_nb_messages + 2u == lines.size());
+		if (g_max_nb_messages + 2u != lines.size()) {
+			return;
+		}
+		MAGE_CHECK("Warning: 15 similar messages suppressed.\n"
+				   == lines[g_max_nb_messages]);
+		MAGE_CHECK("Warning: window 25\n" == lines[g_max_nb_messages + 1u]);
+	}
+
+	void TestRateLimitCallSites(std::FILE* stream, long& position) {
+		for (std::size_t i = 0u; i < g_nb_messages; ++i) {
+			MAGE_WARNING("call site {}", i);
+			MAGE_WARNING("call site {}", i);
+		}
+
+		// Call sites with the same format string are limited separately.
+		auto lines = ReadLines(stream, position);
+		MAGE_CHECK(2u * g_max_nb_messages == lines.size());
+		MAGE_CHECK(2u == Count(lines, "Warning: call site 9\n"));
+
+		ReportSuppressedMessages();
+		lines = ReadLines(stream, position);
+		MAGE_CHECK(2u == Count(lines, "Warning: 15 similar messages suppressed.\n"));
+	}
+
+	void TestRateLimitThreads(std::FILE* stream, long& position) {
+		constexpr std::size_t nb_threads = 4u;
+
+		std::vector< std::thread > threads;
+		for (std::size_t t = 0u; t < nb_threads; ++t) {
+			threads.emplace_back([]() {
+				for (std::size_t i = 0u; i < g_nb_messages; ++i) {
+					MAGE_ERROR("thread {}", i);
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+
+		// All messages of the threads are either logged or suppressed.
+		auto lines = ReadLines(stream, position);
+		const auto nb_logged = lines.size();
+		MAGE_CHECK(g_max_nb_messages <= nb_logged);
+		MAGE_CHECK(nb_threads * g_nb_messages > nb_logged);
+
+		ReportSuppressedMessages();
+		lines = ReadLines(stream, position);
+		MAGE_CHECK(1u == lines.size());
+		if (1u != lines.size()) {
+			return;
+		}
+		std::size_t nb_suppressed = 0u;
+		MAGE_CHECK(1 == std::sscanf(lines.front().c_str(),
+									"Error:   %zu similar messages suppressed.",
+									&nb_suppressed));
+		MAGE_CHECK(nb_threads * g_nb_messages == nb_logged + nb_suppressed);
+	}
+
+	void TestNotRateLimited(std::FILE* stream, long& position) {
+		for (std::size_t i = 0u; i < g_nb_messages; ++i) {
+			Warning("not rate limited {}", i);
+		}
+
+		// Messages without a log site are not rate limited.
+		const auto lines = ReadLines(stream, position);
+		MAGE_CHECK(g_nb_messages == lines.size());
+	}
+}
+
+int main() {
+	const auto stream = std::tmpfile();
+	long position = 0;
+
+	AsyncLogger::Get().Start(LogOverflowPolicy::Block,
+							 NotNull< std::FILE* >(stream));
+
+	test::Run("LoggingRateLimit", [&]() {
+		TestRateLimit(stream, position);
+	});
+	test::Run("LoggingRateLimitWide", [&]() {
+		TestRateLimitWide(stream, position);
+	});
+	test::Run("LoggingRateLimitWindow", [&]() {
+		TestRateLimitWindow(stream, position);
+	});
+	test::Run("LoggingRateLimitCallSites", [&]() {
+		TestRateLimitCallSites(stream, position);
+	});
+	test::Run("LoggingRateLimitThreads", [&]() {
+		TestRateLimitThreads(stream, position);
+	});
+	test::Run("LoggingNotRateLimited", [&]() {
+		TestNotRateLimited(stream, position);
+	});
+
+	AsyncLogger::Get().Stop();
+	std::fclose(stream);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
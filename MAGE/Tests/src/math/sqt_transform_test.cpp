@@ -0,0 +1,152 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "transform/sqt_transform.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	constexpr F32 g_epsilon = 1e-4f;
+
+	[[nodiscard]]
+	bool XM_CALLCONV NearEqual(FXMVECTOR v1, FXMVECTOR v2) noexcept {
+		return XMVector4NearEqual(v1, v2, XMVectorReplicate(g_epsilon));
+	}
+
+	[[nodiscard]]
+	bool XM_CALLCONV NearEqual(FXMMATRIX m1, CXMMATRIX m2) noexcept {
+		return NearEqual(m1.r[0], m2.r[0]) && NearEqual(m1.r[1], m2.r[1])
+			&& NearEqual(m1.r[2], m2.r[2]) && NearEqual(m1.r[3], m2.r[3]);
+	}
+
+	/**
+	 Returns the equivalent rotation of the given quaternion with a
+	 non-negative real part (i.e. q and -q represent the same rotation).
+	 */
+	[[nodiscard]]
+	const XMVECTOR XM_CALLCONV Canonical(FXMVECTOR q) noexcept {
+		return (0.0f > XMVectorGetW(q)) ? -q : q;
+	}
+
+	[[nodiscard]]
+	const SQTTransform3D MakeFrom() noexcept {
+		return SQTTransform3D(
+			XMVectorSet(1.0f, 2.0f, 3.0f, 0.0f),
+			XMQuaternionRotationRollPitchYaw(0.1f, 0.2f, 0.3f),
+			XMVectorSet(1.0f, 1.0f, 1.0f, 0.0f));
+	}
+
+	[[nodiscard]]
+	const SQTTransform3D MakeTo() noexcept {
+		return SQTTransform3D(
+			XMVectorSet(-3.0f, 6.0f, 0.0f, 0.0f),
+			XMQuaternionRotationRollPitchYaw(0.9f, -0.4f, 1.7f),
+			XMVectorSet(2.0f, 0.5f, 3.0f, 0.0f));
+	}
+
+	void TestDefault() {
+		const SQTTransform3D transform;
+
+		// The default transform is the identity.
+		MAGE_CHECK(NearEqual(XMQuaternionIdentity(), transform.GetRotation()));
+		MAGE_CHECK(NearEqual(XMMatrixIdentity(),
+							 transform.GetObjectToParentMatrix()));
+		MAGE_CHECK(NearEqual(XMMatrixIdentity(),
+							 transform.GetParentToObjectMatrix()));
+	}
+
+	void TestMatrices() {
+		const auto transform = MakeTo();
+
+		// Scale . Rotation . Translation
+		const auto expected
+			= XMMatrixScalingFromVector(transform.GetScale())
+			* XMMatrixRotationQuaternion(transform.GetRotation())
+			* XMMatrixTranslationFromVector(transform.GetTranslation());
+
+		const auto object_to_parent = transform.GetObjectToParentMatrix();
+		const auto parent_to_object = transform.GetParentToObjectMatrix();
+		MAGE_CHECK(NearEqual(expected, object_to_parent));
+		MAGE_CHECK(NearEqual(XMMatrixIdentity(),
+							 object_to_parent * parent_to_object));
+		MAGE_CHECK(NearEqual(XMMatrixIdentity(),
+							 parent_to_object * object_to_parent));
+	}
+
+	void TestLerpEndpoints() {
+		const auto from = MakeFrom();
+		const auto to   = MakeTo();
+
+		MAGE_CHECK(NearEqual(from.GetObjectToParentMatrix(),
+							 Lerp(from, to, 0.0f).GetObjectToParentMatrix()));
+		MAGE_CHECK(NearEqual(to.GetObjectToParentMatrix(),
+							 Lerp(from, to, 1.0f).GetObjectToParentMatrix()));
+	}
+
+	void TestLerp() {
+		const auto from = MakeFrom();
+		const auto to   = MakeTo();
+
+		for (const auto alpha : { 0.25f, 0.5f, 0.75f }) {
+			const auto transform = Lerp(from, to, alpha);
+
+			// The translation and scale components are interpolated
+			// linearly.
+			MAGE_CHECK(NearEqual(XMVectorLerp(from.GetTranslation(),
+											  to.GetTranslation(), alpha),
+								 transform.GetTranslation()));
+			MAGE_CHECK(NearEqual(XMVectorLerp(from.GetScale(),
+											  to.GetScale(), alpha),
+								 transform.GetScale()));
+
+			// The rotation component is a unit quaternion at the given
+			// fraction of the angle between both rotations.
+			const auto rotation = transform.GetRotation();
+			MAGE_CHECK_NEAR(1.0f, XMVectorGetX(XMQuaternionLength(rotation)),
+							g_epsilon);
+
+			const auto angle = [](FXMVECTOR q1, FXMVECTOR q2) noexcept {
+				const auto d = XMVectorGetX(XMQuaternionDot(q1, q2));
+				return 2.0f * std::acos(std::min(1.0f, std::abs(d)));
+			};
+			const auto total = angle(from.GetRotation(), to.GetRotation());
+			MAGE_CHECK_NEAR(alpha * total,
+							angle(from.GetRotation(), rotation), 1e-3f);
+			MAGE_CHECK_NEAR((1.0f - alpha) * total,
+							angle(rotation, to.GetRotation()), 1e-3f);
+		}
+
+		// Interpolating towards the same rotation preserves it.
+		const auto transform = Lerp(from, from, 0.5f);
+		MAGE_CHECK(NearEqual(Canonical(from.GetRotation()),
+							 Canonical(transform.GetRotation())));
+	}
+}
+
+int main() {
+	test::Run("SQTTransformDefault",       TestDefault);
+	test::Run("SQTTransformMatrices",      TestMatrices);
+	test::Run("SQTTransformLerpEndpoints", TestLerpEndpoints);
+	test::Run("SQTTransformLerp",          TestLerp);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "parallel/thread_pool.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	void TestResults() {
+		ThreadPool pool(4u);
+
+		std::vector< std::future< int > > futures;
+		for (int i = 0; 64 > i; ++i) {
+			futures.push_back(pool.Enqueue([i]() { return i * i; }));
+		}
+
+		for (int i = 0; 64 > i; ++i) {
+			MAGE_CHECK(i * i == futures[i].get());
+		}
+	}
+
+	void TestExceptions() {
+		ThreadPool pool(1u);
+
+		auto future = pool.Enqueue([]() -> int {
+			throw std::runtime_error("task failed");
+		});
+
+		bool thrown = false;
+		try {
+			(void)future.get();
+		}
+		catch (const std::runtime_error&) {
+			thrown = true;
+		}
+		MAGE_CHECK(thrown);
+	}
+
+	void TestDrainOnDestruction() {
+		std::atomic< int > nb_executed = 0;
+		std::vector< std::future< void > > futures;
+
+		{
+			ThreadPool pool(2u);
+			for (int i = 0; 32 > i; ++i) {
+				futures.push_back(pool.Enqueue([&nb_executed]() {
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+					++nb_executed;
+				}));
+			}
+		}
+
+		// All queued tasks are executed: no future reports a broken promise.
+		MAGE_CHECK(32 == nb_executed);
+		for (auto& future : futures) {
+			bool broken = false;
+			try {
+				future.get();
+			}
+			catch (const std::future_error&) {
+				broken = true;
+			}
+			MAGE_CHECK(!broken);
+		}
+	}
+
+	void TestJoin() {
+		std::atomic< int > nb_executed = 0;
+
+		ThreadPool pool(2u);
+		for (int i = 0; 32 > i; ++i) {
+			(void)pool.Enqueue([&nb_executed]() {
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				++nb_executed;
+			});
+		}
+
+		// Joining drains the queue, and the destructor joins nothing anymore.
+		pool.Join();
+		MAGE_CHECK(32 == nb_executed);
+		MAGE_CHECK(0u == pool.GetNumberOfQueuedTasks());
+		pool.Join();
+	}
+}
+
+int main() {
+	test::Run("ThreadPoolResults",            TestResults);
+	test::Run("ThreadPoolExceptions",         TestExceptions);
+	test::Run("ThreadPoolDrainOnDestruction", TestDrainOnDestruction);
+	test::Run("ThreadPoolJoin",               TestJoin);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
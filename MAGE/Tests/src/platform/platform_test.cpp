@@ -0,0 +1,82 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "io/binary_reader.hpp"
+#include "parallel/parallel.hpp"
+#include "system/system_usage.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <fstream>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	void TestNumberOfCores() {
+		const auto nb_physical_cores = NumberOfPhysicalCores();
+		const auto nb_system_cores   = NumberOfSystemCores();
+
+		MAGE_CHECK(1u <= nb_physical_cores);
+		MAGE_CHECK(1u <= nb_system_cores);
+	}
+
+	void TestMemoryUsage() {
+		MAGE_CHECK(0u < GetVirtualMemoryUsage());
+		MAGE_CHECK(0u < GetPhysicalMemoryUsage());
+	}
+
+	void TestReadBinaryFile() {
+		const auto path = std::filesystem::temp_directory_path()
+			            / "mage_platform_test.bin";
+		{
+			std::ofstream file(path, std::ios::binary);
+			for (int i = 0; 256 > i; ++i) {
+				file.put(static_cast< char >(i));
+			}
+		}
+
+		UniquePtr< U8[] > data;
+		std::size_t size = 0u;
+		ReadBinaryFile(path, data, size);
+		MAGE_CHECK(256u == size);
+		MAGE_CHECK(0u == data[0] && 255u == data[255]);
+
+		U8 range[16] = {};
+		const auto nb_read = ReadBinaryFile(path, 250u, range);
+		MAGE_CHECK(6u == nb_read);
+		MAGE_CHECK(250u == range[0] && 255u == range[5]);
+
+		std::filesystem::remove(path);
+
+		bool thrown = false;
+		try {
+			ReadBinaryFile(path, data, size);
+		}
+		catch (const Exception&) {
+			thrown = true;
+		}
+		MAGE_CHECK(thrown);
+	}
+}
+
+int main() {
+	test::Run("NumberOfCores",  TestNumberOfCores);
+	test::Run("MemoryUsage",    TestMemoryUsage);
+	test::Run("ReadBinaryFile", TestReadBinaryFile);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
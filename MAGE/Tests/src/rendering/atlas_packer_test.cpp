@@ -0,0 +1,167 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "resource/texture/atlas_packer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace mage::rendering;
+
+namespace {
+
+	struct Rectangle {
+		U32 m_x, m_y, m_width, m_height;
+	};
+
+	/**
+	 Packs random glyph-like rectangles until the first rectangle does not
+	 fit, and checks that all packed rectangles are disjoint and inside the
+	 page.
+
+	 @return		The packed rectangles.
+	 */
+	[[nodiscard]]
+	std::vector< Rectangle > PackUntilFull(AtlasPacker& packer, unsigned seed) {
+		std::mt19937 generator(seed);
+		std::uniform_int_distribution< U32 > width_distribution(4u, 32u);
+		std::uniform_int_distribution< U32 > height_distribution(12u, 24u);
+
+		const auto size = packer.GetSize();
+		std::vector< bool > used(static_cast< std::size_t >(size[0]) * size[1]);
+
+		std::vector< Rectangle > rectangles;
+		for (;;) {
+			const auto width  = width_distribution(generator);
+			const auto height = height_distribution(generator);
+			const auto position = packer.Pack(width, height);
+			if (!position) {
+				break;
+			}
+
+			const Rectangle rectangle = { (*position)[0], (*position)[1],
+										  width, height };
+			MAGE_CHECK(rectangle.m_x + width  <= size[0]);
+			MAGE_CHECK(rectangle.m_y + height <= size[1]);
+
+			for (auto y = rectangle.m_y; y < rectangle.m_y + height; ++y)
+			for (auto x = rectangle.m_x; x < rectangle.m_x + width;  ++x) {
+				auto&& pixel = used[static_cast< std::size_t >(y) * size[0] + x];
+				if (pixel) {
+					MAGE_CHECK(!pixel);
+					return rectangles;
+				}
+				pixel = true;
+			}
+
+			rectangles.push_back(rectangle);
+		}
+
+		return rectangles;
+	}
+
+	void TestExactFit() {
+		AtlasPacker packer(256u, 256u);
+
+		for (int i = 0; 4 > i; ++i) {
+			MAGE_CHECK(packer.Pack(128u, 128u).has_value());
+		}
+		MAGE_CHECK(!packer.Pack(1u, 1u).has_value());
+
+		MAGE_CHECK(4u == packer.GetNumberOfRectangles());
+		MAGE_CHECK_NEAR(1.0f, packer.GetOccupancy(), 1e-6f);
+		MAGE_CHECK_NEAR(0.0f, packer.GetFragmentation(), 1e-6f);
+	}
+
+	void TestInvalidRectangles() {
+		AtlasPacker packer(64u, 32u);
+
+		MAGE_CHECK(!packer.Pack(0u, 8u).has_value());
+		MAGE_CHECK(!packer.Pack(8u, 0u).has_value());
+		MAGE_CHECK(!packer.Pack(65u, 1u).has_value());
+		MAGE_CHECK(!packer.Pack(1u, 33u).has_value());
+		MAGE_CHECK(packer.Pack(64u, 32u).has_value());
+		MAGE_CHECK(1u == packer.GetNumberOfRectangles());
+	}
+
+	void TestBottomLeft() {
+		AtlasPacker packer(100u, 100u);
+
+		// The rectangle minimizing the top edge is chosen.
+		const auto p0 = packer.Pack(40u, 10u);
+		const auto p1 = packer.Pack(60u, 30u);
+		const auto p2 = packer.Pack(100u, 5u);
+		MAGE_CHECK(p0 && 0u  == (*p0)[0] && 0u  == (*p0)[1]);
+		MAGE_CHECK(p1 && 40u == (*p1)[0] && 0u  == (*p1)[1]);
+		MAGE_CHECK(p2 && 0u  == (*p2)[0] && 30u == (*p2)[1]);
+
+		// The 40x20 gap below the last rectangle can no longer be packed.
+		MAGE_CHECK_NEAR(2700.0f / 10000.0f, packer.GetOccupancy(), 1e-6f);
+		MAGE_CHECK_NEAR( 800.0f /  3500.0f, packer.GetFragmentation(), 1e-6f);
+	}
+
+	void TestClear() {
+		AtlasPacker packer(64u, 64u);
+
+		MAGE_CHECK(packer.Pack(64u, 64u).has_value());
+		packer.Clear();
+
+		MAGE_CHECK(0u == packer.GetNumberOfRectangles());
+		MAGE_CHECK_NEAR(0.0f, packer.GetOccupancy(), 1e-6f);
+		MAGE_CHECK_NEAR(0.0f, packer.GetFragmentation(), 1e-6f);
+		MAGE_CHECK(packer.Pack(64u, 64u).has_value());
+	}
+
+	void TestGlyphs() {
+		for (const auto& [width, height] : { std::pair(256u, 256u),
+											 std::pair(512u, 512u),
+											 std::pair(1024u, 256u) }) {
+			AtlasPacker packer(width, height);
+
+			const auto rectangles = PackUntilFull(packer, width ^ height);
+			MAGE_CHECK(rectangles.size() == packer.GetNumberOfRectangles());
+
+			U64 area = 0u;
+			for (const auto& rectangle : rectangles) {
+				area += static_cast< U64 >(rectangle.m_width) * rectangle.m_height;
+			}
+			const auto occupancy = static_cast< F32 >(area) / (width * height);
+			MAGE_CHECK_NEAR(occupancy, packer.GetOccupancy(), 1e-6f);
+
+			std::printf("  %4ux%-4u %5zu glyphs: occupancy %5.1f%%, "
+						"fragmentation %5.1f%%\n",
+						width, height, rectangles.size(),
+						100.0f * packer.GetOccupancy(),
+						100.0f * packer.GetFragmentation());
+
+			// Glyphs of similar heights are packed tightly.
+			MAGE_CHECK(0.8f  < packer.GetOccupancy());
+			MAGE_CHECK(0.15f > packer.GetFragmentation());
+		}
+	}
+}
+
+int main() {
+	test::Run("AtlasPackerExactFit",         TestExactFit);
+	test::Run("AtlasPackerInvalidRectangles", TestInvalidRectangles);
+	test::Run("AtlasPackerBottomLeft",       TestBottomLeft);
+	test::Run("AtlasPackerClear",            TestClear);
+	test::Run("AtlasPackerGlyphs",           TestGlyphs);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,590 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "resource/texture/block_compression.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace mage::rendering;
+
+namespace {
+
+	/**
+	 The maximum root mean square error of the color channels of BC1 blocks
+	 of smooth texel blocks.
+	 */
+	constexpr F32 g_bc1_max_rmse = 20.0f;
+
+	//-------------------------------------------------------------------------
+	// Decoders (reference implementations of the Direct3D 11 specification)
+	//-------------------------------------------------------------------------
+
+	/**
+	 A class of little endian bit readers for reading compressed blocks.
+	 */
+	class BitReader {
+
+	public:
+
+		explicit BitReader(const U8* input) noexcept
+			: m_input(input),
+			m_position(0u) {}
+
+		[[nodiscard]]
+		U32 Read(U32 nb_bits) noexcept {
+			U32 value = 0u;
+			for (U32 i = 0u; i < nb_bits; ++i, ++m_position) {
+				value |= ((m_input[m_position >> 3u] >> (m_position & 7u)) & 1u) << i;
+			}
+			return value;
+		}
+
+	private:
+
+		const U8* m_input;
+
+		std::size_t m_position;
+	};
+
+	void ExpandRGB565(U32 color, U32 (&output)[3]) noexcept {
+		const U32 r = (color >> 11u) & 31u;
+		const U32 g = (color >>  5u) & 63u;
+		const U32 b =  color         & 31u;
+		output[0] = (r << 3u) | (r >> 2u);
+		output[1] = (g << 2u) | (g >> 4u);
+		output[2] = (b << 3u) | (b >> 2u);
+	}
+
+	[[nodiscard]]
+	TexelBlock DecodeBC1(const U8* input) noexcept {
+		BitReader reader(input);
+		const auto c0 = reader.Read(16u);
+		const auto c1 = reader.Read(16u);
+
+		U32 palette[4][4];
+		ExpandRGB565(c0, reinterpret_cast< U32 (&)[3] >(palette[0]));
+		ExpandRGB565(c1, reinterpret_cast< U32 (&)[3] >(palette[1]));
+		palette[0][3] = palette[1][3] = palette[2][3] = 255u;
+		palette[3][3] = (c0 > c1) ? 255u : 0u;
+		for (std::size_t c = 0u; c < 3u; ++c) {
+			if (c0 > c1) {
+				palette[2][c] = (2u * palette[0][c] +      palette[1][c]) / 3u;
+				palette[3][c] = (     palette[0][c] + 2u * palette[1][c]) / 3u;
+			}
+			else {
+				palette[2][c] = (palette[0][c] + palette[1][c]) / 2u;
+				palette[3][c] = 0u;
+			}
+		}
+
+		TexelBlock texels;
+		for (auto& texel : texels) {
+			const auto index = reader.Read(2u);
+			for (std::size_t c = 0u; c < 4u; ++c) {
+				texel[c] = static_cast< U8 >(palette[index][c]);
+			}
+		}
+		return texels;
+	}
+
+	void DecodeBC4(const U8* input, std::size_t channel,
+				   TexelBlock& texels) noexcept {
+		BitReader reader(input);
+		const auto a0 = reader.Read(8u);
+		const auto a1 = reader.Read(8u);
+
+		U32 palette[8] = { a0, a1 };
+		if (a0 > a1) {
+			for (U32 i = 1u; i < 7u; ++i) {
+				palette[i + 1u] = ((7u - i) * a0 + i * a1 + 3u) / 7u;
+			}
+		}
+		else {
+			for (U32 i = 1u; i < 5u; ++i) {
+				palette[i + 1u] = ((5u - i) * a0 + i * a1 + 2u) / 5u;
+			}
+			palette[6] = 0u;
+			palette[7] = 255u;
+		}
+
+		for (auto& texel : texels) {
+			texel[channel] = static_cast< U8 >(palette[reader.Read(3u)]);
+		}
+	}
+
+	[[nodiscard]]
+	TexelBlock DecodeBC3(const U8* input) noexcept {
+		auto texels = DecodeBC1(input + 8u);
+		DecodeBC4(input, 3u, texels);
+		return texels;
+	}
+
+	[[nodiscard]]
+	TexelBlock DecodeBC7Mode6(const U8* input) noexcept {
+		constexpr U32 weights[16] = {
+			0u, 4u, 9u, 13u, 17u, 21u, 26u, 30u,
+			34u, 38u, 43u, 47u, 51u, 55u, 60u, 64u
+		};
+
+		BitReader reader(input);
+		MAGE_CHECK((1u << 6u) == reader.Read(7u));
+
+		U32 e0[4];
+		U32 e1[4];
+		for (std::size_t c = 0u; c < 4u; ++c) {
+			e0[c] = reader.Read(7u);
+			e1[c] = reader.Read(7u);
+		}
+		const auto p0 = reader.Read(1u);
+		const auto p1 = reader.Read(1u);
+		for (std::size_t c = 0u; c < 4u; ++c) {
+			e0[c] = (e0[c] << 1u) | p0;
+			e1[c] = (e1[c] << 1u) | p1;
+		}
+
+		TexelBlock texels;
+		for (std::size_t i = 0u; i < 16u; ++i) {
+			// The most significant bit of the anchor index is implicitly 0.
+			const auto w = weights[reader.Read((0u == i) ? 3u : 4u)];
+			for (std::size_t c = 0u; c < 4u; ++c) {
+				texels[i][c] = static_cast< U8 >(
+					((64u - w) * e0[c] + w * e1[c] + 32u) >> 6u);
+			}
+		}
+		return texels;
+	}
+
+	//-------------------------------------------------------------------------
+	// Utilities
+	//-------------------------------------------------------------------------
+
+	/**
+	 Returns the maximum absolute error of the given channels.
+	 */
+	[[nodiscard]]
+	U32 GetMaxError(const TexelBlock& lhs, const TexelBlock& rhs,
+					std::size_t first_channel, std::size_t last_channel) noexcept {
+		U32 max_error = 0u;
+		for (std::size_t i = 0u; i < 16u; ++i) {
+			for (auto c = first_channel; c <= last_channel; ++c) {
+				max_error = std::max(max_error, static_cast< U32 >(
+					std::abs(static_cast< S32 >(lhs[i][c])
+						   - static_cast< S32 >(rhs[i][c]))));
+			}
+		}
+		return max_error;
+	}
+
+	/**
+	 Returns the root mean square error of the given channels.
+	 */
+	[[nodiscard]]
+	F32 GetRMSE(const TexelBlock& lhs, const TexelBlock& rhs,
+				std::size_t first_channel, std::size_t last_channel) noexcept {
+		F32 error = 0.0f;
+		for (std::size_t i = 0u; i < 16u; ++i) {
+			for (auto c = first_channel; c <= last_channel; ++c) {
+				const auto d = static_cast< F32 >(lhs[i][c])
+					         - static_cast< F32 >(rhs[i][c]);
+				error += d * d;
+			}
+		}
+		return std::sqrt(error / (16.0f * (last_channel - first_channel + 1u)));
+	}
+
+	/**
+	 Returns the squared error of the given channel.
+	 */
+	[[nodiscard]]
+	U32 GetSquaredError(const TexelBlock& lhs, const TexelBlock& rhs,
+						std::size_t channel) noexcept {
+		U32 error = 0u;
+		for (std::size_t i = 0u; i < 16u; ++i) {
+			const auto d = static_cast< S32 >(lhs[i][channel])
+				         - static_cast< S32 >(rhs[i][channel]);
+			error += static_cast< U32 >(d * d);
+		}
+		return error;
+	}
+
+	/**
+	 Returns the squared error of the given channel of the given texel block
+	 compressed with the BC4 8-value mode (with the minimum and maximum as
+	 endpoints).
+	 */
+	[[nodiscard]]
+	U32 GetBC4EightValueError(const TexelBlock& texels,
+							  std::size_t channel) noexcept {
+		U32 a0 = 0u;
+		U32 a1 = 255u;
+		for (const auto& texel : texels) {
+			a0 = std::max< U32 >(a0, texel[channel]);
+			a1 = std::min< U32 >(a1, texel[channel]);
+		}
+
+		U32 palette[8] = { a0, a1 };
+		for (U32 i = 1u; i < 7u; ++i) {
+			palette[i + 1u] = ((7u - i) * a0 + i * a1 + 3u) / 7u;
+		}
+
+		U32 error = 0u;
+		for (const auto& texel : texels) {
+			U32 best_error = std::numeric_limits< U32 >::max();
+			for (const auto v : palette) {
+				const auto d = static_cast< S32 >(texel[channel])
+					         - static_cast< S32 >(v);
+				best_error = std::min(best_error, static_cast< U32 >(d * d));
+			}
+			error += best_error;
+		}
+		return error;
+	}
+
+	[[nodiscard]]
+	constexpr U8x4 Texel(U32 r, U32 g, U32 b, U32 a) noexcept {
+		return U8x4(static_cast< U8 >(r), static_cast< U8 >(g),
+					static_cast< U8 >(b), static_cast< U8 >(a));
+	}
+
+	[[nodiscard]]
+	TexelBlock CreateConstantBlock(U8 r, U8 g, U8 b, U8 a) noexcept {
+		TexelBlock texels;
+		texels.fill(U8x4(r, g, b, a));
+		return texels;
+	}
+
+	/**
+	 Creates a texel block interpolating between the given colors in
+	 row-major order.
+	 */
+	[[nodiscard]]
+	TexelBlock CreateGradientBlock(const U8x4& from, const U8x4& to) noexcept {
+		TexelBlock texels;
+		for (std::size_t i = 0u; i < 16u; ++i) {
+			for (std::size_t c = 0u; c < 4u; ++c) {
+				const auto v = from[c] + (static_cast< S32 >(to[c]) - from[c])
+					         * static_cast< S32 >(i) / 15;
+				texels[i][c] = static_cast< U8 >(v);
+			}
+		}
+		return texels;
+	}
+
+	/**
+	 Creates a smooth texel block (i.e. a random gradient with noise).
+	 */
+	[[nodiscard]]
+	TexelBlock CreateSmoothBlock(std::mt19937& generator) noexcept {
+		std::uniform_int_distribution< S32 > color(0, 255);
+		std::uniform_int_distribution< S32 > noise(-4, 4);
+
+		U8x4 from;
+		U8x4 to;
+		for (std::size_t c = 0u; c < 4u; ++c) {
+			from[c] = static_cast< U8 >(color(generator));
+			to[c]   = static_cast< U8 >(color(generator));
+		}
+
+		auto texels = CreateGradientBlock(from, to);
+		for (auto& texel : texels) {
+			for (std::size_t c = 0u; c < 4u; ++c) {
+				texel[c] = static_cast< U8 >(
+					std::clamp(texel[c] + noise(generator), 0, 255));
+			}
+		}
+		return texels;
+	}
+
+	[[nodiscard]]
+	TexelBlock RoundTripBC1(const TexelBlock& texels) noexcept {
+		U8 block[8];
+		CompressBC1Block(texels, gsl::span< U8, 8 >(block, 8));
+		return DecodeBC1(block);
+	}
+
+	[[nodiscard]]
+	TexelBlock RoundTripBC3(const TexelBlock& texels) noexcept {
+		U8 block[16];
+		CompressBC3Block(texels, gsl::span< U8, 16 >(block, 16));
+		return DecodeBC3(block);
+	}
+
+	[[nodiscard]]
+	TexelBlock RoundTripBC4(const TexelBlock& texels, std::size_t channel,
+							U8 (&block)[8]) noexcept {
+		CompressBC4Block(texels, channel, gsl::span< U8, 8 >(block, 8));
+		auto decoded = texels;
+		DecodeBC4(block, channel, decoded);
+		return decoded;
+	}
+
+	[[nodiscard]]
+	TexelBlock RoundTripBC7(const TexelBlock& texels) noexcept {
+		U8 block[16];
+		CompressBC7Block(texels, gsl::span< U8, 16 >(block, 16));
+		return DecodeBC7Mode6(block);
+	}
+
+	//-------------------------------------------------------------------------
+	// BC1
+	//-------------------------------------------------------------------------
+
+	void TestBC1Constant() {
+		// Constant blocks are exact up to the RGB565 quantization.
+		const auto texels  = CreateConstantBlock(200u, 100u, 50u, 255u);
+		const auto decoded = RoundTripBC1(texels);
+		MAGE_CHECK(4u >= GetMaxError(texels, decoded, 0u, 2u));
+
+		// Equal endpoints must not select the 3-color mode's transparent
+		// black.
+		U8 block[8];
+		CompressBC1Block(texels, gsl::span< U8, 8 >(block, 8));
+		MAGE_CHECK(0u == (block[4] | block[5] | block[6] | block[7]));
+		MAGE_CHECK(255u == decoded[0][3]);
+
+		const auto black = CreateConstantBlock(0u, 0u, 0u, 255u);
+		MAGE_CHECK(0u == GetMaxError(black, RoundTripBC1(black), 0u, 3u));
+	}
+
+	void TestBC1EndpointSwap() {
+		// The principal axis and least squares fit produce the darker
+		// endpoint first for both gradient directions: the endpoints must be
+		// swapped to select the 4-color mode.
+		const auto gradients = {
+			CreateGradientBlock(Texel(  0u,   0u,   0u, 255u), Texel(255u, 255u, 255u, 255u)),
+			CreateGradientBlock(Texel(255u, 255u, 255u, 255u), Texel(  0u,   0u,   0u, 255u)),
+			CreateGradientBlock(Texel( 10u, 200u,  30u, 255u), Texel(240u,  20u, 220u, 255u)),
+		};
+
+		for (const auto& texels : gradients) {
+			U8 block[8];
+			CompressBC1Block(texels, gsl::span< U8, 8 >(block, 8));
+			const auto c0 = static_cast< U32 >(block[0] | (block[1] << 8u));
+			const auto c1 = static_cast< U32 >(block[2] | (block[3] << 8u));
+			MAGE_CHECK(c0 > c1);
+
+			// Four colors along the gradient: at most half of a third of the
+			// range, plus the quantization error.
+			const auto decoded = DecodeBC1(block);
+			MAGE_CHECK(48u >= GetMaxError(texels, decoded, 0u, 2u));
+			MAGE_CHECK(24.0f >= GetRMSE(texels, decoded, 0u, 2u));
+		}
+	}
+
+	void TestBC1Alpha() {
+		// The alpha channel is ignored: the block is decoded as opaque, even
+		// for transparent texels.
+		std::mt19937 generator(33u);
+		for (int i = 0; 64 > i; ++i) {
+			auto texels = CreateSmoothBlock(generator);
+			texels[i % 16][3] = 0u;
+
+			const auto decoded = RoundTripBC1(texels);
+			for (const auto& texel : decoded) {
+				MAGE_CHECK(255u == texel[3]);
+			}
+		}
+	}
+
+	void TestBC1Smooth() {
+		// Four colors along gradients spanning (up to) the entire color cube.
+		std::mt19937 generator(1u);
+		for (int i = 0; 256 > i; ++i) {
+			const auto texels = CreateSmoothBlock(generator);
+			MAGE_CHECK(g_bc1_max_rmse >= GetRMSE(texels, RoundTripBC1(texels), 0u, 2u));
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// BC3
+	//-------------------------------------------------------------------------
+
+	void TestBC3() {
+		std::mt19937 generator(3u);
+		for (int i = 0; 256 > i; ++i) {
+			const auto texels  = CreateSmoothBlock(generator);
+			const auto decoded = RoundTripBC3(texels);
+			MAGE_CHECK(g_bc1_max_rmse >= GetRMSE(texels, decoded, 0u, 2u));
+			MAGE_CHECK(GetBC4EightValueError(texels, 3u)
+					   >= GetSquaredError(texels, decoded, 3u));
+		}
+
+		// Constant alpha is exact.
+		const auto texels = CreateConstantBlock(10u, 20u, 30u, 77u);
+		const auto decoded = RoundTripBC3(texels);
+		MAGE_CHECK(0u == GetMaxError(texels, decoded, 3u, 3u));
+	}
+
+	//-------------------------------------------------------------------------
+	// BC4
+	//-------------------------------------------------------------------------
+
+	void TestBC4EightValueMode() {
+		// A gradient without 0 and 255 uses the 8-value mode: the error is at
+		// most half of a seventh of the range.
+		const auto texels = CreateGradientBlock(Texel( 20u,   0u,   0u,   0u),
+												Texel(230u,   0u,   0u,   0u));
+		U8 block[8];
+		const auto decoded = RoundTripBC4(texels, 0u, block);
+		MAGE_CHECK(block[0] > block[1]);
+		MAGE_CHECK(20u == block[1] && 230u == block[0]);
+		MAGE_CHECK(15u >= GetMaxError(texels, decoded, 0u, 0u));
+
+		// Two values are exact.
+		TexelBlock two = CreateConstantBlock(40u, 0u, 0u, 0u);
+		for (std::size_t i = 0u; i < 16u; i += 3u) {
+			two[i][0] = 180u;
+		}
+		MAGE_CHECK(0u == GetMaxError(two, RoundTripBC4(two, 0u, block), 0u, 0u));
+		MAGE_CHECK(block[0] > block[1]);
+	}
+
+	void TestBC4SixValueMode() {
+		// Values 0 and 255 plus a narrow range of intermediate values use the
+		// 6-value mode, which represents 0 and 255 exactly.
+		TexelBlock texels = CreateConstantBlock(0u, 0u, 0u, 0u);
+		for (std::size_t i = 0u; i < 16u; ++i) {
+			texels[i][1] = static_cast< U8 >(100u + 4u * (i % 6u));
+		}
+		texels[0][1]  = 0u;
+		texels[15][1] = 255u;
+
+		U8 block[8];
+		const auto decoded = RoundTripBC4(texels, 1u, block);
+		MAGE_CHECK(block[0] <= block[1]);
+		MAGE_CHECK(100u == block[0] && 120u == block[1]);
+		MAGE_CHECK(0u   == decoded[0][1]);
+		MAGE_CHECK(255u == decoded[15][1]);
+		MAGE_CHECK(2u >= GetMaxError(texels, decoded, 1u, 1u));
+
+		// Only 0 and 255 are exact in the 8-value mode.
+		TexelBlock extremes = CreateConstantBlock(0u, 0u, 0u, 0u);
+		for (std::size_t i = 0u; i < 16u; i += 2u) {
+			extremes[i][2] = 255u;
+		}
+		MAGE_CHECK(0u == GetMaxError(extremes, RoundTripBC4(extremes, 2u, block),
+									 2u, 2u));
+	}
+
+	void TestBC4Constant() {
+		for (const U32 v : { 0u, 1u, 128u, 254u, 255u }) {
+			const auto texels = CreateConstantBlock(0u, 0u, 0u, static_cast< U8 >(v));
+			U8 block[8];
+			MAGE_CHECK(0u == GetMaxError(texels, RoundTripBC4(texels, 3u, block),
+										 3u, 3u));
+			MAGE_CHECK(block[0] == block[1]);
+		}
+	}
+
+	void TestBC4Random() {
+		// The better of both modes is never worse than the 8-value mode, whose
+		// error is at most half of a seventh of the range.
+		std::mt19937 generator(4u);
+		std::uniform_int_distribution< S32 > value(0, 255);
+		std::size_t nb_six_value_blocks = 0u;
+		for (int i = 0; 1024 > i; ++i) {
+			TexelBlock texels;
+			U32 min = 255u;
+			U32 max = 0u;
+			for (auto& texel : texels) {
+				texel[0] = static_cast< U8 >(value(generator) >> (i % 4));
+				min = std::min< U32 >(min, texel[0]);
+				max = std::max< U32 >(max, texel[0]);
+			}
+
+			U8 block[8];
+			const auto decoded = RoundTripBC4(texels, 0u, block);
+			MAGE_CHECK(GetBC4EightValueError(texels, 0u)
+					   >= GetSquaredError(texels, decoded, 0u));
+			if (block[0] > block[1]) {
+				MAGE_CHECK((max - min) / 14u + 1u
+						   >= GetMaxError(texels, decoded, 0u, 0u));
+			}
+			else {
+				++nb_six_value_blocks;
+			}
+		}
+		MAGE_CHECK(0u != nb_six_value_blocks);
+	}
+
+	//-------------------------------------------------------------------------
+	// BC7
+	//-------------------------------------------------------------------------
+
+	void TestBC7Constant() {
+		// 7-bit endpoints with a p-bit represent every 8-bit value exactly,
+		// as long as all channels have the same parity (since the p-bit is
+		// shared by all channels of an endpoint).
+		for (const U32 v : { 0u, 1u, 127u, 128u, 254u, 255u }) {
+			const auto u = static_cast< U8 >(v);
+			const auto gray = CreateConstantBlock(u, u, u, u);
+			MAGE_CHECK(0u == GetMaxError(gray, RoundTripBC7(gray), 0u, 3u));
+
+			const auto color = CreateConstantBlock(u, u, static_cast< U8 >(255u - v), u);
+			MAGE_CHECK(1u >= GetMaxError(color, RoundTripBC7(color), 0u, 3u));
+		}
+	}
+
+	void TestBC7Anchor() {
+		// The first texel lies at the second endpoint: the endpoints must be
+		// swapped, since the most significant bit of its index is implicit.
+		const auto texels = CreateGradientBlock(Texel(255u, 255u, 255u, 255u),
+												Texel(  0u,   0u,   0u,   0u));
+		U8 block[16];
+		CompressBC7Block(texels, gsl::span< U8, 16 >(block, 16));
+		const auto decoded = DecodeBC7Mode6(block);
+		MAGE_CHECK(4u >= GetMaxError(texels, decoded, 0u, 3u));
+
+		const auto reversed = CreateGradientBlock(Texel(  0u,   0u,   0u,   0u),
+												  Texel(255u, 255u, 255u, 255u));
+		MAGE_CHECK(4u >= GetMaxError(reversed, RoundTripBC7(reversed), 0u, 3u));
+	}
+
+	void TestBC7Smooth() {
+		std::mt19937 generator(7u);
+		for (int i = 0; 256 > i; ++i) {
+			const auto texels  = CreateSmoothBlock(generator);
+			const auto decoded = RoundTripBC7(texels);
+			MAGE_CHECK(8.0f >= GetRMSE(texels, decoded, 0u, 3u));
+			// Never worse than BC1 for the color channels.
+			MAGE_CHECK(GetRMSE(texels, decoded, 0u, 2u)
+					   <= GetRMSE(texels, RoundTripBC1(texels), 0u, 2u) + 0.5f);
+		}
+	}
+}
+
+int main() {
+	test::Run("BC1Constant",          TestBC1Constant);
+	test::Run("BC1EndpointSwap",      TestBC1EndpointSwap);
+	test::Run("BC1Alpha",             TestBC1Alpha);
+	test::Run("BC1Smooth",            TestBC1Smooth);
+	test::Run("BC3",                  TestBC3);
+	test::Run("BC4EightValueMode",    TestBC4EightValueMode);
+	test::Run("BC4SixValueMode",      TestBC4SixValueMode);
+	test::Run("BC4Constant",          TestBC4Constant);
+	test::Run("BC4Random",            TestBC4Random);
+	test::Run("BC7Constant",          TestBC7Constant);
+	test::Run("BC7Anchor",            TestBC7Anchor);
+	test::Run("BC7Smooth",            TestBC7Smooth);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
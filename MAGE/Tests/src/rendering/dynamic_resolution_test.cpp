@@ -0,0 +1,194 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "renderer/dynamic_resolution.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace mage::rendering;
+
+namespace {
+
+	/**
+	 The target frame time (in milliseconds).
+	 */
+	constexpr F64 g_target_frame_time = 16.0;
+
+	/**
+	 A class of synthetic GPU workloads whose frame time is proportional to
+	 the number of rendered pixels, with optional multiplicative noise.
+	 */
+	class Workload {
+
+	public:
+
+		explicit Workload(F64 cost, F64 noise = 0.0)
+			: m_cost(cost), m_noise(noise), m_generator(77u) {}
+
+		void SetCost(F64 cost) noexcept {
+			m_cost = cost;
+		}
+
+		/**
+		 Returns the frame time (in milliseconds) of a frame rendered at the
+		 given resolution scale.
+		 */
+		[[nodiscard]]
+		F64 GetFrameTime(F32 scale) {
+			std::uniform_real_distribution< F64 > distribution(-m_noise, m_noise);
+			const auto noise = (0.0 == m_noise) ? 0.0 : distribution(m_generator);
+			return m_cost * scale * scale * (1.0 + noise);
+		}
+
+	private:
+
+		F64 m_cost;
+		F64 m_noise;
+		std::mt19937 m_generator;
+	};
+
+	/**
+	 Drives the given controller with the given workload for the given number
+	 of frames and returns the final resolution scale.
+	 */
+	F32 Run(DynamicResolutionController& controller, Workload& workload,
+			std::size_t nb_frames) {
+		for (std::size_t i = 0u; i < nb_frames; ++i) {
+			controller.Update(workload.GetFrameTime(controller.GetScale()));
+		}
+		return controller.GetScale();
+	}
+
+	void TestConvergence() {
+		DynamicResolutionController controller(g_target_frame_time);
+		Workload workload(20.0);
+
+		// The resolution scale converges to the resolution scale matching
+		// the target frame time, up to the hysteresis thresholds.
+		const auto scale = Run(controller, workload, 200u);
+		const auto expected = std::sqrt(g_target_frame_time / 20.0);
+		MAGE_CHECK_NEAR(expected, scale, 0.03 * expected);
+		MAGE_CHECK_NEAR(g_target_frame_time, workload.GetFrameTime(scale),
+						0.06 * g_target_frame_time);
+
+		// Once converged, the resolution scale remains constant.
+		MAGE_CHECK(scale == Run(controller, workload, 100u));
+	}
+
+	void TestUnderBudget() {
+		DynamicResolutionController controller(g_target_frame_time);
+		Workload workload(10.0);
+
+		for (std::size_t i = 0u; i < 100u; ++i) {
+			MAGE_CHECK(1.0f == controller.Update(
+				workload.GetFrameTime(controller.GetScale())));
+		}
+	}
+
+	void TestNoWindUp() {
+		DynamicResolutionController controller(g_target_frame_time, 0.5f, 1.0f);
+		Workload workload(100.0);
+
+		// The resolution scale saturates at the minimum resolution scale.
+		MAGE_CHECK(0.5f == Run(controller, workload, 200u));
+
+		// The saturation does not accumulate an error delaying the recovery
+		// once the workload drops.
+		workload.SetCost(10.0);
+		std::size_t nb_frames = 0u;
+		while (1.0f != controller.GetScale() && 100u > nb_frames) {
+			controller.Update(workload.GetFrameTime(controller.GetScale()));
+			++nb_frames;
+		}
+		MAGE_CHECK(100u > nb_frames);
+	}
+
+	void TestStepResponse() {
+		DynamicResolutionController controller(g_target_frame_time);
+		Workload workload(30.0);
+
+		static_cast< void >(Run(controller, workload, 200u));
+
+		// After a drop of the workload, the resolution scale rises to the
+		// new resolution scale without oscillating around it.
+		workload.SetCost(20.0);
+		const auto expected = std::sqrt(g_target_frame_time / 20.0);
+		auto previous = controller.GetScale();
+		for (std::size_t i = 0u; i < 200u; ++i) {
+			const auto scale = controller.Update(workload.GetFrameTime(previous));
+			MAGE_CHECK(previous <= scale);
+			MAGE_CHECK(scale <= expected * 1.03);
+			previous = scale;
+		}
+		MAGE_CHECK_NEAR(expected, previous, 0.03 * expected);
+	}
+
+	void TestNoise() {
+		DynamicResolutionController controller(g_target_frame_time);
+		Workload workload(g_target_frame_time, 0.05);
+
+		// Frame time noise around the target frame time does not cause the
+		// resolution scale to oscillate.
+		std::size_t nb_changes = 0u;
+		auto previous = controller.GetScale();
+		for (std::size_t i = 0u; i < 1000u; ++i) {
+			const auto scale = controller.Update(workload.GetFrameTime(previous));
+			if (scale != previous) {
+				++nb_changes;
+			}
+			previous = scale;
+		}
+
+		MAGE_CHECK(0.95f <= previous);
+		MAGE_CHECK(50u > nb_changes);
+		std::printf("  %zu resolution scale changes in 1000 frames\n",
+					nb_changes);
+	}
+
+	void TestReset() {
+		DynamicResolutionController controller(g_target_frame_time);
+		Workload workload(40.0);
+
+		MAGE_CHECK(1.0f > Run(controller, workload, 50u));
+
+		controller.Reset();
+		MAGE_CHECK(1.0f == controller.GetScale());
+
+		// A non-positive target frame time or frame time is ignored.
+		controller.SetTargetFrameTime(0.0);
+		MAGE_CHECK(1.0f == Run(controller, workload, 50u));
+		controller.SetTargetFrameTime(g_target_frame_time);
+		MAGE_CHECK(1.0f == controller.Update(0.0));
+
+		controller.SetScaleRange(0.25f, 0.75f);
+		MAGE_CHECK(0.75f == controller.GetScale());
+	}
+}
+
+int main() {
+	test::Run("DynamicResolutionConvergence",  TestConvergence);
+	test::Run("DynamicResolutionUnderBudget",  TestUnderBudget);
+	test::Run("DynamicResolutionNoWindUp",     TestNoWindUp);
+	test::Run("DynamicResolutionStepResponse", TestStepResponse);
+	test::Run("DynamicResolutionNoise",        TestNoise);
+	test::Run("DynamicResolutionReset",        TestReset);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,231 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "renderer/frame_handoff.hpp"
+#include "type/scalar_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace mage::rendering;
+
+namespace {
+
+	/**
+	 A frame (i.e. the stand-in of a render snapshot).
+	 */
+	struct Frame {
+
+		/**
+		 The number of the frame (written by the submitting thread).
+		 */
+		U64 m_number = 0u;
+
+		/**
+		 The number of the last rendering of the frame (written by the render
+		 thread, i.e. the stand-in of the pipeline statistics).
+		 */
+		U64 m_rendered_number = 0u;
+	};
+
+	/**
+	 A render function recording the numbers of the rendered frames, and
+	 throwing while rendering the frame with the given number.
+	 */
+	struct Renderer {
+
+		void operator()(Frame& frame) {
+			// Give the submitting thread the chance to overlap.
+			if (0u == frame.m_number % 8u) {
+				std::this_thread::sleep_for(std::chrono::microseconds(100));
+			}
+
+			frame.m_rendered_number = frame.m_number;
+			m_rendered->push_back(frame.m_number);
+
+			if (m_failing_number == frame.m_number) {
+				throw std::runtime_error("render failed");
+			}
+		}
+
+		std::vector< U64 >* m_rendered = nullptr;
+		U64 m_failing_number           = 0u;
+	};
+
+	void TestSubmit() {
+		std::vector< U64 > rendered;
+		FrameHandoff< Frame > handoff;
+		MAGE_CHECK(!handoff.IsRunning());
+
+		handoff.Start(Renderer{ &rendered });
+		MAGE_CHECK(handoff.IsRunning());
+
+		constexpr U64 nb_frames = 200u;
+		std::vector< U64 > handed_back;
+		for (U64 number = 1u; number <= nb_frames; ++number) {
+			handoff.Submit([&handed_back, number](Frame& frame) {
+				// The previous rendering of the frame (if any) completed: its
+				// result is handed back to the submitting thread.
+				handed_back.push_back(frame.m_rendered_number);
+				MAGE_CHECK(frame.m_number == frame.m_rendered_number);
+				frame.m_number = number;
+			});
+		}
+
+		// The submitted frame is rendered before stopping.
+		handoff.Stop();
+		MAGE_CHECK(!handoff.IsRunning());
+
+		// All frames are rendered, in submission order.
+		MAGE_CHECK(nb_frames == rendered.size());
+		for (std::size_t i = 0u; i < rendered.size(); ++i) {
+			MAGE_CHECK(i + 1u == rendered[i]);
+		}
+
+		// The result of a frame is handed back two frames later.
+		MAGE_CHECK(0u == handed_back[0]);
+		MAGE_CHECK(0u == handed_back[1]);
+		for (std::size_t i = 2u; i < handed_back.size(); ++i) {
+			MAGE_CHECK(i - 1u == handed_back[i]);
+		}
+	}
+
+	void TestFlush() {
+		std::vector< U64 > rendered;
+		FrameHandoff< Frame > handoff;
+		handoff.Start(Renderer{ &rendered });
+
+		for (U64 number = 1u; number <= 10u; ++number) {
+			handoff.Submit([number](Frame& frame) {
+				frame.m_number = number;
+			});
+
+			// All submitted frames are rendered after a flush.
+			handoff.Flush();
+			MAGE_CHECK(number == rendered.size());
+		}
+	}
+
+	void TestException() {
+		std::vector< U64 > rendered;
+		FrameHandoff< Frame > handoff;
+		handoff.Start(Renderer{ &rendered, 3u });
+
+		// The exception of the render thread is rethrown once, on the next
+		// submission or flush.
+		std::size_t nb_exceptions = 0u;
+		for (U64 number = 1u; number <= 10u; ++number) {
+			try {
+				handoff.Submit([number](Frame& frame) {
+					frame.m_number = number;
+				});
+			}
+			catch (const std::runtime_error&) {
+				++nb_exceptions;
+			}
+		}
+		try {
+			handoff.Flush();
+		}
+		catch (const std::runtime_error&) {
+			++nb_exceptions;
+		}
+		MAGE_CHECK(1u == nb_exceptions);
+
+		// The render thread keeps rendering after an exception. The frame
+		// which is not submitted due to the exception is skipped.
+		handoff.Stop();
+		MAGE_CHECK(9u == rendered.size());
+		MAGE_CHECK(3u == rendered[2]);
+	}
+
+	void TestExceptionAfterStop() {
+		std::vector< U64 > rendered;
+		FrameHandoff< Frame > handoff;
+		handoff.Start(Renderer{ &rendered, 1u });
+		handoff.Submit([](Frame& frame) {
+			frame.m_number = 1u;
+		});
+		handoff.Stop();
+
+		// The exception of the stopped render thread is rethrown on the next
+		// flush only.
+		bool thrown = false;
+		try {
+			handoff.Flush();
+		}
+		catch (const std::runtime_error&) {
+			thrown = true;
+		}
+		MAGE_CHECK(thrown);
+		handoff.Flush();
+	}
+
+	void TestRestart() {
+		std::vector< U64 > rendered;
+		FrameHandoff< Frame > handoff;
+
+		for (U64 run = 0u; run < 3u; ++run) {
+			handoff.Start(Renderer{ &rendered });
+			handoff.Submit([run](Frame& frame) {
+				frame.m_number = run + 1u;
+			});
+			handoff.Stop();
+		}
+
+		MAGE_CHECK(3u == rendered.size());
+		MAGE_CHECK(3u == rendered.back());
+
+		// The frames keep the results of their last rendering.
+		const auto& frames = handoff.GetFrames();
+		MAGE_CHECK(frames[0].m_number == frames[0].m_rendered_number);
+		MAGE_CHECK(frames[1].m_number == frames[1].m_rendered_number);
+	}
+
+	void TestIdle() {
+		std::atomic< std::size_t > nb_idle_calls = 0u;
+		FrameHandoff< Frame > handoff([&nb_idle_calls]() noexcept {
+			++nb_idle_calls;
+		});
+
+		handoff.Start([](Frame&) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		});
+		handoff.Submit([](Frame&) {});
+
+		// The idle function is called while waiting for the render thread.
+		handoff.Flush();
+		MAGE_CHECK(0u < nb_idle_calls.load());
+		handoff.Stop();
+	}
+}
+
+int main() {
+	test::Run("FrameHandoffSubmit",             TestSubmit);
+	test::Run("FrameHandoffFlush",              TestFlush);
+	test::Run("FrameHandoffException",          TestException);
+	test::Run("FrameHandoffExceptionAfterStop", TestExceptionAfterStop);
+	test::Run("FrameHandoffRestart",            TestRestart);
+	test::Run("FrameHandoffIdle",               TestIdle);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
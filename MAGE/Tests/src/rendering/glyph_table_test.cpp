@@ -0,0 +1,176 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "resource/font/glyph_table.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace mage::rendering;
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	/**
+	 Returns the characters of a typical font: printable ASCII and Latin-1,
+	 a few Greek letters, some symbols and a few characters outside the
+	 Basic Multilingual Plane.
+	 */
+	[[nodiscard]]
+	std::vector< U32 > CreateCharacters() {
+		std::vector< U32 > characters;
+		for (U32 c = 0x20u; 0x7Fu > c; ++c) {
+			characters.push_back(c);
+		}
+		for (U32 c = 0xA0u; 0x100u > c; ++c) {
+			characters.push_back(c);
+		}
+		for (U32 c = 0x391u; 0x3AAu > c; ++c) {
+			characters.push_back(c);
+		}
+		characters.insert(characters.end(), {
+			0x20ACu, 0x2122u, 0xFFFDu, 0x1F600u, 0x1F601u, 0x1F680u });
+		return characters;
+	}
+
+	/**
+	 Returns the glyph index of the given character by binary search (i.e.
+	 the ground truth).
+	 */
+	[[nodiscard]]
+	U32 BinarySearch(const std::vector< U32 >& characters, U32 character) noexcept {
+		const auto it = std::lower_bound(characters.cbegin(), characters.cend(),
+										 character);
+		return (it != characters.cend() && *it == character)
+			? static_cast< U32 >(it - characters.cbegin()) : GlyphTable::s_no_glyph;
+	}
+
+	void TestEmpty() {
+		const GlyphTable table;
+
+		MAGE_CHECK(1u == table.GetNumberOfPages());
+		MAGE_CHECK(GlyphTable::s_no_glyph == table.Find(0u));
+		MAGE_CHECK(GlyphTable::s_no_glyph == table.Find(L'A'));
+		MAGE_CHECK(GlyphTable::s_no_glyph == table.Find(0xFFFFu));
+		MAGE_CHECK(GlyphTable::s_no_glyph == table.Find(0x10FFFFu));
+	}
+
+	void TestLookup() {
+		const auto characters = CreateCharacters();
+		const GlyphTable table(characters);
+
+		// The empty page, the ASCII/Latin-1 page, the Greek page, the
+		// U+20xx and U+21xx pages and the U+FFxx page.
+		MAGE_CHECK(6u == table.GetNumberOfPages());
+
+		for (std::size_t i = 0u; i < characters.size(); ++i) {
+			MAGE_CHECK(i == table.Find(characters[i]));
+		}
+
+		// Every code point agrees with the binary search.
+		for (U32 c = 0u; 0x20000u > c; ++c) {
+			if (BinarySearch(characters, c) != table.Find(c)) {
+				MAGE_CHECK(BinarySearch(characters, c) == table.Find(c));
+				break;
+			}
+		}
+		MAGE_CHECK(GlyphTable::s_no_glyph == table.Find(0x10FFFFu));
+	}
+
+	void TestOnlyHighCharacters() {
+		const std::vector< U32 > characters = { 0x10000u, 0x1F600u, 0x10FFFFu };
+		const GlyphTable table(characters);
+
+		MAGE_CHECK(1u == table.GetNumberOfPages());
+		MAGE_CHECK(0u == table.Find(0x10000u));
+		MAGE_CHECK(1u == table.Find(0x1F600u));
+		MAGE_CHECK(2u == table.Find(0x10FFFFu));
+		MAGE_CHECK(GlyphTable::s_no_glyph == table.Find(0xFFFFu));
+		MAGE_CHECK(GlyphTable::s_no_glyph == table.Find(0x1F601u));
+	}
+
+	void TestMemoryUsage() {
+		// An ASCII/Latin-1 font uses two glyph pages (i.e. 2 KiB).
+		std::vector< U32 > characters;
+		for (U32 c = 0x20u; 0x100u > c; ++c) {
+			characters.push_back(c);
+		}
+		const GlyphTable table(characters);
+
+		MAGE_CHECK(2u == table.GetNumberOfPages());
+		MAGE_CHECK(sizeof(GlyphTable) + 2u * 256u * sizeof(U32)
+				   == table.GetMemoryUsage());
+	}
+
+	/**
+	 Compares the throughput of the glyph table against binary search over
+	 a buffer of random printable ASCII characters.
+	 */
+	void BenchmarkLookup() {
+		const auto characters = CreateCharacters();
+		const GlyphTable table(characters);
+
+		std::mt19937 generator(0u);
+		std::uniform_int_distribution< U32 > distribution(0x20u, 0x7Eu);
+		std::vector< U32 > text(10000u);
+		for (auto& c : text) {
+			c = distribution(generator);
+		}
+
+		constexpr std::size_t nb_iterations = 200u;
+
+		const auto measure = [&](auto&& find) {
+			U64 checksum = 0u;
+			const auto start = Clock::now();
+			for (std::size_t i = 0u; i < nb_iterations; ++i) {
+				for (const auto c : text) {
+					checksum += find(c);
+				}
+			}
+			const std::chrono::duration< double > time = Clock::now() - start;
+			std::printf("    %6.1f M glyphs/s (checksum %llu)\n",
+						nb_iterations * text.size() / (1.0e6 * time.count()),
+						static_cast< unsigned long long >(checksum));
+			return checksum;
+		};
+
+		std::printf("  binary search:\n");
+		const auto expected = measure([&](U32 c) noexcept {
+			return BinarySearch(characters, c);
+		});
+		std::printf("  glyph table:\n");
+		const auto result = measure([&](U32 c) noexcept {
+			return table.Find(c);
+		});
+
+		MAGE_CHECK(expected == result);
+	}
+}
+
+int main() {
+	test::Run("GlyphTableEmpty",               TestEmpty);
+	test::Run("GlyphTableLookup",              TestLookup);
+	test::Run("GlyphTableOnlyHighCharacters",  TestOnlyHighCharacters);
+	test::Run("GlyphTableMemoryUsage",         TestMemoryUsage);
+	test::Run("GlyphTableLookupThroughput",    BenchmarkLookup);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
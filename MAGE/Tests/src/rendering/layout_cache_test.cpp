@@ -0,0 +1,169 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "scene/sprite/layout_cache.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace mage::rendering;
+
+namespace {
+
+	/**
+	 A layout function appending the given number of sprites with the given
+	 value, and counting its calls.
+	 */
+	struct CountingLayout {
+
+		void operator()(AlignedVector< U32 >& sprites) {
+			++m_nb_calls;
+			sprites.insert(sprites.end(), m_nb_sprites, m_value);
+		}
+
+		std::size_t m_nb_calls   = 0u;
+		std::size_t m_nb_sprites = 1u;
+		U32 m_value              = 0u;
+	};
+
+	void TestLayoutOnce() {
+		LayoutCache< U32 > cache;
+		CountingLayout layout;
+		layout.m_nb_sprites = 3u;
+		layout.m_value      = 7u;
+
+		MAGE_CHECK(!cache.IsValid());
+
+		for (int i = 0; 100 > i; ++i) {
+			const auto& sprites = cache.Get(layout);
+			MAGE_CHECK(3u == sprites.size());
+			MAGE_CHECK(7u == sprites.front());
+		}
+
+		MAGE_CHECK(cache.IsValid());
+		MAGE_CHECK(1u == layout.m_nb_calls);
+	}
+
+	void TestInvalidate() {
+		LayoutCache< U32 > cache;
+		CountingLayout layout;
+		layout.m_value = 1u;
+		(void)cache.Get(layout);
+
+		// A change which is not followed by an invalidation is not visible.
+		layout.m_value = 2u;
+		MAGE_CHECK(1u == cache.Get(layout).front());
+
+		// The sprites are replaced (not appended) after an invalidation.
+		cache.Invalidate();
+		MAGE_CHECK(!cache.IsValid());
+		const auto& sprites = cache.Get(layout);
+		MAGE_CHECK(1u == sprites.size());
+		MAGE_CHECK(2u == sprites.front());
+		MAGE_CHECK(2u == layout.m_nb_calls);
+	}
+
+	void TestInvalidateWithoutChange() {
+		LayoutCache< U32 > cache;
+		CountingLayout layout;
+		(void)cache.Get(layout);
+
+		// The layout does not depend on the content of the layout
+		// parameters: setting the same parameters lays out again.
+		for (std::size_t i = 0u; 10u > i; ++i) {
+			cache.Invalidate();
+			(void)cache.Get(layout);
+		}
+
+		MAGE_CHECK(11u == layout.m_nb_calls);
+	}
+
+	void TestEmptyLayout() {
+		LayoutCache< U32 > cache;
+		CountingLayout layout;
+		layout.m_nb_sprites = 0u;
+
+		MAGE_CHECK(cache.Get(layout).empty());
+		MAGE_CHECK(cache.Get(layout).empty());
+		MAGE_CHECK(1u == layout.m_nb_calls);
+	}
+
+	void TestCopy() {
+		LayoutCache< U32 > cache;
+		CountingLayout layout;
+		layout.m_value = 5u;
+		(void)cache.Get(layout);
+
+		// Copies do not share the cached sprites.
+		LayoutCache< U32 > copy(cache);
+		MAGE_CHECK(cache.IsValid());
+		MAGE_CHECK(!copy.IsValid());
+		layout.m_value = 6u;
+		MAGE_CHECK(6u == copy.Get(layout).front());
+		MAGE_CHECK(5u == cache.Get(layout).front());
+
+		// Copy assignment invalidates the assigned cache.
+		cache = copy;
+		MAGE_CHECK(!cache.IsValid());
+		MAGE_CHECK(6u == cache.Get(layout).front());
+		MAGE_CHECK(3u == layout.m_nb_calls);
+	}
+
+	void TestCopyUnchanged() {
+		LayoutCache< U32 > source;
+		LayoutCache< U32 > snapshot;
+		CountingLayout layout;
+		layout.m_value = 4u;
+		(void)snapshot.Get(layout);
+
+		// The first copy invalidates the copy (i.e. the versions differ).
+		snapshot = source;
+		MAGE_CHECK(!snapshot.IsValid());
+		MAGE_CHECK(source.GetVersion() == snapshot.GetVersion());
+		(void)snapshot.Get(layout);
+
+		// Copies of an unchanged cache keep the cached sprites.
+		for (std::size_t i = 0u; 10u > i; ++i) {
+			snapshot = source;
+			MAGE_CHECK(snapshot.IsValid());
+			MAGE_CHECK(4u == snapshot.Get(layout).front());
+		}
+		MAGE_CHECK(2u == layout.m_nb_calls);
+
+		// Copies of an invalidated cache invalidate the copy.
+		source.Invalidate();
+		MAGE_CHECK(source.GetVersion() != snapshot.GetVersion());
+		snapshot = source;
+		MAGE_CHECK(!snapshot.IsValid());
+	}
+
+	void TestMove() {
+		LayoutCache< U32 > cache;
+		CountingLayout layout;
+		layout.m_value = 9u;
+		(void)cache.Get(layout);
+
+		LayoutCache< U32 > moved(std::move(cache));
+		MAGE_CHECK(moved.IsValid());
+		MAGE_CHECK(9u == moved.Get(layout).front());
+		MAGE_CHECK(1u == layout.m_nb_calls);
+	}
+}
+
+int main() {
+	test::Run("LayoutCacheLayoutOnce",             TestLayoutOnce);
+	test::Run("LayoutCacheInvalidate",             TestInvalidate);
+	test::Run("LayoutCacheInvalidateWithoutChange", TestInvalidateWithoutChange);
+	test::Run("LayoutCacheEmptyLayout",            TestEmptyLayout);
+	test::Run("LayoutCacheCopy",                   TestCopy);
+	test::Run("LayoutCacheCopyUnchanged",          TestCopyUnchanged);
+	test::Run("LayoutCacheMove",                   TestMove);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,226 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "resource/mesh/mesh_optimizer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace mage::rendering;
+
+namespace {
+
+	struct Vertex {
+		Point3 m_p;
+	};
+
+	/**
+	 A struct of model part index ranges.
+	 */
+	struct Part {
+		std::size_t m_start_index;
+		std::size_t m_nb_indices;
+	};
+
+	/**
+	 A triangle identified by the positions of its vertices, rotated such
+	 that the smallest position comes first (which preserves the winding).
+	 */
+	using Triangle = std::array< std::array< F32, 3u >, 3u >;
+
+	constexpr std::size_t g_nb_u = 48u;
+	constexpr std::size_t g_nb_v = 24u;
+
+	/**
+	 Builds a unit sphere with shuffled triangles, split in two model parts
+	 (the upper and lower hemisphere).
+	 */
+	void BuildSphere(std::vector< Vertex >& vertices,
+					 std::vector< U32 >& indices,
+					 std::vector< Part >& parts) {
+		constexpr auto pi = 3.14159265358979f;
+
+		for (std::size_t v = 0u; v <= g_nb_v; ++v) {
+			const auto theta = pi * v / g_nb_v;
+			for (std::size_t u = 0u; u <= g_nb_u; ++u) {
+				const auto phi = 2.0f * pi * u / g_nb_u;
+				vertices.push_back({ Point3(std::sin(theta) * std::cos(phi),
+											std::cos(theta),
+											std::sin(theta) * std::sin(phi)) });
+			}
+		}
+
+		const auto index = [](std::size_t u, std::size_t v) noexcept {
+			return static_cast< U32 >(v * (g_nb_u + 1u) + u);
+		};
+
+		std::mt19937 generator(26u);
+		for (std::size_t h = 0u; h < 2u; ++h) {
+			std::vector< std::array< U32, 3u > > triangles;
+			for (auto v = h * g_nb_v / 2u; v < (h + 1u) * g_nb_v / 2u; ++v)
+			for (std::size_t u = 0u; u < g_nb_u; ++u) {
+				triangles.push_back({ index(u, v), index(u + 1u, v), index(u, v + 1u) });
+				triangles.push_back({ index(u + 1u, v), index(u + 1u, v + 1u), index(u, v + 1u) });
+			}
+			std::shuffle(triangles.begin(), triangles.end(), generator);
+
+			parts.push_back({ indices.size(), 3u * triangles.size() });
+			for (const auto& triangle : triangles) {
+				indices.insert(indices.end(), triangle.cbegin(), triangle.cend());
+			}
+		}
+	}
+
+	/**
+	 Returns the sorted triangles of the given part.
+	 */
+	[[nodiscard]]
+	std::vector< Triangle > GetTriangles(const std::vector< Vertex >& vertices,
+										 const std::vector< U32 >& indices,
+										 const Part& part) {
+		std::vector< Triangle > triangles;
+		for (auto i = part.m_start_index;
+			 i < part.m_start_index + part.m_nb_indices; i += 3u) {
+
+			Triangle triangle;
+			for (std::size_t j = 0u; j < 3u; ++j) {
+				const auto& p = vertices[indices[i + j]].m_p;
+				triangle[j] = { p[0], p[1], p[2] };
+			}
+			std::rotate(triangle.begin(),
+						std::min_element(triangle.begin(), triangle.end()),
+						triangle.end());
+			triangles.push_back(triangle);
+		}
+
+		std::sort(triangles.begin(), triangles.end());
+		return triangles;
+	}
+
+	/**
+	 Optimizes the model parts like ModelOutput::OptimizeModelParts.
+	 */
+	void Optimize(std::vector< Vertex >& vertices,
+				  std::vector< U32 >& indices,
+				  const std::vector< Part >& parts,
+				  bool optimize_overdraw) {
+		for (const auto& part : parts) {
+			const auto span = gsl::make_span(
+				indices.data() + part.m_start_index,
+				static_cast< std::ptrdiff_t >(part.m_nb_indices));
+
+			OptimizeVertexCache(span);
+			if (optimize_overdraw) {
+				OptimizeOverdraw(span, vertices);
+			}
+		}
+
+		OptimizeVertexFetch(vertices, gsl::make_span(indices));
+	}
+
+	[[nodiscard]]
+	const VertexCacheStatistics
+		GetStatistics(const std::vector< U32 >& indices) {
+		return ComputeVertexCacheStatistics(gsl::make_span(std::as_const(indices)));
+	}
+
+	void TestStatistics() {
+		// A single triangle misses the cache for each of its vertices.
+		const std::vector< U32 > triangle = { 0u, 1u, 2u };
+		MAGE_CHECK_NEAR(3.0f, GetStatistics(triangle).m_acmr, 1e-6f);
+		MAGE_CHECK_NEAR(1.0f, GetStatistics(triangle).m_atvr, 1e-6f);
+
+		// A quad shares two vertices between both triangles.
+		const std::vector< U32 > quad = { 0u, 1u, 2u, 2u, 1u, 3u };
+		MAGE_CHECK_NEAR(2.0f, GetStatistics(quad).m_acmr, 1e-6f);
+		MAGE_CHECK_NEAR(1.0f, GetStatistics(quad).m_atvr, 1e-6f);
+	}
+
+	void TestOptimize(bool optimize_overdraw) {
+		std::vector< Vertex > vertices;
+		std::vector< U32 > indices;
+		std::vector< Part > parts;
+		BuildSphere(vertices, indices, parts);
+
+		const auto nb_vertices = vertices.size();
+		const auto nb_indices  = indices.size();
+		const auto before      = GetStatistics(indices);
+		std::vector< std::vector< Triangle > > triangles;
+		for (const auto& part : parts) {
+			triangles.push_back(GetTriangles(vertices, indices, part));
+		}
+
+		Optimize(vertices, indices, parts, optimize_overdraw);
+
+		// The vertices and indices are only reordered.
+		MAGE_CHECK(nb_vertices == vertices.size());
+		MAGE_CHECK(nb_indices  == indices.size());
+		for (const auto index : indices) {
+			MAGE_CHECK(index < nb_vertices);
+		}
+
+		// Each model part still contains exactly its own triangles, with the
+		// same winding.
+		for (std::size_t p = 0u; p < parts.size(); ++p) {
+			MAGE_CHECK(triangles[p] == GetTriangles(vertices, indices, parts[p]));
+		}
+
+		// The vertices are in order of first use.
+		U32 next = 0u;
+		for (const auto index : indices) {
+			MAGE_CHECK(index <= next);
+			next = std::max(next, index + 1u);
+		}
+
+		// The ACMR does not get worse (and improves on shuffled triangles).
+		const auto after = GetStatistics(indices);
+		MAGE_CHECK(after.m_acmr < before.m_acmr);
+		MAGE_CHECK(after.m_atvr <= before.m_atvr);
+
+		std::printf("  ACMR %.3f -> %.3f, ATVR %.3f -> %.3f\n",
+					before.m_acmr, after.m_acmr, before.m_atvr, after.m_atvr);
+	}
+
+	void TestOptimizeOptimized() {
+		std::vector< Vertex > vertices;
+		std::vector< U32 > indices;
+		std::vector< Part > parts;
+		BuildSphere(vertices, indices, parts);
+
+		Optimize(vertices, indices, parts, true);
+		const auto before = GetStatistics(indices);
+
+		// Optimizing an optimized mesh again does not make it worse.
+		Optimize(vertices, indices, parts, true);
+		MAGE_CHECK(GetStatistics(indices).m_acmr <= before.m_acmr + 1e-3f);
+	}
+}
+
+int main() {
+	test::Run("MeshOptimizerStatistics",  TestStatistics);
+	test::Run("MeshOptimizerVertexCache", []() { TestOptimize(false); });
+	test::Run("MeshOptimizerOverdraw",    []() { TestOptimize(true); });
+	test::Run("MeshOptimizerIdempotent",  TestOptimizeOptimized);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
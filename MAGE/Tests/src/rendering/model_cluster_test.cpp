@@ -0,0 +1,244 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "resource/model/model_cluster.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace mage::rendering;
+
+namespace {
+
+	struct Vertex {
+		Point3 m_p;
+	};
+
+	constexpr std::size_t g_nb_tiles_u  = 8u;
+	constexpr std::size_t g_nb_tiles_v  = 4u;
+	constexpr std::size_t g_tile_size_u = 8u;
+	constexpr std::size_t g_tile_size_v = 4u;
+	constexpr std::size_t g_start_index = 30u;
+
+	/**
+	 Builds a unit sphere whose triangles are emitted tile by tile, so that
+	 every model cluster of 64 triangles covers a single (curved) tile.
+	 */
+	void BuildSphere(std::vector< Vertex >& vertices, std::vector< U32 >& indices) {
+		constexpr auto nb_u = g_nb_tiles_u * g_tile_size_u;
+		constexpr auto nb_v = g_nb_tiles_v * g_tile_size_v;
+		constexpr auto pi   = 3.14159265358979f;
+
+		for (std::size_t v = 0u; v <= nb_v; ++v) {
+			const auto theta = pi * v / nb_v;
+			for (std::size_t u = 0u; u <= nb_u; ++u) {
+				const auto phi = 2.0f * pi * u / nb_u;
+				vertices.push_back({ Point3(std::sin(theta) * std::cos(phi),
+											std::cos(theta),
+											std::sin(theta) * std::sin(phi)) });
+			}
+		}
+
+		// Padding indices preceding the model part.
+		indices.assign(g_start_index, 0u);
+
+		const auto index = [](std::size_t u, std::size_t v) noexcept {
+			return static_cast< U32 >(v * (nb_u + 1u) + u);
+		};
+
+		for (std::size_t tv = 0u; tv < g_nb_tiles_v; ++tv)
+		for (std::size_t tu = 0u; tu < g_nb_tiles_u; ++tu)
+		for (std::size_t v = tv * g_tile_size_v; v < (tv + 1u) * g_tile_size_v; ++v)
+		for (std::size_t u = tu * g_tile_size_u; u < (tu + 1u) * g_tile_size_u; ++u) {
+			indices.insert(indices.end(), {
+				index(u,      v), index(u + 1u, v), index(u,      v + 1u),
+				index(u + 1u, v), index(u + 1u, v + 1u), index(u, v + 1u) });
+		}
+	}
+
+	[[nodiscard]]
+	AlignedVector< ModelCluster >
+		BuildClusters(const std::vector< Vertex >& vertices,
+					  const std::vector< U32 >& indices) {
+
+		const gsl::span< const U32 > part(
+			indices.data() + g_start_index,
+			static_cast< std::ptrdiff_t >(indices.size() - g_start_index));
+
+		return BuildModelClusters(vertices, part, g_start_index);
+	}
+
+	[[nodiscard]]
+	const XMVECTOR XM_CALLCONV GetNormal(const std::vector< Vertex >& vertices,
+										 const U32* triangle) noexcept {
+		const auto p0 = XMLoad(vertices[triangle[0]].m_p);
+		const auto p1 = XMLoad(vertices[triangle[1]].m_p);
+		const auto p2 = XMLoad(vertices[triangle[2]].m_p);
+		return XMVector3Cross(p1 - p0, p2 - p0);
+	}
+
+	[[nodiscard]]
+	bool XM_CALLCONV IsBackFacing(const std::vector< Vertex >& vertices,
+								  const U32* triangle,
+								  FXMVECTOR eye) noexcept {
+		const auto n = GetNormal(vertices, triangle);
+		const auto d = XMLoad(vertices[triangle[0]].m_p) - eye;
+		return 0.0f <= XMVectorGetX(XMVector3Dot(n, d));
+	}
+
+	[[nodiscard]]
+	bool XM_CALLCONV IsInsideFrustum(const std::vector< Vertex >& vertices,
+									 const U32* triangle,
+									 FXMMATRIX object_to_projection) noexcept {
+		for (std::size_t i = 0u; 3u > i; ++i) {
+			const auto p = XMVector3Transform(XMLoad(vertices[triangle[i]].m_p),
+											  object_to_projection);
+			const auto w = XMVectorGetW(p);
+			const auto x = XMVectorGetX(p);
+			const auto y = XMVectorGetY(p);
+			const auto z = XMVectorGetZ(p);
+			if (-w <= x && x <= w && -w <= y && y <= w && 0.0f <= z && z <= w) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void TestCoverage() {
+		std::vector< Vertex > vertices;
+		std::vector< U32 > indices;
+		BuildSphere(vertices, indices);
+
+		const auto clusters = BuildClusters(vertices, indices);
+
+		MAGE_CHECK(g_nb_tiles_u * g_nb_tiles_v == clusters.size());
+
+		auto next = g_start_index;
+		for (const auto& cluster : clusters) {
+			// The clusters cover the model part in order, without gaps.
+			MAGE_CHECK(next == cluster.m_start_index);
+			MAGE_CHECK(3u * ModelCluster::s_max_nb_triangles
+					   >= cluster.m_nb_indices);
+			next += cluster.m_nb_indices;
+
+			// The AABB of each cluster contains all its vertices.
+			for (auto i = cluster.m_start_index;
+				 i < cluster.m_start_index + cluster.m_nb_indices; ++i) {
+
+				const auto p = XMLoad(vertices[indices[i]].m_p);
+				MAGE_CHECK(XMVector3GreaterOrEqual(p, cluster.m_aabb.MinPoint()));
+				MAGE_CHECK(XMVector3LessOrEqual(p, cluster.m_aabb.MaxPoint()));
+			}
+		}
+		MAGE_CHECK(indices.size() == next);
+	}
+
+	void TestConeCulling() {
+		std::vector< Vertex > vertices;
+		std::vector< U32 > indices;
+		BuildSphere(vertices, indices);
+
+		const auto clusters = BuildClusters(vertices, indices);
+
+		const XMVECTOR eyes[] = {
+			XMVectorSet( 0.0f, 0.0f, -3.0f, 1.0f),
+			XMVectorSet( 2.0f, 1.5f,  0.5f, 1.0f),
+			XMVectorSet(-1.2f, 0.0f,  1.2f, 1.0f),
+			XMVectorSet( 0.0f, 20.0f, 0.0f, 1.0f)
+		};
+
+		for (const auto eye : eyes) {
+			std::size_t nb_culled = 0u;
+
+			for (const auto& cluster : clusters) {
+				if (!cluster.IsBackFacing(eye)) {
+					continue;
+				}
+
+				++nb_culled;
+
+				// A back facing cluster contains only back facing triangles.
+				for (auto i = cluster.m_start_index;
+					 i < cluster.m_start_index + cluster.m_nb_indices; i += 3u) {
+
+					MAGE_CHECK(IsBackFacing(vertices, &indices[i], eye));
+				}
+			}
+
+			// The normal cones are tight enough to cull some clusters.
+			MAGE_CHECK(0u < nb_culled);
+		}
+	}
+
+	void TestVisibleIndexRanges() {
+		std::vector< Vertex > vertices;
+		std::vector< U32 > indices;
+		BuildSphere(vertices, indices);
+
+		const auto clusters = BuildClusters(vertices, indices);
+
+		const auto eye = XMVectorSet(0.4f, 0.3f, -2.5f, 1.0f);
+		const auto object_to_projection
+			= XMMatrixLookAtLH(eye, XMVectorSet(0.6f, 0.0f, 0.0f, 1.0f),
+							   g_XMIdentityR1)
+			* XMMatrixPerspectiveFovLH(0.6f, 1.0f, 0.1f, 100.0f);
+
+		for (const auto cone_culling : { false, true }) {
+			std::vector< bool > drawn(indices.size() / 3u, false);
+			std::size_t previous_end = 0u;
+			std::size_t nb_drawn     = 0u;
+
+			ForEachVisibleIndexRange(object_to_projection, clusters,
+									 cone_culling,
+				[&](std::size_t start, std::size_t nb_indices) {
+					// Sorted, disjoint and non-adjacent (i.e. merged) ranges.
+					MAGE_CHECK(previous_end < start || 0u == previous_end);
+					MAGE_CHECK(g_start_index <= start);
+					MAGE_CHECK(start + nb_indices <= indices.size());
+					MAGE_CHECK(0u == start % 3u && 0u == nb_indices % 3u);
+
+					for (auto i = start; i < start + nb_indices; i += 3u) {
+						drawn[i / 3u] = true;
+					}
+					previous_end = start + nb_indices;
+					nb_drawn    += nb_indices;
+				});
+
+			// Ground truth: every triangle with a vertex inside the view
+			// frustum (and front facing, if cone culling) must be drawn.
+			for (auto i = g_start_index; i < indices.size(); i += 3u) {
+				const auto visible
+					= IsInsideFrustum(vertices, &indices[i], object_to_projection)
+					&& (!cone_culling || !IsBackFacing(vertices, &indices[i], eye));
+				MAGE_CHECK(!visible || drawn[i / 3u]);
+			}
+
+			// The culling is not trivial.
+			MAGE_CHECK(0u < nb_drawn);
+			MAGE_CHECK(indices.size() - g_start_index > nb_drawn);
+		}
+	}
+}
+
+int main() {
+	test::Run("ModelClusterCoverage", TestCoverage);
+	test::Run("ModelClusterConeCulling", TestConeCulling);
+	test::Run("ModelClusterVisibleIndexRanges", TestVisibleIndexRanges);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,247 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "renderer/pass/sprite_sort.hpp"
+#include "memory/allocation_counter.hpp"
+#include "type/vector_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace mage::rendering;
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	/**
+	 A texture (i.e. the stand-in of a shader resource view).
+	 */
+	struct Texture {
+
+		U32x2 m_size;
+	};
+
+	/**
+	 A particle sprite (i.e. the device-independent part of a sprite info).
+	 */
+	struct Particle {
+
+		F32 m_depth;
+		const Texture* m_texture;
+		U32x2 m_texture_size;
+	};
+
+	/**
+	 A locked map from textures to texture sizes (i.e. the stand-in of the
+	 private data of shader resource views, which is guarded by a lock of the
+	 device).
+	 */
+	class LockedTextureSizes {
+
+	public:
+
+		void Set(const Texture* texture, const U32x2& size) {
+			const std::scoped_lock lock(m_mutex);
+			m_sizes[texture] = size;
+		}
+
+		[[nodiscard]]
+		const U32x2 Get(const Texture* texture) const {
+			const std::scoped_lock lock(m_mutex);
+			return m_sizes.at(texture);
+		}
+
+	private:
+
+		mutable std::mutex m_mutex;
+		std::unordered_map< const Texture*, U32x2 > m_sizes;
+	};
+
+	/**
+	 Returns the given number of particles with random depths, using the
+	 given textures at random.
+	 */
+	[[nodiscard]]
+	std::vector< Particle > CreateParticles(std::size_t nb_particles,
+											const std::vector< Texture >& textures) {
+		std::mt19937 generator(7u);
+		std::uniform_real_distribution< F32 > depth_distribution(0.0f, 1.0f);
+		std::uniform_int_distribution< std::size_t >
+			texture_distribution(0u, textures.size() - 1u);
+
+		std::vector< Particle > particles(nb_particles);
+		for (auto& particle : particles) {
+			const auto& texture     = textures[texture_distribution(generator)];
+			particle.m_depth        = depth_distribution(generator);
+			particle.m_texture      = &texture;
+			particle.m_texture_size = texture.m_size;
+		}
+		return particles;
+	}
+
+	/**
+	 A sprite batch frame (back-to-front, then texture): the construction of
+	 the sort keys, the sort and the traversal of the texture runs.
+	 */
+	class Frame {
+
+	public:
+
+		template< typename SortT, typename SizeT >
+		[[nodiscard]]
+		U64 Run(const std::vector< Particle >& particles,
+				SortT&& sort, SizeT&& get_size) {
+
+			m_sort_keys.clear();
+			m_texture_ids.clear();
+
+			const Texture* last_texture = nullptr;
+			U32 last_texture_id = 0u;
+			for (std::size_t i = 0u; i < particles.size(); ++i) {
+				const auto& particle = particles[i];
+				if (particle.m_texture != last_texture || 0u == i) {
+					const auto id   = static_cast< U32 >(m_texture_ids.size());
+					last_texture    = particle.m_texture;
+					last_texture_id = m_texture_ids.try_emplace(last_texture,
+																id).first->second;
+				}
+
+				const U64 depth = ~ToOrderedBits(particle.m_depth);
+				m_sort_keys.push_back({ (depth << 32u) | last_texture_id,
+										static_cast< U32 >(i) });
+			}
+
+			sort(m_sort_keys, m_sort_buffer);
+
+			// Traverse the runs of sprites sharing a texture, and accumulate
+			// the texture sizes (i.e. the per-run work of the renderer).
+			U64 checksum = 0u;
+			const Texture* run_texture = nullptr;
+			for (const auto& sort_key : m_sort_keys) {
+				const auto& particle = particles[sort_key.m_index];
+				if (particle.m_texture != run_texture) {
+					run_texture = particle.m_texture;
+					const auto size = get_size(particle);
+					checksum += size[0] + size[1];
+				}
+			}
+
+			return checksum;
+		}
+
+		[[nodiscard]]
+		const std::vector< SpriteSortKey >& GetSortKeys() const noexcept {
+			return m_sort_keys;
+		}
+
+	private:
+
+		std::vector< SpriteSortKey > m_sort_keys;
+		std::vector< SpriteSortKey > m_sort_buffer;
+		std::unordered_map< const Texture*, U32 > m_texture_ids;
+	};
+
+	void RadixSortKeys(std::vector< SpriteSortKey >& keys,
+					   std::vector< SpriteSortKey >& buffer) {
+		RadixSort(keys, buffer);
+	}
+
+	void StableSortKeys(std::vector< SpriteSortKey >& keys,
+						[[maybe_unused]] std::vector< SpriteSortKey >& buffer) {
+		std::stable_sort(keys.begin(), keys.end(),
+			[](const SpriteSortKey& lhs, const SpriteSortKey& rhs) noexcept {
+				return lhs.m_key < rhs.m_key;
+			});
+	}
+
+	template< typename SortT, typename SizeT >
+	[[nodiscard]]
+	U64 Benchmark(const char* name,
+				  const std::vector< Particle >& particles,
+				  std::size_t nb_frames,
+				  SortT&& sort, SizeT&& get_size) {
+
+		Frame frame;
+		U64 checksum = frame.Run(particles, sort, get_size); // Warm up.
+
+		const auto nb_allocations = GetNumberOfAllocations();
+		const auto start          = Clock::now();
+		for (std::size_t i = 0u; i < nb_frames; ++i) {
+			MAGE_CHECK(checksum == frame.Run(particles, sort, get_size));
+		}
+		const std::chrono::duration< double, std::milli > time
+			= Clock::now() - start;
+		const auto allocations = GetNumberOfAllocations() - nb_allocations;
+
+		// The sort keys are sorted (back-to-front, then texture).
+		const auto& keys = frame.GetSortKeys();
+		MAGE_CHECK(std::is_sorted(keys.cbegin(), keys.cend(),
+			[](const SpriteSortKey& lhs, const SpriteSortKey& rhs) noexcept {
+				return lhs.m_key < rhs.m_key;
+			}));
+
+		std::printf("  %-36s %8.3f ms/frame %8.1f allocations/frame\n",
+					name, time.count() / nb_frames,
+					static_cast< double >(allocations) / nb_frames);
+		return checksum;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	const std::size_t nb_particles = (1 < argc) ? std::stoul(argv[1]) : 100000u;
+	const std::size_t nb_textures  = (2 < argc) ? std::stoul(argv[2]) : 8u;
+	const std::size_t nb_frames    = (3 < argc) ? std::stoul(argv[3]) : 10u;
+
+	std::vector< Texture > textures(std::max(nb_textures, std::size_t(1u)));
+	LockedTextureSizes locked_sizes;
+	for (std::size_t i = 0u; i < textures.size(); ++i) {
+		const auto size = static_cast< U32 >(16u << (i % 6u));
+		textures[i].m_size = { size, size };
+		locked_sizes.Set(&textures[i], textures[i].m_size);
+	}
+
+	const auto particles = CreateParticles(nb_particles, textures);
+
+	std::printf("%zu particles, %zu textures, %zu frames\n",
+				nb_particles, textures.size(), nb_frames);
+
+	const auto stored_size = [](const Particle& particle) noexcept {
+		return particle.m_texture_size;
+	};
+	const auto locked_size = [&locked_sizes](const Particle& particle) {
+		return locked_sizes.Get(particle.m_texture);
+	};
+
+	const auto checksum = Benchmark("radix sort, stored texture sizes",
+									particles, nb_frames,
+									RadixSortKeys, stored_size);
+	MAGE_CHECK(checksum == Benchmark("radix sort, locked texture sizes",
+									 particles, nb_frames,
+									 RadixSortKeys, locked_size));
+	MAGE_CHECK(checksum == Benchmark("stable sort, stored texture sizes",
+									 particles, nb_frames,
+									 StableSortKeys, stored_size));
+
+	return test::GetExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,180 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "renderer/pass/sprite_sort.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace mage::rendering;
+
+namespace {
+
+	/**
+	 Returns the sort keys with the given keys, in submission order.
+	 */
+	[[nodiscard]]
+	std::vector< SpriteSortKey > CreateSortKeys(const std::vector< U64 >& keys) {
+		std::vector< SpriteSortKey > sort_keys;
+		for (std::size_t i = 0u; i < keys.size(); ++i) {
+			sort_keys.push_back({ keys[i], static_cast< U32 >(i) });
+		}
+		return sort_keys;
+	}
+
+	/**
+	 Sorts the given sort keys with the radix sort and checks the result
+	 against a stable comparison sort.
+	 */
+	void CheckRadixSort(std::vector< SpriteSortKey > sort_keys) {
+		auto expected = sort_keys;
+		std::stable_sort(expected.begin(), expected.end(),
+			[](const SpriteSortKey& lhs, const SpriteSortKey& rhs) noexcept {
+				return lhs.m_key < rhs.m_key;
+			});
+
+		std::vector< SpriteSortKey > buffer;
+		RadixSort(sort_keys, buffer);
+
+		MAGE_CHECK(expected.size() == sort_keys.size());
+		for (std::size_t i = 0u; i < expected.size(); ++i) {
+			MAGE_CHECK(expected[i].m_key   == sort_keys[i].m_key);
+			MAGE_CHECK(expected[i].m_index == sort_keys[i].m_index);
+		}
+	}
+
+	void TestEmpty() {
+		std::vector< SpriteSortKey > sort_keys;
+		std::vector< SpriteSortKey > buffer;
+		RadixSort(sort_keys, buffer);
+		MAGE_CHECK(sort_keys.empty());
+	}
+
+	void TestSingle() {
+		CheckRadixSort(CreateSortKeys({ 0x0123456789ABCDEFull }));
+	}
+
+	void TestOrdering() {
+		std::mt19937_64 generator(3u);
+		std::vector< U64 > keys(10000u);
+		for (auto& key : keys) {
+			key = generator();
+		}
+
+		CheckRadixSort(CreateSortKeys(keys));
+	}
+
+	void TestStability() {
+		// Few distinct keys: most keys are equal, so the submission order of
+		// the equal keys must be preserved.
+		std::mt19937_64 generator(5u);
+		std::uniform_int_distribution< U64 > distribution(0u, 3u);
+		std::vector< U64 > keys(1000u);
+		for (auto& key : keys) {
+			// The distinct keys differ in the low and high bytes.
+			const auto k = distribution(generator);
+			key = (k << 56u) | (k << 8u);
+		}
+
+		CheckRadixSort(CreateSortKeys(keys));
+	}
+
+	void TestIdenticalKeys() {
+		// All passes are skipped: the keys keep their submission order.
+		auto sort_keys = CreateSortKeys(std::vector< U64 >(257u, 0xFEDCBA9876543210ull));
+		std::vector< SpriteSortKey > buffer;
+		RadixSort(sort_keys, buffer);
+
+		for (std::size_t i = 0u; i < sort_keys.size(); ++i) {
+			MAGE_CHECK(i == sort_keys[i].m_index);
+		}
+	}
+
+	void TestSkippedPasses() {
+		// Only the second, fifth and last byte differ: passes are skipped,
+		// and an odd number of passes is performed (i.e. the result ends up
+		// in the scratch buffer before it is swapped).
+		CheckRadixSort(CreateSortKeys({
+			0x0100000200000300ull,
+			0x0000000000000100ull,
+			0x0100000000000100ull,
+			0x0000000200000300ull,
+			0x0000000000000100ull,
+			0x0100000200000100ull }));
+
+		// Only the second and the last byte differ (i.e. an even number of
+		// passes is performed).
+		CheckRadixSort(CreateSortKeys({
+			0x0100000000000300ull,
+			0x0000000000000100ull,
+			0x0100000000000100ull,
+			0x0000000000000300ull,
+			0x0000000000000100ull }));
+
+		// Only the lowest byte differs (i.e. a single pass).
+		CheckRadixSort(CreateSortKeys({ 3u, 1u, 2u, 1u, 0u, 3u }));
+
+		// Only the highest byte differs.
+		CheckRadixSort(CreateSortKeys({
+			0xFF00000000000000ull, 0x0000000000000000ull,
+			0x8000000000000000ull, 0x0000000000000000ull }));
+	}
+
+	void TestBufferReuse() {
+		// The scratch buffer may contain stale keys of a previous sort.
+		std::vector< SpriteSortKey > buffer(100u, { ~U64(0u), 42u });
+		auto sort_keys = CreateSortKeys({ 2u, 1u, 0u });
+		RadixSort(sort_keys, buffer);
+
+		MAGE_CHECK(3u == sort_keys.size());
+		MAGE_CHECK(2u == sort_keys[0].m_index);
+		MAGE_CHECK(1u == sort_keys[1].m_index);
+		MAGE_CHECK(0u == sort_keys[2].m_index);
+	}
+
+	void TestOrderedBits() {
+		constexpr auto max     = std::numeric_limits< F32 >::max();
+		constexpr auto min     = std::numeric_limits< F32 >::min();
+		constexpr auto inf     = std::numeric_limits< F32 >::infinity();
+		const F32 depths[] = {
+			-inf, -max, -1.0f, -min, 0.0f, min, 0.5f, 1.0f, max, inf
+		};
+
+		for (std::size_t i = 1u; i < std::size(depths); ++i) {
+			MAGE_CHECK(ToOrderedBits(depths[i - 1u]) < ToOrderedBits(depths[i]));
+		}
+
+		// -0.0f and +0.0f are equal.
+		MAGE_CHECK(ToOrderedBits(-0.0f) == ToOrderedBits(0.0f));
+	}
+}
+
+int main() {
+	test::Run("SpriteSortEmpty",          TestEmpty);
+	test::Run("SpriteSortSingle",         TestSingle);
+	test::Run("SpriteSortOrdering",       TestOrdering);
+	test::Run("SpriteSortStability",      TestStability);
+	test::Run("SpriteSortIdenticalKeys",  TestIdenticalKeys);
+	test::Run("SpriteSortSkippedPasses",  TestSkippedPasses);
+	test::Run("SpriteSortBufferReuse",    TestBufferReuse);
+	test::Run("SpriteSortOrderedBits",    TestOrderedBits);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,174 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "loaders/dds/dds_loader.hpp"
+#include "loaders/wic/wic_loader.hpp"
+#include "string/string_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace mage::rendering;
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	/**
+	 Writes the given number of synthetic DDS files (RGBA8 with a complete mip
+	 chain) of the given size to the given directory.
+	 */
+	void WriteTextures(const std::filesystem::path& directory,
+					   std::size_t nb_textures,
+					   U32 size) {
+
+		TextureDescriptor desc;
+		desc.m_dimension     = D3D11_RESOURCE_DIMENSION_TEXTURE2D;
+		desc.m_format        = DXGI_FORMAT_R8G8B8A8_UNORM;
+		desc.m_width         = size;
+		desc.m_height        = size;
+		desc.m_depth         = 1u;
+		desc.m_array_size    = 1u;
+		desc.m_nb_mip_levels = 1u;
+		for (auto mip_size = size; 1u < mip_size; mip_size >>= 1u) {
+			++desc.m_nb_mip_levels;
+		}
+
+		TextureData data;
+		data.Initialize(desc);
+		for (std::size_t i = 0u; i < data.GetSize(); ++i) {
+			data.GetPixels()[i] = static_cast< U8 >(i * 31u);
+		}
+
+		std::filesystem::create_directories(directory);
+		for (std::size_t i = 0u; i < nb_textures; ++i) {
+			const auto path = directory / (std::to_wstring(i) + L".dds");
+			loader::ExportDDSTextureToFile(path, data);
+		}
+	}
+
+	/**
+	 Decodes the given texture.
+
+	 @return		The size (in bytes) of the decoded pixel data.
+	 */
+	[[nodiscard]]
+	std::size_t Decode(const std::filesystem::path& path) {
+		std::wstring extension(path.extension());
+		TransformToLowerCase(extension);
+
+		TextureData data;
+		if (L".dds" == extension) {
+			loader::ImportDDSTextureFromFile(path, data);
+		}
+		else {
+			loader::ImportWICTextureFromFile(path, data);
+		}
+
+		return data.GetSize();
+	}
+
+	/**
+	 Decodes all given textures from the given number of threads.
+
+	 @return		The wall clock time (in milliseconds).
+	 */
+	[[nodiscard]]
+	double Run(const std::vector< std::filesystem::path >& paths,
+			   std::size_t nb_threads,
+			   std::size_t& size) {
+
+		std::atomic< std::size_t > next = 0u;
+		std::atomic< std::size_t > total_size = 0u;
+
+		const auto start = Clock::now();
+
+		std::vector< std::thread > threads;
+		for (std::size_t t = 0u; t < nb_threads; ++t) {
+			threads.emplace_back([&]() {
+				// WIC requires COM.
+				const auto result = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+				MAGE_CHECK(SUCCEEDED(result));
+
+				for (auto i = next++; i < paths.size(); i = next++) {
+					try {
+						total_size += Decode(paths[i]);
+					}
+					catch (const std::exception& e) {
+						test::ReportFailure(e.what(), __FILE__, __LINE__);
+					}
+				}
+
+				CoUninitialize();
+			});
+		}
+
+		for (auto& thread : threads) {
+			thread.join();
+		}
+
+		const std::chrono::duration< double, std::milli > time
+			= Clock::now() - start;
+
+		size = total_size;
+		return time.count();
+	}
+}
+
+int main(int argc, char* argv[]) {
+	// Decode the textures of the given directory, or synthetic textures.
+	const auto synthetic = (1 >= argc);
+	const auto directory = synthetic
+		? std::filesystem::temp_directory_path() / "mage_texture_decode_benchmark"
+		: std::filesystem::path(argv[1]);
+
+	if (synthetic) {
+		WriteTextures(directory, 32u, 1024u);
+	}
+
+	std::vector< std::filesystem::path > paths;
+	for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+		if (entry.is_regular_file()) {
+			paths.push_back(entry.path());
+		}
+	}
+
+	std::printf("%zu textures\n", paths.size());
+
+	std::size_t expected_size = 0u;
+	for (const std::size_t nb_threads : { 1u, 2u, 4u, 8u, 16u }) {
+		std::size_t size = 0u;
+		const auto time = Run(paths, nb_threads, size);
+
+		// Every thread count decodes the same pixel data.
+		MAGE_CHECK(0u == expected_size || expected_size == size);
+		expected_size = size;
+
+		std::printf("%2zu threads: %9.2f ms (%9.1f MB/s, %7.1f textures/s)\n",
+					nb_threads, time, size / (1000.0 * time),
+					1000.0 * paths.size() / time);
+	}
+
+	if (synthetic) {
+		std::filesystem::remove_all(directory);
+	}
+
+	return test::GetExitCode();
+}
\ No newline at end of file
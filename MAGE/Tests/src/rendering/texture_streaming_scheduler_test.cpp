@@ -0,0 +1,241 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "resource/texture/texture_streaming_scheduler.hpp"
+#include "exception/exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace mage::rendering;
+
+namespace {
+
+	/**
+	 Returns the memory usage (in bytes) of each mip level of a square RGBA8
+	 texture of the given size.
+	 */
+	[[nodiscard]]
+	std::vector< std::size_t > GetMipLevelSizes(U32 size) {
+		std::vector< std::size_t > sizes;
+		for (auto mip_size = size; 0u < mip_size; mip_size >>= 1u) {
+			sizes.push_back(4u * mip_size * mip_size);
+		}
+		return sizes;
+	}
+
+	/**
+	 Returns the memory usage (in bytes) of the mip chain of a square RGBA8
+	 texture of the given size starting at the given mip level.
+	 */
+	[[nodiscard]]
+	std::size_t GetMipChainSize(U32 size, U32 mip_level) noexcept {
+		std::size_t chain_size = 0u;
+		for (auto mip_size = size >> mip_level; 0u < mip_size; mip_size >>= 1u) {
+			chain_size += 4u * mip_size * mip_size;
+		}
+		return chain_size;
+	}
+
+	/**
+	 Completes all given requests.
+	 */
+	void Complete(TextureStreamingScheduler& scheduler,
+				  const std::vector< TextureStreamingRequest >& requests) {
+		for (const auto& request : requests) {
+			scheduler.OnCompleted(request);
+		}
+	}
+
+	/**
+	 Streams the given texture until it converges for the given on-screen
+	 size, and returns its resident mip level.
+	 */
+	[[nodiscard]]
+	U32 Converge(TextureStreamingScheduler& scheduler,
+				 std::size_t index,
+				 F32 screen_size) {
+		for (int frame = 0; 16 > frame; ++frame) {
+			scheduler.SetScreenSize(index, screen_size);
+			Complete(scheduler, scheduler.Schedule(4u));
+		}
+		return scheduler.GetResidentMipLevel(index);
+	}
+
+	void TestSchedulerRegister() {
+		TextureStreamingScheduler scheduler(~std::size_t(0u));
+
+		// The resident mip level is clamped to the least detailed mip level.
+		const auto a = scheduler.Register(GetMipLevelSizes(64u), 64u, 100u);
+		MAGE_CHECK(6u == scheduler.GetResidentMipLevel(a));
+		MAGE_CHECK(GetMipChainSize(64u, 6u) == scheduler.GetMemoryUsage());
+
+		bool thrown = false;
+		try {
+			(void)scheduler.Register({}, 64u, 0u);
+		}
+		catch (const Exception&) {
+			thrown = true;
+		}
+		MAGE_CHECK(thrown);
+		MAGE_CHECK(1u == scheduler.GetNumberOfTextures());
+	}
+
+	void TestSchedulerMipSelection() {
+		TextureStreamingScheduler scheduler(~std::size_t(0u));
+		const auto sizes = GetMipLevelSizes(1024u);
+
+		// One texel per pixel, rounding towards the more detailed mip level.
+		const auto a = scheduler.Register(sizes, 1024u, 10u);
+		MAGE_CHECK(0u == Converge(scheduler, a, 4096.0f));
+		const auto b = scheduler.Register(sizes, 1024u, 10u);
+		MAGE_CHECK(1u == Converge(scheduler, b, 512.0f));
+		const auto c = scheduler.Register(sizes, 1024u, 10u);
+		MAGE_CHECK(2u == Converge(scheduler, c, 200.0f));
+
+		// The most detailed mip level is never streamed out.
+		const auto d = scheduler.Register(sizes, 1024u, 4u);
+		MAGE_CHECK(4u == Converge(scheduler, d, 1.0f));
+
+		// Textures which are no longer visible are only streamed out to make
+		// room within the memory budget.
+		MAGE_CHECK(0u == Converge(scheduler, a, 0.0f));
+		MAGE_CHECK(GetMipChainSize(1024u, 0u) + GetMipChainSize(1024u, 1u)
+				   + GetMipChainSize(1024u, 2u) + GetMipChainSize(1024u, 4u)
+				   == scheduler.GetMemoryUsage());
+	}
+
+	void TestSchedulerPriority() {
+		const auto sizes = GetMipLevelSizes(1024u);
+		TextureStreamingScheduler scheduler(~std::size_t(0u));
+
+		const auto a = scheduler.Register(sizes, 1024u, 6u);
+		const auto b = scheduler.Register(sizes, 1024u, 6u);
+		MAGE_CHECK(2u == scheduler.GetNumberOfTextures());
+		MAGE_CHECK(2u * GetMipChainSize(1024u, 6u) == scheduler.GetMemoryUsage());
+
+		// The largest on-screen texel deficit first, one mip level at a time.
+		scheduler.SetScreenSize(a, 512.0f);
+		scheduler.SetScreenSize(b, 128.0f);
+		auto requests = scheduler.Schedule(1u);
+		MAGE_CHECK(1u == requests.size());
+		MAGE_CHECK(a == requests[0].m_index && 5u == requests[0].m_mip_level);
+		MAGE_CHECK(1u == scheduler.GetNumberOfPendingRequests());
+
+		// Textures with pending requests are skipped.
+		scheduler.SetScreenSize(a, 512.0f);
+		scheduler.SetScreenSize(b, 128.0f);
+		const auto b_requests = scheduler.Schedule(4u);
+		MAGE_CHECK(1u == b_requests.size());
+		MAGE_CHECK(b == b_requests[0].m_index && 5u == b_requests[0].m_mip_level);
+		Complete(scheduler, requests);
+		Complete(scheduler, b_requests);
+		MAGE_CHECK(0u == scheduler.GetNumberOfPendingRequests());
+
+		// Converge to one texel per pixel.
+		for (int frame = 0; 16 > frame; ++frame) {
+			scheduler.SetScreenSize(a, 512.0f);
+			scheduler.SetScreenSize(b, 128.0f);
+			Complete(scheduler, scheduler.Schedule(4u));
+		}
+		MAGE_CHECK(1u == scheduler.GetResidentMipLevel(a));
+		MAGE_CHECK(3u == scheduler.GetResidentMipLevel(b));
+		MAGE_CHECK(GetMipChainSize(1024u, 1u) + GetMipChainSize(1024u, 3u)
+				   == scheduler.GetMemoryUsage());
+
+		// Unregistering releases the memory and reuses the index.
+		scheduler.Unregister(a);
+		MAGE_CHECK(GetMipChainSize(1024u, 3u) == scheduler.GetMemoryUsage());
+		MAGE_CHECK(a == scheduler.Register(sizes, 1024u, 6u));
+	}
+
+	void TestSchedulerBudget() {
+		const auto sizes = GetMipLevelSizes(1024u);
+		const auto mip_size = 4u * 32u * 32u;
+		TextureStreamingScheduler scheduler(2u * GetMipChainSize(1024u, 6u) + mip_size);
+
+		const auto a = scheduler.Register(sizes, 1024u, 6u);
+		const auto b = scheduler.Register(sizes, 1024u, 6u);
+
+		// Only one mip level fits in the budget.
+		scheduler.SetScreenSize(a, 1024.0f);
+		scheduler.SetScreenSize(b, 1024.0f);
+		auto requests = scheduler.Schedule(4u);
+		MAGE_CHECK(1u == requests.size());
+		MAGE_CHECK(a == requests[0].m_index);
+		MAGE_CHECK(scheduler.GetMemoryBudget() == scheduler.GetMemoryUsage());
+		Complete(scheduler, requests);
+
+		// Texture a is no longer visible and is streamed out to make room.
+		scheduler.SetScreenSize(b, 1024.0f);
+		requests = scheduler.Schedule(4u);
+		MAGE_CHECK(1u == requests.size());
+		MAGE_CHECK(a == requests[0].m_index && 6u == requests[0].m_mip_level);
+		MAGE_CHECK(scheduler.GetMemoryBudget() == scheduler.GetMemoryUsage());
+		Complete(scheduler, requests);
+		MAGE_CHECK(6u == scheduler.GetResidentMipLevel(a));
+		MAGE_CHECK(scheduler.GetMemoryBudget() - mip_size == scheduler.GetMemoryUsage());
+
+		scheduler.SetScreenSize(b, 1024.0f);
+		requests = scheduler.Schedule(4u);
+		MAGE_CHECK(1u == requests.size());
+		MAGE_CHECK(b == requests[0].m_index && 5u == requests[0].m_mip_level);
+	}
+
+	void TestSchedulerUnregisterPending() {
+		const auto sizes = GetMipLevelSizes(1024u);
+		TextureStreamingScheduler scheduler(~std::size_t(0u));
+
+		const auto a = scheduler.Register(sizes, 1024u, 6u);
+		scheduler.SetScreenSize(a, 1024.0f);
+		const auto requests = scheduler.Schedule(4u);
+		MAGE_CHECK(1u == requests.size());
+
+		// Unregistering releases the reservation of the pending request, and
+		// the late completion is ignored.
+		scheduler.Unregister(a);
+		MAGE_CHECK(0u == scheduler.GetNumberOfPendingRequests());
+		MAGE_CHECK(0u == scheduler.GetMemoryUsage());
+		Complete(scheduler, requests);
+		MAGE_CHECK(0u == scheduler.GetMemoryUsage());
+		MAGE_CHECK(0u == scheduler.GetNumberOfTextures());
+	}
+
+	void TestSchedulerFailure() {
+		const auto sizes = GetMipLevelSizes(1024u);
+		TextureStreamingScheduler scheduler(~std::size_t(0u));
+
+		const auto a = scheduler.Register(sizes, 1024u, 6u);
+
+		scheduler.SetScreenSize(a, 1024.0f);
+		const auto requests = scheduler.Schedule(4u);
+		MAGE_CHECK(1u == requests.size());
+		MAGE_CHECK(GetMipChainSize(1024u, 5u) == scheduler.GetMemoryUsage());
+
+		// The reservation is released and the texture is never streamed again.
+		scheduler.OnFailed(requests[0]);
+		MAGE_CHECK(0u == scheduler.GetNumberOfPendingRequests());
+		MAGE_CHECK(GetMipChainSize(1024u, 6u) == scheduler.GetMemoryUsage());
+
+		scheduler.SetScreenSize(a, 1024.0f);
+		MAGE_CHECK(scheduler.Schedule(4u).empty());
+		MAGE_CHECK(6u == scheduler.GetResidentMipLevel(a));
+	}
+}
+
+int main() {
+	test::Run("TextureStreamingSchedulerRegister",         TestSchedulerRegister);
+	test::Run("TextureStreamingSchedulerMipSelection",     TestSchedulerMipSelection);
+	test::Run("TextureStreamingSchedulerPriority",         TestSchedulerPriority);
+	test::Run("TextureStreamingSchedulerBudget",           TestSchedulerBudget);
+	test::Run("TextureStreamingSchedulerUnregisterPending", TestSchedulerUnregisterPending);
+	test::Run("TextureStreamingSchedulerFailure",          TestSchedulerFailure);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "loaders/dds/dds_loader.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace mage::rendering;
+
+namespace {
+
+	[[nodiscard]]
+	const TextureDescriptor CreateDescriptor(DXGI_FORMAT format,
+											 U32 width,
+											 U32 height,
+											 U32 array_size = 1u) noexcept {
+		TextureDescriptor desc;
+		desc.m_dimension     = D3D11_RESOURCE_DIMENSION_TEXTURE2D;
+		desc.m_format        = format;
+		desc.m_width         = width;
+		desc.m_height        = height;
+		desc.m_depth         = 1u;
+		desc.m_array_size    = array_size;
+		desc.m_nb_mip_levels = 1u;
+		for (auto size = std::max(width, height); 1u < size; size >>= 1u) {
+			++desc.m_nb_mip_levels;
+		}
+		return desc;
+	}
+
+	//-------------------------------------------------------------------------
+	// Mip Offsets
+	//-------------------------------------------------------------------------
+
+	void TestSubresources() {
+		const auto desc = CreateDescriptor(DXGI_FORMAT_R8G8B8A8_UNORM, 256u, 64u, 2u);
+		MAGE_CHECK(9u == desc.m_nb_mip_levels);
+
+		const auto subresources = ComputeSubresources(desc);
+		MAGE_CHECK(18u == subresources.size());
+
+		// All mip levels of the first item, then all mip levels of the second.
+		std::size_t offset = 0u;
+		for (std::size_t i = 0u; i < subresources.size(); ++i) {
+			const auto& subresource = subresources[i];
+			const auto  mip_level   = static_cast< U32 >(i % desc.m_nb_mip_levels);
+
+			MAGE_CHECK(offset == subresource.m_offset);
+			MAGE_CHECK(std::max(256u >> mip_level, 1u) == subresource.m_width);
+			MAGE_CHECK(std::max( 64u >> mip_level, 1u) == subresource.m_height);
+			MAGE_CHECK(4u * subresource.m_width == subresource.m_row_pitch);
+			MAGE_CHECK(subresource.m_row_pitch * subresource.m_height
+					   == subresource.m_size);
+			offset += subresource.m_size;
+		}
+	}
+
+	void TestBlockCompressedSubresources() {
+		std::size_t row_pitch   = 0u;
+		std::size_t slice_pitch = 0u;
+		ComputePitch(DXGI_FORMAT_BC1_UNORM, 1u, 1u, row_pitch, slice_pitch);
+		MAGE_CHECK(8u == row_pitch && 8u == slice_pitch);
+		ComputePitch(DXGI_FORMAT_BC3_UNORM, 64u, 32u, row_pitch, slice_pitch);
+		MAGE_CHECK(256u == row_pitch && 2048u == slice_pitch);
+
+		// 64, 32, 16, 8, 4, 2 and 1 pixels wide (at least one 4x4 block).
+		const auto desc = CreateDescriptor(DXGI_FORMAT_BC1_UNORM, 64u, 64u);
+		const auto subresources = ComputeSubresources(desc);
+		MAGE_CHECK(7u == subresources.size());
+
+		const std::size_t sizes[] = { 2048u, 512u, 128u, 32u, 8u, 8u, 8u };
+		std::size_t offset = 0u;
+		for (std::size_t i = 0u; i < subresources.size(); ++i) {
+			MAGE_CHECK(offset   == subresources[i].m_offset);
+			MAGE_CHECK(sizes[i] == subresources[i].m_size);
+			offset += sizes[i];
+		}
+	}
+
+	void TestMipLevelSizes() {
+		// The mip levels of all texture array items are summed.
+		const auto desc  = CreateDescriptor(DXGI_FORMAT_R8G8B8A8_UNORM, 256u, 64u, 2u);
+		const auto sizes = ComputeMipLevelSizes(desc);
+		MAGE_CHECK(9u == sizes.size());
+		for (U32 mip_level = 0u; mip_level < sizes.size(); ++mip_level) {
+			MAGE_CHECK(2u * 4u * std::max(256u >> mip_level, 1u)
+						         * std::max( 64u >> mip_level, 1u)
+					   == sizes[mip_level]);
+		}
+
+		// At least one 4x4 block per mip level.
+		const auto bc_sizes = ComputeMipLevelSizes(
+			CreateDescriptor(DXGI_FORMAT_BC1_UNORM, 8u, 8u));
+		MAGE_CHECK((std::vector< std::size_t >{ 32u, 8u, 8u, 8u }) == bc_sizes);
+	}
+
+	void TestMipChain() {
+		const auto desc  = CreateDescriptor(DXGI_FORMAT_R8G8B8A8_UNORM, 256u, 64u, 2u);
+		const auto chain = GetMipChain(desc, 7u);
+
+		MAGE_CHECK(2u == chain.m_width);
+		MAGE_CHECK(1u == chain.m_height);
+		MAGE_CHECK(2u == chain.m_nb_mip_levels);
+		MAGE_CHECK(2u == chain.m_array_size);
+	}
+
+	void TestImportMipTail() {
+		const auto path = std::filesystem::temp_directory_path()
+			            / "mage_texture_streaming_test.dds";
+
+		const auto desc = CreateDescriptor(DXGI_FORMAT_R8G8B8A8_UNORM, 64u, 64u, 2u);
+		TextureData data;
+		data.Initialize(desc);
+		for (std::size_t i = 0u; i < data.GetSize(); ++i) {
+			data.GetPixels()[i] = static_cast< U8 >(i * 7u + i / 251u);
+		}
+		loader::ExportDDSTextureToFile(path, data);
+
+		TextureDescriptor file_desc;
+		loader::ImportDDSTextureDescriptorFromFile(path, file_desc);
+		MAGE_CHECK(64u == file_desc.m_width);
+		MAGE_CHECK(7u  == file_desc.m_nb_mip_levels);
+		MAGE_CHECK(2u  == file_desc.m_array_size);
+
+		// Only the mip levels starting at mip level 2 are read.
+		TextureData tail;
+		loader::ImportDDSTextureFromFile(path, tail, 2u);
+		MAGE_CHECK(16u == tail.GetDescriptor().m_width);
+		MAGE_CHECK(5u  == tail.GetDescriptor().m_nb_mip_levels);
+		MAGE_CHECK(10u == tail.GetNumberOfSubresources());
+
+		for (U32 item = 0u; 2u > item; ++item)
+		for (U32 mip_level = 0u; 5u > mip_level; ++mip_level) {
+			const auto i = tail.GetSubresourceIndex(mip_level, item);
+			const auto j = data.GetSubresourceIndex(mip_level + 2u, item);
+			MAGE_CHECK(data.GetSubresource(j).m_size == tail.GetSubresource(i).m_size);
+			MAGE_CHECK(0 == std::memcmp(data.GetPixels(j), tail.GetPixels(i),
+										tail.GetSubresource(i).m_size));
+		}
+
+		// The first mip level is clamped to the least detailed mip level.
+		loader::ImportDDSTextureFromFile(path, tail, 100u);
+		MAGE_CHECK(1u == tail.GetDescriptor().m_width);
+		MAGE_CHECK(1u == tail.GetDescriptor().m_nb_mip_levels);
+
+		std::filesystem::remove(path);
+	}
+}
+
+int main() {
+	test::Run("TextureSubresources",                TestSubresources);
+	test::Run("TextureBlockCompressedSubresources", TestBlockCompressedSubresources);
+	test::Run("TextureMipLevelSizes",               TestMipLevelSizes);
+	test::Run("TextureMipChain",                    TestMipChain);
+	test::Run("TextureImportMipTail",               TestImportMipTail);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
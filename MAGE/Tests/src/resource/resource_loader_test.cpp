@@ -0,0 +1,219 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "resource/resource_loader.hpp"
+#include "resource/resource_callbacks.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	using Loader = ResourceLoader< std::wstring, const int >;
+	using Handle = Loader::handle_type;
+
+	/**
+	 A gate blocking the loads until it is opened.
+	 */
+	class Gate {
+
+	public:
+
+		Gate()
+			: m_promise(),
+			m_future(m_promise.get_future().share()) {}
+
+		void Open() {
+			m_promise.set_value();
+		}
+
+		void Wait() const {
+			m_future.wait();
+		}
+
+	private:
+
+		std::promise< void > m_promise;
+		std::shared_future< void > m_future;
+	};
+
+	void Wait(const Handle& handle) {
+		handle.GetFuture().wait();
+	}
+
+	void TestDeduplication() {
+		ThreadPool pool(2u);
+		Loader loader;
+		Gate gate;
+		std::atomic< int > nb_loads = 0;
+
+		const auto load = [&gate, &nb_loads](int value) {
+			return [&gate, &nb_loads, value]() {
+				gate.Wait();
+				++nb_loads;
+				return MakeShared< const int >(value);
+			};
+		};
+
+		// Concurrent requests for the same key share a single in-flight load.
+		const auto a0 = loader.GetOrLoad(L"a", pool, load(1));
+		const auto a1 = loader.GetOrLoad(L"a", pool, load(2));
+		const auto b  = loader.GetOrLoad(L"b", pool, load(3));
+		MAGE_CHECK(2u == loader.size());
+		MAGE_CHECK(!a0.IsReady());
+		MAGE_CHECK(0u == loader.RemoveCompleted());
+
+		gate.Open();
+		Wait(a0);
+		Wait(a1);
+		Wait(b);
+
+		MAGE_CHECK(2 == nb_loads);
+		MAGE_CHECK(a0.Get() == a1.Get());
+		MAGE_CHECK(1 == *a1.Get());
+		MAGE_CHECK(3 == *b.Get());
+
+		// Completed loads are removed, after which a new request loads again.
+		MAGE_CHECK(2u == loader.RemoveCompleted());
+		MAGE_CHECK(0u == loader.size());
+
+		const auto a2 = loader.GetOrLoad(L"a", pool, load(4));
+		Wait(a2);
+		MAGE_CHECK(3 == nb_loads);
+		MAGE_CHECK(4 == *a2.Get());
+	}
+
+	void TestCallbacks() {
+		ThreadPool pool(1u);
+		Loader loader;
+		ResourceCallbacks callbacks;
+		Gate gate;
+		std::vector< int > performed;
+
+		const auto a = loader.GetOrLoad(L"a", pool, [&gate]() {
+			gate.Wait();
+			return MakeShared< const int >(1);
+		});
+		const auto b = loader.GetOrLoad(L"b", pool, []() {
+			return MakeShared< const int >(2);
+		});
+
+		callbacks.OnLoaded(a, [&performed](SharedPtr< const int > resource) {
+			performed.push_back(*resource);
+		});
+		callbacks.OnLoaded(b, [&performed](SharedPtr< const int > resource) {
+			performed.push_back(*resource);
+		});
+		callbacks.OnLoaded(a, [&performed](SharedPtr< const int > resource) {
+			performed.push_back(10 * *resource);
+		});
+		MAGE_CHECK(3u == callbacks.size());
+
+		// Nothing is performed until the resources are loaded. The thread pool
+		// executes the loads in order, so b is not loaded before a.
+		MAGE_CHECK(0u == callbacks.Update());
+		MAGE_CHECK(performed.empty());
+		MAGE_CHECK(3u == callbacks.size());
+
+		gate.Open();
+		Wait(a);
+		Wait(b);
+
+		// The actions are performed once, in order of registration.
+		MAGE_CHECK(3u == callbacks.Update());
+		MAGE_CHECK((std::vector< int >{ 1, 2, 10 }) == performed);
+		MAGE_CHECK(0u == callbacks.size());
+		MAGE_CHECK(0u == callbacks.Update());
+		MAGE_CHECK(3u == performed.size());
+	}
+
+	void TestCallbacksFailure() {
+		ThreadPool pool(1u);
+		Loader loader;
+		ResourceCallbacks callbacks;
+		bool performed = false;
+
+		const auto a = loader.GetOrLoad(L"a", pool, []() -> SharedPtr< const int > {
+			throw std::runtime_error("load failed");
+		});
+		Wait(a);
+
+		// The action of a failed load is discarded.
+		callbacks.OnLoaded(a, [&performed](SharedPtr< const int >) {
+			performed = true;
+		});
+		MAGE_CHECK(1u == callbacks.Update());
+		MAGE_CHECK(!performed);
+		MAGE_CHECK(0u == callbacks.size());
+	}
+
+	void TestCallbacksNested() {
+		ThreadPool pool(1u);
+		Loader loader;
+		ResourceCallbacks callbacks;
+		int nb_performed = 0;
+
+		const auto a = loader.GetOrLoad(L"a", pool, []() {
+			return MakeShared< const int >(1);
+		});
+		Wait(a);
+
+		// Actions registered by an action are performed on the next update.
+		callbacks.OnLoaded(a, [&](SharedPtr< const int >) {
+			++nb_performed;
+			callbacks.OnLoaded(a, [&nb_performed](SharedPtr< const int >) {
+				++nb_performed;
+			});
+		});
+		MAGE_CHECK(1u == callbacks.Update());
+		MAGE_CHECK(1 == nb_performed);
+		MAGE_CHECK(1u == callbacks.size());
+		MAGE_CHECK(1u == callbacks.Update());
+		MAGE_CHECK(2 == nb_performed);
+	}
+
+	void TestCallbacksClear() {
+		ResourceCallbacks callbacks;
+		bool performed = false;
+
+		std::promise< SharedPtr< const int > > promise;
+		const Handle handle(promise.get_future().share());
+		callbacks.OnLoaded(handle, [&performed](SharedPtr< const int >) {
+			performed = true;
+		});
+
+		// Discarded actions are not performed once the resource is loaded.
+		callbacks.clear();
+		promise.set_value(MakeShared< const int >(1));
+		MAGE_CHECK(0u == callbacks.Update());
+		MAGE_CHECK(!performed);
+	}
+}
+
+int main() {
+	test::Run("ResourceLoaderDeduplication",  TestDeduplication);
+	test::Run("ResourceCallbacks",            TestCallbacks);
+	test::Run("ResourceCallbacksFailure",     TestCallbacksFailure);
+	test::Run("ResourceCallbacksNested",      TestCallbacksNested);
+	test::Run("ResourceCallbacksClear",       TestCallbacksClear);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "resource/resource_pool.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	/**
+	 A resource whose construction simulates a file load and parse.
+	 */
+	class SlowResource {
+
+	public:
+
+		explicit SlowResource(std::chrono::microseconds load_time,
+							  std::atomic< std::size_t >& nb_constructions) {
+			++nb_constructions;
+			std::this_thread::sleep_for(load_time);
+		}
+	};
+
+	/**
+	 Requests all keys from the given number of loader threads. Each thread
+	 starts at a different key, so the requests of the threads overlap.
+
+	 @return		The wall clock time (in milliseconds).
+	 */
+	template< typename PoolT >
+	[[nodiscard]]
+	double Run(std::size_t nb_threads,
+			   std::size_t nb_keys,
+			   std::chrono::microseconds load_time) {
+
+		PoolT pool;
+		std::atomic< std::size_t > nb_constructions = 0u;
+
+		const auto start = Clock::now();
+
+		// The loaded resources stay referenced (e.g. by a scene) until all
+		// loader threads are finished.
+		std::vector< std::vector< SharedPtr< SlowResource > > >
+			resources(nb_threads);
+
+		std::vector< std::thread > threads;
+		for (std::size_t t = 0u; t < nb_threads; ++t) {
+			threads.emplace_back([&, t]() {
+				resources[t].reserve(nb_keys);
+
+				const auto offset = t * nb_keys / nb_threads;
+				for (std::size_t i = 0u; i < nb_keys; ++i) {
+					const auto key = std::to_wstring((offset + i) % nb_keys);
+					resources[t].push_back(
+						pool.GetOrCreate(key, load_time, nb_constructions));
+					MAGE_CHECK(nullptr != resources[t].back());
+				}
+			});
+		}
+
+		for (auto& thread : threads) {
+			thread.join();
+		}
+
+		const std::chrono::duration< double, std::milli > time
+			= Clock::now() - start;
+
+		// Every key is constructed exactly once.
+		MAGE_CHECK(nb_keys == nb_constructions);
+		MAGE_CHECK(nb_keys == pool.size());
+
+		return time.count();
+	}
+
+	template< typename PoolT >
+	void Benchmark(const char* name,
+				   std::size_t nb_keys,
+				   std::chrono::microseconds load_time) {
+
+		for (const std::size_t nb_threads : { 1u, 2u, 4u, 8u, 16u }) {
+			const auto time = Run< PoolT >(nb_threads, nb_keys, load_time);
+			std::printf("%-24s %2zu threads: %9.2f ms (%9.1f loads/s)\n",
+						name, nb_threads, time, 1000.0 * nb_keys / time);
+		}
+	}
+}
+
+int main(int argc, char* argv[]) {
+	const std::size_t nb_keys = (1 < argc) ? std::stoul(argv[1]) : 256u;
+	const std::chrono::microseconds load_time((2 < argc) ? std::stol(argv[2]) : 500);
+
+	std::printf("%zu keys, %lld us per load\n",
+				nb_keys, static_cast< long long >(load_time.count()));
+
+	Benchmark< ResourcePool< std::wstring, SlowResource > >(
+		"ResourcePool", nb_keys, load_time);
+	Benchmark< PersistentResourcePool< std::wstring, SlowResource > >(
+		"PersistentResourcePool", nb_keys, load_time);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,201 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "resource/resource_pool.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	/**
+	 A resource whose memory usage changes after its construction (e.g., a
+	 streamed texture).
+	 */
+	class Resource {
+
+	public:
+
+		explicit Resource(std::size_t memory_usage) noexcept
+			: m_memory_usage(memory_usage) {}
+
+		[[nodiscard]]
+		std::size_t GetMemoryUsage() const noexcept {
+			return m_memory_usage;
+		}
+
+		void SetMemoryUsage(std::size_t memory_usage) noexcept {
+			m_memory_usage = memory_usage;
+		}
+
+	private:
+
+		std::size_t m_memory_usage;
+	};
+
+	using Pool = ResourcePool< int, Resource >;
+
+	void TestStatistics() {
+		Pool pool(100u);
+
+		const auto r0 = pool.GetOrCreate(0, 10u);
+		const auto r1 = pool.GetOrCreate(0, 10u);
+		const auto r2 = pool.GetOrCreate(1, 20u);
+
+		MAGE_CHECK(r0 == r1);
+		MAGE_CHECK(r0 != r2);
+		MAGE_CHECK(2u == pool.size());
+
+		const auto statistics = pool.GetStatistics();
+		MAGE_CHECK(2u == statistics.m_nb_resources);
+		MAGE_CHECK(0u == statistics.m_nb_unreferenced_resources);
+		MAGE_CHECK(30u == statistics.m_memory_usage);
+		MAGE_CHECK(1u == statistics.m_nb_hits);
+		MAGE_CHECK(2u == statistics.m_nb_misses);
+	}
+
+	void TestLeastRecentlyUsedEviction() {
+		Pool pool(30u);
+
+		// Resources 0, 1 and 2 are unreferenced and kept warm.
+		pool.GetOrCreate(0, 10u);
+		pool.GetOrCreate(1, 10u);
+		pool.GetOrCreate(2, 10u);
+		MAGE_CHECK(3u == pool.size());
+
+		// Using resource 0 makes resource 1 the least recently used one.
+		MAGE_CHECK(nullptr != pool.Get(0));
+
+		pool.GetOrCreate(3, 10u);
+		MAGE_CHECK(pool.Contains(0));
+		MAGE_CHECK(!pool.Contains(1));
+		MAGE_CHECK(pool.Contains(2));
+		MAGE_CHECK(pool.Contains(3));
+	}
+
+	void TestContainsDoesNotCountAsUse() {
+		Pool pool(30u);
+
+		pool.GetOrCreate(0, 10u);
+		pool.GetOrCreate(1, 10u);
+		pool.GetOrCreate(2, 10u);
+
+		// Resource 0 remains the least recently used one.
+		MAGE_CHECK(pool.Contains(0));
+
+		pool.GetOrCreate(3, 10u);
+		MAGE_CHECK(!pool.Contains(0));
+		MAGE_CHECK(pool.Contains(1));
+	}
+
+	void TestReferencedResourcesAreNotEvicted() {
+		Pool pool(10u);
+
+		const auto r0 = pool.GetOrCreate(0, 10u);
+		const auto r1 = pool.GetOrCreate(1, 10u);
+		MAGE_CHECK(2u == pool.size());
+		MAGE_CHECK(0u == pool.Trim());
+
+		const auto statistics = pool.GetStatistics();
+		MAGE_CHECK(20u == statistics.m_memory_usage);
+		MAGE_CHECK(20u == statistics.m_peak_memory_usage);
+	}
+
+	void TestChangingMemoryUsage() {
+		Pool pool(40u);
+
+		auto r0 = pool.GetOrCreate(0, 10u);
+		pool.GetOrCreate(1, 10u);
+		MAGE_CHECK(2u == pool.size());
+		MAGE_CHECK(20u == pool.GetStatistics().m_memory_usage);
+
+		// Resource 0 grows beyond the memory budget after its construction.
+		// The growth is only accounted for once the memory usage is updated.
+		r0->SetMemoryUsage(35u);
+		MAGE_CHECK(45u == pool.GetStatistics().m_memory_usage);
+		MAGE_CHECK(0u == pool.Trim());
+		MAGE_CHECK(pool.Contains(1));
+		pool.UpdateMemoryUsage();
+		MAGE_CHECK(1u == pool.Trim());
+		MAGE_CHECK(pool.Contains(0));
+		MAGE_CHECK(!pool.Contains(1));
+
+		// Resource 0 shrinks, the freed memory is available again (the trim
+		// finds the budget exceeded and updates the memory usage first).
+		r0->SetMemoryUsage(5u);
+		pool.GetOrCreate(2, 30u);
+		MAGE_CHECK(0u == pool.Trim());
+		MAGE_CHECK(35u == pool.GetStatistics().m_memory_usage);
+
+		// The current memory usage is subtracted on eviction.
+		r0->SetMemoryUsage(20u);
+		r0.reset();
+		pool.UpdateMemoryUsage();
+		MAGE_CHECK(1u == pool.Trim());
+		MAGE_CHECK(!pool.Contains(0));
+		MAGE_CHECK(30u == pool.GetStatistics().m_memory_usage);
+
+		pool.GetOrCreate(3, 40u);
+		MAGE_CHECK(!pool.Contains(2));
+		MAGE_CHECK(pool.Contains(3));
+		MAGE_CHECK(40u == pool.GetStatistics().m_memory_usage);
+	}
+
+	void TestRemove() {
+		Pool pool(100u);
+
+		auto r0 = pool.GetOrCreate(0, 10u);
+
+		// Referenced resources are not removed.
+		pool.Remove(0);
+		MAGE_CHECK(pool.Contains(0));
+
+		r0->SetMemoryUsage(30u);
+		r0.reset();
+		pool.Remove(0);
+		MAGE_CHECK(pool.empty());
+		MAGE_CHECK(0u == pool.GetStatistics().m_memory_usage);
+	}
+
+	void TestPersistentRemove() {
+		PersistentResourcePool< int, Resource > pool;
+
+		const auto r0 = pool.GetOrCreate(0, 10u);
+		pool.GetOrCreate(1, 20u);
+		MAGE_CHECK(30u == pool.GetStatistics().m_memory_usage);
+
+		// The memory usage accounted for at construction is subtracted, even
+		// if the resource grew or shrank in the meantime.
+		r0->SetMemoryUsage(50u);
+		pool.Remove(0);
+		MAGE_CHECK(!pool.Contains(0));
+		MAGE_CHECK(1u == pool.GetStatistics().m_nb_resources);
+		MAGE_CHECK(20u == pool.GetStatistics().m_memory_usage);
+
+		const auto r1 = pool.Get(1);
+		r1->SetMemoryUsage(5u);
+		pool.Remove(1);
+		MAGE_CHECK(pool.empty());
+		MAGE_CHECK(0u == pool.GetStatistics().m_nb_resources);
+		MAGE_CHECK(0u == pool.GetStatistics().m_memory_usage);
+	}
+}
+
+int main() {
+	test::Run("ResourcePoolStatistics",                  TestStatistics);
+	test::Run("ResourcePoolLeastRecentlyUsedEviction",   TestLeastRecentlyUsedEviction);
+	test::Run("ResourcePoolContainsDoesNotCountAsUse",   TestContainsDoesNotCountAsUse);
+	test::Run("ResourcePoolReferencedResources",         TestReferencedResourcesAreNotEvicted);
+	test::Run("ResourcePoolChangingMemoryUsage",         TestChangingMemoryUsage);
+	test::Run("ResourcePoolRemove",                      TestRemove);
+	test::Run("PersistentResourcePoolRemove",            TestPersistentRemove);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
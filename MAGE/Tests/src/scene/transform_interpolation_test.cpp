@@ -0,0 +1,191 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "collection/vector.hpp"
+#include "scene/node.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	constexpr F32 g_epsilon = 1e-4f;
+
+	[[nodiscard]]
+	bool XM_CALLCONV NearEqual(FXMVECTOR v1, FXMVECTOR v2) noexcept {
+		return XMVector3NearEqual(v1, v2, XMVectorReplicate(g_epsilon));
+	}
+
+	/**
+	 Returns the given number of nodes owned by a vector.
+	 */
+	[[nodiscard]]
+	AlignedVector< Node > CreateNodes(std::size_t nb_nodes) {
+		AlignedVector< Node > nodes(nb_nodes);
+		for (std::size_t i = 0u; i < nodes.size(); ++i) {
+			nodes[i].Set(Node::NodePtr(nodes, i));
+		}
+		return nodes;
+	}
+
+	void TestDisabled() {
+		auto nodes = CreateNodes(1u);
+		auto& transform = nodes[0].GetTransform();
+
+		// No transform is interpolated: the engine does not traverse the
+		// nodes for the interpolation.
+		MAGE_CHECK(!transform.IsInterpolated());
+		MAGE_CHECK(0u == Transform::GetNumberOfInterpolatedTransforms());
+
+		// Storing, applying and reverting the interpolation of a transform
+		// which is not interpolated have no effect.
+		transform.SetTranslation(1.0f, 2.0f, 3.0f);
+		transform.StorePreviousTransform();
+		transform.SetTranslation(3.0f, 2.0f, 1.0f);
+		transform.ApplyInterpolation(0.5f);
+		MAGE_CHECK(NearEqual(XMVectorSet(3.0f, 2.0f, 1.0f, 1.0f),
+							 transform.GetWorldOrigin()));
+		transform.RevertInterpolation();
+		MAGE_CHECK(NearEqual(XMVectorSet(3.0f, 2.0f, 1.0f, 1.0f),
+							 transform.GetWorldOrigin()));
+		MAGE_CHECK(0u == Transform::GetNumberOfInterpolatedTransforms());
+	}
+
+	void TestNumberOfInterpolatedTransforms() {
+		Transform a;
+		Transform b;
+		a.SetInterpolated(true);
+		b.SetInterpolated(true);
+		b.SetInterpolated(true);
+		MAGE_CHECK(2u == Transform::GetNumberOfInterpolatedTransforms());
+
+		// The interpolation state is not copied.
+		{
+			Transform copy(a);
+			MAGE_CHECK(!copy.IsInterpolated());
+			copy = b;
+			MAGE_CHECK(!copy.IsInterpolated());
+			MAGE_CHECK(2u == Transform::GetNumberOfInterpolatedTransforms());
+		}
+
+		// The interpolation state is moved.
+		{
+			Transform moved(std::move(a));
+			MAGE_CHECK(moved.IsInterpolated());
+			MAGE_CHECK(2u == Transform::GetNumberOfInterpolatedTransforms());
+
+			// The interpolation state of the assigned transform is
+			// destroyed.
+			b = std::move(moved);
+			MAGE_CHECK(b.IsInterpolated());
+			MAGE_CHECK(1u == Transform::GetNumberOfInterpolatedTransforms());
+		}
+
+		b.SetInterpolated(false);
+		MAGE_CHECK(0u == Transform::GetNumberOfInterpolatedTransforms());
+
+		// Destroyed transforms are no longer counted.
+		{
+			Transform c;
+			c.SetInterpolated(true);
+			MAGE_CHECK(1u == Transform::GetNumberOfInterpolatedTransforms());
+		}
+		MAGE_CHECK(0u == Transform::GetNumberOfInterpolatedTransforms());
+	}
+
+	void TestApplyRevert() {
+		auto nodes = CreateNodes(2u);
+		nodes[0].AddChild(Node::NodePtr(nodes, 1u));
+		auto& parent = nodes[0].GetTransform();
+		auto& child  = nodes[1].GetTransform();
+		child.SetTranslation(0.0f, 1.0f, 0.0f);
+
+		parent.SetInterpolated(true);
+		parent.StorePreviousTransform();
+		parent.SetTranslation(2.0f, 0.0f, 0.0f);
+
+		// The world matrices of the transform and its descendants reflect
+		// the interpolated local transform. The local transform itself is
+		// not changed.
+		parent.ApplyInterpolation(0.25f);
+		MAGE_CHECK(NearEqual(XMVectorSet(0.5f, 0.0f, 0.0f, 1.0f),
+							 parent.GetWorldOrigin()));
+		MAGE_CHECK(NearEqual(XMVectorSet(0.5f, 1.0f, 0.0f, 1.0f),
+							 child.GetWorldOrigin()));
+		MAGE_CHECK(2.0f == parent.GetTranslationX());
+
+		// Reverting restores the current local transform.
+		parent.RevertInterpolation();
+		MAGE_CHECK(NearEqual(XMVectorSet(2.0f, 0.0f, 0.0f, 1.0f),
+							 parent.GetWorldOrigin()));
+		MAGE_CHECK(NearEqual(XMVectorSet(2.0f, 1.0f, 0.0f, 1.0f),
+							 child.GetWorldOrigin()));
+
+		// The end points are the previous and the current local transform.
+		parent.ApplyInterpolation(0.0f);
+		MAGE_CHECK(NearEqual(XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f),
+							 parent.GetWorldOrigin()));
+		parent.RevertInterpolation();
+		parent.ApplyInterpolation(1.0f);
+		MAGE_CHECK(NearEqual(XMVectorSet(2.0f, 0.0f, 0.0f, 1.0f),
+							 parent.GetWorldOrigin()));
+		parent.RevertInterpolation();
+
+		// Reverting twice has no effect.
+		parent.RevertInterpolation();
+		MAGE_CHECK(NearEqual(XMVectorSet(2.0f, 0.0f, 0.0f, 1.0f),
+							 parent.GetWorldOrigin()));
+
+		parent.SetInterpolated(false);
+	}
+
+	void TestApplyRotation() {
+		auto nodes = CreateNodes(2u);
+		nodes[0].AddChild(Node::NodePtr(nodes, 1u));
+		auto& parent = nodes[0].GetTransform();
+		auto& child  = nodes[1].GetTransform();
+		child.SetTranslation(0.0f, 0.0f, 1.0f);
+
+		parent.SetInterpolated(true);
+		parent.SetRotationY(XM_PIDIV2);
+
+		// The rotation is slerped: halfway, the child is rotated by a
+		// quarter of pi around the y-axis of the parent.
+		parent.ApplyInterpolation(0.5f);
+		const auto origin = child.GetWorldOrigin();
+		MAGE_CHECK_NEAR(std::sqrt(0.5f), std::abs(XMVectorGetX(origin)), g_epsilon);
+		MAGE_CHECK_NEAR(0.0f, XMVectorGetY(origin), g_epsilon);
+		MAGE_CHECK_NEAR(std::sqrt(0.5f), XMVectorGetZ(origin), g_epsilon);
+
+		// Disabling the interpolation reverts it.
+		parent.SetInterpolated(false);
+		MAGE_CHECK_NEAR(1.0f, std::abs(XMVectorGetX(child.GetWorldOrigin())), g_epsilon);
+		MAGE_CHECK(0u == Transform::GetNumberOfInterpolatedTransforms());
+	}
+}
+
+int main() {
+	test::Run("TransformInterpolationDisabled",                  TestDisabled);
+	test::Run("TransformNumberOfInterpolatedTransforms",         TestNumberOfInterpolatedTransforms);
+	test::Run("TransformInterpolationApplyRevert",               TestApplyRevert);
+	test::Run("TransformInterpolationApplyRotation",             TestApplyRotation);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
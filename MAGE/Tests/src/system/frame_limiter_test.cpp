@@ -0,0 +1,213 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "system/frame_limiter.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <memory>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+using namespace std::chrono_literals;
+
+namespace {
+
+	/**
+	 A struct of test clocks. Each poll of a test clock advances its time by
+	 a fixed amount, so spinning terminates.
+	 */
+	struct TestClock {
+		using rep        = U64;
+		using period     = std::nano;
+		using duration   = std::chrono::duration< rep, period >;
+		using time_point = std::chrono::time_point< TestClock >;
+
+		static constexpr bool is_steady = true;
+
+		/**
+		 The time advanced per poll.
+		 */
+		static constexpr duration s_poll = duration(1'000u);
+
+		/**
+		 A struct of test clock states shared by the copies of a test clock
+		 and its sleep function.
+		 */
+		struct State {
+			time_point m_now     = time_point(duration(1'000'000'000u));
+			U64 m_nb_polls       = 0u;
+			U64 m_nb_sleeps      = 0u;
+			// The overshoot of each sleep beyond the requested duration.
+			duration m_overshoot = duration::zero();
+		};
+
+		[[nodiscard]]
+		time_point now() noexcept {
+			++m_state->m_nb_polls;
+			m_state->m_now += s_poll;
+			return m_state->m_now;
+		}
+
+		std::shared_ptr< State > m_state = std::make_shared< State >();
+	};
+
+	using TestFrameLimiter = FrameLimiter< TestClock >;
+
+	[[nodiscard]]
+	TestFrameLimiter MakeFrameLimiter(const TestClock& clock) {
+		const auto state = clock.m_state;
+		return TestFrameLimiter(clock, [state](TestClock::duration duration) {
+			++state->m_nb_sleeps;
+			state->m_now += duration + state->m_overshoot;
+		});
+	}
+
+	/**
+	 Runs the given number of frames of the given duration (excluding the
+	 waiting time) and returns the frame times.
+	 */
+	[[nodiscard]]
+	std::vector< TestClock::duration > RunFrames(TestFrameLimiter& limiter,
+												 TestClock& clock,
+												 std::size_t nb_frames,
+												 TestClock::duration work) {
+		std::vector< TestClock::duration > frame_times;
+
+		auto last = clock.m_state->m_now;
+		for (std::size_t i = 0u; i < nb_frames; ++i) {
+			clock.m_state->m_now += work;
+			limiter.Wait();
+
+			frame_times.push_back(clock.m_state->m_now - last);
+			last = clock.m_state->m_now;
+		}
+
+		return frame_times;
+	}
+
+	void TestPacing() {
+		TestClock clock;
+		auto limiter = MakeFrameLimiter(clock);
+		limiter.SetTargetFrameRate(100.0);
+
+		const auto frame_times = RunFrames(limiter, clock, 100u, 3ms);
+
+		// Every frame lasts the target frame time, up to a few polls.
+		for (const auto frame_time : frame_times) {
+			MAGE_CHECK(10ms <= frame_time + 4u * TestClock::s_poll);
+			MAGE_CHECK(frame_time <= 10ms + 4u * TestClock::s_poll);
+		}
+
+		const auto& statistics = limiter.GetStatistics();
+		MAGE_CHECK(100u == statistics.m_nb_frames);
+		MAGE_CHECK_NEAR(10.0, statistics.m_mean_frame_time, 0.01);
+		MAGE_CHECK(0.01 > statistics.m_jitter);
+	}
+
+	void TestSleepEstimate() {
+		TestClock clock;
+		clock.m_state->m_overshoot = 500us;
+		auto limiter = MakeFrameLimiter(clock);
+		limiter.SetTargetFrameRate(100.0);
+
+		// Learn the sleep durations of 1.5ms.
+		static_cast< void >(RunFrames(limiter, clock, 20u, 1ms));
+
+		const auto nb_polls  = clock.m_state->m_nb_polls;
+		const auto nb_sleeps = clock.m_state->m_nb_sleeps;
+		const auto frame_times = RunFrames(limiter, clock, 100u, 1ms);
+
+		// Sleeping never overshoots the deadline.
+		for (const auto frame_time : frame_times) {
+			MAGE_CHECK(frame_time <= 10ms + 4u * TestClock::s_poll);
+		}
+
+		// Most of the waiting time is slept: per frame about 6 sleeps of
+		// 1.5ms and at most the estimated sleep duration is spun.
+		const auto sleeps_per_frame
+			= static_cast< F64 >(clock.m_state->m_nb_sleeps - nb_sleeps) / 100.0;
+		const auto polls_per_frame
+			= static_cast< F64 >(clock.m_state->m_nb_polls - nb_polls) / 100.0;
+		MAGE_CHECK(5.0 <= sleeps_per_frame && sleeps_per_frame <= 6.0);
+		MAGE_CHECK(polls_per_frame * TestClock::s_poll.count()
+				   <= 2'000'000.0 + sleeps_per_frame * 2'000.0);
+	}
+
+	void TestMissedDeadline() {
+		TestClock clock;
+		auto limiter = MakeFrameLimiter(clock);
+		limiter.SetTargetFrameRate(100.0);
+
+		static_cast< void >(RunFrames(limiter, clock, 10u, 1ms));
+
+		// A frame missing its deadline by more than a frame does not cause a
+		// burst of short frames to catch up.
+		const auto slow = RunFrames(limiter, clock, 1u, 35ms);
+		MAGE_CHECK(35ms <= slow.front());
+
+		for (const auto frame_time : RunFrames(limiter, clock, 10u, 1ms)) {
+			MAGE_CHECK(10ms <= frame_time + 4u * TestClock::s_poll);
+		}
+	}
+
+	void TestRestart() {
+		TestClock clock;
+		auto limiter = MakeFrameLimiter(clock);
+		limiter.SetTargetFrameRate(50.0);
+
+		static_cast< void >(RunFrames(limiter, clock, 10u, 1ms));
+
+		// After a period of inactivity, the next frame starts at the restart.
+		clock.m_state->m_now += 1s;
+		limiter.Restart();
+		const auto restart = clock.m_state->m_now;
+
+		clock.m_state->m_now += 1ms;
+		limiter.Wait();
+		const auto frame_time = clock.m_state->m_now - restart;
+		MAGE_CHECK(20ms <= frame_time + 4u * TestClock::s_poll);
+		MAGE_CHECK(frame_time <= 20ms + 4u * TestClock::s_poll);
+	}
+
+	void TestUnlimited() {
+		TestClock clock;
+		auto limiter = MakeFrameLimiter(clock);
+		limiter.SetTargetFrameRate(0.0);
+
+		const auto frame_times = RunFrames(limiter, clock, 10u, 3ms);
+
+		// Frames are never delayed.
+		MAGE_CHECK(0u == clock.m_state->m_nb_sleeps);
+		for (const auto frame_time : frame_times) {
+			MAGE_CHECK(frame_time <= 3ms + 4u * TestClock::s_poll);
+		}
+		MAGE_CHECK(10u == limiter.GetStatistics().m_nb_frames);
+
+		limiter.ResetStatistics();
+		MAGE_CHECK(0u == limiter.GetStatistics().m_nb_frames);
+	}
+}
+
+int main() {
+	test::Run("FrameLimiterPacing",         TestPacing);
+	test::Run("FrameLimiterSleepEstimate",  TestSleepEstimate);
+	test::Run("FrameLimiterMissedDeadline", TestMissedDeadline);
+	test::Run("FrameLimiterRestart",        TestRestart);
+	test::Run("FrameLimiterUnlimited",      TestUnlimited);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
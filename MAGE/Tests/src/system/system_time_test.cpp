@@ -0,0 +1,124 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "system/system_time.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	constexpr std::size_t g_nb_samples = 1'000'000u;
+
+	/**
+	 Checks that the given clock never goes backwards on the calling thread.
+	 */
+	template< typename ClockT >
+	void CheckMonotonic(std::size_t nb_samples) {
+		auto previous = ClockT::now();
+		for (std::size_t i = 0u; i < nb_samples; ++i) {
+			const auto current = ClockT::now();
+			MAGE_CHECK(previous <= current);
+			previous = current;
+		}
+	}
+
+	void TestTSCClockCalibration() {
+		using std::chrono::milliseconds;
+
+		// Before the calibration, the steady clock is used.
+		const auto before = TSCClock::now();
+		TSCClock::Calibrate();
+		const auto after  = TSCClock::now();
+
+		// The calibrated clock has the same epoch as the steady clock, up to
+		// the error of the calibration.
+		MAGE_CHECK(before <= after + milliseconds(1));
+		MAGE_CHECK(after - before < milliseconds(1000));
+		MAGE_CHECK(TSCClock::IsInvariant() == (0u != TSCClock::GetFrequency()));
+
+		std::printf("  invariant TSC: %s, frequency: %llu Hz\n",
+					TSCClock::IsInvariant() ? "yes" : "no",
+					static_cast< unsigned long long >(TSCClock::GetFrequency()));
+	}
+
+	void TestTSCClockMonotonic() {
+		std::vector< std::thread > threads;
+		for (std::size_t t = 0u; t < 4u; ++t) {
+			threads.emplace_back(CheckMonotonic< TSCClock >, g_nb_samples);
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+	}
+
+	void TestTSCClockRate() {
+		using std::chrono::duration_cast;
+		using std::chrono::microseconds;
+		using std::chrono::milliseconds;
+		using std::chrono::steady_clock;
+
+		const auto steady_begin = steady_clock::now();
+		const auto tsc_begin    = TSCClock::now();
+		std::this_thread::sleep_for(milliseconds(50));
+		const auto tsc_end      = TSCClock::now();
+		const auto steady_end   = steady_clock::now();
+
+		// The clock advances at the rate of the steady clock.
+		const auto steady = duration_cast< microseconds >(steady_end - steady_begin);
+		const auto tsc    = duration_cast< microseconds >(tsc_end - tsc_begin);
+		MAGE_CHECK(tsc <= steady + microseconds(1000));
+		MAGE_CHECK(steady - microseconds(2000) <= tsc);
+	}
+
+	void TestThreadCoreClock() {
+		using std::chrono::milliseconds;
+
+		CheckMonotonic< ThreadCoreClock >(g_nb_samples / 10u);
+
+		// Sleeping does not consume core time, but spinning does.
+		const auto begin = ThreadCoreClock::now();
+		std::this_thread::sleep_for(milliseconds(50));
+		const auto slept = ThreadCoreClock::now();
+
+		const auto wall_begin = TSCClock::now();
+		const auto deadline   = wall_begin + milliseconds(5000);
+		auto spun = slept;
+		while (spun - slept < milliseconds(25) && TSCClock::now() < deadline) {
+			spun = ThreadCoreClock::now();
+		}
+		const auto wall_end   = TSCClock::now();
+
+		MAGE_CHECK(slept - begin < milliseconds(25));
+		MAGE_CHECK(milliseconds(25) <= spun - slept);
+		// The core time of a thread cannot exceed the wall time.
+		MAGE_CHECK(spun - slept <= wall_end - wall_begin + milliseconds(16));
+	}
+}
+
+int main() {
+	// The calibration must precede the other tests.
+	test::Run("TSCClockCalibration", TestTSCClockCalibration);
+	test::Run("TSCClockMonotonic",   TestTSCClockMonotonic);
+	test::Run("TSCClockRate",        TestTSCClockRate);
+	test::Run("ThreadCoreClock",     TestThreadCoreClock);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,270 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "system/telemetry.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	/**
+	 Returns the sample with the given name of the snapshot of the given
+	 telemetry registry.
+	 */
+	[[nodiscard]]
+	const TelemetrySample GetSample(const Telemetry& telemetry,
+									std::string_view name) {
+		for (const auto& sample : telemetry.GetSnapshot()) {
+			if (name == sample.m_name) {
+				return sample;
+			}
+		}
+
+		MAGE_CHECK(!"sample not found");
+		return {};
+	}
+
+	/**
+	 Returns the contents of the given file.
+	 */
+	[[nodiscard]]
+	std::string ReadFile(const std::filesystem::path& path) {
+		std::ifstream file(path);
+		std::stringstream contents;
+		contents << file.rdbuf();
+		return contents.str();
+	}
+
+	[[nodiscard]]
+	bool Contains(const std::string& str, std::string_view substr) {
+		return std::string::npos != str.find(substr);
+	}
+
+	void TestCounter() {
+		Telemetry telemetry;
+		auto& counter = telemetry.GetCounter("counter");
+		MAGE_CHECK(&counter == &telemetry.GetCounter("counter"));
+
+		// Each thread increments its own shard.
+		std::vector< std::thread > threads;
+		for (std::size_t t = 0u; t < 4u; ++t) {
+			threads.emplace_back([&counter]() {
+				for (std::size_t i = 0u; i < 1000u; ++i) {
+					counter.Increment();
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+
+		telemetry.NextFrame();
+		auto sample = GetSample(telemetry, "counter");
+		MAGE_CHECK(TelemetryType::Counter == sample.m_type);
+		MAGE_CHECK(4000.0 == sample.m_value);
+		MAGE_CHECK(4000.0 == sample.m_total);
+
+		// The value of a frame is the increment of the frame.
+		counter.Increment(5u);
+		telemetry.NextFrame();
+		sample = GetSample(telemetry, "counter");
+		MAGE_CHECK(5.0 == sample.m_value);
+		MAGE_CHECK(4005.0 == sample.m_total);
+	}
+
+	void TestGauge() {
+		Telemetry telemetry;
+		telemetry.GetGauge("gauge").Set(2.5);
+		telemetry.NextFrame();
+
+		const auto sample = GetSample(telemetry, "gauge");
+		MAGE_CHECK(TelemetryType::Gauge == sample.m_type);
+		MAGE_CHECK(2.5 == sample.m_value);
+		MAGE_CHECK(2.5 == sample.m_total);
+	}
+
+	void TestHistogramBuckets() {
+		// The reported bound of a bucket is the largest value of the bucket.
+		const std::pair< U64, F64 > values[] = {
+			{ 0u, 0.0 },
+			{ 1u, 1.0 },
+			{ 2u, 3.0 },
+			{ 3u, 3.0 },
+			{ 4u, 7.0 },
+			{ 7u, 7.0 },
+			{ 8u, 15.0 },
+			{ 1000u, 1023.0 },
+			{ 1024u, 2047.0 },
+			{ std::numeric_limits< U64 >::max(), 18446744073709551615.0 }
+		};
+
+		for (const auto& [value, bound] : values) {
+			Telemetry telemetry;
+			telemetry.GetHistogram("histogram").Record(value);
+			telemetry.NextFrame();
+
+			const auto sample = GetSample(telemetry, "histogram");
+			MAGE_CHECK(bound == sample.m_percentiles[0]);
+			MAGE_CHECK(bound == sample.m_percentiles[1]);
+			MAGE_CHECK(bound == sample.m_percentiles[2]);
+			// The value lies in the reported bucket.
+			MAGE_CHECK(static_cast< F64 >(value) <= sample.m_percentiles[0]);
+		}
+	}
+
+	void TestHistogramPercentiles() {
+		Telemetry telemetry;
+		auto& histogram = telemetry.GetHistogram("histogram");
+		for (std::size_t i = 0u; i < 90u; ++i) {
+			histogram.Record(1u);
+		}
+		for (std::size_t i = 0u; i < 9u; ++i) {
+			histogram.Record(100u);
+		}
+		histogram.Record(1000u);
+
+		telemetry.NextFrame();
+		auto sample = GetSample(telemetry, "histogram");
+		MAGE_CHECK(TelemetryType::Histogram == sample.m_type);
+		MAGE_CHECK(100.0 == sample.m_value);
+		MAGE_CHECK(100.0 == sample.m_total);
+		MAGE_CHECK_NEAR(19.9, sample.m_mean, 1e-9);
+		MAGE_CHECK(1.0   == sample.m_percentiles[0]);
+		MAGE_CHECK(127.0 == sample.m_percentiles[1]);
+		MAGE_CHECK(127.0 == sample.m_percentiles[2]);
+
+		// The values of a frame are the values recorded during the frame.
+		histogram.Record(5u);
+		telemetry.NextFrame();
+		sample = GetSample(telemetry, "histogram");
+		MAGE_CHECK(1.0   == sample.m_value);
+		MAGE_CHECK(101.0 == sample.m_total);
+		MAGE_CHECK(5.0   == sample.m_mean);
+		MAGE_CHECK(7.0   == sample.m_percentiles[0]);
+
+		// Frames without values have no mean and percentiles.
+		telemetry.NextFrame();
+		sample = GetSample(telemetry, "histogram");
+		MAGE_CHECK(0.0 == sample.m_value);
+		MAGE_CHECK(0.0 == sample.m_mean);
+		MAGE_CHECK(0.0 == sample.m_percentiles[2]);
+	}
+
+	void TestExportJSON() {
+		Telemetry telemetry;
+		telemetry.GetCounter("frames").Increment(3u);
+		telemetry.GetGauge("a \"quoted\\\" gauge").Set(0.5);
+		telemetry.GetGauge("infinite").Set(std::numeric_limits< F64 >::infinity());
+		telemetry.GetGauge("nan").Set(std::numeric_limits< F64 >::quiet_NaN());
+		telemetry.GetHistogram("histogram").Record(2u);
+		telemetry.NextFrame();
+
+		const auto path = std::filesystem::temp_directory_path()
+						/ "mage_telemetry_test.json";
+		telemetry.ExportJSON(path);
+		const auto json = ReadFile(path);
+		std::filesystem::remove(path);
+
+		MAGE_CHECK(Contains(json, "{\"metrics\":["));
+		MAGE_CHECK(Contains(json,
+			"{\"name\":\"frames\",\"type\":\"counter\",\"value\":3,\"total\":3},"));
+		MAGE_CHECK(Contains(json,
+			"{\"name\":\"a \\\"quoted\\\\\\\" gauge\",\"type\":\"gauge\","
+			"\"value\":0.5,\"total\":0.5},"));
+
+		// Non-finite values are written as null.
+		MAGE_CHECK(Contains(json,
+			"{\"name\":\"infinite\",\"type\":\"gauge\",\"value\":null,\"total\":null},"));
+		MAGE_CHECK(Contains(json,
+			"{\"name\":\"nan\",\"type\":\"gauge\",\"value\":null,\"total\":null},"));
+		MAGE_CHECK(!Contains(json, ":inf"));
+		MAGE_CHECK(!Contains(json, ":nan"));
+
+		MAGE_CHECK(Contains(json,
+			"{\"name\":\"histogram\",\"type\":\"histogram\",\"value\":1,\"total\":1,"
+			"\"mean\":2,\"p50\":3,\"p95\":3,\"p99\":3}\n"));
+		MAGE_CHECK(Contains(json, "]}"));
+	}
+
+	void TestExportCSV() {
+		Telemetry telemetry;
+		telemetry.GetCounter("a \"quoted\" counter").Increment(2u);
+		telemetry.GetHistogram("histogram").Record(4u);
+		telemetry.NextFrame();
+
+		const auto path = std::filesystem::temp_directory_path()
+						/ "mage_telemetry_test.csv";
+		telemetry.ExportCSV(path);
+		const auto csv = ReadFile(path);
+		std::filesystem::remove(path);
+
+		MAGE_CHECK(0u == csv.find("name,type,value,total,mean,p50,p95,p99\n"));
+		MAGE_CHECK(Contains(csv, "\"a \"\"quoted\"\" counter\",counter,2,2,0,0,0,0\n"));
+		MAGE_CHECK(Contains(csv, "\"histogram\",histogram,1,1,4,7,7,7\n"));
+	}
+
+	void TestExportWhileSnapshotting() {
+		Telemetry telemetry;
+		auto& counter   = telemetry.GetCounter("counter");
+		auto& histogram = telemetry.GetHistogram("histogram");
+
+		// The snapshot is rebuilt while it is exported.
+		std::atomic< bool > done = false;
+		std::thread frames([&]() {
+			for (U64 i = 0u; !done.load(); ++i) {
+				counter.Increment();
+				histogram.Record(i);
+				telemetry.NextFrame();
+			}
+		});
+
+		while (telemetry.GetSnapshot().empty()) {
+			std::this_thread::yield();
+		}
+
+		const auto path = std::filesystem::temp_directory_path()
+						/ "mage_telemetry_test_snapshot.json";
+		for (std::size_t i = 0u; i < 100u; ++i) {
+			telemetry.ExportJSON(path);
+			const auto json = ReadFile(path);
+			MAGE_CHECK(Contains(json, "\"name\":\"counter\""));
+			MAGE_CHECK(Contains(json, "\"name\":\"histogram\""));
+		}
+
+		done = true;
+		frames.join();
+		std::filesystem::remove(path);
+	}
+}
+
+int main() {
+	test::Run("TelemetryCounter",                 TestCounter);
+	test::Run("TelemetryGauge",                   TestGauge);
+	test::Run("TelemetryHistogramBuckets",        TestHistogramBuckets);
+	test::Run("TelemetryHistogramPercentiles",    TestHistogramPercentiles);
+	test::Run("TelemetryExportJSON",              TestExportJSON);
+	test::Run("TelemetryExportCSV",               TestExportCSV);
+	test::Run("TelemetryExportWhileSnapshotting", TestExportWhileSnapshotting);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
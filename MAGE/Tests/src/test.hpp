@@ -0,0 +1,93 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+// Check definitions
+// A failed check is reported and counted, but does not abort the test.
+#define MAGE_CHECK(expr) \
+	((expr) ? (void)0 : mage::test::ReportFailure(#expr, __FILE__, __LINE__))
+
+#define MAGE_CHECK_NEAR(lhs, rhs, epsilon) \
+	MAGE_CHECK(std::abs((lhs) - (rhs)) <= (epsilon))
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 Returns the number of failed checks.
+
+	 @return		A reference to the number of failed checks.
+	 */
+	[[nodiscard]]
+	inline int& GetNumberOfFailures() noexcept {
+		static int s_nb_failures = 0;
+		return s_nb_failures;
+	}
+
+	/**
+	 Reports a failed check.
+
+	 @param[in]		expr
+					A pointer to the null-terminated string of the checked
+					expression.
+	 @param[in]		file
+					A pointer to the null-terminated string of the file name.
+	 @param[in]		line
+					The line number.
+	 */
+	inline void ReportFailure(const char* expr,
+							  const char* file,
+							  int line) noexcept {
+
+		std::fprintf(stderr, "%s(%d): check failed: %s\n", file, line, expr);
+		++GetNumberOfFailures();
+	}
+
+	/**
+	 Runs the given test.
+
+	 @tparam		TestT
+					The test type.
+	 @param[in]		name
+					A pointer to the null-terminated string of the test name.
+	 @param[in]		test
+					The test.
+	 */
+	template< typename TestT >
+	inline void Run(const char* name, TestT&& test) {
+		const auto nb_failures = GetNumberOfFailures();
+		test();
+		std::printf("[%s] %s\n",
+					(nb_failures == GetNumberOfFailures()) ? "pass" : "FAIL",
+					name);
+	}
+
+	/**
+	 Returns the exit code of the test executable.
+
+	 @return		@c EXIT_SUCCESS if no check failed. @c EXIT_FAILURE
+					otherwise.
+	 */
+	[[nodiscard]]
+	inline int GetExitCode() noexcept {
+		return (0 == GetNumberOfFailures()) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "type/versioned.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <string>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+using namespace mage;
+
+namespace {
+
+	/**
+	 A value counting its copies.
+	 */
+	struct CountingValue {
+
+		CountingValue() = default;
+
+		CountingValue(const CountingValue& value)
+			: m_data(value.m_data),
+			m_nb_copies(value.m_nb_copies + 1u) {}
+
+		CountingValue(CountingValue&& value) noexcept = default;
+
+		~CountingValue() = default;
+
+		CountingValue& operator=(const CountingValue& value) {
+			m_data      = value.m_data;
+			m_nb_copies = value.m_nb_copies + 1u;
+			return *this;
+		}
+
+		CountingValue& operator=(CountingValue&& value) noexcept = default;
+
+		std::vector< U32 > m_data;
+		std::size_t m_nb_copies = 0u;
+	};
+
+	void TestVersion() {
+		const Version a;
+		const Version b;
+		MAGE_CHECK(a != b);
+
+		// Copies share the version of their source.
+		Version c(a);
+		MAGE_CHECK(a == c);
+
+		// Updates draw a new version.
+		c.Update();
+		MAGE_CHECK(a != c);
+		MAGE_CHECK(b != c);
+	}
+
+	void TestCopyUnchanged() {
+		Versioned< CountingValue > source;
+		source.GetMutable().m_data = { 1u, 2u, 3u };
+		Versioned< CountingValue > snapshot;
+
+		// The first copy copies the value, the next copies of the unchanged
+		// value are skipped.
+		for (std::size_t i = 0u; i < 10u; ++i) {
+			snapshot = source;
+			MAGE_CHECK(1u == snapshot.Get().m_nb_copies);
+			MAGE_CHECK(3u == snapshot.Get().m_data.size());
+			MAGE_CHECK(source.GetVersion() == snapshot.GetVersion());
+		}
+	}
+
+	void TestCopyChanged() {
+		Versioned< std::string > source("a");
+		Versioned< std::string > snapshot;
+		snapshot = source;
+		MAGE_CHECK("a" == snapshot.Get());
+
+		// Each change of the value (through Set or GetMutable) is copied.
+		source.Set("b");
+		MAGE_CHECK(source.GetVersion() != snapshot.GetVersion());
+		snapshot = source;
+		MAGE_CHECK("b" == snapshot.Get());
+
+		source.GetMutable() += "c";
+		snapshot = source;
+		MAGE_CHECK("bc" == snapshot.Get());
+
+		// Read-only accesses do not change the version.
+		const auto version = source.GetVersion();
+		MAGE_CHECK("bc" == source.Get());
+		MAGE_CHECK(version == source.GetVersion());
+	}
+
+	void TestCopyOtherSource() {
+		Versioned< std::string > a("a");
+		Versioned< std::string > b("b");
+		Versioned< std::string > snapshot;
+
+		// The snapshot is copied from another source with another version.
+		snapshot = a;
+		MAGE_CHECK("a" == snapshot.Get());
+		snapshot = b;
+		MAGE_CHECK("b" == snapshot.Get());
+		snapshot = a;
+		MAGE_CHECK("a" == snapshot.Get());
+	}
+
+	void TestChangedCopy() {
+		Versioned< std::string > source("a");
+		Versioned< std::string > snapshot;
+		snapshot = source;
+
+		// A change of the copy is overwritten by the next copy.
+		snapshot.Set("x");
+		snapshot = source;
+		MAGE_CHECK("a" == snapshot.Get());
+	}
+
+	void TestMove() {
+		Versioned< std::string > source("a long string which is not stored inline");
+		Versioned< std::string > snapshot;
+		snapshot = source;
+
+		// A moved from value has a new version: it is copied again.
+		Versioned< std::string > moved(std::move(source));
+		MAGE_CHECK(moved.GetVersion() == snapshot.GetVersion());
+		MAGE_CHECK(source.GetVersion() != snapshot.GetVersion());
+
+		source.Set("b");
+		snapshot = source;
+		MAGE_CHECK("b" == snapshot.Get());
+
+		Versioned< std::string > assigned;
+		assigned = std::move(moved);
+		MAGE_CHECK(moved.GetVersion() != assigned.GetVersion());
+		MAGE_CHECK("a long string which is not stored inline" == assigned.Get());
+	}
+}
+
+int main() {
+	test::Run("Version",                  TestVersion);
+	test::Run("VersionedCopyUnchanged",   TestCopyUnchanged);
+	test::Run("VersionedCopyChanged",     TestCopyChanged);
+	test::Run("VersionedCopyOtherSource", TestCopyOtherSource);
+	test::Run("VersionedChangedCopy",     TestChangedCopy);
+	test::Run("VersionedMove",            TestMove);
+
+	return test::GetExitCode();
+}
\ No newline at end of file
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "collection\vector.hpp"
-#include "logging\logging.hpp"
+#include "collection/vector.hpp"
+#include "logging/logging.hpp"
 
 #pragma endregion
 
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "exception\exception.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "logging\logging.hpp"
+#include "logging/logging.hpp"
 
 #pragma endregion
 
@@ -144,10 +144,12 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
+	#ifdef _WIN32
 	static_assert(!std::is_same< bool, BOOL >::value,
 				  "MAGE/Windows primitive type mismatch");
 	static_assert(!std::is_same< BOOL, HRESULT >::value,
 				  "MAGE/Windows primitive type mismatch");
+	#endif
 
 	/**
 	 Throws if the given result correspond to a failure.
@@ -177,6 +179,8 @@ namespace mage {
 	void ThrowIfFailed(bool result,
 					   std::string_view format_str, const ArgsT&... args);
 
+	#ifdef _WIN32
+
 	/**
 	 Throws if the given result correspond to a failure.
 
@@ -233,6 +237,8 @@ namespace mage {
 	void ThrowIfFailed(HRESULT result,
 					   std::string_view format_str, const ArgsT&... args);
 
+	#endif
+
 	#pragma endregion
 }
 
@@ -241,6 +247,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "exception\exception.tpp"
+#include "exception/exception.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -3,7 +3,22 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\binary_reader.hpp"
+#include "io/binary_reader.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #pragma endregion
 
@@ -12,6 +27,8 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	#ifdef _WIN32
+
 	void ReadBinaryFile(const std::filesystem::path& path,
 						UniquePtr< U8[] >& data,
 						std::size_t& size) {
@@ -53,6 +70,148 @@ namespace mage {
 		}
 	}
 
+	std::size_t ReadBinaryFile(const std::filesystem::path& path,
+							   U64 offset, gsl::span< U8 > data) {
+
+		const auto file_handle
+			= CreateUniqueHandle(CreateFile2(path.c_str(),
+											 GENERIC_READ,
+											 FILE_SHARE_READ,
+											 OPEN_EXISTING,
+											 nullptr));
+		ThrowIfFailed((nullptr != file_handle), "{}: could not open file.", path);
+
+		// Seek the offset.
+		{
+			LARGE_INTEGER distance;
+			distance.QuadPart = static_cast< LONGLONG >(offset);
+			const BOOL result = SetFilePointerEx(file_handle.get(), distance,
+												 nullptr, FILE_BEGIN);
+			ThrowIfFailed(result, "{}: could not seek offset {}.", path, offset);
+		}
+
+		// Populate buffer (in chunks of at most 1 GiB).
+		std::size_t nb_bytes_read = 0u;
+		while (nb_bytes_read < data.size()) {
+			const auto nb_bytes = static_cast< DWORD >(
+				std::min< std::size_t >(data.size() - nb_bytes_read, 1u << 30u));
+
+			DWORD nb_chunk_bytes_read = 0u;
+			const BOOL result = ReadFile(file_handle.get(),
+										 data.data() + nb_bytes_read,
+										 nb_bytes, &nb_chunk_bytes_read, nullptr);
+			ThrowIfFailed(result, "{}: could not load file data.", path);
+
+			nb_bytes_read += nb_chunk_bytes_read;
+			if (nb_chunk_bytes_read < nb_bytes) {
+				// End of file.
+				break;
+			}
+		}
+
+		return nb_bytes_read;
+	}
+
+	#else
+
+	namespace {
+
+		/**
+		 A struct of file descriptor closers.
+		 */
+		struct FileDescriptorCloser {
+
+		public:
+
+			~FileDescriptorCloser() {
+				if (0 <= m_fd) {
+					close(m_fd);
+				}
+			}
+
+			int m_fd;
+		};
+
+		/**
+		 Reads bytes of the given file descriptor starting at the given
+		 offset until the given buffer is full or the end of the file is
+		 reached.
+
+		 @param[in]		path
+						A reference to the path.
+		 @param[in]		fd
+						The file descriptor.
+		 @param[in]		offset
+						The offset (in bytes) of the first byte to read.
+		 @param[out]	data
+						The buffer for storing the read bytes.
+		 @return		The number of read bytes.
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		std::size_t ReadFileDescriptor(const std::filesystem::path& path,
+									   int fd, U64 offset,
+									   gsl::span< U8 > data) {
+
+			// Populate buffer (in chunks of at most 1 GiB).
+			std::size_t nb_bytes_read = 0u;
+			while (nb_bytes_read < static_cast< std::size_t >(data.size())) {
+				const auto nb_bytes = std::min< std::size_t >(
+					data.size() - nb_bytes_read, 1u << 30u);
+
+				const auto result = pread(fd,
+										  data.data() + nb_bytes_read,
+										  nb_bytes,
+										  static_cast< off_t >(offset + nb_bytes_read));
+				ThrowIfFailed((0 <= result), "{}: could not load file data.", path);
+
+				if (0 == result) {
+					// End of file.
+					break;
+				}
+				nb_bytes_read += static_cast< std::size_t >(result);
+			}
+
+			return nb_bytes_read;
+		}
+	}
+
+	void ReadBinaryFile(const std::filesystem::path& path,
+						UniquePtr< U8[] >& data,
+						std::size_t& size) {
+
+		const FileDescriptorCloser file{ open(path.c_str(), O_RDONLY | O_CLOEXEC) };
+		ThrowIfFailed((0 <= file.m_fd), "{}: could not open file.", path);
+
+		struct stat file_info;
+		ThrowIfFailed((0 == fstat(file.m_fd, &file_info)),
+					  "{}: could not retrieve file information.", path);
+
+		// Allocate buffer.
+		const auto nb_bytes = static_cast< std::size_t >(file_info.st_size);
+		size = nb_bytes;
+		data = MakeUnique< U8[] >(nb_bytes);
+		ThrowIfFailed((nullptr != data),
+					  "{}: file too big for allocation.", path);
+
+		// Populate buffer.
+		const auto nb_bytes_read = ReadFileDescriptor(
+			path, file.m_fd, 0u, gsl::span< U8 >(data.get(), nb_bytes));
+		ThrowIfFailed((nb_bytes <= nb_bytes_read),
+					  "{}: could not load all file data.", path);
+	}
+
+	std::size_t ReadBinaryFile(const std::filesystem::path& path,
+							   U64 offset, gsl::span< U8 > data) {
+
+		const FileDescriptorCloser file{ open(path.c_str(), O_RDONLY | O_CLOEXEC) };
+		ThrowIfFailed((0 <= file.m_fd), "{}: could not open file.", path);
+
+		return ReadFileDescriptor(path, file.m_fd, offset, data);
+	}
+
+	#endif
+
 	//-------------------------------------------------------------------------
 	// BinaryReader
 	//-------------------------------------------------------------------------
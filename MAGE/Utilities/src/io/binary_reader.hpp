@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "exception\exception.hpp"
-#include "io\binary_utils.hpp"
+#include "exception/exception.hpp"
+#include "io/binary_utils.hpp"
 
 #pragma endregion
 
@@ -31,6 +31,24 @@ namespace mage {
 	void ReadBinaryFile(const std::filesystem::path& path,
 						UniquePtr< U8[] >& data, std::size_t& size);
 
+	/**
+	 Reads a range of bytes of the binary file associated with the given path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[in]		offset
+					The offset (in bytes) of the first byte to read.
+	 @param[out]	data
+					The buffer for storing the read bytes.
+	 @return		The number of read bytes. This number is smaller than the
+					size of the given buffer if the end of the file is
+					reached.
+	 @throws		Exception
+					Failed to read from the file.
+	 */
+	std::size_t ReadBinaryFile(const std::filesystem::path& path,
+							   U64 offset, gsl::span< U8 > data);
+
 	//-------------------------------------------------------------------------
 	// BinaryReader
 	//-------------------------------------------------------------------------
@@ -423,6 +441,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\binary_reader.tpp"
+#include "io/binary_reader.tpp"
 
 #pragma endregion
\ No newline at end of file
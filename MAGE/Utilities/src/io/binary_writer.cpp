@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\binary_writer.hpp"
+#include "io/binary_writer.hpp"
 
 #pragma endregion
 
@@ -31,8 +31,13 @@ namespace mage {
 
 		std::FILE* file;
 		{
+			#ifdef _WIN32
 			const errno_t result = _wfopen_s(&file, m_path.c_str(), L"wb");
 			ThrowIfFailed((0 == result), "{}: could not open file.", m_path);
+			#else
+			file = std::fopen(m_path.c_str(), "wb");
+			ThrowIfFailed((nullptr != file), "{}: could not open file.", m_path);
+			#endif
 		}
 
 		m_file_stream.reset(file);
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "exception\exception.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -193,6 +193,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\binary_writer.tpp"
+#include "io/binary_writer.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\line_reader.hpp"
-#include "logging\logging.hpp"
+#include "io/line_reader.hpp"
+#include "logging/logging.hpp"
 
 #pragma endregion
 
@@ -74,6 +74,9 @@ namespace mage {
 
 		// Postprocessing
 		Postprocess();
+
+		// Report the diagnostics suppressed while reading.
+		ReportSuppressedMessages();
 	}
 
 	void LineReader::ReadFromMemory(const std::string& input,
@@ -93,6 +96,9 @@ namespace mage {
 
 		// Postprocessing
 		Postprocess();
+
+		// Report the diagnostics suppressed while reading.
+		ReportSuppressedMessages();
 	}
 
 	void LineReader::Preprocess() {}
@@ -118,7 +124,7 @@ namespace mage {
 	void LineReader::ReadRemainingTokens() {
 		while (ContainsTokens()) {
 			const auto token = Read< std::string_view >();
-			Warning("{}: line {}: unused token: {}.",
+			MAGE_WARNING("{}: line {}: unused token: {}.",
 					GetPath(), GetCurrentLineNumber(), token);
 		}
 	}
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "exception\exception.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -320,6 +320,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\line_reader.tpp"
+#include "io/line_reader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\writer.hpp"
-#include "exception\exception.hpp"
+#include "io/writer.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -28,8 +28,13 @@ namespace mage {
 
 		std::FILE* file;
 		{
+			#ifdef _WIN32
 			const errno_t result = _wfopen_s(&file, m_path.c_str(), L"w");
 			ThrowIfFailed((0 == result), "{}: could not open file.", m_path);
+			#else
+			file = std::fopen(m_path.c_str(), "w");
+			ThrowIfFailed((nullptr != file), "{}: could not open file.", m_path);
+			#endif
 		}
 
 		m_file_stream.reset(file);
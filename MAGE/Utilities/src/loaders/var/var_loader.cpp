@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\var\var_loader.hpp"
-#include "loaders\var\var_reader.hpp"
-#include "loaders\var\var_writer.hpp"
+#include "loaders/var/var_loader.hpp"
+#include "loaders/var/var_reader.hpp"
+#include "loaders/var/var_writer.hpp"
 
 #pragma endregion
 
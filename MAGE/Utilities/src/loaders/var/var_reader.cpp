@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\var\var_reader.hpp"
-#include "loaders\var\var_tokens.hpp"
-#include "logging\logging.hpp"
+#include "loaders/var/var_reader.hpp"
+#include "loaders/var/var_tokens.hpp"
+#include "logging/logging.hpp"
 
 #pragma endregion
 
@@ -71,7 +71,7 @@ namespace mage::loader {
 			ReadVARVariable< std::string >();
 		}
 		else {
-			Warning("{}: line {}: unsupported keyword token: {}.",
+			MAGE_WARNING("{}: line {}: unsupported keyword token: {}.",
 					GetPath(), GetCurrentLineNumber(), token);
 			return;
 		}
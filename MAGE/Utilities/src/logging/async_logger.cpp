@@ -0,0 +1,282 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "logging/async_logger.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <chrono>
+#include <iterator>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The size (in bytes) of the batches written by asynchronous loggers.
+		 */
+		constexpr std::size_t g_batch_size = 64u * 1024u;
+
+		/**
+		 The maximum waiting time of idle drain threads.
+		 */
+		constexpr auto g_idle_time = std::chrono::milliseconds(10);
+	}
+
+	std::atomic< bool > AsyncLogger::s_enabled(false);
+
+	[[nodiscard]]
+	AsyncLogger& AsyncLogger::Get() noexcept {
+		static AsyncLogger s_logger;
+		return s_logger;
+	}
+
+	AsyncLogger::AsyncLogger()
+		: m_records(MakeUnique< Record[] >(s_nb_records)),
+		m_enqueue_position(0u),
+		m_dequeue_position(0u),
+		m_nb_written_records(0u),
+		m_nb_dropped_records(0u),
+		m_nb_reported_records(0u),
+		m_policy(LogOverflowPolicy::Count),
+		m_global(false),
+		m_stream(stdout),
+		m_batch(),
+		m_running(false),
+		m_nb_pushing_threads(0u),
+		m_idle(false),
+		m_stop(false),
+		m_mutex(),
+		m_condition(),
+		m_flush_mutex(),
+		m_flush_condition(),
+		m_thread() {
+
+		for (std::size_t i = 0u; i < s_nb_records; ++i) {
+			m_records[i].m_sequence.store(i, std::memory_order_relaxed);
+		}
+
+		m_batch.reserve(g_batch_size);
+	}
+
+	AsyncLogger::~AsyncLogger() {
+		Stop();
+	}
+
+	void AsyncLogger::Start(LogOverflowPolicy policy,
+							NotNull< std::FILE* > stream) {
+		if (m_thread.joinable()) {
+			return;
+		}
+
+		m_policy = policy;
+		m_global = (this == &Get());
+		m_stream = stream;
+		m_stop.store(false, std::memory_order_relaxed);
+		m_thread = std::thread(&AsyncLogger::Drain, this);
+
+		m_running.store(true, std::memory_order_seq_cst);
+		if (m_global) {
+			s_enabled.store(true, std::memory_order_release);
+		}
+	}
+
+	void AsyncLogger::Stop() noexcept {
+		if (!m_thread.joinable()) {
+			return;
+		}
+
+		// Reject new records, and wait for the threads which are pushing
+		// records (while the drain thread still makes room for blocked
+		// threads). Afterwards, all acquired records are committed.
+		if (m_global) {
+			s_enabled.store(false, std::memory_order_release);
+		}
+		m_running.store(false, std::memory_order_seq_cst);
+		while (0u != m_nb_pushing_threads.load(std::memory_order_seq_cst)) {
+			std::this_thread::yield();
+		}
+
+		{
+			const std::scoped_lock lock(m_mutex);
+			m_stop.store(true, std::memory_order_release);
+		}
+		m_condition.notify_one();
+		m_thread.join();
+
+		// Write all remaining records (i.e. up to the enqueue position).
+		while (m_dequeue_position
+			   != m_enqueue_position.load(std::memory_order_acquire)) {
+			DrainRecords();
+		}
+		WriteRecords();
+	}
+
+	void AsyncLogger::Flush() noexcept {
+		if (!m_running.load(std::memory_order_acquire)
+			|| std::this_thread::get_id() == m_thread.get_id()) {
+			return;
+		}
+
+		const auto position = m_enqueue_position.load(std::memory_order_acquire);
+
+		// Wake up the drain thread and wait until it has written all records
+		// up to the enqueue position.
+		m_condition.notify_one();
+
+		std::unique_lock lock(m_flush_mutex);
+		m_flush_condition.wait(lock, [this, position]() noexcept {
+			return position <= GetNumberOfWrittenRecords();
+		});
+	}
+
+	[[nodiscard]]
+	bool AsyncLogger::BeginPush() noexcept {
+		m_nb_pushing_threads.fetch_add(1u, std::memory_order_seq_cst);
+		if (m_running.load(std::memory_order_seq_cst)) {
+			return true;
+		}
+
+		EndPush();
+		return false;
+	}
+
+	[[nodiscard]]
+	AsyncLogger::Record* AsyncLogger::Acquire() noexcept {
+		auto position = m_enqueue_position.load(std::memory_order_relaxed);
+
+		while (true) {
+			auto& record        = m_records[position & (s_nb_records - 1u)];
+			const auto sequence = record.m_sequence.load(std::memory_order_acquire);
+			const auto diff     = static_cast< S64 >(sequence - position);
+
+			if (0 == diff) {
+				// The record is free: try to claim it.
+				if (m_enqueue_position.compare_exchange_weak(
+					position, position + 1u, std::memory_order_relaxed)) {
+					return &record;
+				}
+			}
+			else if (0 > diff) {
+				// The ring is full.
+				if (LogOverflowPolicy::Block != m_policy) {
+					m_nb_dropped_records.fetch_add(1u, std::memory_order_relaxed);
+					return nullptr;
+				}
+
+				if (m_idle.load(std::memory_order_acquire)) {
+					m_condition.notify_one();
+				}
+				std::this_thread::yield();
+				position = m_enqueue_position.load(std::memory_order_relaxed);
+			}
+			else {
+				// Another producer claimed the record.
+				position = m_enqueue_position.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	void AsyncLogger::Commit(Record& record) noexcept {
+		const auto position = record.m_sequence.load(std::memory_order_relaxed);
+		record.m_sequence.store(position + 1u, std::memory_order_release);
+
+		if (m_idle.load(std::memory_order_acquire)) {
+			m_condition.notify_one();
+		}
+	}
+
+	void AsyncLogger::Drain() {
+		while (true) {
+			// Keep batching while records are committed.
+			if (0u != DrainRecords()) {
+				continue;
+			}
+
+			WriteRecords();
+
+			std::unique_lock lock(m_mutex);
+			if (m_stop.load(std::memory_order_acquire)) {
+				break;
+			}
+
+			// Commits can race with the idle flag; the time-out bounds the
+			// latency of a missed notification.
+			m_idle.store(true, std::memory_order_release);
+			m_condition.wait_for(lock, g_idle_time);
+			m_idle.store(false, std::memory_order_release);
+		}
+	}
+
+	std::size_t AsyncLogger::DrainRecords() {
+		std::size_t nb_records = 0u;
+
+		while (true) {
+			auto& record        = m_records[m_dequeue_position & (s_nb_records - 1u)];
+			const auto sequence = record.m_sequence.load(std::memory_order_acquire);
+			if (m_dequeue_position + 1u != sequence) {
+				break;
+			}
+
+			if (record.m_wide) {
+				// Keep the order of the narrow and wide records.
+				WriteRecords();
+				const auto data = reinterpret_cast< const wchar_t* >(record.m_data);
+				WriteTo(NotNull< std::FILE* >(m_stream), L"{}",
+						std::wstring_view(data, record.m_size));
+			}
+			else {
+				m_batch.append(record.m_data, record.m_size);
+			}
+
+			// Release the record to the producers.
+			record.m_sequence.store(m_dequeue_position + s_nb_records,
+									std::memory_order_release);
+			++m_dequeue_position;
+			++nb_records;
+
+			if (g_batch_size <= m_batch.size()) {
+				WriteRecords();
+			}
+		}
+
+		return nb_records;
+	}
+
+	void AsyncLogger::WriteRecords() {
+		if (LogOverflowPolicy::Count == m_policy) {
+			const auto nb_dropped = m_nb_dropped_records.load(std::memory_order_relaxed);
+			if (m_nb_reported_records != nb_dropped) {
+				AppendWrite(std::back_inserter(m_batch),
+							"Warning: {} log records dropped.\n",
+							nb_dropped - m_nb_reported_records);
+				m_nb_reported_records = nb_dropped;
+			}
+		}
+
+		if (!m_batch.empty()) {
+			std::fwrite(m_batch.data(), sizeof(char), m_batch.size(), m_stream);
+			std::fflush(m_stream);
+			m_batch.clear();
+		}
+
+		{
+			const std::scoped_lock lock(m_flush_mutex);
+			m_nb_written_records.store(m_dequeue_position,
+									   std::memory_order_release);
+		}
+		m_flush_condition.notify_all();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,476 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory/memory.hpp"
+#include "string/format.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 An enumeration of the different log overflow policies.
+
+	 This contains:
+	 @c Drop (silently drop records while the queue is full),
+	 @c Count (drop records while the queue is full and log the number of
+	 dropped records once the queue has room again) and
+	 @c Block (wait until the queue has room again).
+	 */
+	enum class LogOverflowPolicy : U8 {
+		Drop = 0,
+		Count,
+		Block
+	};
+
+	/**
+	 A class of asynchronous loggers.
+
+	 Log records are formatted on the logging thread into the fixed-size
+	 records of a bounded multiple-producer single-consumer ring without
+	 locking. A background drain thread writes the records in batches to the
+	 output stream. Records exceeding the record size are truncated.
+
+	 Records can only be pushed while the asynchronous logger is running.
+	 Stopping (or destructing) the asynchronous logger waits for all pushing
+	 threads and writes all pushed records. Afterwards, records must be
+	 written synchronously.
+	 */
+	class AsyncLogger {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The size (in bytes) of the records of asynchronous loggers.
+		 */
+		static constexpr std::size_t s_record_size = 512u;
+
+		/**
+		 The number of records of asynchronous loggers. The number of records
+		 must be a power of two.
+		 */
+		static constexpr std::size_t s_nb_records = 4096u;
+
+		static_assert(0u == (s_nb_records & (s_nb_records - 1u)));
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the global asynchronous logger.
+
+		 @pre			The global asynchronous logger is not destructed (i.e.
+						only use the global asynchronous logger while
+						@c IsEnabled() returns @c true).
+		 @return		A reference to the global asynchronous logger.
+		 */
+		[[nodiscard]]
+		static AsyncLogger& Get() noexcept;
+
+		/**
+		 Checks whether the global asynchronous logger is running. The global
+		 asynchronous logger is not running after its destruction.
+
+		 @return		@c true if the global asynchronous logger is running.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		static bool IsEnabled() noexcept {
+			return s_enabled.load(std::memory_order_acquire);
+		}
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an asynchronous logger.
+		 */
+		AsyncLogger();
+
+		/**
+		 Constructs an asynchronous logger from the given asynchronous logger.
+
+		 @param[in]		logger
+						A reference to the asynchronous logger to copy.
+		 */
+		AsyncLogger(const AsyncLogger& logger) = delete;
+
+		/**
+		 Constructs an asynchronous logger by moving the given asynchronous
+		 logger.
+
+		 @param[in]		logger
+						A reference to the asynchronous logger to move.
+		 */
+		AsyncLogger(AsyncLogger&& logger) = delete;
+
+		/**
+		 Destructs this asynchronous logger. All pending records are written
+		 before the drain thread is stopped.
+		 */
+		~AsyncLogger();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given asynchronous logger to this asynchronous logger.
+
+		 @param[in]		logger
+						A reference to the asynchronous logger to copy.
+		 @return		A reference to the copy of the given asynchronous
+						logger (i.e. this asynchronous logger).
+		 */
+		AsyncLogger& operator=(const AsyncLogger& logger) = delete;
+
+		/**
+		 Moves the given asynchronous logger to this asynchronous logger.
+
+		 @param[in]		logger
+						A reference to the asynchronous logger to move.
+		 @return		A reference to the moved asynchronous logger (i.e.
+						this asynchronous logger).
+		 */
+		AsyncLogger& operator=(AsyncLogger&& logger) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts the drain thread of this asynchronous logger.
+
+		 @param[in]		policy
+						The overflow policy.
+		 @param[in]		stream
+						A pointer to the output stream.
+		 */
+		void Start(LogOverflowPolicy policy = LogOverflowPolicy::Count,
+				   NotNull< std::FILE* > stream = NotNull< std::FILE* >(stdout));
+
+		/**
+		 Stops this asynchronous logger. New records are no longer accepted,
+		 the threads which are pushing records are waited for, and all pushed
+		 records are written before the drain thread is stopped.
+		 */
+		void Stop() noexcept;
+
+		/**
+		 Waits until all records pushed before this call are written.
+
+		 Flushing from the drain thread itself or while this asynchronous
+		 logger is not running returns immediately.
+		 */
+		void Flush() noexcept;
+
+		/**
+		 Pushes a record.
+
+		 @tparam		ArgsT
+						The format argument types.
+		 @param[in]		prefix
+						The prefix of the record.
+		 @param[in]		format_str
+						The format string.
+		 @param[in]		args
+						A reference to the format arguments.
+		 @return		@c true if the record is pushed or dropped according
+						to the overflow policy. @c false if this asynchronous
+						logger is not running (i.e. the record must be written
+						synchronously).
+		 */
+		template< typename... ArgsT >
+		bool Push(std::string_view prefix,
+				  std::string_view format_str, const ArgsT&... args);
+
+		/**
+		 Pushes a record.
+
+		 @tparam		ArgsT
+						The format argument types.
+		 @param[in]		prefix
+						The prefix of the record.
+		 @param[in]		format_str
+						The format string.
+		 @param[in]		args
+						A reference to the format arguments.
+		 @return		@c true if the record is pushed or dropped according
+						to the overflow policy. @c false if this asynchronous
+						logger is not running (i.e. the record must be written
+						synchronously).
+		 */
+		template< typename... ArgsT >
+		bool Push(std::string_view prefix,
+				  std::wstring_view format_str, const ArgsT&... args);
+
+		/**
+		 Returns the number of written records of this asynchronous logger.
+
+		 @return		The number of written records of this asynchronous
+						logger.
+		 */
+		[[nodiscard]]
+		U64 GetNumberOfWrittenRecords() const noexcept {
+			return m_nb_written_records.load(std::memory_order_acquire);
+		}
+
+		/**
+		 Returns the number of dropped records of this asynchronous logger.
+
+		 @return		The number of dropped records of this asynchronous
+						logger.
+		 */
+		[[nodiscard]]
+		U64 GetNumberOfDroppedRecords() const noexcept {
+			return m_nb_dropped_records.load(std::memory_order_relaxed);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of records of asynchronous loggers.
+		 */
+		struct Record {
+
+		public:
+
+			/**
+			 The sequence number of this record.
+			 */
+			std::atomic< U64 > m_sequence;
+
+			/**
+			 The size (in characters) of this record.
+			 */
+			U32 m_size;
+
+			/**
+			 Flag indicating whether this record contains wide characters.
+			 */
+			bool m_wide;
+
+			/**
+			 The characters of this record.
+			 */
+			alignas(wchar_t) char m_data[s_record_size];
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Registers the calling thread as a pushing thread of this
+		 asynchronous logger.
+
+		 @return		@c true if this asynchronous logger is running. @c false
+						otherwise (i.e. the calling thread is not registered).
+		 */
+		[[nodiscard]]
+		bool BeginPush() noexcept;
+
+		/**
+		 Unregisters the calling thread as a pushing thread of this
+		 asynchronous logger.
+		 */
+		void EndPush() noexcept {
+			m_nb_pushing_threads.fetch_sub(1u, std::memory_order_release);
+		}
+
+		/**
+		 Acquires a free record of this asynchronous logger according to the
+		 overflow policy.
+
+		 @return		A pointer to the free record. @c nullptr if the record
+						is dropped.
+		 */
+		[[nodiscard]]
+		Record* Acquire() noexcept;
+
+		/**
+		 Commits the given record to the drain thread of this asynchronous
+		 logger.
+
+		 @param[in,out]	record
+						A reference to the record.
+		 */
+		void Commit(Record& record) noexcept;
+
+		/**
+		 Runs the drain thread of this asynchronous logger.
+		 */
+		void Drain();
+
+		/**
+		 Moves all committed records of this asynchronous logger to the
+		 batch. Full batches are written.
+
+		 @return		The number of moved records.
+		 */
+		std::size_t DrainRecords();
+
+		/**
+		 Writes the batch of this asynchronous logger to the output stream.
+		 */
+		void WriteRecords();
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 Flag indicating whether the global asynchronous logger is running.
+		 */
+		static std::atomic< bool > s_enabled;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the records of this asynchronous logger.
+		 */
+		UniquePtr< Record[] > m_records;
+
+		/**
+		 The enqueue position of this asynchronous logger.
+		 */
+		alignas(64) std::atomic< U64 > m_enqueue_position;
+
+		/**
+		 The dequeue position of this asynchronous logger. Only accessed by
+		 the drain thread.
+		 */
+		alignas(64) U64 m_dequeue_position;
+
+		/**
+		 The published dequeue position (i.e. the number of written records)
+		 of this asynchronous logger.
+		 */
+		std::atomic< U64 > m_nb_written_records;
+
+		/**
+		 The number of dropped records of this asynchronous logger.
+		 */
+		std::atomic< U64 > m_nb_dropped_records;
+
+		/**
+		 The number of reported dropped records of this asynchronous logger.
+		 Only accessed by the drain thread.
+		 */
+		U64 m_nb_reported_records;
+
+		/**
+		 The overflow policy of this asynchronous logger.
+		 */
+		LogOverflowPolicy m_policy;
+
+		/**
+		 Flag indicating whether this asynchronous logger is the global
+		 asynchronous logger.
+		 */
+		bool m_global;
+
+		/**
+		 A pointer to the output stream of this asynchronous logger.
+		 */
+		std::FILE* m_stream;
+
+		/**
+		 The batch of characters to write of this asynchronous logger.
+		 */
+		std::string m_batch;
+
+		/**
+		 Flag indicating whether this asynchronous logger accepts records.
+		 */
+		std::atomic< bool > m_running;
+
+		/**
+		 The number of threads which are pushing records to this asynchronous
+		 logger.
+		 */
+		std::atomic< U32 > m_nb_pushing_threads;
+
+		/**
+		 Flag indicating whether the drain thread of this asynchronous logger
+		 is waiting for records.
+		 */
+		std::atomic< bool > m_idle;
+
+		/**
+		 Flag indicating whether the drain thread of this asynchronous logger
+		 must stop.
+		 */
+		std::atomic< bool > m_stop;
+
+		/**
+		 The mutex for waking up the drain thread of this asynchronous logger.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 The condition variable for waking up the drain thread of this
+		 asynchronous logger.
+		 */
+		std::condition_variable m_condition;
+
+		/**
+		 The mutex for waiting for written records of this asynchronous
+		 logger.
+		 */
+		std::mutex m_flush_mutex;
+
+		/**
+		 The condition variable for waiting for written records of this
+		 asynchronous logger.
+		 */
+		std::condition_variable m_flush_condition;
+
+		/**
+		 The drain thread of this asynchronous logger.
+		 */
+		std::thread m_thread;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "logging/async_logger.tpp"
+
+#pragma endregion
\ No newline at end of file
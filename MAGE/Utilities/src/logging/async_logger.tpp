@@ -0,0 +1,100 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename... ArgsT >
+	bool AsyncLogger::Push(std::string_view prefix,
+						   std::string_view format_str, const ArgsT&... args) {
+
+		if (!BeginPush()) {
+			return false;
+		}
+
+		const auto record = Acquire();
+		if (!record) {
+			EndPush();
+			return true;
+		}
+
+		// Reserve one character for the line feed.
+		constexpr auto capacity = s_record_size - 1u;
+
+		char* const begin = record->m_data;
+		char* end         = std::copy_n(prefix.data(),
+										std::min(prefix.size(), capacity),
+										begin);
+		try {
+			end = AppendWrite(end, capacity - static_cast< std::size_t >(end - begin),
+							  format_str, args...);
+		}
+		catch (...) {
+			// The acquired record must be committed in any case.
+			record->m_size = 0u;
+			record->m_wide = false;
+			Commit(*record);
+			EndPush();
+			throw;
+		}
+		*end++ = '\n';
+
+		record->m_size = static_cast< U32 >(end - begin);
+		record->m_wide = false;
+		Commit(*record);
+		EndPush();
+		return true;
+	}
+
+	template< typename... ArgsT >
+	bool AsyncLogger::Push(std::string_view prefix,
+						   std::wstring_view format_str, const ArgsT&... args) {
+
+		if (!BeginPush()) {
+			return false;
+		}
+
+		const auto record = Acquire();
+		if (!record) {
+			EndPush();
+			return true;
+		}
+
+		// Reserve one character for the line feed.
+		constexpr auto capacity = s_record_size / sizeof(wchar_t) - 1u;
+
+		wchar_t* const begin = reinterpret_cast< wchar_t* >(record->m_data);
+		wchar_t* end         = std::copy_n(prefix.data(),
+										   std::min(prefix.size(), capacity),
+										   begin);
+		try {
+			end = AppendWrite(end, capacity - static_cast< std::size_t >(end - begin),
+							  format_str, args...);
+		}
+		catch (...) {
+			// The acquired record must be committed in any case.
+			record->m_size = 0u;
+			record->m_wide = true;
+			Commit(*record);
+			EndPush();
+			throw;
+		}
+		*end++ = L'\n';
+
+		record->m_size = static_cast< U32 >(end - begin);
+		record->m_wide = true;
+		Commit(*record);
+		EndPush();
+		return true;
+	}
+}
\ No newline at end of file
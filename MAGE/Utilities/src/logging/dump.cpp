@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "logging\dump.hpp"
-#include "logging\logging.hpp"
+#include "logging/dump.hpp"
+#include "logging/logging.hpp"
 
 #pragma endregion
 
@@ -38,6 +38,8 @@ namespace mage {
 			EXCEPTION_POINTERS* exception_record) noexcept {
 
 			CreateMiniDump(exception_record);
+			// Write all pending log messages before terminating.
+			AsyncLogger::Get().Flush();
 			return EXCEPTION_CONTINUE_SEARCH;
 		}
 
@@ -60,7 +62,7 @@ namespace mage {
 											nullptr));
 
 		if (!file_handle) {
-			Error("Failed to create file: {}.", GetLastError());
+			MAGE_ERROR("Failed to create file: {}.", GetLastError());
 			return;
 		}
 
@@ -86,7 +88,7 @@ namespace mage {
 								nullptr);
 
 		if (FALSE == result) {
-			Error("Failed to create a mini dump file: {}.", GetLastError());
+			MAGE_ERROR("Failed to create a mini dump file: {}.", GetLastError());
 		}
 		else {
 			Info("Succeeded to create a mini dump file: MiniDump.dmp.");
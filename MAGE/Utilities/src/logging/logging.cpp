@@ -3,8 +3,22 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "logging\logging.hpp"
-#include "exception\exception.hpp"
+#include "logging/logging.hpp"
+#include "exception/exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <chrono>
+
+#ifndef _WIN32
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
 
 #pragma endregion
 
@@ -22,11 +36,97 @@ namespace mage {
 
 	#pragma endregion
 
+	//-------------------------------------------------------------------------
+	// Logging
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	namespace {
+
+		/**
+		 The maximum number of logged messages per log site and per rate
+		 limiting window.
+		 */
+		constexpr U32 g_max_nb_messages_per_window = 10u;
+
+		/**
+		 The rate limiting window (in clock ticks).
+		 */
+		constexpr S64 g_window = std::chrono::duration_cast<
+			std::chrono::steady_clock::duration >(std::chrono::seconds(1)).count();
+	}
+
+	std::atomic< LogSite* > LogSite::s_first(nullptr);
+
+	[[nodiscard]]
+	bool LogSite::Acquire(std::string_view prefix,
+						  U64& nb_suppressed) noexcept {
+
+		const auto now = static_cast< S64 >(
+			std::chrono::steady_clock::now().time_since_epoch().count());
+
+		nb_suppressed = 0u;
+
+		auto window = m_window.load(std::memory_order_relaxed);
+		if (0 == window || g_window <= now - window) {
+			// Start a new rate limiting window. Only one thread starts it.
+			if (m_window.compare_exchange_strong(window, now,
+												 std::memory_order_relaxed)) {
+				if (0 == window) {
+					Register(prefix);
+				}
+
+				m_nb_messages.store(1u, std::memory_order_relaxed);
+				nb_suppressed = m_nb_suppressed.exchange(0u,
+														 std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		if (g_max_nb_messages_per_window
+			> m_nb_messages.fetch_add(1u, std::memory_order_relaxed)) {
+			return true;
+		}
+
+		m_nb_suppressed.fetch_add(1u, std::memory_order_relaxed);
+		return false;
+	}
+
+	void LogSite::Register(std::string_view prefix) noexcept {
+		m_prefix = prefix;
+
+		// Publish the prefix together with this log site.
+		auto first = s_first.load(std::memory_order_relaxed);
+		do {
+			m_next = first;
+		}
+		while (!s_first.compare_exchange_weak(first, this,
+											  std::memory_order_release,
+											  std::memory_order_relaxed));
+	}
+
+	void ReportSuppressedMessages() {
+		for (auto site = LogSite::s_first.load(std::memory_order_acquire);
+			 site; site = site->m_next) {
+
+			const auto nb_suppressed
+				= site->m_nb_suppressed.exchange(0u, std::memory_order_relaxed);
+			if (0u != nb_suppressed) {
+				details::Log(site->m_prefix, MessageDisposition::Continue,
+							 "{} similar messages suppressed.", nb_suppressed);
+			}
+		}
+	}
+
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// Console
 	//-------------------------------------------------------------------------
 	#pragma region
 
+	#ifdef _WIN32
+
 	namespace {
 
 		/**
@@ -113,5 +213,25 @@ namespace mage {
 		}
 	}
 
+	#else
+
+	[[nodiscard]]
+	FU16 ConsoleWidth() {
+		// Retrieve the window size of the terminal of the standard output.
+		winsize size = {};
+		const int result = ioctl(STDOUT_FILENO, TIOCGWINSZ, &size);
+		ThrowIfFailed((0 == result),
+					  "Retrieving terminal window size failed.");
+
+		return static_cast< FU16 >(size.ws_col);
+	}
+
+	void InitializeConsole() {
+		// The standard streams are already attached to the terminal (if
+		// any) of the process.
+	}
+
+	#endif
+
 	#pragma endregion
 }
\ No newline at end of file
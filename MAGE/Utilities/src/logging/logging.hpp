@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "string\format.hpp"
+#include "string/format.hpp"
 
 #pragma endregion
 
@@ -14,7 +14,11 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <atomic>
 #include <cassert>
+#ifndef _WIN32
+#include <csignal>
+#endif
 
 #pragma endregion
 
@@ -26,13 +30,46 @@
 // Assert definition
 // The macro NDEBUG controls whether assert statements are active or not.
 #ifdef NDEBUG
-	#define Assert(expr) (__noop)
+	#define Assert(expr) ((void)0)
 #else
 	#define Assert(expr) ((expr) ? (void)0 \
                                  : mage::Fatal("Assertion \"{}\" failed in {}, line {}", \
 									           #expr, __FILE__, __LINE__))
 #endif
 
+// Log level definition
+// The macro MAGE_LOG_LEVEL controls the minimum severity of the log messages
+// that are compiled: 0 (debug), 1 (info), 2 (warning) or 3 (error). Log
+// messages of lower severities compile to nothing. Fatal messages are always
+// compiled.
+#ifndef MAGE_LOG_LEVEL
+	#define MAGE_LOG_LEVEL 0
+#endif
+
+// Rate-limited log message definitions
+// The macros MAGE_WARNING and MAGE_ERROR log a warning and an error message,
+// respectively, rate limited per call site (i.e. per static log site). The
+// arguments are not evaluated if the severity is compiled out.
+#if MAGE_LOG_LEVEL <= 2
+	#define MAGE_WARNING(...) \
+		do { \
+			static mage::LogSite mage_log_site; \
+			mage::Warning(mage_log_site, __VA_ARGS__); \
+		} while (false)
+#else
+	#define MAGE_WARNING(...) ((void)0)
+#endif
+
+#if MAGE_LOG_LEVEL <= 3
+	#define MAGE_ERROR(...) \
+		do { \
+			static mage::LogSite mage_log_site; \
+			mage::Error(mage_log_site, __VA_ARGS__); \
+		} while (false)
+#else
+	#define MAGE_ERROR(...) ((void)0)
+#endif
+
 #pragma endregion
 
 //-----------------------------------------------------------------------------
@@ -206,6 +243,160 @@ namespace mage {
 		Abort     // Report and abort exceution.
 	};
 
+	/**
+	 Logs the number of suppressed messages of all log sites that have
+	 suppressed messages which are not reported yet.
+	 */
+	void ReportSuppressedMessages();
+
+	/**
+	 A class of log sites (i.e. the rate limiters of the messages of a call
+	 site).
+
+	 Log sites are static (see @c MAGE_WARNING and @c MAGE_ERROR) and
+	 lock-free. The rate limit is approximate while multiple threads log
+	 messages of the same log site at the start of a rate limiting window.
+	 */
+	class LogSite {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a log site.
+		 */
+		constexpr LogSite() noexcept
+			: m_window(0),
+			m_nb_messages(0u),
+			m_nb_suppressed(0u),
+			m_prefix(),
+			m_next(nullptr) {}
+
+		/**
+		 Constructs a log site from the given log site.
+
+		 @param[in]		site
+						A reference to the log site to copy.
+		 */
+		LogSite(const LogSite& site) = delete;
+
+		/**
+		 Constructs a log site by moving the given log site.
+
+		 @param[in]		site
+						A reference to the log site to move.
+		 */
+		LogSite(LogSite&& site) = delete;
+
+		/**
+		 Destructs this log site.
+		 */
+		~LogSite() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given log site to this log site.
+
+		 @param[in]		site
+						A reference to the log site to copy.
+		 @return		A reference to the copy of the given log site (i.e.
+						this log site).
+		 */
+		LogSite& operator=(const LogSite& site) = delete;
+
+		/**
+		 Moves the given log site to this log site.
+
+		 @param[in]		site
+						A reference to the log site to move.
+		 @return		A reference to the moved log site (i.e. this log
+						site).
+		 */
+		LogSite& operator=(LogSite&& site) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Registers a message at this log site.
+
+		 @param[in]		prefix
+						The prefix of the message.
+		 @param[out]	nb_suppressed
+						The number of suppressed messages of this log site
+						to report before the message.
+		 @return		@c true if the message must be logged. @c false if
+						the message is suppressed.
+		 */
+		[[nodiscard]]
+		bool Acquire(std::string_view prefix, U64& nb_suppressed) noexcept;
+
+	private:
+
+		friend void ReportSuppressedMessages();
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Registers this log site at the log sites reported by
+		 @c ReportSuppressedMessages.
+
+		 @param[in]		prefix
+						The prefix of the messages of this log site.
+		 */
+		void Register(std::string_view prefix) noexcept;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the most recently registered log site.
+		 */
+		static std::atomic< LogSite* > s_first;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The start (in clock ticks) of the current rate limiting window of
+		 this log site. The start is zero before the first message.
+		 */
+		std::atomic< S64 > m_window;
+
+		/**
+		 The number of messages in the current rate limiting window of this
+		 log site.
+		 */
+		std::atomic< U32 > m_nb_messages;
+
+		/**
+		 The number of suppressed messages of this log site which are not
+		 reported yet.
+		 */
+		std::atomic< U64 > m_nb_suppressed;
+
+		/**
+		 The prefix of the messages of this log site.
+		 */
+		std::string_view m_prefix;
+
+		/**
+		 A pointer to the previously registered log site.
+		 */
+		LogSite* m_next;
+	};
+
 	/**
 	 Logs a message.
 
@@ -285,7 +476,8 @@ namespace mage {
 					A reference to the format arguments.
 	 */
 	template< typename... ArgsT >
-	void Info(std::string_view format_str, const ArgsT&... args);
+	void Info([[maybe_unused]] std::string_view format_str,
+			  [[maybe_unused]] const ArgsT&... args);
 
 	/**
 	 Logs an info message.
@@ -300,7 +492,8 @@ namespace mage {
 					A reference to the format arguments.
 	 */
 	template< typename... ArgsT >
-	void Info(std::wstring_view format_str, const ArgsT&... args);
+	void Info([[maybe_unused]] std::wstring_view format_str,
+			  [[maybe_unused]] const ArgsT&... args);
 
 	/**
 	 Logs a warning message.
@@ -308,6 +501,9 @@ namespace mage {
 	 A warning message is associated with anything that can potentially cause
 	 application oddities.
 
+	 Warning messages are not rate limited. Use @c MAGE_WARNING to rate limit
+	 the warning messages of a call site.
+
 	 @tparam		ArgsT
 					The format argument types.
 	 @param[in]		format_str
@@ -316,7 +512,32 @@ namespace mage {
 					A reference to the format arguments.
 	 */
 	template< typename... ArgsT >
-	void Warning(std::string_view format_str, const ArgsT&... args);
+	void Warning([[maybe_unused]] std::string_view format_str,
+				 [[maybe_unused]] const ArgsT&... args);
+
+	/**
+	 Logs a warning message of the given log site.
+
+	 A warning message is associated with anything that can potentially cause
+	 application oddities.
+
+	 Warning messages are rate limited per log site. Suppressed messages are
+	 counted and reported with the next logged message of the same log site
+	 or by @c ReportSuppressedMessages.
+
+	 @tparam		ArgsT
+					The format argument types.
+	 @param[in]		site
+					A reference to the log site.
+	 @param[in]		format_str
+					The format string.
+	 @param[in]		args
+					A reference to the format arguments.
+	 */
+	template< typename... ArgsT >
+	void Warning([[maybe_unused]] LogSite& site,
+				 [[maybe_unused]] std::string_view format_str,
+				 [[maybe_unused]] const ArgsT&... args);
 
 	/**
 	 Logs a warning message.
@@ -324,6 +545,9 @@ namespace mage {
 	 A warning message is associated with anything that can potentially cause
 	 application oddities.
 
+	 Warning messages are not rate limited. Use @c MAGE_WARNING to rate limit
+	 the warning messages of a call site.
+
 	 @tparam		ArgsT
 					The format argument types.
 	 @param[in]		format_str
@@ -332,7 +556,32 @@ namespace mage {
 					A reference to the format arguments.
 	 */
 	template< typename... ArgsT >
-	void Warning(std::wstring_view format_str, const ArgsT&... args);
+	void Warning([[maybe_unused]] std::wstring_view format_str,
+				 [[maybe_unused]] const ArgsT&... args);
+
+	/**
+	 Logs a warning message of the given log site.
+
+	 A warning message is associated with anything that can potentially cause
+	 application oddities.
+
+	 Warning messages are rate limited per log site. Suppressed messages are
+	 counted and reported with the next logged message of the same log site
+	 or by @c ReportSuppressedMessages.
+
+	 @tparam		ArgsT
+					The format argument types.
+	 @param[in]		site
+					A reference to the log site.
+	 @param[in]		format_str
+					The format string.
+	 @param[in]		args
+					A reference to the format arguments.
+	 */
+	template< typename... ArgsT >
+	void Warning([[maybe_unused]] LogSite& site,
+				 [[maybe_unused]] std::wstring_view format_str,
+				 [[maybe_unused]] const ArgsT&... args);
 
 	/**
 	 Logs an error message.
@@ -340,15 +589,43 @@ namespace mage {
 	 An error message is associated with any error which is fatal to the
 	 operation, but not the service or application.
 
+	 Error messages are not rate limited. Use @c MAGE_ERROR to rate limit
+	 the error messages of a call site.
+
+	 @tparam		ArgsT
+					The format argument types.
+	 @param[in]		format_str
+					The format string.
+	 @param[in]		args
+					A reference to the format arguments.
+	 */
+	template< typename... ArgsT >
+	void Error([[maybe_unused]] std::string_view format_str,
+			   [[maybe_unused]] const ArgsT&... args);
+
+	/**
+	 Logs an error message of the given log site.
+
+	 An error message is associated with any error which is fatal to the
+	 operation, but not the service or application.
+
+	 Error messages are rate limited per log site. Suppressed messages are
+	 counted and reported with the next logged message of the same log site
+	 or by @c ReportSuppressedMessages.
+
 	 @tparam		ArgsT
 					The format argument types.
+	 @param[in]		site
+					A reference to the log site.
 	 @param[in]		format_str
 					The format string.
 	 @param[in]		args
 					A reference to the format arguments.
 	 */
 	template< typename... ArgsT >
-	void Error(std::string_view format_str, const ArgsT&... args);
+	void Error([[maybe_unused]] LogSite& site,
+			   [[maybe_unused]] std::string_view format_str,
+			   [[maybe_unused]] const ArgsT&... args);
 
 	/**
 	 Logs an error message.
@@ -356,15 +633,43 @@ namespace mage {
 	 An error message is associated with any error which is fatal to the
 	 operation, but not the service or application.
 
+	 Error messages are not rate limited. Use @c MAGE_ERROR to rate limit
+	 the error messages of a call site.
+
+	 @tparam		ArgsT
+					The format argument types.
+	 @param[in]		format_str
+					The format string.
+	 @param[in]		args
+					A reference to the format arguments.
+	 */
+	template< typename... ArgsT >
+	void Error([[maybe_unused]] std::wstring_view format_str,
+			   [[maybe_unused]] const ArgsT&... args);
+
+	/**
+	 Logs an error message of the given log site.
+
+	 An error message is associated with any error which is fatal to the
+	 operation, but not the service or application.
+
+	 Error messages are rate limited per log site. Suppressed messages are
+	 counted and reported with the next logged message of the same log site
+	 or by @c ReportSuppressedMessages.
+
 	 @tparam		ArgsT
 					The format argument types.
+	 @param[in]		site
+					A reference to the log site.
 	 @param[in]		format_str
 					The format string.
 	 @param[in]		args
 					A reference to the format arguments.
 	 */
 	template< typename... ArgsT >
-	void Error(std::wstring_view format_str, const ArgsT&... args);
+	void Error([[maybe_unused]] LogSite& site,
+			   [[maybe_unused]] std::wstring_view format_str,
+			   [[maybe_unused]] const ArgsT&... args);
 
 	/**
 	 Logs a fatal message.
@@ -435,6 +740,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "logging\logging.tpp"
+#include "logging/logging.tpp"
 
 #pragma endregion
\ No newline at end of file
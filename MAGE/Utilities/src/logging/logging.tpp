@@ -1,47 +1,93 @@
 #pragma once
 
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "logging/async_logger.hpp"
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	template< typename... ArgsT >
-	inline void Log(MessageDisposition disposition,
-					std::string_view format_str, const ArgsT&... args) {
-
-		if (MessageDisposition::Ignore == disposition) {
-			return;
+	namespace details {
+
+		template< typename StringT, typename... ArgsT >
+		inline void Log(std::string_view prefix,
+						MessageDisposition disposition,
+						const StringT& format_str, const ArgsT&... args) {
+
+			if (MessageDisposition::Ignore == disposition) {
+				return;
+			}
+
+			// Format the message on the calling thread, but leave the console
+			// I/O to the drain thread. Messages are written synchronously
+			// while the global asynchronous logger is not running (e.g.,
+			// after its destruction).
+			if (!AsyncLogger::IsEnabled()
+				|| !AsyncLogger::Get().Push(prefix, format_str, args...)) {
+
+				Print(prefix);
+				Print(format_str, args...);
+				Print("\n");
+			}
+
+			if (MessageDisposition::Abort == disposition) {
+				// Write all pending messages before breaking.
+				if (AsyncLogger::IsEnabled()) {
+					AsyncLogger::Get().Flush();
+				}
+
+				#ifdef _WIN32
+				__debugbreak();
+				#else
+				std::raise(SIGTRAP);
+				#endif
+			}
 		}
 
-		Print(format_str, args...);
-		Print("\n");
+		template< typename StringT, typename... ArgsT >
+		inline void LogRateLimited(LogSite& site, std::string_view prefix,
+								   const StringT& format_str, const ArgsT&... args) {
+
+			U64 nb_suppressed = 0u;
+			if (!site.Acquire(prefix, nb_suppressed)) {
+				return;
+			}
 
-		if (MessageDisposition::Abort == disposition) {
-			__debugbreak();
+			if (0u != nb_suppressed) {
+				Log(prefix, MessageDisposition::Continue,
+					"{} similar messages suppressed.", nb_suppressed);
+			}
+
+			Log(prefix, MessageDisposition::Continue, format_str, args...);
 		}
 	}
 
 	template< typename... ArgsT >
 	inline void Log(MessageDisposition disposition,
-					std::wstring_view format_str, const ArgsT&... args) {
+					std::string_view format_str, const ArgsT&... args) {
 
-		if (MessageDisposition::Ignore == disposition) {
-			return;
-		}
+		details::Log({}, disposition, format_str, args...);
+	}
 
-		Print(format_str, args...);
-		Print("\n");
+	template< typename... ArgsT >
+	inline void Log(MessageDisposition disposition,
+					std::wstring_view format_str, const ArgsT&... args) {
 
-		if (MessageDisposition::Abort == disposition) {
-			__debugbreak();
-		}
+		details::Log({}, disposition, format_str, args...);
 	}
 
 	template< typename... ArgsT >
 	inline void Debug([[maybe_unused]] std::string_view format_str,
 					  [[maybe_unused]] const ArgsT&... args) {
 
-		#ifdef _DEBUG
+		#if defined(_DEBUG) && MAGE_LOG_LEVEL <= 0
 		if (  !LoggingConfiguration::Get().IsVerbose()
 			|| LoggingConfiguration::Get().IsQuiet()) {
 			// Do not process info in non-verbose mode.
@@ -49,8 +95,7 @@ namespace mage {
 			return;
 		}
 
-		Print("Debug:   ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::Log("Debug:   ", MessageDisposition::Continue, format_str, args...);
 		#endif
 	}
 
@@ -58,7 +103,7 @@ namespace mage {
 	inline void Debug([[maybe_unused]] std::wstring_view format_str,
 					  [[maybe_unused]] const ArgsT&... args) {
 
-		#ifdef _DEBUG
+		#if defined(_DEBUG) && MAGE_LOG_LEVEL <= 0
 		if (  !LoggingConfiguration::Get().IsVerbose()
 			|| LoggingConfiguration::Get().IsQuiet()) {
 			// Do not process info in non-verbose mode.
@@ -66,13 +111,15 @@ namespace mage {
 			return;
 		}
 
-		Print("Debug:   ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::Log("Debug:   ", MessageDisposition::Continue, format_str, args...);
 		#endif
 	}
 
 	template< typename... ArgsT >
-	inline void Info(std::string_view format_str, const ArgsT&... args) {
+	inline void Info([[maybe_unused]] std::string_view format_str,
+					 [[maybe_unused]] const ArgsT&... args) {
+
+		#if MAGE_LOG_LEVEL <= 1
 		if (  !LoggingConfiguration::Get().IsVerbose()
 			|| LoggingConfiguration::Get().IsQuiet()) {
 			// Do not process info in non-verbose mode.
@@ -80,12 +127,15 @@ namespace mage {
 			return;
 		}
 
-		Print("Info:    ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::Log("Info:    ", MessageDisposition::Continue, format_str, args...);
+		#endif
 	}
 
 	template< typename... ArgsT >
-	inline void Info(std::wstring_view format_str, const ArgsT&... args) {
+	inline void Info([[maybe_unused]] std::wstring_view format_str,
+					 [[maybe_unused]] const ArgsT&... args) {
+
+		#if MAGE_LOG_LEVEL <= 1
 		if (  !LoggingConfiguration::Get().IsVerbose()
 			|| LoggingConfiguration::Get().IsQuiet()) {
 			// Do not process info in non-verbose mode.
@@ -93,53 +143,113 @@ namespace mage {
 			return;
 		}
 
-		Print("Info:    ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::Log("Info:    ", MessageDisposition::Continue, format_str, args...);
+		#endif
 	}
 
 	template< typename... ArgsT >
-	inline void Warning(std::string_view format_str, const ArgsT&... args) {
+	inline void Warning([[maybe_unused]] std::string_view format_str,
+						[[maybe_unused]] const ArgsT&... args) {
+
+		#if MAGE_LOG_LEVEL <= 2
 		if (LoggingConfiguration::Get().IsQuiet()) {
 			// Do not process warning in quiet mode.
 			return;
 		}
 
-		Print("Warning: ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::Log("Warning: ", MessageDisposition::Continue, format_str, args...);
+		#endif
 	}
 
 	template< typename... ArgsT >
-	inline void Warning(std::wstring_view format_str, const ArgsT&... args) {
+	inline void Warning([[maybe_unused]] LogSite& site,
+						[[maybe_unused]] std::string_view format_str,
+						[[maybe_unused]] const ArgsT&... args) {
+
+		#if MAGE_LOG_LEVEL <= 2
 		if (LoggingConfiguration::Get().IsQuiet()) {
 			// Do not process warning in quiet mode.
 			return;
 		}
 
-		Print("Warning: ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::LogRateLimited(site, "Warning: ", format_str, args...);
+		#endif
 	}
 
 	template< typename... ArgsT >
-	inline void Error(std::string_view format_str, const ArgsT&... args) {
-		Print("Error:   ");
-		Log(MessageDisposition::Continue, format_str, args...);
+	inline void Warning([[maybe_unused]] std::wstring_view format_str,
+						[[maybe_unused]] const ArgsT&... args) {
+
+		#if MAGE_LOG_LEVEL <= 2
+		if (LoggingConfiguration::Get().IsQuiet()) {
+			// Do not process warning in quiet mode.
+			return;
+		}
+
+		details::Log("Warning: ", MessageDisposition::Continue, format_str, args...);
+		#endif
 	}
 
 	template< typename... ArgsT >
-	inline void Error(std::wstring_view format_str, const ArgsT&... args) {
-		Print("Error:   ");
-		Log(MessageDisposition::Continue, format_str, args...);
+	inline void Warning([[maybe_unused]] LogSite& site,
+						[[maybe_unused]] std::wstring_view format_str,
+						[[maybe_unused]] const ArgsT&... args) {
+
+		#if MAGE_LOG_LEVEL <= 2
+		if (LoggingConfiguration::Get().IsQuiet()) {
+			// Do not process warning in quiet mode.
+			return;
+		}
+
+		details::LogRateLimited(site, "Warning: ", format_str, args...);
+		#endif
+	}
+
+	template< typename... ArgsT >
+	inline void Error([[maybe_unused]] std::string_view format_str,
+					  [[maybe_unused]] const ArgsT&... args) {
+
+		#if MAGE_LOG_LEVEL <= 3
+		details::Log("Error:   ", MessageDisposition::Continue, format_str, args...);
+		#endif
+	}
+
+	template< typename... ArgsT >
+	inline void Error([[maybe_unused]] LogSite& site,
+					  [[maybe_unused]] std::string_view format_str,
+					  [[maybe_unused]] const ArgsT&... args) {
+
+		#if MAGE_LOG_LEVEL <= 3
+		details::LogRateLimited(site, "Error:   ", format_str, args...);
+		#endif
+	}
+
+	template< typename... ArgsT >
+	inline void Error([[maybe_unused]] std::wstring_view format_str,
+					  [[maybe_unused]] const ArgsT&... args) {
+
+		#if MAGE_LOG_LEVEL <= 3
+		details::Log("Error:   ", MessageDisposition::Continue, format_str, args...);
+		#endif
+	}
+
+	template< typename... ArgsT >
+	inline void Error([[maybe_unused]] LogSite& site,
+					  [[maybe_unused]] std::wstring_view format_str,
+					  [[maybe_unused]] const ArgsT&... args) {
+
+		#if MAGE_LOG_LEVEL <= 3
+		details::LogRateLimited(site, "Error:   ", format_str, args...);
+		#endif
 	}
 
 	template< typename... ArgsT >
 	inline void Fatal(std::string_view format_str, const ArgsT&... args) {
-		Print("Fatal:   ");
-		Log(MessageDisposition::Abort, format_str, args...);
+		details::Log("Fatal:   ", MessageDisposition::Abort, format_str, args...);
 	}
 
 	template< typename... ArgsT >
 	inline void Fatal(std::wstring_view format_str, const ArgsT&... args) {
-		Print("Fatal:   ");
-		Log(MessageDisposition::Abort, format_str, args...);
+		details::Log("Fatal:   ", MessageDisposition::Abort, format_str, args...);
 	}
 }
\ No newline at end of file
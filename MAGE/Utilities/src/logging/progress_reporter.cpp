@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "logging\logging.hpp"
-#include "logging\progress_reporter.hpp"
-#include "system\timer.hpp"
+#include "logging/logging.hpp"
+#include "logging/progress_reporter.hpp"
+#include "system/timer.hpp"
 
 #pragma endregion
 
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -14,7 +14,12 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <algorithm>
+#ifdef _WIN32
 #include <malloc.h>
+#else
+#include <stdlib.h>
+#endif
 #include <new>
 
 #pragma endregion
@@ -38,7 +43,15 @@ namespace mage {
 	 */
 	[[nodiscard]]
 	inline void* AllocAligned(std::size_t size, std::size_t alignment) noexcept {
+		#ifdef _WIN32
 		return _aligned_malloc(size, alignment);
+		#else
+		// posix_memalign requires an alignment of at least sizeof(void*).
+		void* ptr = nullptr;
+		return (0 == posix_memalign(&ptr,
+									std::max(alignment, sizeof(void*)),
+									size)) ? ptr : nullptr;
+		#endif
 	}
 
 	/**
@@ -73,7 +86,11 @@ namespace mage {
 			return;
 		}
 
+		#ifdef _WIN32
 		_aligned_free(ptr);
+		#else
+		free(ptr);
+		#endif
 	}
 
 	/**
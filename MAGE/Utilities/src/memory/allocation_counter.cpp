@@ -0,0 +1,131 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory/allocation_counter.hpp"
+#include "memory/allocation.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The number of allocations performed by the global allocation
+		 functions.
+
+		 The counters are constant initialized, since allocations can
+		 happen before the dynamic initialization of this translation unit.
+		 */
+		std::atomic< U64 > g_nb_allocations(0u);
+
+		/**
+		 The number of bytes allocated by the global allocation functions.
+		 */
+		std::atomic< U64 > g_nb_allocated_bytes(0u);
+	}
+
+	[[nodiscard]]
+	U64 GetNumberOfAllocations() noexcept {
+		return g_nb_allocations.load(std::memory_order_relaxed);
+	}
+
+	[[nodiscard]]
+	U64 GetNumberOfAllocatedBytes() noexcept {
+		return g_nb_allocated_bytes.load(std::memory_order_relaxed);
+	}
+
+	#if MAGE_ALLOCATION_COUNTING
+
+	namespace {
+
+		template< typename AllocatorT >
+		[[nodiscard]]
+		void* CountedAllocate(std::size_t size, AllocatorT&& allocator) {
+			g_nb_allocations.fetch_add(1u, std::memory_order_relaxed);
+			g_nb_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+
+			// Zero-sized allocations must return unique pointers.
+			if (0u == size) {
+				size = 1u;
+			}
+
+			while (true) {
+				if (auto ptr = allocator(size); ptr) {
+					return ptr;
+				}
+
+				// Give the new handler the opportunity to free memory.
+				const auto handler = std::get_new_handler();
+				if (!handler) {
+					throw std::bad_alloc();
+				}
+
+				handler();
+			}
+		}
+	}
+
+	#endif
+}
+
+#if MAGE_ALLOCATION_COUNTING
+
+//-----------------------------------------------------------------------------
+// Global Allocation Functions
+//-----------------------------------------------------------------------------
+#pragma region
+
+// The array and nothrow variants of the global allocation and deallocation
+// functions forward to the replaced scalar variants below.
+
+void* operator new(std::size_t size) {
+	return mage::CountedAllocate(size, [](std::size_t n) noexcept {
+		return std::malloc(n);
+	});
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+	return mage::CountedAllocate(size, [alignment](std::size_t n) noexcept {
+		return mage::AllocAligned(n, static_cast< std::size_t >(alignment));
+	});
+}
+
+void operator delete(void* ptr) noexcept {
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, [[maybe_unused]] std::size_t size) noexcept {
+	std::free(ptr);
+}
+
+void operator delete(void* ptr,
+					 [[maybe_unused]] std::align_val_t alignment) noexcept {
+	mage::FreeAligned(ptr);
+}
+
+void operator delete(void* ptr,
+					 [[maybe_unused]] std::size_t size,
+					 [[maybe_unused]] std::align_val_t alignment) noexcept {
+	mage::FreeAligned(ptr);
+}
+
+#pragma endregion
+
+#endif
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/scalar_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+// Allocation counter definition
+// The macro MAGE_ALLOCATION_COUNTING controls whether the global allocation
+// functions are replaced by counting allocation functions or not. Allocation
+// counting is only enabled in the benchmark configuration (i.e. the benchmark
+// targets of the CMake build, and the Release builds of the Visual Studio
+// solution with the MSBuild property MageBenchmark=true). Otherwise, the
+// default allocation functions are used.
+#ifndef MAGE_ALLOCATION_COUNTING
+	#define MAGE_ALLOCATION_COUNTING 0
+#endif
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 Returns the number of allocations performed by the global allocation
+	 functions (i.e. @c operator @c new) since the start of the application.
+
+	 @return		The number of allocations performed by the global
+					allocation functions. Zero if allocation counting is
+					disabled.
+	 */
+	[[nodiscard]]
+	U64 GetNumberOfAllocations() noexcept;
+
+	/**
+	 Returns the number of bytes allocated by the global allocation functions
+	 (i.e. @c operator @c new) since the start of the application.
+
+	 @return		The number of bytes allocated by the global allocation
+					functions. Zero if allocation counting is disabled.
+	 */
+	[[nodiscard]]
+	U64 GetNumberOfAllocatedBytes() noexcept;
+}
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "platform\windows.hpp"
+#include "platform/windows.hpp"
 
 #pragma endregion
 
@@ -15,9 +15,11 @@
 #pragma region
 
 #include <functional>
-#include <gsl\gsl>
+#include <gsl/gsl>
 #include <memory>
+#ifdef _WIN32
 #include <wrl.h>
+#endif
 
 #pragma endregion
 
@@ -61,6 +63,8 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
+	#ifdef _WIN32
+
 	/**
 	 A class of smart pointers for managing shared-ownership COM resources.
 
@@ -70,6 +74,8 @@ namespace mage {
 	template< typename T >
 	using ComPtr = Microsoft::WRL::ComPtr< T >;
 
+	#endif
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -235,6 +241,8 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
+	#ifdef _WIN32
+
 	namespace details {
 
 		/**
@@ -314,6 +322,8 @@ namespace mage {
 		return SharedHandle(SafeHandle(handle), details::DestructHandle);
 	}
 
+	#endif
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -766,6 +776,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "memory\memory.tpp"
+#include "memory/memory.tpp"
 
 #pragma endregion
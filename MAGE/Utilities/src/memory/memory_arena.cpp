@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "memory\allocation.hpp"
-#include "memory\memory_arena.hpp"
+#include "memory/allocation.hpp"
+#include "memory/memory_arena.hpp"
 
 #pragma endregion
 
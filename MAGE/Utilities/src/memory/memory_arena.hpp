@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -472,6 +472,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "memory\memory_arena.tpp"
+#include "memory/memory_arena.tpp"
 
 #pragma endregion
\ No newline at end of file
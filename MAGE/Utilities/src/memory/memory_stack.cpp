@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "logging\logging.hpp"
-#include "memory\allocation.hpp"
-#include "memory\memory_stack.hpp"
+#include "logging/logging.hpp"
+#include "memory/allocation.hpp"
+#include "memory/memory_stack.hpp"
 
 #pragma endregion
 
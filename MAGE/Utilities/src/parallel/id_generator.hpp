@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\atomic_types.hpp"
+#include "type/atomic_types.hpp"
 
 #pragma endregion
 
@@ -3,8 +3,24 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "exception\exception.hpp"
-#include "parallel\parallel.hpp"
+#include "exception/exception.hpp"
+#include "parallel/parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#ifndef _WIN32
+#include <fstream>
+#include <set>
+#include <string>
+#include <utility>
+#include <sched.h>
+#include <unistd.h>
+#endif
 
 #pragma endregion
 
@@ -13,6 +29,8 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	#ifdef _WIN32
+
 	[[nodiscard]]
 	FU16 NumberOfPhysicalCores() {
 		DWORD length = 0u;
@@ -60,4 +78,49 @@ namespace mage {
 		// Return the number of logical processors in the current group.
 		return static_cast< FU16 >(system_info.dwNumberOfProcessors);
 	}
-}
+
+	#else
+
+	[[nodiscard]]
+	FU16 NumberOfPhysicalCores() {
+		const auto nb_processors = sysconf(_SC_NPROCESSORS_CONF);
+		ThrowIfFailed((0 < nb_processors),
+					  "Retrieving processor information failed.");
+
+		// Logical processors sharing the same package and core identifier
+		// belong to the same physical core.
+		std::set< std::pair< long, long > > cores;
+		for (long i = 0; i < nb_processors; ++i) {
+			const auto topology = "/sys/devices/system/cpu/cpu"
+				                + std::to_string(i) + "/topology/";
+
+			std::ifstream package_file(topology + "physical_package_id");
+			std::ifstream core_file(topology + "core_id");
+			long package = 0, core = 0;
+			if (package_file >> package && core_file >> core) {
+				cores.emplace(package, core);
+			}
+		}
+
+		// Fall back to the number of system cores, if the topology is not
+		// exposed (e.g. in containers).
+		return cores.empty() ? NumberOfSystemCores()
+			                 : static_cast< FU16 >(cores.size());
+	}
+
+	[[nodiscard]]
+	FU16 NumberOfSystemCores() noexcept {
+		// Return the number of logical processors the calling thread may
+		// run on.
+		cpu_set_t cpu_set;
+		CPU_ZERO(&cpu_set);
+		if (0 == sched_getaffinity(0, sizeof(cpu_set), &cpu_set)) {
+			return static_cast< FU16 >(CPU_COUNT(&cpu_set));
+		}
+
+		const auto nb_processors = sysconf(_SC_NPROCESSORS_ONLN);
+		return static_cast< FU16 >((0 < nb_processors) ? nb_processors : 1);
+	}
+
+	#endif
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel/thread_pool.hpp"
+#include "parallel/parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	ThreadPool::ThreadPool(std::size_t nb_threads)
+		: m_tasks(),
+		m_mutex(),
+		m_condition(),
+		m_terminate(false),
+		m_threads() {
+
+		if (0u == nb_threads) {
+			const std::size_t nb_cores = NumberOfSystemCores();
+			nb_threads = std::max< std::size_t >(nb_cores, 2u) - 1u;
+		}
+
+		m_threads.reserve(nb_threads);
+		for (std::size_t i = 0u; i < nb_threads; ++i) {
+			m_threads.emplace_back(&ThreadPool::Work, this);
+		}
+	}
+
+	ThreadPool::~ThreadPool() {
+		Join();
+	}
+
+	void ThreadPool::Join() {
+		{
+			const std::scoped_lock lock(m_mutex);
+			// The worker threads drain the queued tasks before terminating.
+			m_terminate = true;
+		}
+
+		m_condition.notify_all();
+
+		for (auto& thread : m_threads) {
+			if (thread.joinable()) {
+				thread.join();
+			}
+		}
+	}
+
+	[[nodiscard]]
+	std::size_t ThreadPool::GetNumberOfQueuedTasks() const noexcept {
+		const std::scoped_lock lock(m_mutex);
+
+		return m_tasks.size();
+	}
+
+	void ThreadPool::Work() {
+		while (true) {
+			std::function< void() > task;
+
+			{
+				std::unique_lock lock(m_mutex);
+				m_condition.wait(lock, [this]() {
+					return m_terminate || !m_tasks.empty();
+				});
+
+				if (m_tasks.empty()) {
+					// m_terminate is set.
+					return;
+				}
+
+				task = std::move(m_tasks.front());
+				m_tasks.pop_front();
+			}
+
+			task();
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,204 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of thread pools.
+
+	 Tasks are executed in order of submission by a fixed number of worker
+	 threads. Tasks which are still queued when the thread pool is destructed,
+	 are still executed (i.e. the queue is drained) before the worker threads
+	 are joined, so every future obtains its result. Queued tasks may enqueue
+	 further tasks while the queue is drained, but other threads may not
+	 enqueue tasks once the destruction has started.
+	 */
+	class ThreadPool {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a thread pool.
+
+		 @param[in]		nb_threads
+						The number of worker threads. If @a nb_threads is
+						equal to 0, the number of system cores minus one (with
+						a minimum of one) will be chosen.
+		 */
+		explicit ThreadPool(std::size_t nb_threads = 0u);
+
+		/**
+		 Constructs a thread pool from the given thread pool.
+
+		 @param[in]		pool
+						A reference to the thread pool to copy.
+		 */
+		ThreadPool(const ThreadPool& pool) = delete;
+
+		/**
+		 Constructs a thread pool by moving the given thread pool.
+
+		 @param[in]		pool
+						A reference to the thread pool to move.
+		 */
+		ThreadPool(ThreadPool&& pool) = delete;
+
+		/**
+		 Destructs this thread pool. Blocks until all queued tasks are
+		 executed.
+		 */
+		~ThreadPool();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given thread pool to this thread pool.
+
+		 @param[in]		pool
+						A reference to the thread pool to copy.
+		 @return		A reference to the copy of the given thread pool (i.e.
+						this thread pool).
+		 */
+		ThreadPool& operator=(const ThreadPool& pool) = delete;
+
+		/**
+		 Moves the given thread pool to this thread pool.
+
+		 @param[in]		pool
+						A reference to the thread pool to move.
+		 @return		A reference to the moved thread pool (i.e. this thread
+						pool).
+		 */
+		ThreadPool& operator=(ThreadPool&& pool) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of worker threads of this thread pool.
+
+		 @return		The number of worker threads of this thread pool.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfThreads() const noexcept {
+			return m_threads.size();
+		}
+
+		/**
+		 Returns the number of queued (i.e. not yet started) tasks of this
+		 thread pool.
+
+		 @return		The number of queued tasks of this thread pool.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfQueuedTasks() const noexcept;
+
+		/**
+		 Enqueues the given task.
+
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		action
+						A forwarding reference to the action to execute on one
+						of the worker threads.
+		 @return		The future of the result of the given action. Exceptions
+						thrown by the given action are stored in the future.
+		 */
+		template< typename ActionT >
+		[[nodiscard]]
+		std::future< std::invoke_result_t< std::decay_t< ActionT > > >
+			Enqueue(ActionT&& action);
+
+		/**
+		 Executes all queued tasks and joins the worker threads of this thread
+		 pool (as if this thread pool is destructed). No tasks may be enqueued
+		 afterwards, except by the queued tasks themselves.
+		 */
+		void Join();
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Executes the tasks of this thread pool until this thread pool is
+		 destructed and no queued tasks remain.
+		 */
+		void Work();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The queued tasks of this thread pool.
+		 */
+		std::deque< std::function< void() > > m_tasks;
+
+		/**
+		 The mutex for accessing the queued tasks of this thread pool.
+		 */
+		mutable std::mutex m_mutex;
+
+		/**
+		 The condition variable for signaling queued tasks or termination to
+		 the worker threads of this thread pool.
+		 */
+		std::condition_variable m_condition;
+
+		/**
+		 A flag indicating whether the worker threads of this thread pool
+		 need to terminate once all queued tasks are executed.
+		 */
+		bool m_terminate;
+
+		/**
+		 The worker threads of this thread pool.
+		 */
+		std::vector< std::thread > m_threads;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel/thread_pool.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename ActionT >
+	[[nodiscard]]
+	std::future< std::invoke_result_t< std::decay_t< ActionT > > >
+		ThreadPool::Enqueue(ActionT&& action) {
+
+		using result_type = std::invoke_result_t< std::decay_t< ActionT > >;
+
+		// std::function requires copy constructible targets.
+		auto task = MakeShared< std::packaged_task< result_type() > >(
+			std::forward< ActionT >(action));
+		auto future = task->get_future();
+
+		{
+			const std::scoped_lock lock(m_mutex);
+			m_tasks.emplace_back([task]() {
+				(*task)();
+			});
+		}
+
+		m_condition.notify_one();
+
+		return future;
+	}
+}
\ No newline at end of file
@@ -6,10 +6,12 @@
 #pragma region
 
 // Scalar types.
-#include "type\scalar_types.hpp"
+#include "type/scalar_types.hpp"
 
 #pragma endregion
 
+#ifdef _WIN32
+
 //-----------------------------------------------------------------------------
 // System Defines
 //-----------------------------------------------------------------------------
@@ -122,4 +124,20 @@ namespace mage {
 
 	static_assert(is_equivalent_integral_v< std::size_t, SIZE_T >,
 				  "MAGE/Windows type mismatch");
-}
\ No newline at end of file
+}
+
+#else
+
+//-----------------------------------------------------------------------------
+// System Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+// The maximum path length used for (path) buffers.
+#ifndef MAX_PATH
+#define MAX_PATH 260
+#endif
+
+#pragma endregion
+
+#endif
\ No newline at end of file
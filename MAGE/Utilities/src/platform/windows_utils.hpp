@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -71,6 +71,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "platform\windows_utils.tpp"
+#include "platform/windows_utils.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -0,0 +1,32 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/resource_callbacks.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	std::size_t ResourceCallbacks::Update() {
+		// Actions may register new actions.
+		decltype(m_callbacks) callbacks;
+		callbacks.swap(m_callbacks);
+
+		std::size_t nb_performed = 0u;
+		for (auto& callback : callbacks) {
+			if (callback()) {
+				++nb_performed;
+			}
+			else {
+				m_callbacks.push_back(std::move(callback));
+			}
+		}
+
+		return nb_performed;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/resource_handle.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of resource callbacks (i.e. collections of actions to perform on
+	 asynchronously loaded resources, once these are loaded).
+
+	 Resource callbacks are not thread-safe: actions are registered and
+	 performed on the same thread.
+	 */
+	class ResourceCallbacks {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs resource callbacks.
+		 */
+		ResourceCallbacks() = default;
+
+		/**
+		 Constructs resource callbacks from the given resource callbacks.
+
+		 @param[in]		callbacks
+						A reference to the resource callbacks to copy.
+		 */
+		ResourceCallbacks(const ResourceCallbacks& callbacks) = delete;
+
+		/**
+		 Constructs resource callbacks by moving the given resource callbacks.
+
+		 @param[in]		callbacks
+						A reference to the resource callbacks to move.
+		 */
+		ResourceCallbacks(ResourceCallbacks&& callbacks) noexcept = default;
+
+		/**
+		 Destructs these resource callbacks.
+		 */
+		~ResourceCallbacks() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given resource callbacks to these resource callbacks.
+
+		 @param[in]		callbacks
+						A reference to the resource callbacks to copy.
+		 @return		A reference to the copy of the given resource callbacks
+						(i.e. these resource callbacks).
+		 */
+		ResourceCallbacks& operator=(const ResourceCallbacks& callbacks) = delete;
+
+		/**
+		 Moves the given resource callbacks to these resource callbacks.
+
+		 @param[in]		callbacks
+						A reference to the resource callbacks to move.
+		 @return		A reference to the moved resource callbacks (i.e. these
+						resource callbacks).
+		 */
+		ResourceCallbacks& operator=(ResourceCallbacks&& callbacks) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of pending actions of these resource callbacks.
+
+		 @return		The number of pending actions of these resource
+						callbacks.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_callbacks.size();
+		}
+
+		/**
+		 Registers the given action to be performed on the resource of the
+		 given handle, once it is loaded. If the resource fails to load, the
+		 action is not performed.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		handle
+						A reference to the handle to the resource.
+		 @param[in]		action
+						A forwarding reference to the action to perform. The
+						action must accept a pointer to the resource.
+		 */
+		template< typename ResourceT, typename ActionT >
+		void OnLoaded(const ResourceHandle< ResourceT >& handle,
+					  ActionT&& action);
+
+		/**
+		 Performs the actions of all loaded resources of these resource
+		 callbacks, in order of registration. Actions may register new
+		 actions, which are performed on the next update at the earliest.
+
+		 @return		The number of performed (or discarded) actions.
+		 */
+		std::size_t Update();
+
+		/**
+		 Discards all pending actions of these resource callbacks. The loads
+		 themselves are not cancelled.
+		 */
+		void clear() noexcept {
+			m_callbacks.clear();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The pending actions of these resource callbacks. Each action returns
+		 @c true if it is performed (or discarded) and @c false if its load is
+		 still in-flight.
+		 */
+		std::vector< std::function< bool() > > m_callbacks;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/resource_callbacks.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename ResourceT, typename ActionT >
+	void ResourceCallbacks::OnLoaded(const ResourceHandle< ResourceT >& handle,
+									 ActionT&& action) {
+
+		m_callbacks.emplace_back(
+			[future = handle.GetFuture(),
+			 action = std::forward< ActionT >(action)]() mutable {
+
+			if (std::future_status::ready
+				!= future.wait_for(std::chrono::seconds::zero())) {
+				return false;
+			}
+
+			SharedPtr< ResourceT > resource;
+			try {
+				resource = future.get();
+			}
+			catch (const std::exception& e) {
+				MAGE_ERROR("Asynchronous resource load failed: {}", e.what());
+				return true;
+			}
+
+			action(std::move(resource));
+			return true;
+		});
+	}
+}
\ No newline at end of file
@@ -0,0 +1,229 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <future>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of resource handles (i.e. handles to resources which are
+	 possibly still being loaded asynchronously).
+
+	 @tparam		ResourceT
+					The resource type.
+	 */
+	template< typename ResourceT >
+	class ResourceHandle {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The value type of resource handles.
+		 */
+		using value_type = ResourceT;
+
+		/**
+		 The future type of resource handles.
+		 */
+		using future_type = std::shared_future< SharedPtr< ResourceT > >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a resource handle.
+
+		 @param[in]		future
+						The future of the resource.
+		 @param[in]		placeholder
+						A pointer to the placeholder resource which is used
+						until the resource is loaded.
+		 */
+		explicit ResourceHandle(future_type future = {},
+								SharedPtr< ResourceT > placeholder = nullptr)
+			: m_future(std::move(future)),
+			m_placeholder(std::move(placeholder)) {}
+
+		/**
+		 Constructs a resource handle from the given resource handle.
+
+		 @param[in]		handle
+						A reference to the resource handle to copy.
+		 */
+		ResourceHandle(const ResourceHandle& handle) = default;
+
+		/**
+		 Constructs a resource handle by moving the given resource handle.
+
+		 @param[in]		handle
+						A reference to the resource handle to move.
+		 */
+		ResourceHandle(ResourceHandle&& handle) noexcept = default;
+
+		/**
+		 Destructs this resource handle.
+		 */
+		~ResourceHandle() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given resource handle to this resource handle.
+
+		 @param[in]		handle
+						A reference to the resource handle to copy.
+		 @return		A reference to the copy of the given resource handle
+						(i.e. this resource handle).
+		 */
+		ResourceHandle& operator=(const ResourceHandle& handle) = default;
+
+		/**
+		 Moves the given resource handle to this resource handle.
+
+		 @param[in]		handle
+						A reference to the resource handle to move.
+		 @return		A reference to the moved resource handle (i.e. this
+						resource handle).
+		 */
+		ResourceHandle& operator=(ResourceHandle&& handle) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this resource handle refers to a (possibly still
+		 loading) resource.
+
+		 @return		@c true if this resource handle refers to a resource.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsValid() const noexcept {
+			return m_future.valid();
+		}
+
+		/**
+		 Checks whether the loading of the resource of this resource handle
+		 is finished (successfully or not).
+
+		 @return		@c true if the loading of the resource of this resource
+						handle is finished. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsReady() const {
+			return m_future.valid()
+				&& std::future_status::ready
+				   == m_future.wait_for(std::chrono::seconds::zero());
+		}
+
+		/**
+		 Returns the resource of this resource handle, or the placeholder
+		 resource of this resource handle if the resource is not loaded (yet).
+		 This member method never blocks.
+
+		 @return		A pointer to the resource or placeholder resource of
+						this resource handle.
+		 */
+		[[nodiscard]]
+		SharedPtr< ResourceT > Get() const {
+			if (!IsReady()) {
+				return m_placeholder;
+			}
+
+			try {
+				return m_future.get();
+			}
+			catch (...) {
+				return m_placeholder;
+			}
+		}
+
+		/**
+		 Waits for the loading of the resource of this resource handle to
+		 finish, and returns the resource.
+
+		 @pre			This resource handle is valid.
+		 @return		A pointer to the resource of this resource handle.
+		 @throws		Exception
+						Failed to load the resource.
+		 */
+		SharedPtr< ResourceT > Wait() const {
+			return m_future.get();
+		}
+
+		/**
+		 Returns the future of the resource of this resource handle.
+
+		 @return		A reference to the future of the resource of this
+						resource handle.
+		 */
+		[[nodiscard]]
+		const future_type& GetFuture() const noexcept {
+			return m_future;
+		}
+
+		/**
+		 Returns the placeholder resource of this resource handle.
+
+		 @return		A pointer to the placeholder resource of this resource
+						handle.
+		 */
+		[[nodiscard]]
+		const SharedPtr< ResourceT >& GetPlaceholder() const noexcept {
+			return m_placeholder;
+		}
+
+		/**
+		 Sets the placeholder resource of this resource handle to the given
+		 resource.
+
+		 @param[in]		placeholder
+						A pointer to the placeholder resource.
+		 */
+		void SetPlaceholder(SharedPtr< ResourceT > placeholder) noexcept {
+			m_placeholder = std::move(placeholder);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The future of the resource of this resource handle.
+		 */
+		future_type m_future;
+
+		/**
+		 A pointer to the placeholder resource of this resource handle.
+		 */
+		SharedPtr< ResourceT > m_placeholder;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/resource_handle.hpp"
+#include "parallel/thread_pool.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <map>
+#include <mutex>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of resource loaders (i.e. collections of in-flight asynchronous
+	 resource loads).
+
+	 Concurrent requests for the same key share a single in-flight load.
+
+	 @tparam		KeyT
+					The key type.
+	 @tparam		ResourceT
+					The resource type.
+	 */
+	template< typename KeyT, typename ResourceT >
+	class ResourceLoader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The key type of resource loaders.
+		 */
+		using key_type = KeyT;
+
+		/**
+		 The value type of resource loaders.
+		 */
+		using value_type = ResourceT;
+
+		/**
+		 The handle type of resource loaders.
+		 */
+		using handle_type = ResourceHandle< ResourceT >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a resource loader.
+		 */
+		ResourceLoader() = default;
+
+		/**
+		 Constructs a resource loader from the given resource loader.
+
+		 @param[in]		loader
+						A reference to the resource loader to copy.
+		 */
+		ResourceLoader(const ResourceLoader& loader) = delete;
+
+		/**
+		 Constructs a resource loader by moving the given resource loader.
+
+		 @param[in]		loader
+						A reference to the resource loader to move.
+		 */
+		ResourceLoader(ResourceLoader&& loader) = delete;
+
+		/**
+		 Destructs this resource loader.
+		 */
+		~ResourceLoader() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given resource loader to this resource loader.
+
+		 @param[in]		loader
+						A reference to the resource loader to copy.
+		 @return		A reference to the copy of the given resource loader
+						(i.e. this resource loader).
+		 */
+		ResourceLoader& operator=(const ResourceLoader& loader) = delete;
+
+		/**
+		 Moves the given resource loader to this resource loader.
+
+		 @param[in]		loader
+						A reference to the resource loader to move.
+		 @return		A reference to the moved resource loader (i.e. this
+						resource loader).
+		 */
+		ResourceLoader& operator=(ResourceLoader&& loader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of in-flight (or completed, but not yet removed)
+		 loads of this resource loader.
+
+		 @return		The number of in-flight loads of this resource loader.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept;
+
+		/**
+		 Returns a handle to the in-flight load corresponding to the given key
+		 of this resource loader.
+
+		 If no load is in-flight corresponding to the given key, a new load is
+		 enqueued on the given thread pool.
+
+		 @tparam		ActionT
+						The action type.
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @param[in,out]	thread_pool
+						A reference to the thread pool.
+		 @param[in]		action
+						A forwarding reference to the action which loads and
+						returns a pointer to the resource.
+		 @return		A handle to the resource corresponding to the given
+						key.
+		 */
+		template< typename ActionT >
+		[[nodiscard]]
+		handle_type GetOrLoad(const KeyT& key,
+							  ThreadPool& thread_pool,
+							  ActionT&& action);
+
+		/**
+		 Removes all completed loads from this resource loader.
+
+		 @return		The number of removed loads.
+		 */
+		std::size_t RemoveCompleted();
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A load map used by a resource loader.
+		 */
+		using LoadMap = std::map< KeyT, typename handle_type::future_type >;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The load map of this resource loader.
+		 */
+		LoadMap m_load_map;
+
+		/**
+		 The mutex for accessing the load map of this resource loader.
+		 */
+		mutable std::mutex m_mutex;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/resource_loader.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename KeyT, typename ResourceT >
+	[[nodiscard]]
+	inline std::size_t ResourceLoader< KeyT, ResourceT >::size() const noexcept {
+		const std::scoped_lock lock(m_mutex);
+
+		using std::size;
+		return size(m_load_map);
+	}
+
+	template< typename KeyT, typename ResourceT >
+	template< typename ActionT >
+	[[nodiscard]]
+	typename ResourceLoader< KeyT, ResourceT >::handle_type
+		ResourceLoader< KeyT, ResourceT >::GetOrLoad(const KeyT& key,
+													 ThreadPool& thread_pool,
+													 ActionT&& action) {
+
+		const std::scoped_lock lock(m_mutex);
+
+		if (const auto it = m_load_map.find(key);
+			it != m_load_map.end()) {
+
+			return handle_type(it->second);
+		}
+
+		auto future = thread_pool.Enqueue(std::forward< ActionT >(action)).share();
+		m_load_map.emplace(key, future);
+
+		return handle_type(std::move(future));
+	}
+
+	template< typename KeyT, typename ResourceT >
+	std::size_t ResourceLoader< KeyT, ResourceT >::RemoveCompleted() {
+		const std::scoped_lock lock(m_mutex);
+
+		std::size_t nb_removed = 0u;
+		for (auto it = m_load_map.begin(); it != m_load_map.end();) {
+			if (std::future_status::ready
+				== it->second.wait_for(std::chrono::seconds::zero())) {
+
+				it = m_load_map.erase(it);
+				++nb_removed;
+			}
+			else {
+				++it;
+			}
+		}
+
+		return nb_removed;
+	}
+}
\ No newline at end of file
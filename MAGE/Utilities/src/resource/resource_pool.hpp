@@ -5,7 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
+#include "type/atomic_types.hpp"
+#include "system/telemetry.hpp"
 
 #pragma endregion
 
@@ -14,8 +16,14 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <future>
 #include <map>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #pragma endregion
 
@@ -24,6 +32,78 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	//-------------------------------------------------------------------------
+	// ResourcePoolStatistics
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of resource pool statistics.
+	 */
+	struct ResourcePoolStatistics {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the hit rate (i.e. the fraction of requests which are served
+		 by an existing resource).
+
+		 @return		The hit rate.
+		 */
+		[[nodiscard]]
+		F32 GetHitRate() const noexcept {
+			const auto nb_requests = m_nb_hits + m_nb_misses;
+			return (0u == nb_requests)
+				? 0.0f : static_cast< F32 >(m_nb_hits) / nb_requests;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of resources.
+		 */
+		std::size_t m_nb_resources = 0u;
+
+		/**
+		 The number of resources which are only referenced by the resource
+		 pool (i.e. the recently used resources which are kept warm).
+		 */
+		std::size_t m_nb_unreferenced_resources = 0u;
+
+		/**
+		 The memory usage (in bytes) of all resources.
+		 */
+		std::size_t m_memory_usage = 0u;
+
+		/**
+		 The peak memory usage (in bytes) of all resources.
+		 */
+		std::size_t m_peak_memory_usage = 0u;
+
+		/**
+		 The memory budget (in bytes).
+		 */
+		std::size_t m_memory_budget = 0u;
+
+		/**
+		 The number of requests which are served by an existing resource.
+		 */
+		U64 m_nb_hits = 0u;
+
+		/**
+		 The number of requests which resulted in the creation of a resource.
+		 */
+		U64 m_nb_misses = 0u;
+	};
+
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// ResourcePool
 	//-------------------------------------------------------------------------
@@ -32,6 +112,20 @@ namespace mage {
 	/**
 	 A class of resource pools.
 
+	 The resources are distributed over a fixed number of independently
+	 locked shards based on the hash of their keys. Resources are constructed
+	 without holding any lock: concurrent requests for the same key wait for
+	 the in-flight construction of that key only.
+
+	 Resources which are no longer referenced outside the resource pool are
+	 kept warm until the memory budget of the resource pool is exceeded, at
+	 which point they are evicted in least recently used order. The memory
+	 usage of a resource is obtained from its @c GetMemoryUsage member method
+	 (if present) or its size otherwise. Since it may change over the lifetime
+	 of the resource (e.g., streamed textures), it is queried again on
+	 @c UpdateMemoryUsage and whenever a trim finds the memory budget
+	 exceeded.
+
 	 @tparam		KeyT
 					The key type.
 	 @tparam		ResourceT
@@ -62,8 +156,14 @@ namespace mage {
 
 		/**
 		 Constructs a resource pool.
+
+		 @param[in]		memory_budget
+						The memory budget (in bytes). Unreferenced resources
+						are evicted while the memory usage exceeds the memory
+						budget. If @a memory_budget is equal to 0, unreferenced
+						resources are not kept warm.
 		 */
-		ResourcePool() = default;
+		explicit ResourcePool(std::size_t memory_budget = 0u) noexcept;
 
 		/**
 		 Constructs a resource pool from the given resource pool.
@@ -142,7 +242,7 @@ namespace mage {
 						otherwise.
 		 */
 		[[nodiscard]]
-		bool Contains(const KeyT& key) noexcept;
+		bool Contains(const KeyT& key) const noexcept;
 
 		/**
 		 Returns the resource corresponding to the given key from this
@@ -154,6 +254,8 @@ namespace mage {
 						resource pool corresponding to the given key.
 		 @return		A pointer to the resource corresponding to the given key
 						from this resource pool.
+		 @note			Resources which are still being constructed are not
+						returned (i.e. this member method never blocks).
 		 */
 		[[nodiscard]]
 		SharedPtr< ResourceT > Get(const KeyT& key) noexcept;
@@ -187,7 +289,9 @@ namespace mage {
 
 		 If no resource is contained in this resource pool corresponding to the
 		 given key, a new resource is created from the given arguments, added
-		 to this resource pool and returned.
+		 to this resource pool and returned. If the resource corresponding to
+		 the given key is being created by another thread, this member method
+		 waits for and returns that resource instead.
 
 		 @pre			@c DerivedResourceT is a derived class of @c ResourceT.
 		 @tparam		DerivedResourceT
@@ -202,6 +306,9 @@ namespace mage {
 						new resource of type @c DerivedResourceT.
 		 @return		A pointer to the resource corresponding to the given
 						key from this resource pool.
+		 @throws		Exception
+						Failed to create the resource (in this or the other
+						thread).
 		 */
 		template< typename DerivedResourceT, typename... ConstructorArgsT >
 		SharedPtr< ResourceT > GetOrCreateDerived(const KeyT& key,
@@ -209,7 +316,7 @@ namespace mage {
 
 		/**
 		 Removes the resource corresponding to the given key from this resource
-		 pool.
+		 pool, if it is no longer referenced outside this resource pool.
 
 		 @param[in]		key
 						A reference to the key of the resource to remove.
@@ -217,135 +324,280 @@ namespace mage {
 		void Remove(const KeyT& key);
 
 		/**
-		 Removes all resources from this resource pool.
+		 Removes all resources from this resource pool. Resources which are
+		 still referenced outside this resource pool remain alive, but are no
+		 longer accounted for.
 		 */
 		void RemoveAll() noexcept;
 
-	private:
+		/**
+		 Evicts the least recently used unreferenced resources from this
+		 resource pool until the memory usage of this resource pool does not
+		 exceed the memory budget of this resource pool (or until no
+		 unreferenced resources remain).
 
-		//---------------------------------------------------------------------
-		// Class Member Types
-		//---------------------------------------------------------------------
+		 If the accounted memory usage does not exceed the memory budget, this
+		 returns immediately. Changes of the memory usage of resources after
+		 their construction are only accounted for by @c UpdateMemoryUsage
+		 or by a trim which finds the memory budget exceeded.
+
+		 @return		The number of evicted resources.
+		 */
+		std::size_t Trim();
 
 		/**
-		 A resource map used by a resource pool.
+		 Updates the memory usage of this resource pool to the current memory
+		 usage of all its resources. This visits all resources, and is
+		 intended to be called once per update by the owner of this resource
+		 pool (e.g., for streamed textures).
 		 */
-		using ResourceMap = std::map< KeyT, WeakPtr< ResourceT > >;
+		void UpdateMemoryUsage() noexcept;
 
-		//---------------------------------------------------------------------
-		// Member Variables
-		//---------------------------------------------------------------------
+		/**
+		 Returns the memory budget of this resource pool.
+
+		 @return		The memory budget (in bytes) of this resource pool.
+		 */
+		[[nodiscard]]
+		std::size_t GetMemoryBudget() const noexcept {
+			return m_memory_budget.load(std::memory_order_relaxed);
+		}
 
 		/**
-		 The resource map of this resource pool.
+		 Sets the memory budget of this resource pool to the given budget.
+
+		 @param[in]		memory_budget
+						The memory budget (in bytes). Unreferenced resources
+						are evicted while the memory usage exceeds the memory
+						budget. If @a memory_budget is equal to 0, unreferenced
+						resources are not kept warm.
 		 */
-		ResourceMap m_resource_map;
+		void SetMemoryBudget(std::size_t memory_budget) noexcept {
+			m_memory_budget.store(memory_budget, std::memory_order_relaxed);
+		}
 
 		/**
-		 The mutex for accessing the resource map of this resource pool.
+		 Returns the statistics of this resource pool.
+
+		 @return		The statistics of this resource pool.
 		 */
-		mutable std::mutex m_mutex;
+		[[nodiscard]]
+		const ResourcePoolStatistics GetStatistics() const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
 
 		/**
-		 A class of resources.
+		 A latch used by a resource pool for signaling the completion of
+		 the construction of a resource.
+		 */
+		using Latch = std::shared_future< SharedPtr< ResourceT > >;
 
-		 @pre			@c DerivedResourceT is a derived class of @c ResourceT.
-		 @tparam		DerivedResourceT
-						The derived resource type.
+		/**
+		 A struct of resource entries used by a resource pool.
 		 */
-		template< typename DerivedResourceT >
-		class Resource : public DerivedResourceT {
+		struct Entry {
 
 		public:
 
-			static_assert(std::is_base_of_v< ResourceT, DerivedResourceT >);
-
 			//-----------------------------------------------------------------
-			// Constructors and Destructors
+			// Member Methods
 			//-----------------------------------------------------------------
 
 			/**
-			 Constructs a resource.
-
-			 @tparam		ConstructorArgsT
-							The constructor argument types for creating a new
-							resource.
-			 @param[in,out]	resource_pool
-							A reference to the resource pool.
-			 @param[in]		resource_key
-							A reference to the key of the resource in the
-							given resource pool.
-			 @param[in]		args
-							A forwarding reference to the arguments for creating a
-							new resource of type @c DerivedResourceT.
+			 Checks whether the resource of this entry is only referenced by
+			 the resource pool.
+
+			 @return		@c true if the resource of this entry is only
+							referenced by the resource pool. @c false
+							otherwise.
 			 */
-			template< typename... ConstructorArgsT >
-			Resource(ResourcePool& resource_pool,
-				     const KeyT& resource_key,
-				     ConstructorArgsT&&... args);
+			[[nodiscard]]
+			bool IsUnreferenced() const noexcept {
+				return !m_latch.valid() && 1 == m_resource.use_count();
+			}
 
-			/**
-			 Constructs a resource from the given resource.
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
 
-			 @param[in]		resource
-							A reference to the resource to copy.
+			/**
+			 A pointer to the resource of this entry.
 			 */
-			Resource(const Resource& resource) = delete;
+			SharedPtr< ResourceT > m_resource;
 
 			/**
-			 Constructs a resource by moving the given resource poolentry .
-
-			 @param[in]		resource
-							A reference to the resource to move.
+			 The latch of this entry. The latch is only valid while the
+			 resource of this entry is being constructed.
 			 */
-			Resource(Resource&& resource);
+			Latch m_latch;
 
 			/**
-			 Destructs this resource.
+			 The memory usage (in bytes) of the resource of this entry.
 			 */
-			virtual ~Resource();
-
-			//-----------------------------------------------------------------
-			// Assignment Operators
-			//-----------------------------------------------------------------
+			std::size_t m_memory_usage = 0u;
 
 			/**
-			 Copies the given resource to this resource.
-
-			 @param[in]		resource
-							A reference to the resource to copy.
-			 @return		A reference to the copy of the given resource (i.e.
-							this resource).
+			 The time stamp of the last use of the resource of this entry.
 			 */
-			Resource& operator=(const Resource& resource) = delete;
+			U64 m_last_use = 0u;
+		};
 
-			/**
-			 Moves the given resource to this resource.
+		/**
+		 A resource map used by a resource pool.
+		 */
+		using ResourceMap = std::unordered_map< KeyT, Entry >;
 
-			 @param[in]		resource
-							A reference to the resource to move.
-			 @return		A reference to the moved resource (i.e. this
-							resource).
-			 */
-			Resource& operator=(Resource&& resource) = delete;
+		/**
+		 A struct of shards used by a resource pool.
+		 */
+		struct Shard {
 
-		private:
+		public:
 
 			//-----------------------------------------------------------------
 			// Member Variables
 			//-----------------------------------------------------------------
 
 			/**
-			 A reference to the resource pool map containing this resource.
+			 The resource map of this shard.
 			 */
-			ResourcePool& m_resource_pool;
+			ResourceMap m_resource_map;
 
 			/**
-			 The key of this resource in the resource pool map containing
-			 this resource.
+			 The mutex for accessing the resource map of this shard.
 			 */
-			KeyT m_resource_key;
+			mutable std::mutex m_mutex;
 		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of shards of resource pools.
+		 */
+		static constexpr std::size_t s_nb_shards = 16u;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the shard containing the resource corresponding to the given
+		 key of this resource pool.
+
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @return		A reference to the shard containing the resource
+						corresponding to the given key of this resource pool.
+		 */
+		[[nodiscard]]
+		Shard& GetShard(const KeyT& key) noexcept {
+			return m_shards[std::hash< KeyT >()(key) % s_nb_shards];
+		}
+
+		/**
+		 Returns the shard containing the resource corresponding to the given
+		 key of this resource pool.
+
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @return		A reference to the shard containing the resource
+						corresponding to the given key of this resource pool.
+		 */
+		[[nodiscard]]
+		const Shard& GetShard(const KeyT& key) const noexcept {
+			return m_shards[std::hash< KeyT >()(key) % s_nb_shards];
+		}
+
+		/**
+		 Adds the given memory usage to the memory usage of this resource
+		 pool.
+
+		 @param[in]		memory_usage
+						The memory usage (in bytes) to add.
+		 */
+		void AddMemoryUsage(std::size_t memory_usage) noexcept;
+
+		/**
+		 Subtracts the given memory usage from the memory usage of this
+		 resource pool.
+
+		 @param[in]		memory_usage
+						The memory usage (in bytes) to subtract.
+		 */
+		void SubtractMemoryUsage(std::size_t memory_usage) noexcept {
+			m_memory_usage.fetch_sub(memory_usage, std::memory_order_relaxed);
+		}
+
+		/**
+		 Updates the memory usage of the given entry and of this resource pool
+		 to the current memory usage of the resource of the given entry.
+
+		 @pre			The mutex of the shard containing the given entry is
+						locked.
+		 @pre			The resource of the given entry is constructed.
+		 @param[in,out]	entry
+						A reference to the entry.
+		 */
+		void UpdateMemoryUsage(Entry& entry) noexcept;
+
+		/**
+		 Returns a new time stamp for the use of a resource of this resource
+		 pool.
+
+		 @return		A new time stamp for the use of a resource of this
+						resource pool.
+		 */
+		[[nodiscard]]
+		U64 Tick() noexcept {
+			return m_clock.fetch_add(1u, std::memory_order_relaxed);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The shards of this resource pool.
+		 */
+		std::array< Shard, s_nb_shards > m_shards;
+
+		/**
+		 The memory budget (in bytes) of this resource pool.
+		 */
+		std::atomic< std::size_t > m_memory_budget;
+
+		/**
+		 The memory usage (in bytes) of this resource pool.
+		 */
+		std::atomic< std::size_t > m_memory_usage;
+
+		/**
+		 The peak memory usage (in bytes) of this resource pool.
+		 */
+		std::atomic< std::size_t > m_peak_memory_usage;
+
+		/**
+		 The clock for time stamping resource uses of this resource pool.
+		 */
+		AtomicU64 m_clock;
+
+		/**
+		 The number of requests of this resource pool which are served by an
+		 existing resource.
+		 */
+		AtomicU64 m_nb_hits;
+
+		/**
+		 The number of requests of this resource pool which resulted in the
+		 creation of a resource.
+		 */
+		AtomicU64 m_nb_misses;
 	};
 
 	#pragma endregion
@@ -358,6 +610,10 @@ namespace mage {
 	/**
 	 A class of persistent resource pools.
 
+	 Resources are constructed without holding the lock of the persistent
+	 resource pool: concurrent requests for the same key wait for the
+	 in-flight construction of that key only.
+
 	 @tparam		KeyT
 					The key type.
 	 @tparam		ResourceT
@@ -488,6 +744,8 @@ namespace mage {
 						key.
 		 @return		A pointer to the resource corresponding to
 						the given key from this persistent resource pool.
+		 @note			Resources which are still being constructed are not
+						returned (i.e. this member method never blocks).
 		 */
 		[[nodiscard]]
 		SharedPtr< ResourceT > Get(const KeyT& key) noexcept;
@@ -541,6 +799,14 @@ namespace mage {
 		SharedPtr< ResourceT > GetOrCreateDerived(const KeyT& key,
 			                                      ConstructorArgsT&&... args);
 
+		/**
+		 Returns the statistics of this persistent resource pool.
+
+		 @return		The statistics of this persistent resource pool.
+		 */
+		[[nodiscard]]
+		const ResourcePoolStatistics GetStatistics() const noexcept;
+
 		/**
 		 Removes the resource corresponding to the given key from this
 		 persistent resource pool.
@@ -561,10 +827,45 @@ namespace mage {
 		// Class Member Types
 		//---------------------------------------------------------------------
 
+		/**
+		 A latch used by a persistent resource pool for signaling the
+		 completion of the construction of a resource.
+		 */
+		using Latch = std::shared_future< SharedPtr< ResourceT > >;
+
+		/**
+		 A struct of resource entries used by a persistent resource pool.
+		 */
+		struct Entry {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 A pointer to the resource of this entry.
+			 */
+			SharedPtr< ResourceT > m_resource;
+
+			/**
+			 The latch of this entry. The latch is only valid while the
+			 resource of this entry is being constructed.
+			 */
+			Latch m_latch;
+
+			/**
+			 The memory usage (in bytes) of the resource of this entry, as
+			 accounted for in the statistics of the persistent resource pool.
+			 */
+			std::size_t m_memory_usage = 0u;
+		};
+
 		/**
 		 A resource map used by a persistent resource pool.
 		 */
-		using ResourceMap = std::map< KeyT, SharedPtr< ResourceT > >;
+		using ResourceMap = std::map< KeyT, Entry >;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -580,6 +881,11 @@ namespace mage {
 		 pool.
 		 */
 		mutable std::mutex m_mutex;
+
+		/**
+		 The statistics of this persistent resource pool.
+		 */
+		ResourcePoolStatistics m_statistics;
 	};
 
 	#pragma endregion
@@ -590,6 +896,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\resource_pool.tpp"
+#include "resource/resource_pool.tpp"
 
 #pragma endregion
\ No newline at end of file
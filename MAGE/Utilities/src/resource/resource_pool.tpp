@@ -6,55 +6,132 @@
 namespace mage {
 
 	//-------------------------------------------------------------------------
-	// ResourcePool
+	// Utilities
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	template< typename KeyT, typename ResourceT >
-	ResourcePool< KeyT, ResourceT >::ResourcePool(ResourcePool&& pool) noexcept
-		: m_mutex() {
+	namespace details {
 
-		const std::scoped_lock lock(pool.m_mutex);
+		/**
+		 Returns the telemetry counter of the resources loaded by resource
+		 pools.
 
-		m_resource_map = std::move(pool.m_resource_map);
+		 @return		A reference to the telemetry counter of the resources
+						loaded by resource pools.
+		 */
+		[[nodiscard]]
+		inline TelemetryCounter& GetResourceLoadCounter() {
+			static auto& s_counter = Telemetry::Get().GetCounter("Resource loads");
+			return s_counter;
+		}
+
+		/**
+		 Checks whether the given resource type has a @c GetMemoryUsage member
+		 method.
+
+		 @tparam		ResourceT
+						The resource type.
+		 */
+		template< typename ResourceT, typename = void >
+		struct has_memory_usage : std::false_type {};
+
+		/**
+		 Checks whether the given resource type has a @c GetMemoryUsage member
+		 method.
+
+		 @tparam		ResourceT
+						The resource type.
+		 */
+		template< typename ResourceT >
+		struct has_memory_usage< ResourceT,
+			std::void_t< decltype(std::declval< const ResourceT& >().GetMemoryUsage()) > >
+			: std::true_type {};
+
+		/**
+		 Returns the memory usage of the given resource.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @param[in]		resource
+						A reference to the resource.
+		 @return		The memory usage (in bytes) of the given resource.
+		 */
+		template< typename ResourceT >
+		[[nodiscard]]
+		inline std::size_t GetMemoryUsage(const ResourceT& resource) noexcept {
+			if constexpr (has_memory_usage< ResourceT >::value) {
+				return resource.GetMemoryUsage();
+			}
+			else {
+				return sizeof(ResourceT);
+			}
+		}
 	}
 
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ResourcePool
+	//-------------------------------------------------------------------------
+	#pragma region
+
 	template< typename KeyT, typename ResourceT >
-	[[nodiscard]]
-	inline bool ResourcePool< KeyT, ResourceT >::empty() const noexcept {
-		const std::scoped_lock lock(m_mutex);
+	ResourcePool< KeyT, ResourceT >::ResourcePool(std::size_t memory_budget) noexcept
+		: m_shards(),
+		m_memory_budget(memory_budget),
+		m_memory_usage(0u),
+		m_peak_memory_usage(0u),
+		m_clock(0u),
+		m_nb_hits(0u),
+		m_nb_misses(0u) {}
 
-		using std::empty;
-		return empty(m_resource_map);
+	template< typename KeyT, typename ResourceT >
+	ResourcePool< KeyT, ResourceT >::ResourcePool(ResourcePool&& pool) noexcept
+		: m_shards(),
+		m_memory_budget(pool.m_memory_budget.load()),
+		m_memory_usage(pool.m_memory_usage.load()),
+		m_peak_memory_usage(pool.m_peak_memory_usage.load()),
+		m_clock(pool.m_clock.load()),
+		m_nb_hits(pool.m_nb_hits.load()),
+		m_nb_misses(pool.m_nb_misses.load()) {
+
+		for (std::size_t i = 0u; i < s_nb_shards; ++i) {
+			const std::scoped_lock lock(pool.m_shards[i].m_mutex);
+
+			m_shards[i].m_resource_map
+				= std::move(pool.m_shards[i].m_resource_map);
+		}
 	}
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
-	inline std::size_t ResourcePool< KeyT, ResourceT >::size() const noexcept {
-		const std::scoped_lock lock(m_mutex);
-
-		using std::size;
-		return size(m_resource_map);
+	inline bool ResourcePool< KeyT, ResourceT >::empty() const noexcept {
+		return 0u == size();
 	}
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
-	bool ResourcePool< KeyT, ResourceT >::Contains(const KeyT& key) noexcept {
-		const std::scoped_lock lock(m_mutex);
-
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+	std::size_t ResourcePool< KeyT, ResourceT >::size() const noexcept {
+		std::size_t nb_resources = 0u;
+		for (const auto& shard : m_shards) {
+			const std::scoped_lock lock(shard.m_mutex);
 
-			const auto resource = it->second.lock();
+			using std::size;
+			nb_resources += size(shard.m_resource_map);
+		}
 
-			if (resource) {
-				return true;
-			}
+		return nb_resources;
+	}
 
-			m_resource_map.erase(it);
-		}
+	template< typename KeyT, typename ResourceT >
+	[[nodiscard]]
+	bool ResourcePool< KeyT, ResourceT >::Contains(const KeyT& key) const noexcept {
+		const auto& shard = GetShard(key);
+		const std::scoped_lock lock(shard.m_mutex);
 
-		return false;
+		// Unlike Get, this does not count as a use of the resource.
+		const auto it = shard.m_resource_map.find(key);
+		return it != shard.m_resource_map.end() && !it->second.m_latch.valid();
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -62,18 +139,14 @@ namespace mage {
 	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
 		::Get(const KeyT& key) noexcept {
 
-		const std::scoped_lock lock(m_mutex);
-
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+		auto& shard = GetShard(key);
+		const std::scoped_lock lock(shard.m_mutex);
 
-			const auto resource = it->second.lock();
+		if (const auto it = shard.m_resource_map.find(key);
+			it != shard.m_resource_map.end() && !it->second.m_latch.valid()) {
 
-			if (resource) {
-				return resource;
-			}
-
-			m_resource_map.erase(it);
+			it->second.m_last_use = Tick();
+			return it->second.m_resource;
 		}
 
 		return SharedPtr< ResourceT >();
@@ -93,76 +166,268 @@ namespace mage {
 	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
 		::GetOrCreateDerived(const KeyT& key, ConstructorArgsT&&... args) {
 
-		const std::scoped_lock lock(m_mutex);
+		static_assert(std::is_base_of_v< ResourceT, DerivedResourceT >);
+
+		auto& shard = GetShard(key);
+		std::promise< SharedPtr< ResourceT > > promise;
+
+		// Insert an in-flight latch for the given key, unless the resource
+		// already exists or is being constructed.
+		{
+			std::unique_lock lock(shard.m_mutex);
+
+			auto& entry = shard.m_resource_map[key];
+
+			if (entry.m_latch.valid()) {
+				m_nb_hits.fetch_add(1u, std::memory_order_relaxed);
+
+				// Wait for the construction of the resource by another thread.
+				const auto latch = entry.m_latch;
+				lock.unlock();
+				return latch.get();
+			}
+
+			if (entry.m_resource) {
+				m_nb_hits.fetch_add(1u, std::memory_order_relaxed);
+
+				entry.m_last_use = Tick();
+				return entry.m_resource;
+			}
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+			m_nb_misses.fetch_add(1u, std::memory_order_relaxed);
+			details::GetResourceLoadCounter().Increment();
 
-			const auto resource = it->second.lock();
-			if (resource) {
-				return resource;
+			entry.m_latch = promise.get_future().share();
+		}
+
+		// Construct the resource without holding the lock.
+		SharedPtr< DerivedResourceT > new_resource;
+		try {
+			new_resource = MakeAllocatedShared< DerivedResourceT >
+				           (std::forward< ConstructorArgsT >(args)...);
+		}
+		catch (...) {
+			{
+				const std::scoped_lock lock(shard.m_mutex);
+				shard.m_resource_map.erase(key);
 			}
 
-			m_resource_map.erase(it);
+			promise.set_exception(std::current_exception());
+			throw;
+		}
+
+		const auto memory_usage = details::GetMemoryUsage(*new_resource);
+
+		// Publish the resource.
+		{
+			const std::scoped_lock lock(shard.m_mutex);
+
+			auto& entry = shard.m_resource_map[key];
+			entry.m_resource     = new_resource;
+			entry.m_latch        = Latch();
+			entry.m_memory_usage = memory_usage;
+			entry.m_last_use     = Tick();
 		}
 
-		const auto new_resource
-			= MakeAllocatedShared< Resource< DerivedResourceT > >
-			  (*this, key, std::forward< ConstructorArgsT >(args)...);
+		AddMemoryUsage(memory_usage);
+		promise.set_value(new_resource);
 
-		m_resource_map.emplace(key, new_resource);
+		// Keep the memory usage within the memory budget.
+		Trim();
 
 		return new_resource;
 	}
 
 	template< typename KeyT, typename ResourceT >
 	void ResourcePool< KeyT, ResourceT >::Remove(const KeyT& key) {
-		const std::scoped_lock lock(m_mutex);
+		auto& shard = GetShard(key);
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end() && it->second.expired()) {
+		// The resource is destructed after releasing the lock.
+		SharedPtr< ResourceT > resource;
+		{
+			const std::scoped_lock lock(shard.m_mutex);
 
-			m_resource_map.erase(it);
+			if (const auto it = shard.m_resource_map.find(key);
+				it != shard.m_resource_map.end()
+				&& it->second.IsUnreferenced()) {
+
+				UpdateMemoryUsage(it->second);
+				SubtractMemoryUsage(it->second.m_memory_usage);
+				resource = std::move(it->second.m_resource);
+				shard.m_resource_map.erase(it);
+			}
 		}
 	}
 
 	template< typename KeyT, typename ResourceT >
-	inline void ResourcePool< KeyT, ResourceT >::RemoveAll() noexcept {
-		const std::scoped_lock lock(m_mutex);
-
-		m_resource_map.clear();
+	void ResourcePool< KeyT, ResourceT >::RemoveAll() noexcept {
+		for (auto& shard : m_shards) {
+			// The resources are destructed after releasing the lock.
+			std::vector< SharedPtr< ResourceT > > resources;
+			{
+				const std::scoped_lock lock(shard.m_mutex);
+
+				// Retain the entries of resources which are being constructed.
+				for (auto it = shard.m_resource_map.begin();
+					 it != shard.m_resource_map.end();) {
+
+					if (it->second.m_latch.valid()) {
+						++it;
+					}
+					else {
+						UpdateMemoryUsage(it->second);
+						SubtractMemoryUsage(it->second.m_memory_usage);
+						resources.push_back(std::move(it->second.m_resource));
+						it = shard.m_resource_map.erase(it);
+					}
+				}
+			}
+		}
 	}
 
-	#pragma endregion
+	template< typename KeyT, typename ResourceT >
+	std::size_t ResourcePool< KeyT, ResourceT >::Trim() {
+		const auto memory_budget = GetMemoryBudget();
+		if (m_memory_usage.load(std::memory_order_relaxed) <= memory_budget) {
+			return 0u;
+		}
 
-	//-------------------------------------------------------------------------
-	// Resource
-	//-------------------------------------------------------------------------
-	#pragma region
+		// The memory usage of resources may have shrunk after their
+		// construction (e.g., streamed textures).
+		UpdateMemoryUsage();
+		if (m_memory_usage.load(std::memory_order_relaxed) <= memory_budget) {
+			return 0u;
+		}
+
+		// Collect all unreferenced resources.
+		struct Candidate {
+			U64 m_last_use;
+			std::size_t m_shard;
+			KeyT m_key;
+		};
+
+		std::vector< Candidate > candidates;
+		for (std::size_t i = 0u; i < s_nb_shards; ++i) {
+			const std::scoped_lock lock(m_shards[i].m_mutex);
+
+			for (const auto& [key, entry] : m_shards[i].m_resource_map) {
+				if (entry.IsUnreferenced()) {
+					candidates.push_back({ entry.m_last_use, i, key });
+				}
+			}
+		}
+
+		// Evict the least recently used resources first.
+		std::sort(candidates.begin(), candidates.end(),
+				  [](const Candidate& lhs, const Candidate& rhs) noexcept {
+					  return lhs.m_last_use < rhs.m_last_use;
+				  });
+
+		std::size_t nb_evicted = 0u;
+		for (const auto& candidate : candidates) {
+			if (m_memory_usage.load(std::memory_order_relaxed) <= memory_budget) {
+				break;
+			}
+
+			auto& shard = m_shards[candidate.m_shard];
+
+			// The resource is destructed after releasing the lock.
+			SharedPtr< ResourceT > resource;
+			{
+				const std::scoped_lock lock(shard.m_mutex);
+
+				// The resource may have been used in the meantime.
+				if (const auto it = shard.m_resource_map.find(candidate.m_key);
+					it != shard.m_resource_map.end()
+					&& it->second.IsUnreferenced()
+					&& it->second.m_last_use == candidate.m_last_use) {
+
+					UpdateMemoryUsage(it->second);
+					SubtractMemoryUsage(it->second.m_memory_usage);
+					resource = std::move(it->second.m_resource);
+					shard.m_resource_map.erase(it);
+					++nb_evicted;
+				}
+			}
+		}
+
+		return nb_evicted;
+	}
 
 	template< typename KeyT, typename ResourceT >
-	template< typename DerivedResourceT >
-	template< typename... ConstructorArgsT >
-	ResourcePool< KeyT, ResourceT >::Resource< DerivedResourceT >
-		::Resource(ResourcePool& resource_pool,
-			       const KeyT& resource_key,
-			       ConstructorArgsT&&... args)
-		: DerivedResourceT(std::forward< ConstructorArgsT >(args)...),
-		m_resource_pool(resource_pool),
-		m_resource_key(resource_key) {}
+	[[nodiscard]]
+	const ResourcePoolStatistics ResourcePool< KeyT, ResourceT >
+		::GetStatistics() const noexcept {
+
+		ResourcePoolStatistics statistics;
+
+		// The current memory usage of the resources is reported, which may
+		// differ from the memory usage accounted for at the last trim.
+		for (const auto& shard : m_shards) {
+			const std::scoped_lock lock(shard.m_mutex);
+
+			for (const auto& [key, entry] : shard.m_resource_map) {
+				if (entry.m_latch.valid()) {
+					continue;
+				}
+
+				++statistics.m_nb_resources;
+				statistics.m_memory_usage
+					+= details::GetMemoryUsage(*entry.m_resource);
+				if (entry.IsUnreferenced()) {
+					++statistics.m_nb_unreferenced_resources;
+				}
+			}
+		}
+
+		statistics.m_peak_memory_usage = std::max(m_peak_memory_usage.load(),
+												  statistics.m_memory_usage);
+		statistics.m_memory_budget     = m_memory_budget.load();
+		statistics.m_nb_hits           = m_nb_hits.load();
+		statistics.m_nb_misses         = m_nb_misses.load();
+
+		return statistics;
+	}
 
 	template< typename KeyT, typename ResourceT >
-	template< typename DerivedResourceT >
-	ResourcePool< KeyT, ResourceT >::Resource< DerivedResourceT >
-		::Resource(Resource&& resource) = default;
+	void ResourcePool< KeyT, ResourceT >
+		::AddMemoryUsage(std::size_t memory_usage) noexcept {
+
+		const auto new_memory_usage
+			= m_memory_usage.fetch_add(memory_usage, std::memory_order_relaxed)
+			+ memory_usage;
+
+		auto peak_memory_usage = m_peak_memory_usage.load(std::memory_order_relaxed);
+		while (peak_memory_usage < new_memory_usage
+			   && !m_peak_memory_usage.compare_exchange_weak(peak_memory_usage,
+															 new_memory_usage,
+															 std::memory_order_relaxed)) {}
+	}
 
+	template< typename KeyT, typename ResourceT >
+	void ResourcePool< KeyT, ResourceT >::UpdateMemoryUsage() noexcept {
+		for (auto& shard : m_shards) {
+			const std::scoped_lock lock(shard.m_mutex);
+
+			for (auto& [key, entry] : shard.m_resource_map) {
+				if (!entry.m_latch.valid()) {
+					UpdateMemoryUsage(entry);
+				}
+			}
+		}
+	}
 
 	template< typename KeyT, typename ResourceT >
-	template< typename DerivedResourceT >
-	ResourcePool< KeyT, ResourceT >::Resource< DerivedResourceT >
-		::~Resource() {
+	void ResourcePool< KeyT, ResourceT >::UpdateMemoryUsage(Entry& entry) noexcept {
+		const auto memory_usage = details::GetMemoryUsage(*entry.m_resource);
+		if (entry.m_memory_usage < memory_usage) {
+			AddMemoryUsage(memory_usage - entry.m_memory_usage);
+		}
+		else {
+			SubtractMemoryUsage(entry.m_memory_usage - memory_usage);
+		}
 
-		m_resource_pool.Remove(m_resource_key);
+		entry.m_memory_usage = memory_usage;
 	}
 
 	#pragma endregion
@@ -180,6 +445,7 @@ namespace mage {
 		const std::scoped_lock lock(pool.m_mutex);
 
 		m_resource_map = std::move(pool.m_resource_map);
+		m_statistics   = pool.m_statistics;
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -211,7 +477,7 @@ namespace mage {
 		const std::scoped_lock lock(m_mutex);
 
 		const auto it = m_resource_map.find(key);
-		return (it != m_resource_map.end());
+		return (it != m_resource_map.end()) && !it->second.m_latch.valid();
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -221,7 +487,7 @@ namespace mage {
 		const std::scoped_lock lock(m_mutex);
 
 		const auto it = m_resource_map.find(key);
-		return (it != m_resource_map.end()) ? it->second
+		return (it != m_resource_map.end()) ? it->second.m_resource
 			                                : SharedPtr< ResourceT >();
 	}
 
@@ -239,42 +505,130 @@ namespace mage {
 	SharedPtr< ResourceT > PersistentResourcePool< KeyT, ResourceT >
 		::GetOrCreateDerived(const KeyT& key, ConstructorArgsT&&... args) {
 
-		const std::scoped_lock lock(m_mutex);
+		static_assert(std::is_base_of_v< ResourceT, DerivedResourceT >);
+
+		std::promise< SharedPtr< ResourceT > > promise;
+
+		// Insert an in-flight latch for the given key, unless the resource
+		// already exists or is being constructed.
+		{
+			std::unique_lock lock(m_mutex);
+
+			auto& entry = m_resource_map[key];
+
+			if (entry.m_latch.valid()) {
+				++m_statistics.m_nb_hits;
+
+				// Wait for the construction of the resource by another thread.
+				const auto latch = entry.m_latch;
+				lock.unlock();
+				return latch.get();
+			}
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+			if (entry.m_resource) {
+				++m_statistics.m_nb_hits;
+				return entry.m_resource;
+			}
+
+			++m_statistics.m_nb_misses;
+			details::GetResourceLoadCounter().Increment();
+
+			entry.m_latch = promise.get_future().share();
+		}
 
-			return it->second;
+		// Construct the resource without holding the lock.
+		SharedPtr< ResourceT > new_resource;
+		try {
+			new_resource = MakeAllocatedShared< DerivedResourceT >
+				           (std::forward< ConstructorArgsT >(args)...);
 		}
+		catch (...) {
+			{
+				const std::scoped_lock lock(m_mutex);
+				m_resource_map.erase(key);
+			}
+
+			promise.set_exception(std::current_exception());
+			throw;
+		}
+
+		const auto memory_usage = details::GetMemoryUsage(*new_resource);
 
-		const auto new_resource = MakeAllocatedShared< DerivedResourceT >
-			                      (std::forward< ConstructorArgsT >(args)...);
+		// Publish the resource.
+		{
+			const std::scoped_lock lock(m_mutex);
 
-		m_resource_map.emplace(key, new_resource);
+			auto& entry = m_resource_map[key];
+			entry.m_resource     = new_resource;
+			entry.m_latch        = Latch();
+			entry.m_memory_usage = memory_usage;
+
+			++m_statistics.m_nb_resources;
+			m_statistics.m_memory_usage += memory_usage;
+			m_statistics.m_peak_memory_usage
+				= std::max(m_statistics.m_peak_memory_usage,
+						   m_statistics.m_memory_usage);
+		}
+
+		promise.set_value(new_resource);
 
 		return new_resource;
 	}
 
+	template< typename KeyT, typename ResourceT >
+	[[nodiscard]]
+	const ResourcePoolStatistics PersistentResourcePool< KeyT, ResourceT >
+		::GetStatistics() const noexcept {
+
+		const std::scoped_lock lock(m_mutex);
+
+		return m_statistics;
+	}
+
 	template< typename KeyT, typename ResourceT >
 	void PersistentResourcePool< KeyT, ResourceT >
 		::Remove(const KeyT& key) {
 
-		const std::scoped_lock lock(m_mutex);
+		// The resource is destructed after releasing the lock.
+		SharedPtr< ResourceT > resource;
+		{
+			const std::scoped_lock lock(m_mutex);
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+			if (const auto it = m_resource_map.find(key);
+				it != m_resource_map.end() && !it->second.m_latch.valid()) {
 
-			m_resource_map.erase(it);
+				--m_statistics.m_nb_resources;
+				m_statistics.m_memory_usage -= it->second.m_memory_usage;
+				resource = std::move(it->second.m_resource);
+				m_resource_map.erase(it);
+			}
 		}
 	}
 
 	template< typename KeyT, typename ResourceT >
-	inline void PersistentResourcePool< KeyT, ResourceT >
+	void PersistentResourcePool< KeyT, ResourceT >
 		::RemoveAll() noexcept {
 
-		const std::scoped_lock lock(m_mutex);
+		// The resources are destructed after releasing the lock.
+		std::vector< SharedPtr< ResourceT > > resources;
+		{
+			const std::scoped_lock lock(m_mutex);
+
+			// Retain the entries of resources which are being constructed.
+			for (auto it = m_resource_map.begin(); it != m_resource_map.end();) {
+				if (it->second.m_latch.valid()) {
+					++it;
+				}
+				else {
+					resources.push_back(std::move(it->second.m_resource));
+					it = m_resource_map.erase(it);
+				}
+			}
 
-		m_resource_map.clear();
+			// Resources which are being constructed are not accounted for yet.
+			m_statistics.m_nb_resources = 0u;
+			m_statistics.m_memory_usage = 0u;
+		}
 	}
 
 	#pragma endregion
@@ -54,7 +54,7 @@ namespace mage {
 			it->second = std::forward< T >(value);
 		}
 		else {
-			Warning("{}: Variable {} not found.", GetGuid(), name);
+			MAGE_WARNING("{}: Variable {} not found.", GetGuid(), name);
 		}
 	}
 }
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "string\formats.hpp"
+#include "string/formats.hpp"
 
 #pragma endregion
 
@@ -70,6 +70,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "string\format.tpp"
+#include "string/format.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "string\string_utils.hpp"
+#include "string/string_utils.hpp"
 
 #pragma endregion
 
@@ -15,7 +15,7 @@
 #pragma region
 
 #include <filesystem>
-#include <fmt\format.h>
+#include <fmt/format.h>
 
 #pragma endregion
 
@@ -68,7 +68,12 @@ namespace fmt {
 
 		template< typename FormatContextT >
 		auto format(const std::filesystem::path& path, FormatContextT& ctx) {
+			#ifdef _WIN32
 			const mage::UTF16toUTF8 str(path.c_str());
+			#else
+			// Native paths are (UTF-8) narrow strings on POSIX platforms.
+			const std::string_view str(path.native());
+			#endif
 			// An explicit formatting string is provided to avoid clashes with
 			// the string.
 			return format_to(ctx.begin(), "{}", std::string_view(str));
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "string\string_utils.hpp"
+#include "string/string_utils.hpp"
 
 #pragma endregion
 
@@ -14,6 +14,10 @@
 
 #include <limits>
 
+#ifndef _WIN32
+#include <cerrno>
+#endif
+
 #pragma endregion
 
 //-----------------------------------------------------------------------------
@@ -21,7 +25,9 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	DWORD UTF8toUTF16::Convert(std::string_view s) {
+	#ifdef _WIN32
+
+	U32 UTF8toUTF16::Convert(std::string_view s) {
 		if (static_cast< std::size_t >(std::numeric_limits< int >::max()) < s.size()) {
 			return ERROR_INVALID_PARAMETER;
 		}
@@ -49,7 +55,7 @@ namespace mage {
 		return 0u;
 	}
 
-	DWORD UTF16toUTF8::Convert(std::wstring_view s) {
+	U32 UTF16toUTF8::Convert(std::wstring_view s) {
 		if (static_cast< std::size_t >(std::numeric_limits< int >::max()) < s.size()) {
 			return ERROR_INVALID_PARAMETER;
 		}
@@ -76,4 +82,90 @@ namespace mage {
 
 		return 0u;
 	}
+
+	#else
+
+	// wchar_t strings are UTF-32 encoded on POSIX platforms.
+
+	U32 UTF8toUTF16::Convert(std::string_view s) {
+		m_buffer.resize(0u);
+
+		for (std::size_t i = 0u; i < s.size();) {
+			const auto c = static_cast< U8 >(s[i]);
+
+			// Decode the length and leading bits of the code point.
+			std::size_t length = 0u;
+			U32 code_point = 0u;
+			if (0x80u > c) {
+				length = 1u, code_point = c;
+			}
+			else if (0xC0u == (c & 0xE0u)) {
+				length = 2u, code_point = c & 0x1Fu;
+			}
+			else if (0xE0u == (c & 0xF0u)) {
+				length = 3u, code_point = c & 0x0Fu;
+			}
+			else if (0xF0u == (c & 0xF8u)) {
+				length = 4u, code_point = c & 0x07u;
+			}
+			else {
+				return EILSEQ;
+			}
+
+			if (s.size() - i < length) {
+				return EILSEQ;
+			}
+
+			// Decode the continuation bytes of the code point.
+			for (std::size_t j = 1u; j < length; ++j) {
+				const auto cc = static_cast< U8 >(s[i + j]);
+				if (0x80u != (cc & 0xC0u)) {
+					return EILSEQ;
+				}
+				code_point = (code_point << 6u) | (cc & 0x3Fu);
+			}
+
+			m_buffer.push_back(static_cast< wchar_t >(code_point));
+			i += length;
+		}
+
+		m_buffer.push_back(L'\0');
+		return 0u;
+	}
+
+	U32 UTF16toUTF8::Convert(std::wstring_view s) {
+		m_buffer.resize(0u);
+
+		for (const auto wc : s) {
+			const auto code_point = static_cast< U32 >(wc);
+			if (0x80u > code_point) {
+				m_buffer.push_back(static_cast< char >(code_point));
+			}
+			else if (0x800u > code_point) {
+				m_buffer.push_back(static_cast< char >(0xC0u | (code_point >> 6u)));
+				m_buffer.push_back(static_cast< char >(0x80u | (code_point & 0x3Fu)));
+			}
+			else if (0x10000u > code_point) {
+				m_buffer.push_back(static_cast< char >(0xE0u | (code_point >> 12u)));
+				m_buffer.push_back(static_cast< char >(0x80u | ((code_point >> 6u) & 0x3Fu)));
+				m_buffer.push_back(static_cast< char >(0x80u | (code_point & 0x3Fu)));
+			}
+			else if (0x110000u > code_point) {
+				m_buffer.push_back(static_cast< char >(0xF0u | (code_point >> 18u)));
+				m_buffer.push_back(static_cast< char >(0x80u | ((code_point >> 12u) & 0x3Fu)));
+				m_buffer.push_back(static_cast< char >(0x80u | ((code_point >> 6u) & 0x3Fu)));
+				m_buffer.push_back(static_cast< char >(0x80u | (code_point & 0x3Fu)));
+			}
+			else {
+				m_buffer.resize(1u);
+				m_buffer[0] = '\0';
+				return EILSEQ;
+			}
+		}
+
+		m_buffer.push_back('\0');
+		return 0u;
+	}
+
+	#endif
 }
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "memory\memory_buffer.hpp"
+#include "memory/memory_buffer.hpp"
 
 #pragma endregion
 
@@ -121,7 +121,7 @@ namespace mage {
 		// Member Methods
 		//---------------------------------------------------------------------
 
-		DWORD Convert(std::string_view s);
+		U32 Convert(std::string_view s);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -184,7 +184,7 @@ namespace mage {
 		// Member Methods
 		//---------------------------------------------------------------------
 
-		DWORD Convert(std::wstring_view s);
+		U32 Convert(std::wstring_view s);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -276,6 +276,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "string\string_utils.tpp"
+#include "string/string_utils.tpp"
 
 #pragma endregion
\ No newline at end of file
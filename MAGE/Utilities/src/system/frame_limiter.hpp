@@ -0,0 +1,354 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "system/timer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// FrameStatistics
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of frame time statistics.
+	 */
+	struct FrameStatistics {
+
+	public:
+
+		/**
+		 The number of measured frames.
+		 */
+		U64 m_nb_frames = 0u;
+
+		/**
+		 The mean frame time (in milliseconds).
+		 */
+		F64 m_mean_frame_time = 0.0;
+
+		/**
+		 The jitter (i.e. the standard deviation of the frame time) (in
+		 milliseconds).
+		 */
+		F64 m_jitter = 0.0;
+
+		/**
+		 The minimum frame time (in milliseconds).
+		 */
+		F64 m_min_frame_time = 0.0;
+
+		/**
+		 The maximum frame time (in milliseconds).
+		 */
+		F64 m_max_frame_time = 0.0;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// FrameLimiter
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of frame limiters pacing frames at a target frame rate.
+
+	 Frame limiters sleep until shortly before the deadline of the frame and
+	 spin (i.e. poll the clock) for the remainder. The remaining time below
+	 which the frame limiter spins, is estimated from the observed sleep
+	 durations (i.e. the mean plus the standard deviation), and thus adapts
+	 to the sleep granularity of the system.
+
+	 The clock and the sleep function can be injected (e.g., for testing the
+	 pacing deterministically). The clock is polled while sleeping and
+	 spinning, so an injected clock must advance on its own or from within
+	 the sleep function.
+
+	 @tparam		ClockT
+					The clock type.
+	 */
+	template< typename ClockT >
+	class FrameLimiter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The time stamp type representing the time points of frame limiters.
+		 */
+		using TimeStamp = typename ClockT::time_point;
+
+		/**
+		 The time interval type representing the interval between time points
+		 of frame limiters.
+		 */
+		using TimeInterval = typename ClockT::duration;
+
+		/**
+		 The function type for sleeping the calling thread for a given time
+		 interval.
+		 */
+		using SleepFunction = std::function< void(TimeInterval) >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a frame limiter sleeping the calling thread with
+		 @c std::this_thread::sleep_for.
+		 */
+		FrameLimiter();
+
+		/**
+		 Constructs a frame limiter.
+
+		 @param[in]		clock
+						The clock.
+		 @param[in]		sleep
+						The function for sleeping the calling thread.
+		 */
+		explicit FrameLimiter(ClockT clock, SleepFunction sleep);
+
+		/**
+		 Constructs a frame limiter from the given frame limiter.
+
+		 @param[in]		limiter
+						A reference to the frame limiter to copy.
+		 */
+		FrameLimiter(const FrameLimiter& limiter) = default;
+
+		/**
+		 Constructs a frame limiter by moving the given frame limiter.
+
+		 @param[in]		limiter
+						A reference to the frame limiter to move.
+		 */
+		FrameLimiter(FrameLimiter&& limiter) noexcept = default;
+
+		/**
+		 Destructs this frame limiter.
+		 */
+		~FrameLimiter() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given frame limiter to this frame limiter.
+
+		 @param[in]		limiter
+						A reference to the frame limiter to copy.
+		 @return		A reference to the copy of the given frame limiter
+						(i.e. this frame limiter).
+		 */
+		FrameLimiter& operator=(const FrameLimiter& limiter) = default;
+
+		/**
+		 Moves the given frame limiter to this frame limiter.
+
+		 @param[in]		limiter
+						A reference to the frame limiter to move.
+		 @return		A reference to the moved frame limiter (i.e. this
+						frame limiter).
+		 */
+		FrameLimiter& operator=(FrameLimiter&& limiter) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the target frame rate (in frames per second) of this frame
+		 limiter.
+
+		 @return		The target frame rate (in frames per second) of this
+						frame limiter. @c 0 if the frame rate is unlimited.
+		 */
+		[[nodiscard]]
+		F64 GetTargetFrameRate() const noexcept;
+
+		/**
+		 Sets the target frame rate (in frames per second) of this frame
+		 limiter to the given frame rate.
+
+		 @param[in]		frame_rate
+						The target frame rate (in frames per second).
+						@c 0 to not limit the frame rate.
+		 */
+		void SetTargetFrameRate(F64 frame_rate) noexcept;
+
+		/**
+		 Restarts the pacing of this frame limiter. The next frame starts
+		 now (e.g., after a period of inactivity).
+		 */
+		void Restart() noexcept;
+
+		/**
+		 Ends the current frame of this frame limiter. Waits until the
+		 deadline of the current frame (if the frame rate is limited).
+		 */
+		void Wait();
+
+		/**
+		 Returns the frame time statistics of this frame limiter.
+
+		 @return		A reference to the frame time statistics of this frame
+						limiter. The frame times include the waiting times.
+		 */
+		[[nodiscard]]
+		const FrameStatistics& GetStatistics() const noexcept {
+			return m_statistics;
+		}
+
+		/**
+		 Resets the frame time statistics of this frame limiter.
+		 */
+		void ResetStatistics() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Sleeps until the estimated sleep duration exceeds the remaining
+		 time until the given deadline.
+
+		 @param[in]		deadline
+						The deadline.
+		 */
+		void Sleep(TimeStamp deadline);
+
+		/**
+		 Spins until the given deadline.
+
+		 @param[in]		deadline
+						The deadline.
+		 */
+		void Spin(TimeStamp deadline) noexcept;
+
+		/**
+		 Records the given frame time in the frame time statistics of this
+		 frame limiter.
+
+		 @param[in]		frame_time
+						The frame time.
+		 */
+		void RecordFrameTime(TimeInterval frame_time) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The clock of this frame limiter.
+		 */
+		ClockT m_clock;
+
+		/**
+		 The function for sleeping the calling thread of this frame limiter.
+		 */
+		SleepFunction m_sleep;
+
+		/**
+		 The target frame rate (in frames per second) of this frame limiter.
+		 */
+		F64 m_frame_rate;
+
+		/**
+		 The target frame time of this frame limiter.
+		 */
+		TimeInterval m_frame_time;
+
+		/**
+		 The timestamp of the end of the last frame of this frame limiter.
+		 */
+		TimeStamp m_last_timestamp;
+
+		/**
+		 The deadline of the current frame of this frame limiter.
+		 */
+		TimeStamp m_deadline;
+
+		/**
+		 A flag indicating whether this frame limiter has started a frame.
+		 */
+		bool m_started;
+
+		/**
+		 The number of observed sleep durations of this frame limiter.
+		 */
+		U64 m_nb_sleeps;
+
+		/**
+		 The mean of the observed sleep durations (in seconds) of this frame
+		 limiter.
+		 */
+		F64 m_sleep_mean;
+
+		/**
+		 The sum of squared deviations from the mean of the observed sleep
+		 durations (in seconds) of this frame limiter.
+		 */
+		F64 m_sleep_m2;
+
+		/**
+		 The sum of squared deviations from the mean of the frame times (in
+		 milliseconds) of this frame limiter.
+		 */
+		F64 m_frame_time_m2;
+
+		/**
+		 The frame time statistics of this frame limiter.
+		 */
+		FrameStatistics m_statistics;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Type Declarations and Definitions
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of wall clock frame limiters.
+	 */
+	using WallClockFrameLimiter = FrameLimiter< TSCClock >;
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "system/frame_limiter.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,165 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename ClockT >
+	FrameLimiter< ClockT >::FrameLimiter()
+		: FrameLimiter(ClockT(), [](TimeInterval duration) {
+			std::this_thread::sleep_for(duration);
+		}) {}
+
+	template< typename ClockT >
+	FrameLimiter< ClockT >::FrameLimiter(ClockT clock, SleepFunction sleep)
+		: m_clock(std::move(clock)),
+		m_sleep(std::move(sleep)),
+		m_frame_rate(0.0),
+		m_frame_time(TimeInterval::zero()),
+		m_last_timestamp(),
+		m_deadline(),
+		m_started(false),
+		// Conservatively assume a sleep granularity of 5ms until sleep
+		// durations are observed.
+		m_nb_sleeps(1u),
+		m_sleep_mean(0.005),
+		m_sleep_m2(0.0),
+		m_frame_time_m2(0.0),
+		m_statistics() {}
+
+	template< typename ClockT >
+	inline F64 FrameLimiter< ClockT >::GetTargetFrameRate() const noexcept {
+		return m_frame_rate;
+	}
+
+	template< typename ClockT >
+	inline void FrameLimiter< ClockT >
+		::SetTargetFrameRate(F64 frame_rate) noexcept {
+
+		m_frame_rate = std::max(0.0, frame_rate);
+		m_frame_time = (0.0 < m_frame_rate)
+			? std::chrono::duration_cast< TimeInterval >(
+				TimeIntervalSeconds(1.0 / m_frame_rate))
+			: TimeInterval::zero();
+
+		Restart();
+	}
+
+	template< typename ClockT >
+	inline void FrameLimiter< ClockT >::Restart() noexcept {
+		m_last_timestamp = m_clock.now();
+		m_deadline       = m_last_timestamp + m_frame_time;
+		m_started        = true;
+	}
+
+	template< typename ClockT >
+	void FrameLimiter< ClockT >::Wait() {
+		if (!m_started) {
+			Restart();
+		}
+
+		if (TimeInterval::zero() != m_frame_time) {
+			Sleep(m_deadline);
+			Spin(m_deadline);
+		}
+
+		const auto current_timestamp = m_clock.now();
+		RecordFrameTime(current_timestamp - m_last_timestamp);
+		m_last_timestamp = current_timestamp;
+
+		// Advance the deadline by one frame. If the deadline was missed by
+		// more than a frame, resynchronize instead of rendering a burst of
+		// frames to catch up.
+		m_deadline += m_frame_time;
+		if (m_deadline < current_timestamp) {
+			m_deadline = current_timestamp + m_frame_time;
+		}
+	}
+
+	template< typename ClockT >
+	inline void FrameLimiter< ClockT >::ResetStatistics() noexcept {
+		m_frame_time_m2 = 0.0;
+		m_statistics    = {};
+	}
+
+	template< typename ClockT >
+	void FrameLimiter< ClockT >::Sleep(TimeStamp deadline) {
+		using std::chrono::duration_cast;
+		static constexpr auto s_quantum = std::chrono::milliseconds(1);
+
+		while (true) {
+			const auto current_timestamp = m_clock.now();
+			if (deadline <= current_timestamp) {
+				return;
+			}
+
+			// Estimate the (worst-case) duration of a sleep as the mean plus
+			// the standard deviation of the observed sleep durations.
+			const auto remaining
+				= duration_cast< TimeIntervalSeconds >(deadline - current_timestamp);
+			const auto estimate = m_sleep_mean
+				+ std::sqrt(m_sleep_m2 / static_cast< F64 >(m_nb_sleeps));
+			if (remaining.count() <= estimate) {
+				return;
+			}
+
+			m_sleep(duration_cast< TimeInterval >(s_quantum));
+
+			// Update the estimate with the observed sleep duration.
+			const auto observed = duration_cast< TimeIntervalSeconds >(
+				m_clock.now() - current_timestamp).count();
+			++m_nb_sleeps;
+			const auto delta = observed - m_sleep_mean;
+			m_sleep_mean += delta / static_cast< F64 >(m_nb_sleeps);
+			m_sleep_m2   += delta * (observed - m_sleep_mean);
+		}
+	}
+
+	template< typename ClockT >
+	inline void FrameLimiter< ClockT >::Spin(TimeStamp deadline) noexcept {
+		while (m_clock.now() < deadline) {
+			std::this_thread::yield();
+		}
+	}
+
+	template< typename ClockT >
+	void FrameLimiter< ClockT >
+		::RecordFrameTime(TimeInterval frame_time) noexcept {
+
+		using TimeIntervalMilliseconds = std::chrono::duration< F64, std::milli >;
+		const auto time = std::chrono::duration_cast< TimeIntervalMilliseconds >(
+			frame_time).count();
+
+		if (0u == m_statistics.m_nb_frames) {
+			m_statistics.m_min_frame_time = time;
+			m_statistics.m_max_frame_time = time;
+		}
+		else {
+			m_statistics.m_min_frame_time
+				= std::min(m_statistics.m_min_frame_time, time);
+			m_statistics.m_max_frame_time
+				= std::max(m_statistics.m_max_frame_time, time);
+		}
+
+		// Welford's online algorithm for the mean and variance.
+		++m_statistics.m_nb_frames;
+		const auto delta = time - m_statistics.m_mean_frame_time;
+		m_statistics.m_mean_frame_time
+			+= delta / static_cast< F64 >(m_statistics.m_nb_frames);
+		m_frame_time_m2 += delta * (time - m_statistics.m_mean_frame_time);
+		m_statistics.m_jitter = std::sqrt(
+			m_frame_time_m2 / static_cast< F64 >(m_statistics.m_nb_frames));
+	}
+}
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "system\timer.hpp"
+#include "system/timer.hpp"
 
 #pragma endregion
 
@@ -0,0 +1,377 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "system/profiler.hpp"
+#include "system/system_time.hpp"
+#include "io/writer.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <atomic>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The smoothing factor of the moving averages of profile statistics.
+		 */
+		constexpr F64 g_average_smoothing = 0.05;
+
+		/**
+		 The nesting depth of the profile scopes of the calling thread.
+		 */
+		thread_local U32 g_depth = 0u;
+
+		/**
+		 A class of Chrome trace writers for writing profile events.
+		 */
+		class ChromeTraceWriter : private Writer {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			explicit ChromeTraceWriter(const std::vector< ProfileEvent >& events)
+				: Writer(),
+				m_events(events) {}
+
+			ChromeTraceWriter(const ChromeTraceWriter& writer) = delete;
+
+			ChromeTraceWriter(ChromeTraceWriter&& writer) noexcept = default;
+
+			~ChromeTraceWriter() = default;
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			ChromeTraceWriter& operator=(const ChromeTraceWriter& writer) = delete;
+
+			ChromeTraceWriter& operator=(ChromeTraceWriter&& writer) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			using Writer::WriteToFile;
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			virtual void Write() override {
+				WriteStringLine(NotNull< const_zstring >(
+					"{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+
+				// Time stamps are relative to the first captured event.
+				U64 origin = ~U64(0u);
+				for (const auto& event : m_events) {
+					origin = std::min(origin, event.m_begin);
+				}
+
+				char buffer[128];
+				const auto not_null_buffer = NotNull< zstring >(buffer);
+
+				for (std::size_t i = 0u; i < m_events.size(); ++i) {
+					const auto& event = m_events[i];
+
+					WriteString(NotNull< const_zstring >("{\"name\":\""));
+					// Escape the name.
+					for (auto name = event.m_name; '\0' != *name; ++name) {
+						if ('"' == *name || '\\' == *name) {
+							WriteCharacter('\\');
+						}
+						WriteCharacter(*name);
+					}
+
+					// Complete events with microsecond time stamps.
+					WriteTo(buffer,
+							"\",\"cat\":\"mage\",\"ph\":\"X\",\"pid\":0,"
+							"\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}{}",
+							event.m_thread,
+							(event.m_begin - origin) * 0.001,
+							(event.m_end - event.m_begin) * 0.001,
+							(i + 1u != m_events.size()) ? "," : "");
+					WriteStringLine(not_null_buffer);
+				}
+
+				WriteStringLine(NotNull< const_zstring >("]}"));
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			const std::vector< ProfileEvent >& m_events;
+		};
+	}
+
+	//-------------------------------------------------------------------------
+	// Profiler::ThreadBuffer
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	struct Profiler::ThreadBuffer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The capacity (i.e. a power of two) of thread buffers.
+		 */
+		static constexpr std::size_t s_capacity = 1u << 14u;
+
+		/**
+		 The maximum number of profile events which can be collected at once
+		 from thread buffers. The remaining half of the ring buffer provides
+		 a margin for concurrently recorded profile events.
+		 */
+		static constexpr std::size_t s_max_nb_collected_events = s_capacity / 2u;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		explicit ThreadBuffer(U32 thread)
+			: m_events(MakeUnique< ProfileEvent[] >(s_capacity)),
+			m_head(0u),
+			m_tail(0u),
+			m_thread(thread) {}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Pushes the given profile event (only called by the owning thread).
+
+		 @param[in]		event
+						A reference to the profile event.
+		 */
+		void Push(const ProfileEvent& event) noexcept {
+			const auto head = m_head.load(std::memory_order_relaxed);
+			m_events[head & (s_capacity - 1u)] = event;
+			m_head.store(head + 1u, std::memory_order_release);
+		}
+
+		/**
+		 Collects all pushed profile events (only called by the profiler).
+
+		 @param[out]	events
+						A reference to the vector to append the profile
+						events to.
+		 */
+		void Collect(std::vector< ProfileEvent >& events) {
+			const auto head = m_head.load(std::memory_order_acquire);
+			// Drop the oldest profile events, if too many are pushed.
+			m_tail = std::max(m_tail, (head > s_max_nb_collected_events)
+				                      ? head - s_max_nb_collected_events : 0u);
+
+			for (; m_tail < head; ++m_tail) {
+				events.push_back(m_events[m_tail & (s_capacity - 1u)]);
+			}
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The profile events of this thread buffer.
+		 */
+		UniquePtr< ProfileEvent[] > m_events;
+
+		/**
+		 The number of pushed profile events of this thread buffer.
+		 */
+		std::atomic< U64 > m_head;
+
+		/**
+		 The number of collected (or dropped) profile events of this thread
+		 buffer.
+		 */
+		U64 m_tail;
+
+		/**
+		 The thread index of this thread buffer.
+		 */
+		U32 m_thread;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Profiler
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	[[nodiscard]]
+	Profiler& Profiler::Get() noexcept {
+		static Profiler s_profiler;
+		return s_profiler;
+	}
+
+	[[nodiscard]]
+	U64 Profiler::Now() noexcept {
+		return TSCClock::now().time_since_epoch().count();
+	}
+
+	Profiler::Profiler()
+		: m_thread_buffers(),
+		m_frame_events(),
+		m_statistics(),
+		m_statistics_indices(),
+		m_capture_events(),
+		m_capture_path(),
+		m_nb_capture_frames(0u),
+		m_mutex() {}
+
+	Profiler::~Profiler() = default;
+
+	void Profiler::Record(const char* name, U64 begin, U64 end, U32 depth) {
+		auto& buffer = GetThreadBuffer();
+		buffer.Push({ name, begin, end, depth, buffer.m_thread });
+	}
+
+	void Profiler::NextFrame() {
+		m_frame_events.clear();
+
+		{
+			const std::scoped_lock lock(m_mutex);
+
+			for (const auto& buffer : m_thread_buffers) {
+				buffer->Collect(m_frame_events);
+			}
+		}
+
+		// Profile events are recorded on scope exit (i.e. children before
+		// parents). Sort on begin time stamp to register new profile scopes
+		// in hierarchical order.
+		std::sort(m_frame_events.begin(), m_frame_events.end(),
+				  [](const ProfileEvent& lhs, const ProfileEvent& rhs) noexcept {
+					  return lhs.m_begin < rhs.m_begin;
+				  });
+
+		UpdateStatistics(m_frame_events);
+
+		if (!IsCapturing()) {
+			return;
+		}
+
+		m_capture_events.insert(m_capture_events.end(),
+								m_frame_events.cbegin(),
+								m_frame_events.cend());
+
+		if (0u != --m_nb_capture_frames) {
+			return;
+		}
+
+		try {
+			ChromeTraceWriter writer(m_capture_events);
+			writer.WriteToFile(m_capture_path);
+		}
+		catch (const std::exception& e) {
+			MAGE_WARNING("Profile capture export failed: {}", e.what());
+		}
+
+		m_capture_events.clear();
+	}
+
+	void Profiler::Capture(std::filesystem::path path, std::size_t nb_frames) {
+		m_capture_events.clear();
+		m_capture_path      = std::move(path);
+		m_nb_capture_frames = nb_frames;
+	}
+
+	void Profiler::ResetStatistics() noexcept {
+		m_statistics.clear();
+		m_statistics_indices.clear();
+	}
+
+	[[nodiscard]]
+	Profiler::ThreadBuffer& Profiler::GetThreadBuffer() {
+		thread_local ThreadBuffer* t_buffer = nullptr;
+
+		if (!t_buffer) {
+			const std::scoped_lock lock(m_mutex);
+
+			const auto thread = static_cast< U32 >(m_thread_buffers.size());
+			m_thread_buffers.push_back(MakeUnique< ThreadBuffer >(thread));
+			t_buffer = m_thread_buffers.back().get();
+		}
+
+		return *t_buffer;
+	}
+
+	void Profiler::UpdateStatistics(const std::vector< ProfileEvent >& events) {
+		for (auto& statistics : m_statistics) {
+			statistics.m_nb_calls  = 0u;
+			statistics.m_last_time = 0.0;
+		}
+
+		for (const auto& event : events) {
+			const auto [it, inserted]
+				= m_statistics_indices.try_emplace(event.m_name,
+												   m_statistics.size());
+			if (inserted) {
+				ProfileStatistics statistics;
+				statistics.m_name  = event.m_name;
+				statistics.m_depth = event.m_depth;
+				m_statistics.push_back(statistics);
+			}
+
+			auto& statistics = m_statistics[it->second];
+			statistics.m_depth      = std::min(statistics.m_depth, event.m_depth);
+			statistics.m_last_time += (event.m_end - event.m_begin) * 0.000001;
+			++statistics.m_nb_calls;
+		}
+
+		for (auto& statistics : m_statistics) {
+			statistics.m_average_time += g_average_smoothing
+				* (statistics.m_last_time - statistics.m_average_time);
+			statistics.m_max_time = std::max(statistics.m_max_time,
+											 statistics.m_last_time);
+		}
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ProfileScope
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	ProfileScope::ProfileScope(const char* name) noexcept
+		: m_name(name),
+		m_begin(Profiler::Now()),
+		m_depth(g_depth++) {}
+
+	ProfileScope::~ProfileScope() {
+		--g_depth;
+		Profiler::Get().Record(m_name, m_begin, Profiler::Now(), m_depth);
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
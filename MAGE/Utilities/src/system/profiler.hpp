@@ -0,0 +1,476 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory/memory.hpp"
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+// Profiler definition
+// The macro MAGE_PROFILING controls whether profile scopes are active or not.
+// Define MAGE_PROFILING as 0 to compile out all profile scopes.
+#ifndef MAGE_PROFILING
+	#define MAGE_PROFILING 1
+#endif
+
+#define MAGE_PROFILE_CONCATENATE_IMPL(a, b) a##b
+#define MAGE_PROFILE_CONCATENATE(a, b) MAGE_PROFILE_CONCATENATE_IMPL(a, b)
+
+#if MAGE_PROFILING
+	#define MAGE_PROFILE_SCOPE(name) \
+		const mage::ProfileScope MAGE_PROFILE_CONCATENATE(mage_profile_scope_, __LINE__)(name)
+	#define MAGE_PROFILE_FRAME() mage::Profiler::Get().NextFrame()
+#else
+	#define MAGE_PROFILE_SCOPE(name) ((void)0)
+	#define MAGE_PROFILE_FRAME() ((void)0)
+#endif
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// ProfileEvent
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of profile events (i.e. completed profile scopes).
+	 */
+	struct ProfileEvent {
+
+	public:
+
+		/**
+		 A pointer to the (static) name of this profile event.
+		 */
+		const char* m_name = nullptr;
+
+		/**
+		 The begin time stamp (in nanoseconds) of this profile event.
+		 */
+		U64 m_begin = 0u;
+
+		/**
+		 The end time stamp (in nanoseconds) of this profile event.
+		 */
+		U64 m_end = 0u;
+
+		/**
+		 The nesting depth of this profile event.
+		 */
+		U32 m_depth = 0u;
+
+		/**
+		 The thread index of this profile event.
+		 */
+		U32 m_thread = 0u;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ProfileStatistics
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of profile statistics of a single profile scope.
+	 */
+	struct ProfileStatistics {
+
+	public:
+
+		/**
+		 A pointer to the (static) name of the profile scope.
+		 */
+		const char* m_name = nullptr;
+
+		/**
+		 The (smallest) nesting depth of the profile scope.
+		 */
+		U32 m_depth = 0u;
+
+		/**
+		 The number of calls of the profile scope during the last frame.
+		 */
+		U32 m_nb_calls = 0u;
+
+		/**
+		 The total time (in milliseconds) of the profile scope during the last
+		 frame.
+		 */
+		F64 m_last_time = 0.0;
+
+		/**
+		 The moving average of the total time (in milliseconds) per frame of
+		 the profile scope.
+		 */
+		F64 m_average_time = 0.0;
+
+		/**
+		 The maximum total time (in milliseconds) per frame of the profile
+		 scope.
+		 */
+		F64 m_max_time = 0.0;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Profiler
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of (hierarchical CPU) profilers.
+
+	 Profile scopes are recorded in per-thread ring buffers without locking.
+	 Once per frame, the recorded profile events of all threads are collected
+	 into per-scope statistics and, while capturing, into a Chrome trace.
+	 */
+	class Profiler {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the global profiler.
+
+		 @return		A reference to the global profiler.
+		 */
+		[[nodiscard]]
+		static Profiler& Get() noexcept;
+
+		/**
+		 Returns the current time stamp.
+
+		 @return		The current time stamp (in nanoseconds).
+		 */
+		[[nodiscard]]
+		static U64 Now() noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a profiler.
+		 */
+		Profiler();
+
+		/**
+		 Constructs a profiler from the given profiler.
+
+		 @param[in]		profiler
+						A reference to the profiler to copy.
+		 */
+		Profiler(const Profiler& profiler) = delete;
+
+		/**
+		 Constructs a profiler by moving the given profiler.
+
+		 @param[in]		profiler
+						A reference to the profiler to move.
+		 */
+		Profiler(Profiler&& profiler) = delete;
+
+		/**
+		 Destructs this profiler.
+		 */
+		~Profiler();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given profiler to this profiler.
+
+		 @param[in]		profiler
+						A reference to the profiler to copy.
+		 @return		A reference to the copy of the given profiler (i.e.
+						this profiler).
+		 */
+		Profiler& operator=(const Profiler& profiler) = delete;
+
+		/**
+		 Moves the given profiler to this profiler.
+
+		 @param[in]		profiler
+						A reference to the profiler to move.
+		 @return		A reference to the moved profiler (i.e. this
+						profiler).
+		 */
+		Profiler& operator=(Profiler&& profiler) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Records the given profile event for the calling thread.
+
+		 @param[in]		name
+						A pointer to the (static) name of the profile scope.
+		 @param[in]		begin
+						The begin time stamp (in nanoseconds).
+		 @param[in]		end
+						The end time stamp (in nanoseconds).
+		 @param[in]		depth
+						The nesting depth of the profile scope.
+		 */
+		void Record(const char* name, U64 begin, U64 end, U32 depth);
+
+		/**
+		 Ends the current frame of this profiler.
+
+		 The recorded profile events of all threads are collected into the
+		 statistics and, while capturing, into the captured frames. This
+		 method must be called once per frame from a single thread.
+		 */
+		void NextFrame();
+
+		/**
+		 Captures the given number of frames and exports them as a Chrome
+		 trace (i.e. chrome://tracing or Perfetto) to the given file.
+
+		 @param[in]		path
+						The path of the trace file.
+		 @param[in]		nb_frames
+						The number of frames to capture.
+		 */
+		void Capture(std::filesystem::path path, std::size_t nb_frames);
+
+		/**
+		 Checks whether this profiler is capturing frames.
+
+		 @return		@c true if this profiler is capturing frames.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsCapturing() const noexcept {
+			return 0u != m_nb_capture_frames;
+		}
+
+		/**
+		 Returns the statistics of this profiler.
+
+		 @return		A reference to a vector containing the statistics of
+						all profile scopes (in order of first appearance) of
+						this profiler.
+		 */
+		[[nodiscard]]
+		const std::vector< ProfileStatistics >& GetStatistics() const noexcept {
+			return m_statistics;
+		}
+
+		/**
+		 Resets the statistics of this profiler.
+		 */
+		void ResetStatistics() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of per-thread ring buffers of profile events.
+		 */
+		struct ThreadBuffer;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the thread buffer of the calling thread.
+
+		 @return		A reference to the thread buffer of the calling thread.
+		 */
+		[[nodiscard]]
+		ThreadBuffer& GetThreadBuffer();
+
+		/**
+		 Updates the statistics of this profiler with the given profile events
+		 of a single frame.
+
+		 @param[in]		events
+						A reference to a vector containing the profile events.
+		 */
+		void UpdateStatistics(const std::vector< ProfileEvent >& events);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The thread buffers of this profiler.
+		 */
+		std::vector< UniquePtr< ThreadBuffer > > m_thread_buffers;
+
+		/**
+		 The profile events of the current frame of this profiler.
+		 */
+		std::vector< ProfileEvent > m_frame_events;
+
+		/**
+		 The statistics of this profiler.
+		 */
+		std::vector< ProfileStatistics > m_statistics;
+
+		/**
+		 A map containing the indices of the statistics of this profiler.
+		 */
+		std::unordered_map< const char*, std::size_t > m_statistics_indices;
+
+		/**
+		 The captured profile events of this profiler.
+		 */
+		std::vector< ProfileEvent > m_capture_events;
+
+		/**
+		 The path of the trace file of this profiler.
+		 */
+		std::filesystem::path m_capture_path;
+
+		/**
+		 The number of remaining frames to capture of this profiler.
+		 */
+		std::size_t m_nb_capture_frames;
+
+		/**
+		 The mutex for accessing the thread buffers of this profiler.
+		 */
+		mutable std::mutex m_mutex;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ProfileScope
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of profile scopes recording their lifetime with the global
+	 profiler.
+
+	 Use the @c MAGE_PROFILE_SCOPE macro instead of this class directly, so
+	 profile scopes can be compiled out.
+	 */
+	class ProfileScope {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a profile scope.
+
+		 @param[in]		name
+						A pointer to the name of the profile scope. The name
+						must outlive the profiler (e.g., a string literal).
+		 */
+		explicit ProfileScope(const char* name) noexcept;
+
+		/**
+		 Constructs a profile scope from the given profile scope.
+
+		 @param[in]		scope
+						A reference to the profile scope to copy.
+		 */
+		ProfileScope(const ProfileScope& scope) = delete;
+
+		/**
+		 Constructs a profile scope by moving the given profile scope.
+
+		 @param[in]		scope
+						A reference to the profile scope to move.
+		 */
+		ProfileScope(ProfileScope&& scope) = delete;
+
+		/**
+		 Destructs this profile scope.
+		 */
+		~ProfileScope();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given profile scope to this profile scope.
+
+		 @param[in]		scope
+						A reference to the profile scope to copy.
+		 @return		A reference to the copy of the given profile scope
+						(i.e. this profile scope).
+		 */
+		ProfileScope& operator=(const ProfileScope& scope) = delete;
+
+		/**
+		 Moves the given profile scope to this profile scope.
+
+		 @param[in]		scope
+						A reference to the profile scope to move.
+		 @return		A reference to the moved profile scope (i.e. this
+						profile scope).
+		 */
+		ProfileScope& operator=(ProfileScope&& scope) = delete;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the name of this profile scope.
+		 */
+		const char* m_name;
+
+		/**
+		 The begin time stamp (in nanoseconds) of this profile scope.
+		 */
+		U64 m_begin;
+
+		/**
+		 The nesting depth of this profile scope.
+		 */
+		U32 m_depth;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
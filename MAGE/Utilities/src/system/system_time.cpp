@@ -3,8 +3,35 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "parallel\parallel.hpp"
-#include "system\system_time.hpp"
+#include "parallel/parallel.hpp"
+#include "system/system_time.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#ifndef _WIN32
+#include <ctime>
+#include <cwchar>
+#include <sys/resource.h>
+#include <sys/time.h>
+#endif
+
+#if defined(MAGE_X64) || defined(MAGE_X86)
+#ifdef _WIN32
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+#endif
 
 #pragma endregion
 
@@ -18,6 +45,8 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	namespace {
 
+		#ifdef _WIN32
+
 		/**
 		 Converts the given file time to an @c U64 (in 100 ns).
 
@@ -30,6 +59,48 @@ namespace mage {
 			return static_cast< U64 >(ftime.dwLowDateTime)
 				 | static_cast< U64 >(ftime.dwHighDateTime) << 32u;
 		}
+
+		#else
+
+		/**
+		 Converts the given time value to an @c U64 (in 100 ns).
+
+		 @param[in]		time
+						A reference to the time value.
+		 @return		A @c U64 (in 100 ns) representing the given time
+						value.
+		 */
+		[[nodiscard]]
+		inline U64 ConvertTimestamp(const timeval& time) noexcept {
+			return static_cast< U64 >(time.tv_sec)  * 10'000'000u
+				 + static_cast< U64 >(time.tv_usec) * 10u;
+		}
+
+		/**
+		 Formats the current local system date and/or time with the given
+		 format.
+
+		 @param[in]		format
+						A pointer to the @c wcsftime format string.
+		 @return		The formatted current local system date and/or time.
+		 */
+		[[nodiscard]]
+		const std::wstring FormatLocalSystemTime(const wchar_t* format) {
+			const auto time = std::time(nullptr);
+
+			std::tm local_time;
+			if (!localtime_r(&time, &local_time)) {
+				return {};
+			}
+
+			wchar_t str[255];
+			const auto length = std::wcsftime(str, std::size(str), format,
+											  &local_time);
+
+			return std::wstring(str, length);
+		}
+
+		#endif
 	}
 
 	//-------------------------------------------------------------------------
@@ -37,6 +108,8 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
+	#ifdef _WIN32
+
 	namespace {
 
 		/**
@@ -156,8 +229,53 @@ namespace mage {
 		return std::wstring(str_date) + L'-' + std::wstring(str_time);
 	}
 
+	#else
+
+	namespace {
+
+		/**
+		 Returns the current system timestamp (in 100 ns).
+
+		 @return		The current system timestamp (in 100 ns).
+		 */
+		[[nodiscard]]
+		U64 GetSystemTimestamp() noexcept {
+			timespec time;
+			if (0 != clock_gettime(CLOCK_REALTIME, &time)) {
+				return 0u;
+			}
+
+			// Convert to local time.
+			std::tm local_time;
+			if (!localtime_r(&time.tv_sec, &local_time)) {
+				return 0u;
+			}
+
+			return static_cast< U64 >(time.tv_sec + local_time.tm_gmtoff)
+				                                  * 10'000'000u
+				 + static_cast< U64 >(time.tv_nsec) / 100u;
+		}
+	}
+
+	[[nodiscard]]
+	const std::wstring GetLocalSystemDateAsString() {
+		return FormatLocalSystemTime(L"%Y-%m-%d");
+	}
+
+	[[nodiscard]]
+	const std::wstring GetLocalSystemTimeAsString() {
+		return FormatLocalSystemTime(L"%H-%M-%S");
+	}
+
+	[[nodiscard]]
+	const std::wstring GetLocalSystemDateAndTimeAsString() {
+		return FormatLocalSystemTime(L"%Y-%m-%d-%H-%M-%S");
+	}
+
+	#endif
+
 	[[nodiscard]]
-	typename const SystemClock::time_point SystemClock::now() noexcept {
+	const SystemClock::time_point SystemClock::now() noexcept {
 		return time_point(duration(GetSystemTimestamp()));
 	}
 
@@ -186,6 +304,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const std::pair< U64, U64 > GetCoreTimestamps() noexcept {
+			#ifdef _WIN32
 			FILETIME ftime;
 			FILETIME kernel_mode_ftime;
 			FILETIME user_mode_ftime;
@@ -203,6 +322,18 @@ namespace mage {
 				ConvertTimestamp(kernel_mode_ftime),
 				ConvertTimestamp(user_mode_ftime)
 			};
+			#else
+			// Retrieve resource usage information for the process.
+			rusage usage;
+			if (0 != getrusage(RUSAGE_SELF, &usage)) {
+				return {};
+			}
+
+			return {
+				ConvertTimestamp(usage.ru_stime),
+				ConvertTimestamp(usage.ru_utime)
+			};
+			#endif
 		}
 
 		/**
@@ -275,44 +406,276 @@ namespace mage {
 	}
 
 	[[nodiscard]]
-	typename const CoreClock::time_point CoreClock::now() noexcept {
+	const CoreClock::time_point CoreClock::now() noexcept {
 		return time_point(duration(GetCoreTimestamp()));
 	}
 
 	[[nodiscard]]
-	typename const KernelModeCoreClock::time_point
+	const KernelModeCoreClock::time_point
 		KernelModeCoreClock::now() noexcept {
 
 		return time_point(duration(GetKernelModeCoreTimestamp()));
 	}
 
 	[[nodiscard]]
-	typename const UserModeCoreClock::time_point
+	const UserModeCoreClock::time_point
 		UserModeCoreClock::now() noexcept {
 
 		return time_point(duration(GetUserModeCoreTimestamp()));
 	}
 
 	[[nodiscard]]
-	typename const CoreClockPerCore::time_point
+	const CoreClockPerCore::time_point
 		CoreClockPerCore::now() noexcept {
 
 		return time_point(duration(GetCoreTimestampPerCore()));
 	}
 
 	[[nodiscard]]
-	typename const KernelModeCoreClockPerCore::time_point
+	const KernelModeCoreClockPerCore::time_point
 		KernelModeCoreClockPerCore::now() noexcept {
 
 		return time_point(duration(GetKernelModeCoreTimestampPerCore()));
 	}
 
 	[[nodiscard]]
-	typename const UserModeCoreClockPerCore::time_point
+	const UserModeCoreClockPerCore::time_point
 		UserModeCoreClockPerCore::now() noexcept {
 
 		return time_point(duration(GetUserModeCoreTimestampPerCore()));
 	}
 
 	#pragma endregion
-}
+
+	//-------------------------------------------------------------------------
+	// Time Stamp Counter Time
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	namespace {
+
+		/**
+		 The duration of the calibration of the time stamp counter.
+		 */
+		constexpr auto g_tsc_calibration_duration = std::chrono::milliseconds(20);
+
+		/**
+		 A struct of time stamp counter calibrations.
+		 */
+		struct TSCCalibration {
+
+		public:
+
+			/**
+			 The time stamp counter value at the calibration.
+			 */
+			U64 m_base = 0u;
+
+			/**
+			 The steady timestamp (in ns) at the calibration.
+			 */
+			U64 m_steady_base = 0u;
+
+			/**
+			 The frequency (in Hz) of the time stamp counter, or zero if the
+			 time stamp counter is not invariant.
+			 */
+			U64 m_frequency = 0u;
+
+			/**
+			 The number of nanoseconds per tick of the time stamp counter.
+			 */
+			F64 m_nanoseconds_per_tick = 0.0;
+		};
+
+		/**
+		 Checks whether the CPU has an invariant time stamp counter (i.e. a
+		 time stamp counter running at a constant rate in all ACPI P-, C-
+		 and T-states).
+
+		 @return		@c true if the CPU has an invariant time stamp
+						counter. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool HasInvariantTSC() noexcept {
+			#if defined(MAGE_X64) || defined(MAGE_X86)
+			// CPUID.80000007H:EDX[8] indicates an invariant TSC.
+			#ifdef _WIN32
+			int info[4];
+			__cpuid(info, 0x80000000);
+			if (0x80000007u > static_cast< U32 >(info[0])) {
+				return false;
+			}
+
+			__cpuid(info, 0x80000007);
+			return 0u != (static_cast< U32 >(info[3]) & (1u << 8u));
+			#else
+			unsigned int eax = 0u, ebx = 0u, ecx = 0u, edx = 0u;
+			if (0 == __get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx)) {
+				return false;
+			}
+
+			return 0u != (edx & (1u << 8u));
+			#endif
+			#else
+			return false;
+			#endif
+		}
+
+		/**
+		 Reads the time stamp counter.
+
+		 @return		The current value of the time stamp counter.
+		 */
+		[[nodiscard]]
+		inline U64 ReadTSC() noexcept {
+			#if defined(MAGE_X64) || defined(MAGE_X86)
+			return static_cast< U64 >(__rdtsc());
+			#else
+			return 0u;
+			#endif
+		}
+
+		/**
+		 Returns the current steady timestamp (in ns).
+
+		 @return		The current steady timestamp (in ns).
+		 */
+		[[nodiscard]]
+		inline U64 GetSteadyTimestamp() noexcept {
+			using std::chrono::duration_cast;
+			using std::chrono::nanoseconds;
+			using std::chrono::steady_clock;
+
+			return static_cast< U64 >(duration_cast< nanoseconds >(
+				steady_clock::now().time_since_epoch()).count());
+		}
+
+		/**
+		 Calibrates the time stamp counter against the steady clock.
+
+		 @return		The time stamp counter calibration.
+		 */
+		[[nodiscard]]
+		const TSCCalibration CalibrateTSC() noexcept {
+			if (!HasInvariantTSC()) {
+				return {};
+			}
+
+			const auto steady_begin = GetSteadyTimestamp();
+			const auto tsc_begin    = ReadTSC();
+
+			std::this_thread::sleep_for(g_tsc_calibration_duration);
+
+			const auto tsc_end      = ReadTSC();
+			const auto steady_end   = GetSteadyTimestamp();
+
+			if (tsc_end <= tsc_begin || steady_end <= steady_begin) {
+				return {};
+			}
+
+			const auto nb_ticks       = static_cast< F64 >(tsc_end - tsc_begin);
+			const auto nb_nanoseconds = static_cast< F64 >(steady_end - steady_begin);
+
+			TSCCalibration calibration;
+			calibration.m_base        = tsc_begin;
+			calibration.m_steady_base = steady_begin;
+			calibration.m_frequency = static_cast< U64 >(
+				1'000'000'000.0 * nb_ticks / nb_nanoseconds);
+			calibration.m_nanoseconds_per_tick = nb_nanoseconds / nb_ticks;
+			return calibration;
+		}
+
+		/**
+		 The time stamp counter calibration.
+		 */
+		TSCCalibration g_tsc_calibration;
+
+		/**
+		 Flag indicating whether @c g_tsc_calibration is published.
+		 */
+		std::atomic< bool > g_tsc_calibrated = false;
+	}
+
+	void TSCClock::Calibrate() noexcept {
+		if (g_tsc_calibrated.load(std::memory_order_acquire)) {
+			return;
+		}
+
+		const auto calibration = CalibrateTSC();
+		if (0u == calibration.m_frequency) {
+			return;
+		}
+
+		g_tsc_calibration = calibration;
+		g_tsc_calibrated.store(true, std::memory_order_release);
+	}
+
+	[[nodiscard]]
+	const TSCClock::time_point TSCClock::now() noexcept {
+		if (!g_tsc_calibrated.load(std::memory_order_acquire)) {
+			return time_point(duration(GetSteadyTimestamp()));
+		}
+
+		// The time stamp counters of different cores can be slightly out of
+		// sync, so a counter value can precede the base value.
+		const auto nb_ticks = static_cast< S64 >(ReadTSC()
+			                                   - g_tsc_calibration.m_base);
+		const auto offset   = static_cast< S64 >(static_cast< F64 >(nb_ticks)
+			                * g_tsc_calibration.m_nanoseconds_per_tick);
+		const auto base     = static_cast< S64 >(g_tsc_calibration.m_steady_base);
+
+		return time_point(duration(static_cast< U64 >(
+			std::max(base + offset, S64(0)))));
+	}
+
+	[[nodiscard]]
+	bool TSCClock::IsInvariant() noexcept {
+		return g_tsc_calibrated.load(std::memory_order_acquire);
+	}
+
+	[[nodiscard]]
+	U64 TSCClock::GetFrequency() noexcept {
+		return IsInvariant() ? g_tsc_calibration.m_frequency : 0u;
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Thread Core Time
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	[[nodiscard]]
+	const ThreadCoreClock::time_point ThreadCoreClock::now() noexcept {
+		#ifdef _WIN32
+		// The cycle time of threads (QueryThreadCycleTime) is not counted at
+		// the rate of the time stamp counter, so cannot be converted to time.
+		FILETIME ftime;
+		FILETIME kernel_mode_ftime;
+		FILETIME user_mode_ftime;
+		// Retrieve timing information for the thread.
+		const BOOL result = GetThreadTimes(GetCurrentThread(),
+										   &ftime,
+										   &ftime,
+										   &kernel_mode_ftime,
+										   &user_mode_ftime);
+		if (FALSE == result) {
+			return {};
+		}
+
+		return time_point(duration(100u * (ConvertTimestamp(kernel_mode_ftime)
+			                             + ConvertTimestamp(user_mode_ftime))));
+		#else
+		timespec time;
+		if (0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time)) {
+			return {};
+		}
+
+		return time_point(duration(static_cast< U64 >(time.tv_sec) * 1'000'000'000u
+			                     + static_cast< U64 >(time.tv_nsec)));
+		#endif
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
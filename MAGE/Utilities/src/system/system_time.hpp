@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -144,4 +144,82 @@ namespace mage {
 	};
 
 	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Time Stamp Counter Time
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A clock based on the invariant time stamp counter (TSC) of the CPU.
+
+	 The time stamp counter is calibrated once against the steady clock by
+	 @c Calibrate, which must be called at startup. Until then, or if the CPU
+	 has no invariant time stamp counter, the steady clock is used instead.
+	 Time points of both have the same epoch.
+	 */
+	struct TSCClock {
+		using rep        = U64;
+		using period     = std::nano;
+		using duration   = std::chrono::duration< rep, period >;
+		using time_point = std::chrono::time_point< TSCClock >;
+
+		static constexpr bool is_steady = true;
+
+		[[nodiscard]]
+		static const time_point now() noexcept;
+
+		/**
+		 Calibrates the time stamp counter against the steady clock.
+
+		 This blocks the calling thread for about 20 ms and has no effect
+		 after a successful calibration.
+		 */
+		static void Calibrate() noexcept;
+
+		/**
+		 Checks whether this clock uses the invariant time stamp counter.
+
+		 @return		@c true if this clock uses the invariant time stamp
+						counter. @c false otherwise (i.e. this clock uses
+						the steady clock).
+		 */
+		[[nodiscard]]
+		static bool IsInvariant() noexcept;
+
+		/**
+		 Returns the calibrated frequency (in Hz) of the time stamp counter.
+
+		 @return		The calibrated frequency (in Hz) of the time stamp
+						counter, or zero if this clock uses the steady
+						clock.
+		 */
+		[[nodiscard]]
+		static U64 GetFrequency() noexcept;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Thread Core Time
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A clock measuring the core time (i.e. kernel and user mode time) of the
+	 calling thread.
+	 */
+	struct ThreadCoreClock {
+		using rep        = U64;
+		using period     = std::nano;
+		using duration   = std::chrono::duration< rep, period >;
+		using time_point = std::chrono::time_point< ThreadCoreClock >;
+
+		static constexpr bool is_steady = true;
+
+		[[nodiscard]]
+		static const time_point now() noexcept;
+	};
+
+	#pragma endregion
 }
\ No newline at end of file
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "system\system_usage.hpp"
+#include "system/system_usage.hpp"
 
 #pragma endregion
 
@@ -12,7 +12,13 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#ifdef _WIN32
 #include <psapi.h>
+#else
+#include <cstdio>
+#include <utility>
+#include <unistd.h>
+#endif
 
 #pragma endregion
 
@@ -21,6 +27,8 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	#ifdef _WIN32
+
 	[[nodiscard]]
 	U64 GetVirtualMemoryUsage() noexcept {
 		PROCESS_MEMORY_COUNTERS memory_stats = {};
@@ -42,4 +50,56 @@ namespace mage {
 		return (FALSE == result) ? 0u
 			                     : static_cast< U64 >(memory_stats.WorkingSetSize);
 	}
+
+	#else
+
+	namespace {
+
+		/**
+		 Retrieves the virtual and resident memory size (in bytes) of the
+		 running process.
+
+		 @return		If the retrieval fails, both the virtual and resident
+						memory size are zero.
+		 @return		If the retrieval succeeds, a pair containing the
+						virtual and resident memory size (in bytes) of the
+						running process.
+		 */
+		[[nodiscard]]
+		const std::pair< U64, U64 > GetMemoryUsage() noexcept {
+			// /proc/self/statm contains the sizes in pages.
+			const auto file = std::fopen("/proc/self/statm", "r");
+			if (!file) {
+				return {};
+			}
+
+			unsigned long long nb_virtual_pages  = 0u;
+			unsigned long long nb_resident_pages = 0u;
+			const int result = std::fscanf(file, "%llu %llu",
+										   &nb_virtual_pages,
+										   &nb_resident_pages);
+			std::fclose(file);
+			if (2 != result) {
+				return {};
+			}
+
+			const auto page_size = static_cast< U64 >(sysconf(_SC_PAGESIZE));
+			return {
+				static_cast< U64 >(nb_virtual_pages)  * page_size,
+				static_cast< U64 >(nb_resident_pages) * page_size
+			};
+		}
+	}
+
+	[[nodiscard]]
+	U64 GetVirtualMemoryUsage() noexcept {
+		return GetMemoryUsage().first;
+	}
+
+	[[nodiscard]]
+	U64 GetPhysicalMemoryUsage() noexcept {
+		return GetMemoryUsage().second;
+	}
+
+	#endif
 }
\ No newline at end of file
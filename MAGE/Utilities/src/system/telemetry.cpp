@@ -0,0 +1,553 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "system/telemetry.hpp"
+#include "io/writer.hpp"
+#include "string/format.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The next shard index of telemetry metrics to assign to a thread.
+		 */
+		std::atomic< std::size_t > g_next_shard_index = 0u;
+
+		/**
+		 Returns the bucket index of the given value for telemetry
+		 histograms (i.e. the number of significant bits of the given value).
+
+		 @param[in]		value
+						The value.
+		 @return		The bucket index of the given value.
+		 */
+		[[nodiscard]]
+		inline std::size_t GetBucketIndex(U64 value) noexcept {
+			std::size_t index = 0u;
+			for (U32 shift = 32u; 0u != shift; shift >>= 1u) {
+				if (value >> shift) {
+					value >>= shift;
+					index  += shift;
+				}
+			}
+
+			return index + static_cast< std::size_t >(value);
+		}
+
+		/**
+		 Returns the (inclusive) upper bound of the bucket with the given
+		 index of telemetry histograms (i.e. the largest value of the bucket).
+
+		 @param[in]		index
+						The bucket index.
+		 @return		The upper bound of the bucket with the given index.
+		 */
+		[[nodiscard]]
+		inline F64 GetBucketUpperBound(std::size_t index) noexcept {
+			// Bucket i > 0 contains the values in [2^(i-1), 2^i - 1].
+			return (0u == index)
+				? 0.0 : std::ldexp(1.0, static_cast< int >(index)) - 1.0;
+		}
+
+		/**
+		 Returns the upper bound of the bucket containing the given
+		 percentile of the given bucket counts.
+
+		 @param[in]		counts
+						A reference to the bucket counts.
+		 @param[in]		nb_values
+						The total number of values of the bucket counts.
+		 @param[in]		percentile
+						The percentile (in [0,1]).
+		 @return		The upper bound of the bucket containing the given
+						percentile.
+		 */
+		[[nodiscard]]
+		F64 GetPercentile(
+			const std::array< U64, TelemetryHistogram::s_nb_buckets >& counts,
+			U64 nb_values, F64 percentile) noexcept {
+
+			const auto rank = static_cast< U64 >(std::ceil(percentile * nb_values));
+
+			U64 nb_preceding_values = 0u;
+			for (std::size_t i = 0u; i < counts.size(); ++i) {
+				nb_preceding_values += counts[i];
+				if (rank <= nb_preceding_values) {
+					return GetBucketUpperBound(i);
+				}
+			}
+
+			return GetBucketUpperBound(counts.size() - 1u);
+		}
+
+		/**
+		 Returns the name of the given telemetry metric type.
+
+		 @param[in]		type
+						The telemetry metric type.
+		 @return		A pointer to the name of the given telemetry metric
+						type.
+		 */
+		[[nodiscard]]
+		constexpr const char* ToString(TelemetryType type) noexcept {
+			switch (type) {
+
+			case TelemetryType::Counter:
+				return "counter";
+			case TelemetryType::Gauge:
+				return "gauge";
+			case TelemetryType::Histogram:
+				return "histogram";
+			default:
+				return "unknown";
+			}
+		}
+
+		/**
+		 A class of CSV writers for writing telemetry samples.
+		 */
+		class TelemetryCSVWriter : private Writer {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			explicit TelemetryCSVWriter(const std::vector< TelemetrySample >& samples)
+				: Writer(),
+				m_samples(samples) {}
+
+			TelemetryCSVWriter(const TelemetryCSVWriter& writer) = delete;
+
+			TelemetryCSVWriter(TelemetryCSVWriter&& writer) noexcept = default;
+
+			~TelemetryCSVWriter() = default;
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			TelemetryCSVWriter& operator=(const TelemetryCSVWriter& writer) = delete;
+
+			TelemetryCSVWriter& operator=(TelemetryCSVWriter&& writer) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			using Writer::WriteToFile;
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			virtual void Write() override {
+				WriteStringLine(NotNull< const_zstring >(
+					"name,type,value,total,mean,p50,p95,p99"));
+
+				char buffer[256];
+				const auto not_null_buffer = NotNull< zstring >(buffer);
+
+				for (const auto& sample : m_samples) {
+					WriteCharacter('"');
+					// Escape the name.
+					for (auto name = sample.m_name; '\0' != *name; ++name) {
+						if ('"' == *name) {
+							WriteCharacter('"');
+						}
+						WriteCharacter(*name);
+					}
+
+					WriteTo(buffer, "\",{},{},{},{},{},{},{}",
+							ToString(sample.m_type),
+							sample.m_value,
+							sample.m_total,
+							sample.m_mean,
+							sample.m_percentiles[0],
+							sample.m_percentiles[1],
+							sample.m_percentiles[2]);
+					WriteStringLine(not_null_buffer);
+				}
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			const std::vector< TelemetrySample >& m_samples;
+		};
+
+		/**
+		 Writes the given value to the given buffer as a JSON number. JSON
+		 has no representation for infinities and NaNs, which are written as
+		 @c null instead.
+
+		 @tparam		N
+						The size of the buffer.
+		 @param[out]	buffer
+						A reference to the buffer.
+		 @param[in]		value
+						The value.
+		 */
+		template< std::size_t N >
+		void WriteJSONNumber(char (&buffer)[N], F64 value) {
+			if (std::isfinite(value)) {
+				WriteTo(buffer, "{}", value);
+			}
+			else {
+				WriteTo(buffer, "null");
+			}
+		}
+
+		/**
+		 A class of JSON writers for writing telemetry samples.
+		 */
+		class TelemetryJSONWriter : private Writer {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			explicit TelemetryJSONWriter(const std::vector< TelemetrySample >& samples)
+				: Writer(),
+				m_samples(samples) {}
+
+			TelemetryJSONWriter(const TelemetryJSONWriter& writer) = delete;
+
+			TelemetryJSONWriter(TelemetryJSONWriter&& writer) noexcept = default;
+
+			~TelemetryJSONWriter() = default;
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			TelemetryJSONWriter& operator=(const TelemetryJSONWriter& writer) = delete;
+
+			TelemetryJSONWriter& operator=(TelemetryJSONWriter&& writer) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			using Writer::WriteToFile;
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			virtual void Write() override {
+				WriteStringLine(NotNull< const_zstring >("{\"metrics\":["));
+
+				char buffer[256];
+				const auto not_null_buffer = NotNull< zstring >(buffer);
+
+				for (std::size_t i = 0u; i < m_samples.size(); ++i) {
+					const auto& sample = m_samples[i];
+
+					WriteString(NotNull< const_zstring >("{\"name\":\""));
+					// Escape the name.
+					for (auto name = sample.m_name; '\0' != *name; ++name) {
+						if ('"' == *name || '\\' == *name) {
+							WriteCharacter('\\');
+						}
+						WriteCharacter(*name);
+					}
+
+					WriteTo(buffer, "\",\"type\":\"{}\"", ToString(sample.m_type));
+					WriteString(not_null_buffer);
+
+					WriteNumber("value", sample.m_value);
+					WriteNumber("total", sample.m_total);
+
+					if (TelemetryType::Histogram == sample.m_type) {
+						WriteNumber("mean", sample.m_mean);
+						WriteNumber("p50",  sample.m_percentiles[0]);
+						WriteNumber("p95",  sample.m_percentiles[1]);
+						WriteNumber("p99",  sample.m_percentiles[2]);
+					}
+
+					WriteStringLine(NotNull< const_zstring >(
+						(i + 1u != m_samples.size()) ? "}," : "}"));
+				}
+
+				WriteStringLine(NotNull< const_zstring >("]}"));
+			}
+
+			/**
+			 Writes the member with the given key and number.
+			 */
+			void WriteNumber(const char* key, F64 value) {
+				char buffer[64];
+				WriteTo(buffer, ",\"{}\":", key);
+				WriteString(NotNull< const_zstring >(buffer));
+				WriteJSONNumber(buffer, value);
+				WriteString(NotNull< const_zstring >(buffer));
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			const std::vector< TelemetrySample >& m_samples;
+		};
+	}
+
+	namespace details {
+
+		[[nodiscard]]
+		std::size_t GetTelemetryShardIndex() noexcept {
+			thread_local const std::size_t t_index
+				= g_next_shard_index.fetch_add(1u, std::memory_order_relaxed)
+				  % g_nb_telemetry_shards;
+			return t_index;
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// TelemetryCounter
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	TelemetryCounter::TelemetryCounter(std::string name)
+		: m_shards(),
+		m_name(std::move(name)) {}
+
+	TelemetryCounter::~TelemetryCounter() = default;
+
+	[[nodiscard]]
+	U64 TelemetryCounter::GetTotal() const noexcept {
+		U64 total = 0u;
+		for (const auto& shard : m_shards) {
+			total += shard.m_value.load(std::memory_order_relaxed);
+		}
+
+		return total;
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// TelemetryGauge
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	TelemetryGauge::TelemetryGauge(std::string name)
+		: m_value(0.0),
+		m_name(std::move(name)) {}
+
+	TelemetryGauge::~TelemetryGauge() = default;
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// TelemetryHistogram
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	TelemetryHistogram::TelemetryHistogram(std::string name)
+		: m_shards(),
+		m_name(std::move(name)) {}
+
+	TelemetryHistogram::~TelemetryHistogram() = default;
+
+	void TelemetryHistogram::Record(U64 value) noexcept {
+		auto& shard = m_shards[details::GetTelemetryShardIndex()];
+		shard.m_counts[GetBucketIndex(value)]
+			.fetch_add(1u, std::memory_order_relaxed);
+		shard.m_sum.fetch_add(value, std::memory_order_relaxed);
+	}
+
+	void TelemetryHistogram::GetTotals(std::array< U64, s_nb_buckets >& counts,
+									   U64& sum) const noexcept {
+		counts.fill(0u);
+		sum = 0u;
+
+		for (const auto& shard : m_shards) {
+			for (std::size_t i = 0u; i < s_nb_buckets; ++i) {
+				counts[i] += shard.m_counts[i].load(std::memory_order_relaxed);
+			}
+			sum += shard.m_sum.load(std::memory_order_relaxed);
+		}
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Telemetry
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	[[nodiscard]]
+	Telemetry& Telemetry::Get() noexcept {
+		static Telemetry s_telemetry;
+		return s_telemetry;
+	}
+
+	Telemetry::Telemetry()
+		: m_counters(),
+		m_counter_totals(),
+		m_gauges(),
+		m_histograms(),
+		m_histogram_totals(),
+		m_histogram_sums(),
+		m_snapshot(),
+		m_mutex() {}
+
+	Telemetry::~Telemetry() = default;
+
+	[[nodiscard]]
+	TelemetryCounter& Telemetry::GetCounter(std::string_view name) {
+		const std::scoped_lock lock(m_mutex);
+
+		for (const auto& counter : m_counters) {
+			if (counter->GetName() == name) {
+				return *counter;
+			}
+		}
+
+		m_counter_totals.push_back(0u);
+		return *m_counters.emplace_back(
+			MakeUnique< TelemetryCounter >(std::string(name)));
+	}
+
+	[[nodiscard]]
+	TelemetryGauge& Telemetry::GetGauge(std::string_view name) {
+		const std::scoped_lock lock(m_mutex);
+
+		for (const auto& gauge : m_gauges) {
+			if (gauge->GetName() == name) {
+				return *gauge;
+			}
+		}
+
+		return *m_gauges.emplace_back(
+			MakeUnique< TelemetryGauge >(std::string(name)));
+	}
+
+	[[nodiscard]]
+	TelemetryHistogram& Telemetry::GetHistogram(std::string_view name) {
+		const std::scoped_lock lock(m_mutex);
+
+		for (const auto& histogram : m_histograms) {
+			if (histogram->GetName() == name) {
+				return *histogram;
+			}
+		}
+
+		m_histogram_totals.emplace_back();
+		m_histogram_totals.back().fill(0u);
+		m_histogram_sums.push_back(0u);
+		return *m_histograms.emplace_back(
+			MakeUnique< TelemetryHistogram >(std::string(name)));
+	}
+
+	void Telemetry::NextFrame() {
+		const std::scoped_lock lock(m_mutex);
+
+		m_snapshot.clear();
+
+		for (std::size_t i = 0u; i < m_counters.size(); ++i) {
+			const auto total = m_counters[i]->GetTotal();
+
+			TelemetrySample sample;
+			sample.m_name  = m_counters[i]->GetName().c_str();
+			sample.m_type  = TelemetryType::Counter;
+			sample.m_value = static_cast< F64 >(total - m_counter_totals[i]);
+			sample.m_total = static_cast< F64 >(total);
+			m_snapshot.push_back(sample);
+
+			m_counter_totals[i] = total;
+		}
+
+		for (const auto& gauge : m_gauges) {
+			TelemetrySample sample;
+			sample.m_name  = gauge->GetName().c_str();
+			sample.m_type  = TelemetryType::Gauge;
+			sample.m_value = gauge->Get();
+			sample.m_total = sample.m_value;
+			m_snapshot.push_back(sample);
+		}
+
+		std::array< U64, TelemetryHistogram::s_nb_buckets > totals;
+		std::array< U64, TelemetryHistogram::s_nb_buckets > counts;
+		for (std::size_t i = 0u; i < m_histograms.size(); ++i) {
+			U64 sum = 0u;
+			m_histograms[i]->GetTotals(totals, sum);
+
+			// The per-frame bucket counts are the differences with the
+			// totals of the previous snapshot.
+			U64 nb_values = 0u, nb_total_values = 0u;
+			for (std::size_t j = 0u; j < counts.size(); ++j) {
+				counts[j]        = totals[j] - m_histogram_totals[i][j];
+				nb_values       += counts[j];
+				nb_total_values += totals[j];
+			}
+
+			TelemetrySample sample;
+			sample.m_name  = m_histograms[i]->GetName().c_str();
+			sample.m_type  = TelemetryType::Histogram;
+			sample.m_value = static_cast< F64 >(nb_values);
+			sample.m_total = static_cast< F64 >(nb_total_values);
+			if (0u != nb_values) {
+				sample.m_mean = static_cast< F64 >(sum - m_histogram_sums[i])
+					          / static_cast< F64 >(nb_values);
+				sample.m_percentiles = {
+					GetPercentile(counts, nb_values, 0.50),
+					GetPercentile(counts, nb_values, 0.95),
+					GetPercentile(counts, nb_values, 0.99)
+				};
+			}
+			m_snapshot.push_back(sample);
+
+			m_histogram_totals[i] = totals;
+			m_histogram_sums[i]   = sum;
+		}
+	}
+
+	[[nodiscard]]
+	std::vector< TelemetrySample > Telemetry::GetSnapshot() const {
+		const std::scoped_lock lock(m_mutex);
+		return m_snapshot;
+	}
+
+	void Telemetry::ExportCSV(const std::filesystem::path& path) const {
+		// Write a copy of the snapshot outside the lock.
+		const auto snapshot = GetSnapshot();
+		TelemetryCSVWriter writer(snapshot);
+		writer.WriteToFile(path);
+	}
+
+	void Telemetry::ExportJSON(const std::filesystem::path& path) const {
+		// Write a copy of the snapshot outside the lock.
+		const auto snapshot = GetSnapshot();
+		TelemetryJSONWriter writer(snapshot);
+		writer.WriteToFile(path);
+	}
+
+	#pragma endregion
+}
\ No newline at end of file
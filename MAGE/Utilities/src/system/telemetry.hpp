@@ -0,0 +1,748 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory/memory.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace details {
+
+		/**
+		 The number of shards of telemetry metrics.
+		 */
+		constexpr std::size_t g_nb_telemetry_shards = 8u;
+
+		/**
+		 Returns the shard index of the calling thread for telemetry metrics.
+
+		 @return		The shard index of the calling thread for telemetry
+						metrics.
+		 */
+		[[nodiscard]]
+		std::size_t GetTelemetryShardIndex() noexcept;
+	}
+
+	//-------------------------------------------------------------------------
+	// TelemetryCounter
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of telemetry counters.
+
+	 Telemetry counters are monotonically increasing. Each thread increments
+	 its own shard of the counter to avoid contention.
+	 */
+	class TelemetryCounter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a telemetry counter.
+
+		 @param[in]		name
+						The name.
+		 */
+		explicit TelemetryCounter(std::string name);
+
+		/**
+		 Constructs a telemetry counter from the given telemetry counter.
+
+		 @param[in]		counter
+						A reference to the telemetry counter to copy.
+		 */
+		TelemetryCounter(const TelemetryCounter& counter) = delete;
+
+		/**
+		 Constructs a telemetry counter by moving the given telemetry counter.
+
+		 @param[in]		counter
+						A reference to the telemetry counter to move.
+		 */
+		TelemetryCounter(TelemetryCounter&& counter) = delete;
+
+		/**
+		 Destructs this telemetry counter.
+		 */
+		~TelemetryCounter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given telemetry counter to this telemetry counter.
+
+		 @param[in]		counter
+						A reference to the telemetry counter to copy.
+		 @return		A reference to the copy of the given telemetry counter
+						(i.e. this telemetry counter).
+		 */
+		TelemetryCounter& operator=(const TelemetryCounter& counter) = delete;
+
+		/**
+		 Moves the given telemetry counter to this telemetry counter.
+
+		 @param[in]		counter
+						A reference to the telemetry counter to move.
+		 @return		A reference to the moved telemetry counter (i.e. this
+						telemetry counter).
+		 */
+		TelemetryCounter& operator=(TelemetryCounter&& counter) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the name of this telemetry counter.
+
+		 @return		A reference to the name of this telemetry counter.
+		 */
+		[[nodiscard]]
+		const std::string& GetName() const noexcept {
+			return m_name;
+		}
+
+		/**
+		 Increments this telemetry counter with the given value.
+
+		 @param[in]		value
+						The value.
+		 */
+		void Increment(U64 value = 1u) noexcept {
+			m_shards[details::GetTelemetryShardIndex()].m_value
+				.fetch_add(value, std::memory_order_relaxed);
+		}
+
+		/**
+		 Returns the total value of this telemetry counter.
+
+		 @return		The total value of this telemetry counter.
+		 */
+		[[nodiscard]]
+		U64 GetTotal() const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of shards of telemetry counters. Each shard occupies its
+		 own cache line.
+		 */
+		struct alignas(64) Shard {
+
+		public:
+
+			std::atomic< U64 > m_value = 0u;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The shards of this telemetry counter.
+		 */
+		std::array< Shard, details::g_nb_telemetry_shards > m_shards;
+
+		/**
+		 The name of this telemetry counter.
+		 */
+		std::string m_name;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// TelemetryGauge
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of telemetry gauges.
+
+	 Telemetry gauges hold the last value set.
+	 */
+	class TelemetryGauge {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a telemetry gauge.
+
+		 @param[in]		name
+						The name.
+		 */
+		explicit TelemetryGauge(std::string name);
+
+		/**
+		 Constructs a telemetry gauge from the given telemetry gauge.
+
+		 @param[in]		gauge
+						A reference to the telemetry gauge to copy.
+		 */
+		TelemetryGauge(const TelemetryGauge& gauge) = delete;
+
+		/**
+		 Constructs a telemetry gauge by moving the given telemetry gauge.
+
+		 @param[in]		gauge
+						A reference to the telemetry gauge to move.
+		 */
+		TelemetryGauge(TelemetryGauge&& gauge) = delete;
+
+		/**
+		 Destructs this telemetry gauge.
+		 */
+		~TelemetryGauge();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given telemetry gauge to this telemetry gauge.
+
+		 @param[in]		gauge
+						A reference to the telemetry gauge to copy.
+		 @return		A reference to the copy of the given telemetry gauge
+						(i.e. this telemetry gauge).
+		 */
+		TelemetryGauge& operator=(const TelemetryGauge& gauge) = delete;
+
+		/**
+		 Moves the given telemetry gauge to this telemetry gauge.
+
+		 @param[in]		gauge
+						A reference to the telemetry gauge to move.
+		 @return		A reference to the moved telemetry gauge (i.e. this
+						telemetry gauge).
+		 */
+		TelemetryGauge& operator=(TelemetryGauge&& gauge) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the name of this telemetry gauge.
+
+		 @return		A reference to the name of this telemetry gauge.
+		 */
+		[[nodiscard]]
+		const std::string& GetName() const noexcept {
+			return m_name;
+		}
+
+		/**
+		 Sets the value of this telemetry gauge to the given value.
+
+		 @param[in]		value
+						The value.
+		 */
+		void Set(F64 value) noexcept {
+			m_value.store(value, std::memory_order_relaxed);
+		}
+
+		/**
+		 Returns the value of this telemetry gauge.
+
+		 @return		The value of this telemetry gauge.
+		 */
+		[[nodiscard]]
+		F64 Get() const noexcept {
+			return m_value.load(std::memory_order_relaxed);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The value of this telemetry gauge.
+		 */
+		std::atomic< F64 > m_value;
+
+		/**
+		 The name of this telemetry gauge.
+		 */
+		std::string m_name;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// TelemetryHistogram
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of telemetry histograms.
+
+	 Telemetry histograms count the recorded values in power-of-two buckets:
+	 bucket 0 contains the value 0 and bucket i > 0 contains the values in
+	 [2^(i-1), 2^i - 1]. Each thread records in its own shard of the histogram
+	 to avoid contention.
+	 */
+	class TelemetryHistogram {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of buckets of telemetry histograms.
+		 */
+		static constexpr std::size_t s_nb_buckets = 65u;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a telemetry histogram.
+
+		 @param[in]		name
+						The name.
+		 */
+		explicit TelemetryHistogram(std::string name);
+
+		/**
+		 Constructs a telemetry histogram from the given telemetry histogram.
+
+		 @param[in]		histogram
+						A reference to the telemetry histogram to copy.
+		 */
+		TelemetryHistogram(const TelemetryHistogram& histogram) = delete;
+
+		/**
+		 Constructs a telemetry histogram by moving the given telemetry
+		 histogram.
+
+		 @param[in]		histogram
+						A reference to the telemetry histogram to move.
+		 */
+		TelemetryHistogram(TelemetryHistogram&& histogram) = delete;
+
+		/**
+		 Destructs this telemetry histogram.
+		 */
+		~TelemetryHistogram();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given telemetry histogram to this telemetry histogram.
+
+		 @param[in]		histogram
+						A reference to the telemetry histogram to copy.
+		 @return		A reference to the copy of the given telemetry
+						histogram (i.e. this telemetry histogram).
+		 */
+		TelemetryHistogram& operator=(const TelemetryHistogram& histogram) = delete;
+
+		/**
+		 Moves the given telemetry histogram to this telemetry histogram.
+
+		 @param[in]		histogram
+						A reference to the telemetry histogram to move.
+		 @return		A reference to the moved telemetry histogram (i.e.
+						this telemetry histogram).
+		 */
+		TelemetryHistogram& operator=(TelemetryHistogram&& histogram) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the name of this telemetry histogram.
+
+		 @return		A reference to the name of this telemetry histogram.
+		 */
+		[[nodiscard]]
+		const std::string& GetName() const noexcept {
+			return m_name;
+		}
+
+		/**
+		 Records the given value in this telemetry histogram.
+
+		 @param[in]		value
+						The value.
+		 */
+		void Record(U64 value) noexcept;
+
+		/**
+		 Returns the total bucket counts of this telemetry histogram.
+
+		 @param[out]	counts
+						A reference to the total bucket counts.
+		 @param[out]	sum
+						A reference to the total sum of the recorded values.
+		 */
+		void GetTotals(std::array< U64, s_nb_buckets >& counts,
+					   U64& sum) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of shards of telemetry histograms. Each shard starts at its
+		 own cache line.
+		 */
+		struct alignas(64) Shard {
+
+		public:
+
+			std::array< std::atomic< U64 >, s_nb_buckets > m_counts = {};
+
+			std::atomic< U64 > m_sum = 0u;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The shards of this telemetry histogram.
+		 */
+		std::array< Shard, details::g_nb_telemetry_shards > m_shards;
+
+		/**
+		 The name of this telemetry histogram.
+		 */
+		std::string m_name;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// TelemetrySample
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 An enumeration of the different telemetry metric types.
+
+	 This contains:
+	 @c Counter,
+	 @c Gauge and
+	 @c Histogram.
+	 */
+	enum class TelemetryType : U8 {
+		Counter = 0,
+		Gauge,
+		Histogram
+	};
+
+	/**
+	 A struct of telemetry samples containing the per-frame value of a
+	 telemetry metric.
+	 */
+	struct TelemetrySample {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the name of the telemetry metric of this telemetry
+		 sample.
+		 */
+		const char* m_name = nullptr;
+
+		/**
+		 The type of the telemetry metric of this telemetry sample.
+		 */
+		TelemetryType m_type = TelemetryType::Counter;
+
+		/**
+		 The value of this telemetry sample: the increment of the frame for
+		 counters, the value for gauges and the number of recorded values of
+		 the frame for histograms.
+		 */
+		F64 m_value = 0.0;
+
+		/**
+		 The total value of this telemetry sample for counters and the total
+		 number of recorded values for histograms.
+		 */
+		F64 m_total = 0.0;
+
+		/**
+		 The mean of the recorded values of the frame of this telemetry
+		 sample for histograms.
+		 */
+		F64 m_mean = 0.0;
+
+		/**
+		 The (inclusive) upper bounds (i.e. the largest values) of the
+		 buckets containing the 50th, 95th and 99th percentile of the
+		 recorded values of the frame of this telemetry sample for
+		 histograms.
+		 */
+		std::array< F64, 3u > m_percentiles = {};
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Telemetry
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of telemetry registries of named counters, gauges and
+	 histograms.
+
+	 Metrics are registered on first use and never unregistered, so the
+	 returned references can be cached at the call sites. Once per frame, a
+	 snapshot of all metrics is taken.
+	 */
+	class Telemetry {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the global telemetry registry.
+
+		 @return		A reference to the global telemetry registry.
+		 */
+		[[nodiscard]]
+		static Telemetry& Get() noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a telemetry registry.
+		 */
+		Telemetry();
+
+		/**
+		 Constructs a telemetry registry from the given telemetry registry.
+
+		 @param[in]		telemetry
+						A reference to the telemetry registry to copy.
+		 */
+		Telemetry(const Telemetry& telemetry) = delete;
+
+		/**
+		 Constructs a telemetry registry by moving the given telemetry
+		 registry.
+
+		 @param[in]		telemetry
+						A reference to the telemetry registry to move.
+		 */
+		Telemetry(Telemetry&& telemetry) = delete;
+
+		/**
+		 Destructs this telemetry registry.
+		 */
+		~Telemetry();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given telemetry registry to this telemetry registry.
+
+		 @param[in]		telemetry
+						A reference to the telemetry registry to copy.
+		 @return		A reference to the copy of the given telemetry
+						registry (i.e. this telemetry registry).
+		 */
+		Telemetry& operator=(const Telemetry& telemetry) = delete;
+
+		/**
+		 Moves the given telemetry registry to this telemetry registry.
+
+		 @param[in]		telemetry
+						A reference to the telemetry registry to move.
+		 @return		A reference to the moved telemetry registry (i.e. this
+						telemetry registry).
+		 */
+		Telemetry& operator=(Telemetry&& telemetry) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the telemetry counter with the given name. The telemetry
+		 counter is registered if it does not exist yet.
+
+		 @param[in]		name
+						The name.
+		 @return		A reference to the telemetry counter.
+		 */
+		[[nodiscard]]
+		TelemetryCounter& GetCounter(std::string_view name);
+
+		/**
+		 Returns the telemetry gauge with the given name. The telemetry gauge
+		 is registered if it does not exist yet.
+
+		 @param[in]		name
+						The name.
+		 @return		A reference to the telemetry gauge.
+		 */
+		[[nodiscard]]
+		TelemetryGauge& GetGauge(std::string_view name);
+
+		/**
+		 Returns the telemetry histogram with the given name. The telemetry
+		 histogram is registered if it does not exist yet.
+
+		 @param[in]		name
+						The name.
+		 @return		A reference to the telemetry histogram.
+		 */
+		[[nodiscard]]
+		TelemetryHistogram& GetHistogram(std::string_view name);
+
+		/**
+		 Takes the snapshot of the previous frame of this telemetry registry.
+		 */
+		void NextFrame();
+
+		/**
+		 Returns a copy of the snapshot of the previous frame of this
+		 telemetry registry.
+
+		 @return		A vector containing the telemetry samples of the
+						previous frame.
+		 */
+		[[nodiscard]]
+		std::vector< TelemetrySample > GetSnapshot() const;
+
+		/**
+		 Exports the snapshot of this telemetry registry to the given CSV
+		 file.
+
+		 @param[in]		path
+						A reference to the path.
+		 @throws		Exception
+						Failed to export the snapshot.
+		 */
+		void ExportCSV(const std::filesystem::path& path) const;
+
+		/**
+		 Exports the snapshot of this telemetry registry to the given JSON
+		 file.
+
+		 @param[in]		path
+						A reference to the path.
+		 @throws		Exception
+						Failed to export the snapshot.
+		 */
+		void ExportJSON(const std::filesystem::path& path) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The telemetry counters of this telemetry registry.
+		 */
+		std::vector< UniquePtr< TelemetryCounter > > m_counters;
+
+		/**
+		 The totals of the telemetry counters of this telemetry registry at
+		 the previous snapshot.
+		 */
+		std::vector< U64 > m_counter_totals;
+
+		/**
+		 The telemetry gauges of this telemetry registry.
+		 */
+		std::vector< UniquePtr< TelemetryGauge > > m_gauges;
+
+		/**
+		 The telemetry histograms of this telemetry registry.
+		 */
+		std::vector< UniquePtr< TelemetryHistogram > > m_histograms;
+
+		/**
+		 The total bucket counts of the telemetry histograms of this
+		 telemetry registry at the previous snapshot.
+		 */
+		std::vector< std::array< U64, TelemetryHistogram::s_nb_buckets > >
+			m_histogram_totals;
+
+		/**
+		 The total sums of the telemetry histograms of this telemetry
+		 registry at the previous snapshot.
+		 */
+		std::vector< U64 > m_histogram_sums;
+
+		/**
+		 The snapshot of the previous frame of this telemetry registry.
+		 */
+		std::vector< TelemetrySample > m_snapshot;
+
+		/**
+		 The mutex for registering metrics and for accessing the snapshot of
+		 this telemetry registry.
+		 */
+		mutable std::mutex m_mutex;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
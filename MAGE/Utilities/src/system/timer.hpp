@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "system\system_time.hpp"
+#include "system/system_time.hpp"
 
 #pragma endregion
 
@@ -224,13 +224,18 @@ namespace mage {
 	/**
 	 A class of wall clock timers.
 	 */
-	using WallClockTimer = Timer< std::chrono::high_resolution_clock >;
+	using WallClockTimer = Timer< TSCClock >;
 
 	/**
 	 A class of CPU (i.e. core clock per core) timers.
 	 */
 	using CPUTimer = Timer< CoreClockPerCore >;
 
+	/**
+	 A class of thread CPU (i.e. core clock of the calling thread) timers.
+	 */
+	using ThreadCPUTimer = Timer< ThreadCoreClock >;
+
 	#pragma endregion
 }
 
@@ -239,6 +244,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "system\timer.tpp"
+#include "system/timer.tpp"
 
 #pragma endregion
\ No newline at end of file
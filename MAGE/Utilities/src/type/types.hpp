@@ -7,13 +7,13 @@
 
 // Scalar types.
 // Vector types.
-#include "type\vector_types.hpp"
+#include "type/vector_types.hpp"
 
 // Platform types.
 // Smart pointer types.
-#include "memory\memory.hpp"
+#include "memory/memory.hpp"
 
 // String types.
-#include "string\string.hpp"
+#include "string/string.hpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "collection\array.hpp"
-#include "type\scalar_types.hpp"
+#include "collection/array.hpp"
+#include "type/scalar_types.hpp"
 
 #pragma endregion
 
@@ -0,0 +1,321 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel/id_generator.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <type_traits>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// Version
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of versions identifying the state of an object.
+
+	 Versions are globally unique: a new version is drawn on construction and
+	 on each update, and copies share the version of their source. Two
+	 objects with the same version have the same state, as long as each
+	 change of the state updates the version.
+	 */
+	class Version {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a (new) version.
+		 */
+		Version() noexcept
+			: m_value(GetNextGuid()) {}
+
+		/**
+		 Constructs a version from the given version.
+
+		 @param[in]		version
+						A reference to the version to copy.
+		 */
+		Version(const Version& version) noexcept = default;
+
+		/**
+		 Constructs a version by moving the given version.
+
+		 @param[in]		version
+						A reference to the version to move.
+		 */
+		Version(Version&& version) noexcept = default;
+
+		/**
+		 Destructs this version.
+		 */
+		~Version() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given version to this version.
+
+		 @param[in]		version
+						A reference to the version to copy.
+		 @return		A reference to the copy of the given version (i.e.
+						this version).
+		 */
+		Version& operator=(const Version& version) noexcept = default;
+
+		/**
+		 Moves the given version to this version.
+
+		 @param[in]		version
+						A reference to the version to move.
+		 @return		A reference to the moved version (i.e. this version).
+		 */
+		Version& operator=(Version&& version) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Compares this version against the given version for equality.
+
+		 @param[in]		version
+						A reference to the version to compare against.
+		 @return		@c true if this version is equal to the given
+						version. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool operator==(const Version& version) const noexcept {
+			return m_value == version.m_value;
+		}
+
+		/**
+		 Compares this version against the given version for inequality.
+
+		 @param[in]		version
+						A reference to the version to compare against.
+		 @return		@c true if this version is not equal to the given
+						version. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool operator!=(const Version& version) const noexcept {
+			return !(*this == version);
+		}
+
+		/**
+		 Updates this version (i.e. draws a new version).
+		 */
+		void Update() noexcept {
+			m_value = GetNextGuid();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The value of this version.
+		 */
+		U64 m_value;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Versioned
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of versioned values (i.e. values which are only copied when
+	 their versions differ).
+
+	 Copy assignment skips the copy of the value if the assigned versioned
+	 value already holds the version of the given versioned value, which
+	 makes repeated copies of unchanged values (e.g., render snapshots)
+	 cheap. The version is updated on each (non-const) access to the value.
+
+	 @tparam		T
+					The value type.
+	 */
+	template< typename T >
+	class Versioned {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a versioned value.
+
+		 @param[in]		value
+						The value.
+		 */
+		explicit Versioned(T value = T())
+			: m_value(std::move(value)),
+			m_version() {}
+
+		/**
+		 Constructs a versioned value from the given versioned value.
+
+		 @param[in]		versioned
+						A reference to the versioned value to copy.
+		 */
+		Versioned(const Versioned& versioned) = default;
+
+		/**
+		 Constructs a versioned value by moving the given versioned value.
+		 The version of the given versioned value is updated.
+
+		 @param[in]		versioned
+						A reference to the versioned value to move.
+		 */
+		Versioned(Versioned&& versioned)
+			noexcept(std::is_nothrow_move_constructible_v< T >)
+			: m_value(std::move(versioned.m_value)),
+			m_version(versioned.m_version) {
+
+			versioned.m_version.Update();
+		}
+
+		/**
+		 Destructs this versioned value.
+		 */
+		~Versioned() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given versioned value to this versioned value. The value
+		 is only copied if the versions differ.
+
+		 @param[in]		versioned
+						A reference to the versioned value to copy.
+		 @return		A reference to the copy of the given versioned value
+						(i.e. this versioned value).
+		 */
+		Versioned& operator=(const Versioned& versioned) {
+			if (m_version != versioned.m_version) {
+				m_value   = versioned.m_value;
+				m_version = versioned.m_version;
+			}
+
+			return *this;
+		}
+
+		/**
+		 Moves the given versioned value to this versioned value. The version
+		 of the given versioned value is updated.
+
+		 @param[in]		versioned
+						A reference to the versioned value to move.
+		 @return		A reference to the moved versioned value (i.e. this
+						versioned value).
+		 */
+		Versioned& operator=(Versioned&& versioned)
+			noexcept(std::is_nothrow_move_assignable_v< T >) {
+
+			m_value   = std::move(versioned.m_value);
+			m_version = versioned.m_version;
+			versioned.m_version.Update();
+			return *this;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the value of this versioned value.
+
+		 @return		A reference to the value of this versioned value.
+		 */
+		[[nodiscard]]
+		const T& Get() const noexcept {
+			return m_value;
+		}
+
+		/**
+		 Returns the value of this versioned value. The version of this
+		 versioned value is updated.
+
+		 @pre			The returned reference is not used to change the
+						value after this versioned value has been copied.
+		 @return		A reference to the value of this versioned value.
+		 */
+		[[nodiscard]]
+		T& GetMutable() noexcept {
+			m_version.Update();
+			return m_value;
+		}
+
+		/**
+		 Sets the value of this versioned value to the given value. The
+		 version of this versioned value is updated.
+
+		 @param[in]		value
+						The value.
+		 */
+		void Set(T value) {
+			m_value = std::move(value);
+			m_version.Update();
+		}
+
+		/**
+		 Returns the version of this versioned value.
+
+		 @return		A reference to the version of this versioned value.
+		 */
+		[[nodiscard]]
+		const Version& GetVersion() const noexcept {
+			return m_version;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The value of this versioned value.
+		 */
+		T m_value;
+
+		/**
+		 The version of the value of this versioned value.
+		 */
+		Version m_version;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
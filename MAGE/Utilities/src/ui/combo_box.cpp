@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "ui\combo_box.hpp"
+#include "ui/combo_box.hpp"
 
 #pragma endregion
 
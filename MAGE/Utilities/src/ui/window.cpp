@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "exception\exception.hpp"
-#include "platform\windows_utils.hpp"
-#include "ui\window.hpp"
+#include "exception/exception.hpp"
+#include "platform/windows_utils.hpp"
+#include "ui/window.hpp"
 
 #pragma endregion
 
@@ -269,7 +269,7 @@ namespace mage {
 				                               MOD_ALT | MOD_NOREPEAT,
 											   VK_SNAPSHOT);
 			if (FALSE == result) {
-				Warning("Registering Alt+PrintScreen hot key failed.");
+				MAGE_WARNING("Registering Alt+PrintScreen hot key failed.");
 			}
 		}
 		{
@@ -278,7 +278,7 @@ namespace mage {
 											   MOD_NOREPEAT,
 											   VK_SNAPSHOT);
 			if (FALSE == result) {
-				Warning("Registering PrintScreen hot key failed.");
+				MAGE_WARNING("Registering PrintScreen hot key failed.");
 			}
 		}
 	}